@@ -117,7 +117,7 @@
 	#define HALF_TWOS_COMPLEMENT_INT 1
 	#define HALF_POP_WARNINGS 1
 	#pragma warning(push)
-	#pragma warning(disable : 4099 4127 4146)	//struct vs class, constant in if, negative unsigned
+	#pragma warning(disable : 4099 4127 4146 4996)	//struct vs class, constant in if, negative unsigned, getenv
 #endif
 
 // check C++11 library features
@@ -139,6 +139,12 @@
 		#ifndef HALF_ENABLE_CPP11_CFENV
 			#define HALF_ENABLE_CPP11_CFENV 1
 		#endif
+		#ifndef HALF_ENABLE_CPP11_THREAD
+			#define HALF_ENABLE_CPP11_THREAD 1
+		#endif
+		#ifndef HALF_ENABLE_CPP11_ATOMIC
+			#define HALF_ENABLE_CPP11_ATOMIC 1
+		#endif
 	#endif
 #elif defined(__GLIBCXX__)									// libstdc++
 	#if defined(__GXX_EXPERIMENTAL_CXX0X__) || __cplusplus >= 201103
@@ -158,6 +164,12 @@
 			#if __GLIBCXX__ >= 20080606 && !defined(HALF_ENABLE_CPP11_CFENV)
 				#define HALF_ENABLE_CPP11_CFENV 1
 			#endif
+			#if __GLIBCXX__ >= 20120322 && defined(_GLIBCXX_HAS_GTHREADS) && !defined(HALF_ENABLE_CPP11_THREAD)
+				#define HALF_ENABLE_CPP11_THREAD 1
+			#endif
+			#if __GLIBCXX__ >= 20120322 && !defined(HALF_ENABLE_CPP11_ATOMIC)
+				#define HALF_ENABLE_CPP11_ATOMIC 1
+			#endif
 		#else
 			#if HALF_GCC_VERSION >= 403 && !defined(HALF_ENABLE_CPP11_TYPE_TRAITS)
 				#define HALF_ENABLE_CPP11_TYPE_TRAITS 1
@@ -174,6 +186,12 @@
 			#if HALF_GCC_VERSION >= 403 && !defined(HALF_ENABLE_CPP11_CFENV)
 				#define HALF_ENABLE_CPP11_CFENV 1
 			#endif
+			#if HALF_GCC_VERSION >= 407 && defined(_GLIBCXX_HAS_GTHREADS) && !defined(HALF_ENABLE_CPP11_THREAD)
+				#define HALF_ENABLE_CPP11_THREAD 1
+			#endif
+			#if HALF_GCC_VERSION >= 407 && !defined(HALF_ENABLE_CPP11_ATOMIC)
+				#define HALF_ENABLE_CPP11_ATOMIC 1
+			#endif
 		#endif
 	#endif
 #elif defined(_CPPLIB_VER)									// Dinkumware/Visual C++
@@ -192,6 +210,12 @@
 	#if _CPPLIB_VER >= 610 && !defined(HALF_ENABLE_CPP11_CFENV)
 		#define HALF_ENABLE_CPP11_CFENV 1
 	#endif
+	#if _CPPLIB_VER >= 540 && !defined(HALF_ENABLE_CPP11_THREAD)
+		#define HALF_ENABLE_CPP11_THREAD 1
+	#endif
+	#if _CPPLIB_VER >= 540 && !defined(HALF_ENABLE_CPP11_ATOMIC)
+		#define HALF_ENABLE_CPP11_ATOMIC 1
+	#endif
 #endif
 #undef HALF_GCC_VERSION
 #undef HALF_ICC_VERSION
@@ -251,6 +275,7 @@
 #include <cmath>
 #include <cstring>
 #include <cstdlib>
+#include <vector>
 #if HALF_ENABLE_CPP11_TYPE_TRAITS
 	#include <type_traits>
 #endif
@@ -266,6 +291,9 @@
 #if HALF_ENABLE_CPP11_HASH
 	#include <functional>
 #endif
+#if HALF_ENABLE_CPP11_ATOMIC
+	#include <atomic>
+#endif
 
 
 #ifndef HALF_ENABLE_F16C_INTRINSICS
@@ -277,9 +305,192 @@
 	/// Unless predefined it will be enabled automatically when the `__F16C__` symbol is defined, which some compilers do on supporting platforms.
 	#define HALF_ENABLE_F16C_INTRINSICS __F16C__
 #endif
-#if HALF_ENABLE_F16C_INTRINSICS
+
+#ifndef HALF_ENABLE_AVX512_INTRINSICS
+	/// Enable AVX-512 instruction set intrinsics.
+	/// Defining this to 1 enables the use of AVX-512F and AVX-512BW compiler intrinsics for the [batch conversion](\ref batch) 
+	/// functions, processing 16 values at once. This will not perform additional checks for support of these instruction sets, so an 
+	/// appropriate target platform is required when enabling this feature. This is not needed when using 
+	/// [runtime dispatch](\ref HALF_ENABLE_SIMD_DISPATCH).
+	///
+	/// Unless predefined it will be enabled automatically when the `__AVX512F__` and `__AVX512BW__` symbols are defined, which some 
+	/// compilers do on supporting platforms.
+	#define HALF_ENABLE_AVX512_INTRINSICS (__AVX512F__ && __AVX512BW__)
+#endif
+
+#ifndef HALF_ENABLE_SIMD_DISPATCH
+	/// Enable runtime selection of SIMD instruction sets.
+	/// Defining this to 1 compiles the [batch conversion](\ref batch) functions for all supported x86 instruction set extensions 
+	/// (SSE2, AVX2 with F16C and AVX-512) regardless of the target platform and selects the best one supported by the processor 
+	/// at runtime using the `cpuid` instruction, so that a single binary can use newer instruction sets while still running on older 
+	/// processors. The selected instruction set can be overridden with set_simd_level() or with the `HALF_SIMD_LEVEL` environment 
+	/// variable (`scalar`, `sse2`, `avx2` or `avx512`). Conversions of single values are not affected by this and still 
+	/// use [F16C](\ref HALF_ENABLE_F16C_INTRINSICS) only if enabled at compile-time.
+	///
+	/// Unless predefined it will be enabled automatically for x86 platforms when using gcc 4.9, clang 4, VC++ 2012 or newer.
+	#if (defined(__i386__) || defined(__x86_64__)) && !defined(__INTEL_COMPILER) && ((defined(__clang__) && __clang_major__ >= 4) || \
+		(!defined(__clang__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+		#define HALF_ENABLE_SIMD_DISPATCH 1
+	#elif defined(_MSC_VER) && _MSC_VER >= 1700 && (defined(_M_IX86) || defined(_M_X64))
+		#define HALF_ENABLE_SIMD_DISPATCH 1
+	#else
+		#define HALF_ENABLE_SIMD_DISPATCH 0
+	#endif
+#endif
+
+#ifndef HALF_ENABLE_FLOAT_ARITHMETIC
+	/// Enable single-precision hardware for basic arithmetic.
+	/// Defining this to 1 computes addition, subtraction, multiplication, division, square root and fused multiply-add of 
+	/// finite half-precision values in single-precision and rounds the results to half-precision afterwards. Since 
+	/// single-precision has more than twice the precision of half-precision plus 2 bits, this gives exactly the same correctly 
+	/// rounded results and exceptions as the integer implementation for all rounding modes, with the single-precision results 
+	/// being rounded to odd using their exactly reconstructed rounding errors. This requires the built-in floating-point 
+	/// arithmetic to evaluate `float` expressions in single-precision, which excludes x87 floating-point units and fast-math 
+	/// optimizations.
+	///
+	/// The single operations reconstruct their rounding errors in double-precision and thus work with any rounding mode of the 
+	/// built-in arithmetic. The batch arithmetic, packed arithmetic and approximated batch functions rely on the built-in 
+	/// arithmetic rounding to nearest, which they switch to for their duration by changing the MXCSR register on x86 or with 
+	/// `std::fesetround` where [C++11 floating-point environment control](\ref HALF_ENABLE_CPP11_CFENV) is supported. On other 
+	/// platforms the built-in rounding mode must not be changed from the default round to nearest while this is enabled.
+	///
+	/// Multiplication and division are only computed in single-precision if the conversions to half-precision can use 
+	/// [F16C instructions](\ref HALF_ENABLE_F16C_INTRINSICS), since they aren't faster than the integer implementation otherwise.
+	///
+	/// This also enables the single-precision approximations of the exponential, logarithmic, trigonometric and hyperbolic 
+	/// [batch functions](\ref batch_functions).
+	///
+	/// Unless predefined it will be enabled automatically when the compiler is known to evaluate `float` expressions in 
+	/// single-precision without fast-math optimizations. It has no effect if [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE) 
+	/// is defined.
+	#if defined(__FAST_MATH__) || defined(_M_FP_FAST)
+		#define HALF_ENABLE_FLOAT_ARITHMETIC 0
+	#elif defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0
+		#define HALF_ENABLE_FLOAT_ARITHMETIC 1
+	#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM) || defined(_M_ARM64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+		#define HALF_ENABLE_FLOAT_ARITHMETIC 1
+	#else
+		#define HALF_ENABLE_FLOAT_ARITHMETIC 0
+	#endif
+#endif
+
+#ifndef HALF_FLUSH_DENORMALS
+	/// Flush subnormal values to zero.
+	/// Defining this to 1 makes the arithmetic operators and the mathematical functions computing rounded results (from fmod() 
+	/// and fma() over sqrt() and pow() to tgamma()) treat subnormal arguments as zeros of the same sign and return zeros of the same 
+	/// sign instead of subnormal results, raising FE_UNDERFLOW and FE_INEXACT for the latter. This is what hardware does in 
+	/// flush-to-zero and denormals-are-zero modes and saves normalizing subnormal arguments, which many functions would 
+	/// otherwise have to do on every call. The [batch arithmetic](\ref batch_arithmetic) functions, the [packed types](\ref packed) 
+	/// and [array expressions](\ref expressions) give the same results as the single operations in this mode as well.
+	///
+	/// Conversions, comparisons and functions only manipulating bits or exponents (like fabs(), fmin(), copysign(), ldexp(), 
+	/// nextafter() or the rounding functions) are not affected. Conversions to half-precision can flush subnormals with 
+	/// [policy_flush_subnormals](\ref half_float::policy_flush_subnormals) instead.
+	///
+	/// Unless predefined it will be disabled, so that subnormal values are fully supported.
+	#define HALF_FLUSH_DENORMALS	0
+#endif
+
+#ifndef HALF_ENABLE_UNARY_TABLES
+	/// Enable lookup tables for unary functions.
+	/// Defining this to 1 makes exp(), log(), sin(), tanh(), erf(), erfc(), lgamma() and tgamma() look their results up in a
+	/// table of all 65536 half-precision arguments instead of computing them. Each table takes 128 KiB and is built on first
+	/// use of the function with a particular rounding mode, by evaluating the exact implementation for every argument, so that
+	/// the results are identical. Building a table is thread-safe when the compiler guards the initialization of local statics,
+	/// which C++11 requires. The [batch versions](\ref batch_functions) of these functions look up whole arrays, using gather
+	/// instructions with AVX2 or AVX-512.
+	///
+	/// Since tables can't reproduce floating-point exceptions, they are not used when any [exception handling](\ref errors)
+	/// is enabled.
+	///
+	/// Unless predefined it will be disabled, which is preferable when these functions are only called occasionally.
+	#define HALF_ENABLE_UNARY_TABLES	0
+#endif
+
+#ifndef HALF_ENABLE_PARALLEL
+	/// Enable thread pool for parallel batch operations.
+	/// Defining this to 1 lets [parallel execution policies](\ref half_float::parallel_policy) split large 
+	/// [batch conversions](\ref batch) and the tabulation of [unary_table](\ref half_float::unary_table)s among a pool of 
+	/// worker threads, which is started on first use. This requires [C++11 threading support](\ref HALF_ENABLE_CPP11_THREAD) 
+	/// and [thread-local storage](\ref HALF_ENABLE_CPP11_THREAD_LOCAL) and includes `<thread>`, `<mutex>` and 
+	/// `<condition_variable>`, so programs usually have to be linked with the platform's thread library (e.g. `-pthread` for 
+	/// GCC and Clang on POSIX systems).
+	///
+	/// Unless predefined it will be disabled, so that parallel execution policies run everything on the calling thread and 
+	/// the library doesn't depend on threading support.
+	#define HALF_ENABLE_PARALLEL	0
+#endif
+#if HALF_ENABLE_PARALLEL && HALF_ENABLE_CPP11_THREAD && HALF_ENABLE_CPP11_THREAD_LOCAL
+	#include <functional>
+	#include <thread>
+	#include <mutex>
+	#include <condition_variable>
+#endif
+
+#ifndef HALF_STREAMING_THRESHOLD
+	/// Minimum array size for streaming batch conversions.
+	/// [Batch conversions](\ref batch) whose source and destination arrays together take at least this many bytes won't fit into 
+	/// the cache anyway. They are converted in small blocks through a buffer kept in the L1 cache, writing the results to memory 
+	/// with non-temporal stores. This saves reading the destination into the cache before writing it and keeps other data from 
+	/// being evicted. It requires SSE2 and can be changed at runtime with set_streaming_threshold().
+	///
+	/// Unless predefined it will be set to 0, which uses the size of the largest cache as reported by the processor (or 8 MiB if 
+	/// that can't be determined).
+	#define HALF_STREAMING_THRESHOLD	0
+#endif
+
+#if HALF_ENABLE_SIMD_DISPATCH
+	#define HALF_SIMD_SSE2		1
+	#define HALF_SIMD_AVX2		1
+	#define HALF_SIMD_AVX512	1
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define HALF_TARGET_SSE2
+		#define HALF_TARGET_AVX2
+		#define HALF_TARGET_AVX512
+	#else
+		#include <cpuid.h>
+		#define HALF_TARGET_SSE2	__attribute__((target("sse2")))
+		#define HALF_TARGET_AVX2	__attribute__((target("avx2,f16c")))
+		#define HALF_TARGET_AVX512	__attribute__((target("avx512f,avx512bw,avx2,f16c")))
+	#endif
+#else
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define HALF_SIMD_SSE2	1
+	#else
+		#define HALF_SIMD_SSE2	0
+	#endif
+	#if HALF_ENABLE_F16C_INTRINSICS && defined(__AVX2__)
+		#define HALF_SIMD_AVX2	1
+	#else
+		#define HALF_SIMD_AVX2	0
+	#endif
+	#define HALF_SIMD_AVX512	HALF_ENABLE_AVX512_INTRINSICS
+	#define HALF_TARGET_SSE2
+	#define HALF_TARGET_AVX2
+	#define HALF_TARGET_AVX512
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define HALF_PACKED_SSE2	1
+#else
+	#define HALF_PACKED_SSE2	0
+#endif
+#if HALF_PACKED_SSE2 && HALF_ENABLE_F16C_INTRINSICS && defined(__AVX2__)
+	#define HALF_PACKED_AVX2	1
+#else
+	#define HALF_PACKED_AVX2	0
+#endif
+#if HALF_ENABLE_F16C_INTRINSICS || HALF_SIMD_SSE2 || HALF_SIMD_AVX2 || HALF_SIMD_AVX512
 	#include <immintrin.h>
 #endif
+#if defined(_MSC_VER)
+	#include <intrin.h>
+	#define HALF_FORCEINLINE	__forceinline
+#elif defined(__GNUC__)
+	#define HALF_FORCEINLINE	inline __attribute__((always_inline))
+#else
+	#define HALF_FORCEINLINE	inline
+#endif
 
 #ifdef HALF_DOXYGEN_ONLY
 /// Type for internal floating-point computations.
@@ -432,6 +643,21 @@
 namespace half_float
 {
 	class half;
+	template<std::size_t> class packed_half;
+	class unary_table;
+	template<std::float_round_style> half pow(half, half);
+
+	/// Policies for conversions to half-precision.
+	/// These modify the rounded results of [half_cast](\ref half_float::half_cast) and the [batch conversions](\ref batch) to 
+	/// half-precision and can be combined with bitwise or. Any exceptions are still raised according to the rounding of the 
+	/// unmodified result.
+	enum conversion_policy
+	{
+		policy_none = 0,				///< keep results as rounded
+		policy_saturate = 1,			///< replace infinities with the largest finite value of the same sign
+		policy_scrub_nan = 2,			///< replace NaNs with positive zero
+		policy_flush_subnormals = 4		///< replace subnormal values with zero of the same sign
+	};
 
 #if HALF_ENABLE_CPP11_USER_LITERALS
 	/// Library-defined half-precision literals.
@@ -611,6 +837,236 @@ namespace half_float
 		#endif
 		}
 
+		/// \}
+		/// \name Bit primitives
+		/// \{
+
+		/// Count leading zeros.
+		/// This uses the `__builtin_clz` or `_BitScanReverse` compiler intrinsics where available, which compile to a single 
+		/// `bsr` or `lzcnt` instruction on x86.
+		/// \param x non-zero value of at most 32 bits
+		/// \return number of leading zero bits of \a x as a 32-bit integer
+		inline int clz(uint32 x)
+		{
+		#if defined(__GNUC__) && UINT_MAX == 0xFFFFFFFF
+			return __builtin_clz(static_cast<unsigned int>(x));
+		#elif defined(_MSC_VER)
+			unsigned long i;
+			_BitScanReverse(&i, static_cast<unsigned long>(x));
+			return 31 - static_cast<int>(i);
+		#else
+			int n = 0;
+			if(!(x&0xFFFF0000))
+				n += 16, x <<= 16;
+			if(!(x&0xFF000000))
+				n += 8, x <<= 8;
+			if(!(x&0xF0000000))
+				n += 4, x <<= 4;
+			if(!(x&0xC0000000))
+				n += 2, x <<= 2;
+			return n + !(x&0x80000000);
+		#endif
+		}
+
+		/// Count trailing zeros.
+		/// This uses the `__builtin_ctz` or `_BitScanForward` compiler intrinsics where available.
+		/// \param x non-zero value of at most 32 bits
+		/// \return number of trailing zero bits of \a x
+		inline int ctz(uint32 x)
+		{
+		#if defined(__GNUC__) && UINT_MAX == 0xFFFFFFFF
+			return __builtin_ctz(static_cast<unsigned int>(x));
+		#elif defined(_MSC_VER)
+			unsigned long i;
+			_BitScanForward(&i, static_cast<unsigned long>(x));
+			return static_cast<int>(i);
+		#else
+			return 31 - clz(x&(0-x));
+		#endif
+		}
+
+		/// Count set bits.
+		/// This uses the `__builtin_popcount` compiler intrinsic where available.
+		/// \param x value of at most 32 bits
+		/// \return number of set bits of \a x
+		inline int popcount(uint32 x)
+		{
+		#if defined(__GNUC__) && UINT_MAX == 0xFFFFFFFF
+			return __builtin_popcount(static_cast<unsigned int>(x));
+		#else
+			x -= (x>>1) & 0x55555555;
+			x = (x&0x33333333) + ((x>>2)&0x33333333);
+			return static_cast<int>(((((x+(x>>4))&0x0F0F0F0F)*0x01010101)&0xFFFFFFFF) >> 24);
+		#endif
+		}
+
+		/// Normalize integer.
+		/// \tparam B bit to normalize to
+		/// \tparam T integer type
+		/// \param m non-zero value to shift left until it is at least 2^\a B
+		/// \return number of bits shifted
+		template<unsigned int B,typename T> int normalize(T &m)
+		{
+			int n = clz(static_cast<uint32>(m)) + static_cast<int>(B) - 31;
+			n = (n>0) ? n : 0;
+			m <<= n;
+			return n;
+		}
+
+		/// Normalize integer with limited shift.
+		/// \tparam B bit to normalize to
+		/// \tparam T integer type
+		/// \param m value to shift left until it is at least 2^\a B
+		/// \param max maximum number of bits to shift (non-negative)
+		/// \return number of bits shifted
+		template<unsigned int B,typename T> int normalize(T &m, int max)
+		{
+			if(!m)
+				return max;
+			int n = clz(static_cast<uint32>(m)) + static_cast<int>(B) - 31;
+			n = (n<0) ? 0 : (n>max) ? max : n;
+			m <<= n;
+			return n;
+		}
+
+		/// Upper part of 64-bit multiplication.
+		/// \tparam R rounding mode to use
+		/// \param x first factor
+		/// \param y second factor
+		/// \return upper 32 bit of \a x * \a y
+		template<std::float_round_style R> uint32 mulhi(uint32 x, uint32 y)
+		{
+		#if HALF_ENABLE_CPP11_LONG_LONG
+			unsigned long long xy = static_cast<unsigned long long>(x) * y;
+			return static_cast<uint32>(xy>>32) + 
+				((R==std::round_to_nearest) ? ((xy>>31)&1) : (R==std::round_toward_infinity) ? ((xy&0xFFFFFFFF)!=0) : 0);
+		#else
+			uint32 xy = (x>>16) * (y&0xFFFF), yx = (x&0xFFFF) * (y>>16), lo = (x&0xFFFF) * (y&0xFFFF), c = (xy&0xFFFF) + (yx&0xFFFF) + (lo>>16);
+			return (x>>16)*(y>>16) + (xy>>16) + (yx>>16) + (c>>16) +
+				((R==std::round_to_nearest) ? ((c>>15)&1) : (R==std::round_toward_infinity) ? (((c|lo)&0xFFFF)!=0) : 0);
+		#endif
+		}
+
+		/// 64-bit multiplication.
+		/// \param x first factor
+		/// \param y second factor
+		/// \return upper 32 bit of \a x * \a y rounded to nearest
+		inline uint32 multiply64(uint32 x, uint32 y) { return mulhi<std::round_to_nearest>(x, y); }
+
+		/// 64-bit division.
+		/// Without `long long` this divides by 16-bit digits like Knuth's algorithm D, needing only two 32-bit divisions.
+		/// \param x upper 32 bit of dividend
+		/// \param y divisor greater than \a x
+		/// \param s variable to store sticky bit for rounding
+		/// \return (\a x << 32) / \a y
+		inline uint32 divide64(uint32 x, uint32 y, int &s)
+		{
+		#if HALF_ENABLE_CPP11_LONG_LONG
+			unsigned long long xx = static_cast<unsigned long long>(x) << 32;
+			return s = (xx%y!=0), static_cast<uint32>(xx/y);
+		#else
+			int n = clz(y);
+			y = (y<<n) & 0xFFFFFFFF;
+			x = (x<<n) & 0xFFFFFFFF;
+			uint32 yh = y >> 16, yl = y & 0xFFFF, qh = x / yh, r = x - qh*yh;
+			while(qh > 0xFFFF || qh*yl > ((r<<16)&0xFFFFFFFF))
+			{
+				--qh;
+				if((r+=yh) > 0xFFFF)
+					break;
+			}
+			x = ((x<<16) - qh*y) & 0xFFFFFFFF;
+			uint32 ql = x / yh;
+			r = x - ql*yh;
+			while(ql > 0xFFFF || ql*yl > ((r<<16)&0xFFFFFFFF))
+			{
+				--ql;
+				if((r+=yh) > 0xFFFF)
+					break;
+			}
+			return s = (((x<<16)-ql*y)&0xFFFFFFFF) != 0, (qh<<16) | ql;
+		#endif
+		}
+
+		/// Full 64-bit multiplication.
+		/// \param x first factor
+		/// \param y second factor
+		/// \param lo variable to store lower 32 bit of product
+		/// \return upper 32 bit of \a x * \a y
+		inline uint32 mulhilo(uint32 x, uint32 y, uint32 &lo)
+		{
+		#if HALF_ENABLE_CPP11_LONG_LONG
+			unsigned long long xy = static_cast<unsigned long long>(x) * y;
+			return lo = static_cast<uint32>(xy&0xFFFFFFFF), static_cast<uint32>(xy>>32);
+		#else
+			uint32 xy = (x>>16) * (y&0xFFFF), yx = (x&0xFFFF) * (y>>16), l = (x&0xFFFF) * (y&0xFFFF), c = (xy&0xFFFF) + (yx&0xFFFF) + (l>>16);
+			lo = ((c<<16)&0xFFFFFFFF) | (l&0xFFFF);
+			return (x>>16)*(y>>16) + (xy>>16) + (yx>>16) + (c>>16);
+		#endif
+		}
+
+		/// Upper part of multiplication of 64-bit fixed point numbers.
+		/// This ignores the product of the lower halves, so the result may be up to 3 * 2^-\a n too small.
+		/// \param xh upper 32 bit of first factor
+		/// \param xl lower 32 bit of first factor
+		/// \param yh upper 32 bit of second factor
+		/// \param yl lower 32 bit of second factor
+		/// \param n number of bits to shift the product right in addition to 64 (at most 31)
+		/// \param lo variable to store lower 32 bit of result
+		/// \return upper 32 bit of (\a x * \a y) >> (64 + \a n)
+		inline uint32 mulhi64(uint32 xh, uint32 xl, uint32 yh, uint32 yl, int n, uint32 &lo)
+		{
+			uint32 p0, p1 = mulhilo(xh, yh, p0), c = mulhi<std::round_toward_zero>(xh, yl);
+			p0 = (p0+c) & 0xFFFFFFFF;
+			p1 += p0 < c;
+			c = mulhi<std::round_toward_zero>(xl, yh);
+			p0 = (p0+c) & 0xFFFFFFFF;
+			p1 += p0 < c;
+			return lo = ((p1<<(31-n)<<1)|(p0>>n)) & 0xFFFFFFFF, p1 >> n;
+		}
+
+		/// 64-bit addition.
+		/// \param hi upper 32 bit of first summand and result
+		/// \param lo lower 32 bit of first summand and result
+		/// \param h upper 32 bit of second summand
+		/// \param l lower 32 bit of second summand
+		inline void add64(uint32 &hi, uint32 &lo, uint32 h, uint32 l)
+		{
+			lo = (lo+l) & 0xFFFFFFFF;
+			hi += h + (lo<l);
+		}
+
+		/// 64-bit subtraction.
+		/// \param hi upper 32 bit of minuend and result
+		/// \param lo lower 32 bit of minuend and result
+		/// \param h upper 32 bit of subtrahend
+		/// \param l lower 32 bit of subtrahend
+		inline void sub64(uint32 &hi, uint32 &lo, uint32 h, uint32 l)
+		{
+			hi -= h + (lo<l);
+			lo = (lo-l) & 0xFFFFFFFF;
+		}
+
+		/// 64-bit right shift.
+		/// \param hi upper 32 bit of value and result
+		/// \param lo lower 32 bit of value and result
+		/// \param n number of bits to shift (non-negative)
+		inline void shr64(uint32 &hi, uint32 &lo, int n)
+		{
+			if(n > 63)
+				hi = lo = 0;
+			else if(n > 31)
+			{
+				lo = hi >> (n-32);
+				hi = 0;
+			}
+			else if(n)
+			{
+				lo = ((hi<<(32-n))|(lo>>n)) & 0xFFFFFFFF;
+				hi >>= n;
+			}
+		}
+
 		/// \}
 		/// \name Error handling
 		/// \{
@@ -772,6 +1228,34 @@ namespace half_float
 			return arg;
 		}
 
+		/// Treat subnormal argument as zero.
+		/// \param arg half-precision value
+		/// \return zero with sign of \a arg if \a arg is subnormal and [flushing](\ref HALF_FLUSH_DENORMALS) is enabled, \a arg otherwise
+		inline HALF_CONSTEXPR unsigned int flush_arg(unsigned int arg)
+		{
+		#if HALF_FLUSH_DENORMALS
+			return (arg&0x7C00) ? arg : (arg&0x8000);
+		#else
+			return arg;
+		#endif
+		}
+
+		/// Flush subnormal result to zero.
+		/// \param value half-precision result
+		/// \return zero with sign of \a value if \a value is subnormal and [flushing](\ref HALF_FLUSH_DENORMALS) is enabled, \a value otherwise
+		/// \exception FE_UNDERFLOW and FE_INEXACT if \a value is flushed
+		inline HALF_CONSTEXPR_NOERR unsigned int flush_result(unsigned int value)
+		{
+		#if HALF_FLUSH_DENORMALS
+			#if HALF_ERRHANDLING
+				raise(FE_UNDERFLOW|FE_INEXACT, !(value&0x7C00) && (value&0x3FF));
+			#endif
+			return ((value&0x7C00) || !(value&0x3FF)) ? value : (value&0x8000);
+		#else
+			return value;
+		#endif
+		}
+
 		/// \}
 		/// \name Conversion and rounding
 		/// \{
@@ -838,6 +1322,18 @@ namespace half_float
 		#endif
 		}
 
+		/// Apply conversion policies to half-precision value.
+		/// \tparam P [conversion policies](\ref half_float::conversion_policy) to apply
+		/// \param value half-precision value as rounded
+		/// \return half-precision value with policies applied
+		template<unsigned int P> HALF_CONSTEXPR unsigned int apply_policy(unsigned int value)
+		{
+			return	((P&policy_scrub_nan) && (value&0x7FFF) > 0x7C00) ? 0 :
+					((P&policy_saturate) && (value&0x7FFF) == 0x7C00) ? (value-1) :
+					((P&policy_flush_subnormals) && !(value&0x7C00)) ? (value&0x8000) :
+					value;
+		}
+
 		/// Round half-precision number to nearest integer value.
 		/// \tparam R rounding mode to use
 		/// \tparam E `true` for round to even, `false` for round away from zero
@@ -890,14 +1386,28 @@ namespace half_float
 				sign = msign & 0x8000;
 			}
 			if(N)
-				for(; m<(static_cast<uint32>(1)<<F) && exp; m<<=1,--exp) ;
+				exp -= normalize<F>(m, exp);
 			else if(exp < 0)
 				return rounded<R,I>(sign+(m>>(F-10-exp)), (m>>(F-11-exp))&1, s|((m&((static_cast<uint32>(1)<<(F-11-exp))-1))!=0));
 			return rounded<R,I>(sign+(exp<<10)+(m>>(F-10)), (m>>(F-11))&1, s|((m&((static_cast<uint32>(1)<<(F-11))-1))!=0));
 		}
 
+	#if HALF_ENABLE_F16C_INTRINSICS || HALF_SIMD_AVX2 || HALF_SIMD_AVX512
+		/// Rounding control for F16C conversion instructions.
+		/// \tparam R rounding mode to use
+		template<std::float_round_style R> struct f16c_rounding
+		{
+			enum { value =	(R==std::round_to_nearest) ? _MM_FROUND_TO_NEAREST_INT :
+							(R==std::round_toward_zero) ? _MM_FROUND_TO_ZERO :
+							(R==std::round_toward_infinity) ? _MM_FROUND_TO_POS_INF :
+							(R==std::round_toward_neg_infinity) ? _MM_FROUND_TO_NEG_INF :
+							_MM_FROUND_CUR_DIRECTION };
+		};
+	#endif
+
 		/// Convert IEEE single-precision to half-precision.
 		/// Credit for this goes to [Jeroen van der Zijp](ftp://ftp.fox-toolkit.org/pub/fasthalffloatconversion.pdf).
+		/// The F16C instructions don't raise any exceptions, so they are not used when exception handling is enabled.
 		/// \tparam R rounding mode to use
 		/// \param value single-precision value to convert
 		/// \return rounded half-precision value
@@ -906,17 +1416,11 @@ namespace half_float
 		/// \exception FE_INEXACT if value had to be rounded
 		template<std::float_round_style R> unsigned int float2half_impl(float value, true_type)
 		{
-		#if HALF_ENABLE_F16C_INTRINSICS
-			return _mm_cvtsi128_si32(_mm_cvtps_ph(_mm_set_ss(value),
-				(R==std::round_to_nearest) ? _MM_FROUND_TO_NEAREST_INT :
-				(R==std::round_toward_zero) ? _MM_FROUND_TO_ZERO :
-				(R==std::round_toward_infinity) ? _MM_FROUND_TO_POS_INF :
-				(R==std::round_toward_neg_infinity) ? _MM_FROUND_TO_NEG_INF :
-				_MM_FROUND_CUR_DIRECTION));
+		#if HALF_ENABLE_F16C_INTRINSICS && !HALF_ERRHANDLING
+			return _mm_cvtsi128_si32(_mm_cvtps_ph(_mm_set_ss(value), f16c_rounding<R>::value));
 		#else
 			bits<float>::type fbits;
 			std::memcpy(&fbits, &value, sizeof(float));
-		#if 1
 			unsigned int sign = (fbits>>16) & 0x8000;
 			fbits &= 0x7FFFFFFF;
 			if(fbits >= 0x7F800000)
@@ -934,58 +1438,11 @@ namespace half_float
 			if(fbits != 0)
 				return underflow<R>(sign);
 			return sign;
-		#else
-			static const uint16 base_table[512] = {
-				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 
-				0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080, 0x0100, 
-				0x0200, 0x0400, 0x0800, 0x0C00, 0x1000, 0x1400, 0x1800, 0x1C00, 0x2000, 0x2400, 0x2800, 0x2C00, 0x3000, 0x3400, 0x3800, 0x3C00, 
-				0x4000, 0x4400, 0x4800, 0x4C00, 0x5000, 0x5400, 0x5800, 0x5C00, 0x6000, 0x6400, 0x6800, 0x6C00, 0x7000, 0x7400, 0x7800, 0x7BFF, 
-				0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 
-				0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 
-				0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 
-				0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 
-				0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 
-				0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 
-				0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7BFF, 0x7C00, 
-				0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 
-				0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 
-				0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 
-				0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 
-				0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 
-				0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 
-				0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8000, 0x8001, 0x8002, 0x8004, 0x8008, 0x8010, 0x8020, 0x8040, 0x8080, 0x8100, 
-				0x8200, 0x8400, 0x8800, 0x8C00, 0x9000, 0x9400, 0x9800, 0x9C00, 0xA000, 0xA400, 0xA800, 0xAC00, 0xB000, 0xB400, 0xB800, 0xBC00, 
-				0xC000, 0xC400, 0xC800, 0xCC00, 0xD000, 0xD400, 0xD800, 0xDC00, 0xE000, 0xE400, 0xE800, 0xEC00, 0xF000, 0xF400, 0xF800, 0xFBFF, 
-				0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 
-				0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 
-				0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 
-				0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 
-				0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 
-				0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 
-				0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFBFF, 0xFC00 };
-			static const unsigned char shift_table[256] = {
-				24, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 
-				25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 
-				25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 
-				25, 25, 25, 25, 25, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 
-				13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
-				24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
-				24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 
-				24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 13 };
-			int sexp = fbits >> 23, exp = sexp & 0xFF, i = shift_table[exp];
-			fbits &= 0x7FFFFF;
-			uint32 m = (fbits|((exp!=0)<<23)) & -static_cast<uint32>(exp!=0xFF);
-			return rounded<R,false>(base_table[sexp]+(fbits>>i), (m>>(i-1))&1, (((static_cast<uint32>(1)<<(i-1))-1)&m)!=0);
-		#endif
 		#endif
 		}
 
 		/// Convert IEEE double-precision to half-precision.
+		/// For `std::round_indeterminate` this may use the F16C instructions, rounding to single-precision first.
 		/// \tparam R rounding mode to use
 		/// \param value double-precision value to convert
 		/// \return rounded half-precision value
@@ -994,7 +1451,7 @@ namespace half_float
 		/// \exception FE_INEXACT if value had to be rounded
 		template<std::float_round_style R> unsigned int float2half_impl(double value, true_type)
 		{
-		#if HALF_ENABLE_F16C_INTRINSICS
+		#if HALF_ENABLE_F16C_INTRINSICS && !HALF_ERRHANDLING
 			if(R == std::round_indeterminate)
 				return _mm_cvtsi128_si32(_mm_cvtps_ph(_mm_cvtpd_ps(_mm_set_sd(value)), _MM_FROUND_CUR_DIRECTION));
 		#endif
@@ -1020,6 +1477,45 @@ namespace half_float
 			return sign;
 		}
 
+		/// Convert IEEE single-precision to half-precision with stochastic rounding.
+		/// Inexact values are rounded away from zero with a probability given by the discarded part (truncated to 32 bits),
+		/// and toward zero otherwise. Values too large for this are rounded to nearest, i.e. to infinity.
+		/// \param value single-precision value to convert
+		/// \param rnd 32 uniformly distributed random bits
+		/// \return rounded half-precision value
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if value had to be rounded
+		inline unsigned int float2half_stochastic(float value, uint32 rnd)
+		{
+			bits<float>::type fbits;
+			std::memcpy(&fbits, &value, sizeof(float));
+			unsigned int sign = (fbits>>16) & 0x8000;
+			fbits &= 0x7FFFFFFF;
+			if(fbits >= 0x7F800000)
+				return sign | 0x7C00 | ((fbits>0x7F800000) ? (0x200|((fbits>>13)&0x3FF)) : 0);
+			if(fbits >= 0x47800000)
+				return overflow<std::round_to_nearest>(sign);
+			if(fbits == 0)
+				return sign;
+			unsigned int exp = fbits >> 23;
+			uint32 m = (fbits&0x7FFFFF) | (exp ? 0x800000 : 0);
+			int i = (exp>113) ? 13 : (exp<70) ? 56 : (126-static_cast<int>(exp));
+			uint32 rest = (i<=32) ? ((m<<(32-i))&0xFFFFFFFF) : (m>>(i-32));
+			unsigned int hbits = sign + ((i<32) ? (m>>i) : 0) + ((exp>113) ? ((exp-113)<<10) : 0);
+			hbits += ((rest+(rnd&0xFFFFFFFF))&0xFFFFFFFF) < rest;
+		#if HALF_ERRHANDLING
+			bool inexact = i > 32 || rest != 0;
+			if((hbits&0x7C00) == 0x7C00)
+				raise(FE_OVERFLOW);
+			else if(hbits & 0x7C00)
+				raise(FE_INEXACT, inexact);
+			else
+				raise(FE_UNDERFLOW, !(HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT) || inexact);
+		#endif
+			return hbits;
+		}
+
 		/// Convert non-IEEE floating-point to half-precision.
 		/// \tparam R rounding mode to use
 		/// \tparam T source type (builtin floating-point type)
@@ -1078,15 +1574,14 @@ namespace half_float
 			unsigned int bits = static_cast<unsigned>(value<0) << 15;
 			if(!value)
 				return bits;
-			if(bits)
-				value = -value;
-			if(value > 0xFFFF)
+			if(bits ? (-(value+1) >= 0xFFFF) : (value > 0xFFFF))
 				return overflow<R>(bits);
-			unsigned int m = static_cast<unsigned int>(value), exp = 24;
-			for(; m<0x400; m<<=1,--exp) ;
+			unsigned int abs = bits ? (static_cast<unsigned int>(-(value+1))+1) : static_cast<unsigned int>(value);
+			unsigned int m = abs, exp = 24;
+			exp -= normalize<10>(m);
 			for(; m>0x7FF; m>>=1,++exp) ;
 			bits |= (exp<<10) + m;
-			return (exp>24) ? rounded<R,false>(bits, (value>>(exp-25))&1, (((1<<(exp-25))-1)&value)!=0) : bits;
+			return (exp>24) ? rounded<R,false>(bits, (abs>>(exp-25))&1, (((1<<(exp-25))-1)&abs)!=0) : bits;
 		}
 
 		/// Convert half-precision to IEEE single-precision.
@@ -1104,7 +1599,7 @@ namespace half_float
 			if(abs)
 			{
 				fbits |= 0x38000000 << static_cast<unsigned>(abs>=0x7C00);
-				for(; abs<0x400; abs<<=1,fbits-=0x800000) ;
+				fbits -= static_cast<bits<float>::type>(normalize<10>(abs)) << 23;
 				fbits += static_cast<bits<float>::type>(abs) << 13;
 			}
 		#else
@@ -1266,7 +1761,7 @@ namespace half_float
 			if(abs)
 			{
 				hi |= 0x3F000000 << static_cast<unsigned>(abs>=0x7C00);
-				for(; abs<0x400; abs<<=1,hi-=0x100000) ;
+				hi -= static_cast<uint32>(normalize<10>(abs)) << 20;
 				hi += static_cast<uint32>(abs) << 10;
 			}
 			bits<double>::type dbits = static_cast<bits<double>::type>(hi) << 32;
@@ -1277,6 +1772,7 @@ namespace half_float
 		}
 
 		/// Convert half-precision to non-IEEE floating-point.
+		/// If single-precision is IEEE-conformant, finite values are converted to it first, which is always exact.
 		/// \tparam T type to convert to (builtin integer type)
 		/// \param value half-precision value to convert
 		/// \return floating-point value
@@ -1289,6 +1785,8 @@ namespace half_float
 					std::numeric_limits<T>::has_quiet_NaN ? std::numeric_limits<T>::quiet_NaN() : T();
 			else if(abs == 0x7C00)
 				out = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+			else if(std::numeric_limits<float>::is_iec559 && sizeof(bits<float>::type)==sizeof(float))
+				return static_cast<T>(half2float_impl(value, 0.0f, true_type()));
 			else if(abs > 0x3FF)
 				out = std::ldexp(static_cast<T>((abs&0x3FF)|0x400), (abs>>10)-25);
 			else
@@ -1344,3166 +1842,10833 @@ namespace half_float
 		}
 
 		/// \}
-		/// \name Mathematics
+		/// \name Random number generation
 		/// \{
 
-		/// upper part of 64-bit multiplication.
-		/// \tparam R rounding mode to use
-		/// \param x first factor
-		/// \param y second factor
-		/// \return upper 32 bit of \a x * \a y
-		template<std::float_round_style R> uint32 mulhi(uint32 x, uint32 y)
+		/// State of random number generator for stochastic rounding.
+		/// This consists of eight interleaved [xoshiro128++](https://prng.di.unimi.it/) generators, whose outputs are used in
+		/// turn. This way vectorized kernels can advance all of them at once while producing the same stream as random_next().
+		struct random_state
 		{
-			uint32 xy = (x>>16) * (y&0xFFFF), yx = (x&0xFFFF) * (y>>16), c = (xy&0xFFFF) + (yx&0xFFFF) + (((x&0xFFFF)*(y&0xFFFF))>>16);
-			return (x>>16)*(y>>16) + (xy>>16) + (yx>>16) + (c>>16) +
-				((R==std::round_to_nearest) ? ((c>>15)&1) : (R==std::round_toward_infinity) ? ((c&0xFFFF)!=0) : 0);
+			bits<float>::type s[4][8];		///< generator states (word-major)
+			bits<float>::type buf[8];		///< last outputs of generators
+			unsigned int pos;				///< index of next output to use from buffer
+		};
+
+		/// Mix bits of 32-bit value.
+		/// This is the finalizer of MurmurHash3, which is a bijection with good avalanche behaviour.
+		/// \param h value to mix
+		/// \return mixed value
+		inline uint32 random_mix(uint32 h)
+		{
+			h ^= h >> 16;
+			h = (h*0x85EBCA6B) & 0xFFFFFFFF;
+			h ^= h >> 13;
+			h = (h*0xC2B2AE35) & 0xFFFFFFFF;
+			return h ^ (h>>16);
 		}
 
-		/// 64-bit multiplication.
-		/// \param x first factor
-		/// \param y second factor
-		/// \return upper 32 bit of \a x * \a y rounded to nearest
-		inline uint32 multiply64(uint32 x, uint32 y)
+		/// Initialize random number generator.
+		/// The state words are derived from distinct inputs to a bijection, so no generator can end up with an all-zero state.
+		/// \param state state to initialize
+		/// \param seed seed value
+		inline void random_seed(random_state &state, unsigned long seed)
 		{
-		#if HALF_ENABLE_CPP11_LONG_LONG
-			return static_cast<uint32>((static_cast<unsigned long long>(x)*static_cast<unsigned long long>(y)+0x80000000)>>32);
+			uint32 base = random_mix((seed>>16>>16)&0xFFFFFFFF) ^ (seed&0xFFFFFFFF);
+			for(unsigned int i=0; i<4; ++i)
+				for(unsigned int j=0; j<8; ++j)
+					state.s[i][j] = random_mix((base+(i*8+j+1)*0x9E3779B9)&0xFFFFFFFF);
+			state.pos = 8;
+		}
+
+		/// Advance all random number generators.
+		/// \param state state to advance, with new outputs stored in its buffer
+		inline void random_step(random_state &state)
+		{
+			for(unsigned int j=0; j<8; ++j)
+			{
+				uint32 s0 = state.s[0][j], s1 = state.s[1][j], s2 = state.s[2][j], s3 = state.s[3][j];
+				uint32 r = (s0+s3) & 0xFFFFFFFF, t = (s1<<9) & 0xFFFFFFFF;
+				state.buf[j] = (((r<<7)|(r>>25))+s0) & 0xFFFFFFFF;
+				s2 ^= s0;
+				s3 ^= s1;
+				s1 ^= s2;
+				s0 ^= s3;
+				s2 ^= t;
+				state.s[0][j] = s0;
+				state.s[1][j] = s1;
+				state.s[2][j] = s2;
+				state.s[3][j] = ((s3<<11)|(s3>>21)) & 0xFFFFFFFF;
+			}
+			state.pos = 0;
+		}
+
+		/// Get next random number.
+		/// \param state generator state
+		/// \return 32 random bits
+		inline uint32 random_next(random_state &state)
+		{
+			if(state.pos >= 8)
+				random_step(state);
+			return state.buf[state.pos++];
+		}
+
+		/// \}
+		/// \name SIMD dispatch
+		/// \{
+
+		/// Query processor features.
+		/// \param info array to store EAX, EBX, ECX and EDX at
+		/// \param leaf function to query
+		/// \param subleaf sub-function to query
+		inline void cpuid(unsigned int *info, unsigned int leaf, unsigned int subleaf = 0)
+		{
+		#if HALF_ENABLE_SIMD_DISPATCH && defined(_MSC_VER)
+			int regs[4];
+			__cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+			for(int i=0; i<4; ++i)
+				info[i] = static_cast<unsigned int>(regs[i]);
+		#elif HALF_ENABLE_SIMD_DISPATCH
+			__cpuid_count(leaf, subleaf, info[0], info[1], info[2], info[3]);
 		#else
-			return mulhi<std::round_to_nearest>(x, y);
+			info[0] = info[1] = info[2] = info[3] = 0 * (leaf+subleaf);
 		#endif
 		}
 
-		/// 64-bit division.
-		/// \param x upper 32 bit of dividend
-		/// \param y divisor
-		/// \param s variable to store sticky bit for rounding
-		/// \return (\a x << 32) / \a y
-		inline uint32 divide64(uint32 x, uint32 y, int &s)
+		/// Query operating system support for extended registers.
+		/// \return lower 32 bits of extended control register XCR0
+		inline unsigned int xgetbv()
 		{
-		#if HALF_ENABLE_CPP11_LONG_LONG
-			unsigned long long xx = static_cast<unsigned long long>(x) << 32;
-			return s = (xx%y!=0), static_cast<uint32>(xx/y);
+		#if HALF_ENABLE_SIMD_DISPATCH && defined(_MSC_VER)
+			return static_cast<unsigned int>(_xgetbv(0));
+		#elif HALF_ENABLE_SIMD_DISPATCH
+			unsigned int eax, edx;
+			__asm__ __volatile__(".byte 0x0F, 0x01, 0xD0" : "=a"(eax), "=d"(edx) : "c"(0));
+			return eax;
+		#else
+			return 0;
+		#endif
+		}
+
+		/// Detect best supported SIMD level.
+		/// With [runtime dispatch](\ref HALF_ENABLE_SIMD_DISPATCH) this checks the processor and operating system for support of 
+		/// the required instruction sets and registers, otherwise it just returns the best level enabled at compile-time.
+		/// \return best SIMD level usable for batch operations
+		inline int simd_detect()
+		{
+		#if HALF_ENABLE_SIMD_DISPATCH
+			unsigned int info[4];
+			cpuid(info, 0);
+			unsigned int max = info[0];
+			if(max < 1)
+				return 0;
+			cpuid(info, 1);
+			if(!(info[3]&0x4000000))
+				return 0;
+			if((info[2]&0x38000000) != 0x38000000 || max < 7)		//OSXSAVE, AVX, F16C
+				return 1;
+			unsigned int xcr0 = xgetbv();
+			cpuid(info, 7);
+			if((xcr0&0x6) != 0x6 || !(info[1]&0x20))				//YMM state, AVX2
+				return 1;
+			if((xcr0&0xE6) != 0xE6 || (info[1]&0x40010000) != 0x40010000)	//ZMM state, AVX512F, AVX512BW
+				return 2;
+			return 3;
+		#elif HALF_SIMD_AVX512
+			return 3;
+		#elif HALF_SIMD_AVX2
+			return 2;
+		#elif HALF_SIMD_SSE2
+			return 1;
 		#else
-			y >>= 1;
-			uint32 rem = x, div = 0;
-			for(unsigned int i=0; i<32; ++i)
+			return 0;
+		#endif
+		}
+
+		/// Initial SIMD level.
+		/// This is the best supported SIMD level, possibly lowered by the `HALF_SIMD_LEVEL` environment variable.
+		/// \return SIMD level to use for batch operations by default
+		inline int simd_default()
+		{
+			static const char *const names[] = { "scalar", "sse2", "avx2", "avx512" };
+			int level = simd_detect();
+			if(const char *env = std::getenv("HALF_SIMD_LEVEL"))
+				for(int i=0; i<4; ++i)
+					if(!std::strcmp(env, names[i]) || (env[0]=='0'+i && !env[1]))
+						return (std::min)(i, level);
+			return level;
+		}
+
+		/// Selected SIMD level.
+		/// This is atomic if [C++11 atomics](\ref HALF_ENABLE_CPP11_ATOMIC) are supported, so it can be selected while other 
+		/// threads run batch operations.
+		/// \return reference to SIMD level used for batch operations
+	#if HALF_ENABLE_CPP11_ATOMIC
+		inline std::atomic<int>& simd_level() { static std::atomic<int> level(simd_default()); return level; }
+	#else
+		inline int& simd_level() { static int level = simd_default(); return level; }
+	#endif
+
+	#if HALF_ENABLE_CPP11_ATOMIC
+		/// Read runtime setting.
+		/// \tparam T type of setting
+		/// \param setting atomic setting to read
+		/// \return current value, read with relaxed memory ordering
+		template<typename T> T load_setting(const std::atomic<T> &setting) { return setting.load(std::memory_order_relaxed); }
+
+		/// Change runtime setting.
+		/// \tparam T type of setting
+		/// \param setting atomic setting to change
+		/// \param value new value
+		/// \return previous value, exchanged with relaxed memory ordering
+		template<typename T> T store_setting(std::atomic<T> &setting, T value) { return setting.exchange(value, std::memory_order_relaxed); }
+	#endif
+
+		/// Read runtime setting without C++11 atomics.
+		/// \tparam T type of setting
+		/// \param setting setting to read
+		/// \return current value
+		template<typename T> T load_setting(const T &setting) { return setting; }
+
+		/// Change runtime setting without C++11 atomics.
+		/// \tparam T type of setting
+		/// \param setting setting to change
+		/// \param value new value
+		/// \return previous value
+		template<typename T> T store_setting(T &setting, T value) { T old = setting; setting = value; return old; }
+
+		/// Select kernel for SIMD level.
+		/// This selects the kernel for the currently used SIMD level, or the best available kernel below it if there is none.
+		/// \tparam F kernel function pointer type
+		/// \param kernels kernels for each SIMD level with `0` for unavailable kernels (first has to be non-null)
+		/// \return kernel to use
+		template<typename F> F simd_kernel(F const (&kernels)[4])
+		{
+			int level = simd_level();
+			for(; !kernels[level]; --level) ;
+			return kernels[level];
+		}
+
+		/// Detect size of largest cache.
+		/// This uses the deterministic cache parameters reported by Intel or AMD processors.
+		/// \return size of largest data or unified cache in bytes, 0 if unknown
+		inline std::size_t cache_detect()
+		{
+			static const unsigned int leaves[2] = { 4, 0x8000001D };
+			std::size_t size = 0;
+			for(int i=0; i<2 && !size; ++i)
 			{
-				div <<= 1;
-				if(rem >= y)
+				unsigned int info[4];
+				cpuid(info, leaves[i]&0x80000000);
+				if(info[0] < leaves[i])
+					continue;
+				for(unsigned int j=0; j<16; ++j)
 				{
-					rem -= y;
-					div |= 1;
+					cpuid(info, leaves[i], j);
+					if(!(info[0]&0x1F))
+						break;
+					if((info[0]&0x1F) != 2)
+						size = (std::max)(size, static_cast<std::size_t>((info[1]>>22)+1) * 
+							(((info[1]>>12)&0x3FF)+1) * ((info[1]&0xFFF)+1) * (info[2]+1));
 				}
-				rem <<= 1;
 			}
-			return s = rem > 1, div;
-		#endif
+			return size;
 		}
 
-		/// Half precision positive modulus.
-		/// \tparam Q `true` to compute full quotient, `false` else
-		/// \tparam R `true` to compute signed remainder, `false` for positive remainder
-		/// \param x first operand as positive finite half-precision value
-		/// \param y second operand as positive finite half-precision value
-		/// \param quo adress to store quotient at, `nullptr` if \a Q `false`
-		/// \return modulus of \a x / \a y
-		template<bool Q,bool R> unsigned int mod(unsigned int x, unsigned int y, int *quo = NULL)
+		/// Default minimum size of streaming conversions.
+		/// \return [HALF_STREAMING_THRESHOLD](\ref HALF_STREAMING_THRESHOLD) if nonzero, else size of largest cache or 8 MiB if unknown
+		inline std::size_t stream_default()
 		{
-			unsigned int q = 0;
-			if(x > y)
+			if(HALF_STREAMING_THRESHOLD)
+				return static_cast<std::size_t>(HALF_STREAMING_THRESHOLD);
+			std::size_t size = cache_detect();
+			return size ? size : (static_cast<std::size_t>(8)<<20);
+		}
+
+		/// Minimum size of streaming conversions.
+		/// This is initialized from [HALF_STREAMING_THRESHOLD](\ref HALF_STREAMING_THRESHOLD). It is atomic if 
+		/// [C++11 atomics](\ref HALF_ENABLE_CPP11_ATOMIC) are supported, so it can be changed while other threads run batch 
+		/// conversions.
+		/// \return reference to minimum number of bytes read and written by batch conversions to use non-temporal stores
+	#if HALF_ENABLE_CPP11_ATOMIC
+		inline std::atomic<std::size_t>& stream_threshold() { static std::atomic<std::size_t> threshold(stream_default()); return threshold; }
+	#else
+		inline std::size_t& stream_threshold() { static std::size_t threshold = stream_default(); return threshold; }
+	#endif
+
+		/// \}
+		/// \name Thread pool
+		/// \{
+
+		/// Initial number of threads for parallel operations.
+		/// \return number of hardware threads, 1 if unknown or without the [thread pool](\ref HALF_ENABLE_PARALLEL)
+		inline unsigned int parallel_default()
+		{
+		#if HALF_ENABLE_PARALLEL && HALF_ENABLE_CPP11_THREAD && HALF_ENABLE_CPP11_THREAD_LOCAL
+			return (std::max)(std::thread::hardware_concurrency(), 1u);
+		#else
+			return 1;
+		#endif
+		}
+
+		/// Default number of threads for parallel operations.
+		/// This is atomic if [C++11 atomics](\ref HALF_ENABLE_CPP11_ATOMIC) are supported, so it can be changed while other threads 
+		/// run parallel batch operations.
+		/// \return reference to number of threads used by [parallel](\ref half_float::parallel_policy) batch operations by default
+	#if HALF_ENABLE_CPP11_ATOMIC
+		inline std::atomic<unsigned int>& parallel_threads() { static std::atomic<unsigned int> threads(parallel_default()); return threads; }
+	#else
+		inline unsigned int& parallel_threads() { static unsigned int threads = parallel_default(); return threads; }
+	#endif
+
+	#if HALF_ENABLE_PARALLEL && HALF_ENABLE_CPP11_THREAD && HALF_ENABLE_CPP11_THREAD_LOCAL
+		/// Pool of worker threads.
+		/// This distributes tasks statically among the calling thread and a number of worker threads, with each thread running 
+		/// one part of a task. The worker threads are only created when first needed and then wait for further tasks until the 
+		/// pool is destroyed. Concurrent tasks are serialized, while tasks started from within a part of another task run all 
+		/// their parts on the calling thread, since waiting for the pool would deadlock there.
+		class thread_pool
+		{
+		public:
+			/// Task type.
+			typedef std::function<void(unsigned int)> task_type;
+
+			/// Constructor.
+			thread_pool() : task_(nullptr), count_(0), pending_(0), generation_(0), flags_(0), stop_(false) {}
+
+			/// Destructor.
+			/// This stops and joins all worker threads.
+			~thread_pool()
 			{
-				int absx = x, absy = y, expx = 0, expy = 0;
-				for(; absx<0x400; absx<<=1,--expx) ;
-				for(; absy<0x400; absy<<=1,--expy) ;
-				expx += absx >> 10;
-				expy += absy >> 10;
-				int mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
-				for(int d=expx-expy; d; --d)
 				{
-					if(!Q && mx == my)
-						return 0;
-					if(mx >= my)
-					{
-						mx -= my;
-						q += Q;
-					}
-					mx <<= 1;
-					q <<= static_cast<int>(Q);
+					std::lock_guard<std::mutex> lock(mutex_);
+					stop_ = true;
 				}
-				if(!Q && mx == my)
-					return 0;
-				if(mx >= my)
+				wake_.notify_all();
+				for(std::thread &thread : threads_)
+					thread.join();
+			}
+
+			/// Run task on multiple threads.
+			/// This starts additional worker threads if necessary and returns once all parts of the task have finished, even 
+			/// if part 0 throws. Called from within a part of a task, this runs all parts one after another instead. The parts 
+			/// run on worker threads must not throw.
+			/// \param task function to call with each part index, part 0 being run on the calling thread
+			/// \param count number of parts to run concurrently
+			/// \return exception flags raised by the worker threads
+			/// \exception any exception thrown by part 0 of \a task
+			int run(const task_type &task, unsigned int count)
+			{
+				if(inside())
 				{
-					mx -= my;
-					++q;
+					for(unsigned int i=0; i<count; ++i)
+						task(i);
+					return 0;
 				}
-				if(Q)
+				std::lock_guard<std::mutex> serial(run_mutex_);
+				std::unique_lock<std::mutex> lock(mutex_);
+				while(threads_.size()+1 < count)
+					threads_.emplace_back(&thread_pool::work, this, static_cast<unsigned int>(threads_.size()+1), generation_);
+				task_ = &task;
+				count_ = count;
+				pending_ = count - 1;
+				flags_ = 0;
+				++generation_;
+				lock.unlock();
+				wake_.notify_all();
 				{
-					q &= (1<<(std::numeric_limits<int>::digits-1)) - 1;
-					if(!mx)
-						return *quo = q, 0;
+					finisher finish(*this);
+					task(0);
 				}
-				for(; mx<0x400; mx<<=1,--expy) ;
-				x = (expy>0) ? ((expy<<10)|(mx&0x3FF)) : (mx>>(1-expy));
+				return flags_;
 			}
-			if(R)
+
+		private:
+			/// Guard for running part of a task on the calling thread.
+			/// This marks the calling thread as running a part and waits for the worker threads to finish theirs on 
+			/// destruction, so that the task and its arguments stay alive until then, even when unwinding an exception.
+			class finisher
 			{
-				unsigned int a, b;
-				if(y < 0x800)
-				{
-					a = (x<0x400) ? (x<<1) : (x+0x400);
-					b = y;
-				}
-				else
+			public:
+				/// Constructor.
+				/// \param pool thread pool running the task
+				explicit finisher(thread_pool &pool) : pool_(pool) { inside() = true; }
+
+				/// Destructor.
+				~finisher()
 				{
-					a = x;
-					b = y - 0x400;
+					inside() = false;
+					std::unique_lock<std::mutex> lock(pool_.mutex_);
+					pool_.done_.wait(lock, [this]() { return !pool_.pending_; });
 				}
-				if(a > b || (a == b && (q&1)))
+
+			private:
+				finisher(const finisher&);
+				finisher& operator=(const finisher&);
+
+				/// Thread pool running the task.
+				thread_pool &pool_;
+			};
+
+			/// Parts of tasks running on the current thread.
+			/// \return reference to thread-local flag, `true` while running part of a task
+			static bool& inside() { HALF_THREAD_LOCAL bool flag = false; return flag; }
+
+			/// Worker thread.
+			/// \param index part index to run
+			/// \param generation number of tasks already run when started
+			void work(unsigned int index, unsigned long generation)
+			{
+				inside() = true;
+				std::unique_lock<std::mutex> lock(mutex_);
+				for(;;)
 				{
-					int exp = (y>>10) + (y<=0x3FF), d = exp - (x>>10) - (x<=0x3FF);
-					int m = (((y&0x3FF)|((y>0x3FF)<<10))<<1) - (((x&0x3FF)|((x>0x3FF)<<10))<<(1-d));
-					for(; m<0x800 && exp>1; m<<=1,--exp) ;
-					x = 0x8000 + ((exp-1)<<10) + (m>>1);
-					q += Q;
+					wake_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+					if(stop_)
+						return;
+					generation = generation_;
+					if(index < count_)
+					{
+						lock.unlock();
+						errflags() = 0;
+						(*task_)(index);
+						lock.lock();
+						flags_ |= errflags();
+						if(!--pending_)
+							done_.notify_one();
+					}
 				}
 			}
-			if(Q)
-				*quo = q;
-			return x;
+
+			/// Worker threads.
+			std::vector<std::thread> threads_;
+
+			/// Mutex serializing tasks.
+			std::mutex run_mutex_;
+
+			/// Mutex protecting pool state.
+			std::mutex mutex_;
+
+			/// Condition for starting tasks.
+			std::condition_variable wake_;
+
+			/// Condition for finishing tasks.
+			std::condition_variable done_;
+
+			/// Current task.
+			const task_type *task_;
+
+			/// Number of parts of current task.
+			unsigned int count_;
+
+			/// Number of parts still running on worker threads.
+			unsigned int pending_;
+
+			/// Number of tasks run.
+			unsigned long generation_;
+
+			/// Exception flags raised by worker threads.
+			int flags_;
+
+			/// Stop worker threads.
+			bool stop_;
+		};
+
+		/// Global thread pool.
+		/// \return thread pool for parallel operations, started on first call
+		inline thread_pool& parallel_pool() { static thread_pool pool; return pool; }
+	#endif
+
+		/// \}
+		/// \name Batch conversion
+		/// \{
+
+		/// Convert array of IEEE single-precision to half-precision one by one.
+		/// \tparam R rounding mode to use
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P> void float2half_scalar(const float *src, uint16 *dst, std::size_t n)
+		{
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = static_cast<uint16>(apply_policy<P>(float2half<R>(src[i])));
 		}
 
-		/// Fixed point square root.
-		/// \tparam F number of fractional bits
-		/// \param r radicand in Q1.F fixed point format
-		/// \param exp exponent
-		/// \return square root as Q1.F/2
-		template<unsigned int F> uint32 sqrt(uint32 &r, int &exp)
+		/// Convert array of IEEE double-precision to half-precision one by one.
+		/// \tparam R rounding mode to use
+		/// \param src double-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P> void float2half_scalar(const double *src, uint16 *dst, std::size_t n)
 		{
-			int i = exp & 1;
-			r <<= i;
-			exp = (exp-i) / 2;
-			uint32 m = 0;
-			for(uint32 bit=static_cast<uint32>(1)<<F; bit; bit>>=2)
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = static_cast<uint16>(apply_policy<P>(float2half<R>(src[i])));
+		}
+
+		/// Convert array of integers to half-precision one by one.
+		/// \tparam R rounding mode to use
+		/// \tparam T type to convert (builtin integer type)
+		/// \param src integral values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P,typename T> void int2half_scalar(const T *src, uint16 *dst, std::size_t n)
+		{
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = static_cast<uint16>(apply_policy<P>(int2half<R>(src[i])));
+		}
+
+		/// Convert array of half-precision to integers one by one.
+		/// \tparam R rounding mode to use
+		/// \tparam T type to convert to (builtin integer type)
+		/// \param src half-precision values to convert
+		/// \param dst array to store integral values at
+		/// \param n number of values to convert
+		/// \exception FE_INVALID if a value is not representable in type \a T
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,typename T> void half2int_scalar(const uint16 *src, T *dst, std::size_t n)
+		{
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = half2int<R,true,true,T>(src[i]);
+		}
+
+		/// Convert array of half-precision to floating-point one by one.
+		/// \tparam T type to convert to (builtin floating-point type)
+		/// \param src half-precision values to convert
+		/// \param dst array to store floating-point values at
+		/// \param n number of values to convert
+		template<typename T> void half2float_scalar(const uint16 *src, T *dst, std::size_t n)
+		{
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = half2float<T>(src[i]);
+		}
+
+		/// Convert array of IEEE single-precision to half-precision with stochastic rounding one by one.
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \param state random number generator to use
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<unsigned int P> void float2half_stochastic_scalar(const float *src, uint16 *dst, std::size_t n, random_state &state)
+		{
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = static_cast<uint16>(apply_policy<P>(float2half_stochastic(src[i], random_next(state))));
+		}
+
+	#if HALF_SIMD_SSE2
+		/// Select values based on mask using SSE2.
+		/// \param mask selection mask with each lane either all ones or zero
+		/// \param a values to select where mask set
+		/// \param b values to select where mask not set
+		/// \return selected values
+		HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i select_sse2(__m128i mask, __m128i a, __m128i b)
+		{
+			return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+		}
+
+		/// Apply conversion policies to eight half-precision values using SSE2.
+		/// \tparam P [conversion policies](\ref half_float::conversion_policy) to apply
+		/// \param h half-precision values as rounded
+		/// \return half-precision values with policies applied
+		template<unsigned int P> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i policy_sse2(__m128i h)
+		{
+			__m128i abs = _mm_and_si128(h, _mm_set1_epi16(0x7FFF));
+			if(P & policy_scrub_nan)
+				h = _mm_andnot_si128(_mm_cmpgt_epi16(abs, _mm_set1_epi16(0x7C00)), h);
+			if(P & policy_saturate)
+				h = _mm_add_epi16(h, _mm_cmpeq_epi16(abs, _mm_set1_epi16(0x7C00)));
+			if(P & policy_flush_subnormals)
+				h = _mm_andnot_si128(_mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(h, _mm_set1_epi16(0x7C00)), 
+					_mm_setzero_si128()), _mm_set1_epi16(0x7FFF)), h);
+			return h;
+		}
+
+		/// Convert four IEEE single-precision values to half-precision using SSE2.
+		/// This is a branchless variant of float2half_impl() treating normal and subnormal results the same way, with the 
+		/// variable right shift realized as 32x32-bit multiplication by a power of two, whose lower half holds the discarded bits. 
+		/// The results and exceptions are identical to those of float2half_impl().
+		/// \tparam R rounding mode to use
+		/// \param fbits single-precision values as integers
+		/// \param flags vector to accumulate exception flags in
+		/// \return half-precision values in lower 16 bits of each 32-bit lane
+		template<std::float_round_style R> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i float2half_sse2(__m128i fbits, __m128i &HALF_UNUSED_NOERR(flags))
+		{
+			const __m128i zero = _mm_setzero_si128(), one = _mm_set1_epi32(1), lo = _mm_set_epi32(0, -1, 0, -1);
+			__m128i sign = _mm_and_si128(_mm_srli_epi32(fbits, 16), _mm_set1_epi32(0x8000));
+			__m128i abs = _mm_and_si128(fbits, _mm_set1_epi32(0x7FFFFFFF)), exp = _mm_srli_epi32(abs, 23);
+			__m128i m = _mm_or_si128(_mm_and_si128(abs, _mm_set1_epi32(0x7FFFFF)), 
+				_mm_andnot_si128(_mm_cmpeq_epi32(exp, zero), _mm_set1_epi32(0x800000)));
+			__m128i e = _mm_add_epi32(exp, _mm_set1_epi32(33)), emin = _mm_set1_epi32(134), emax = _mm_set1_epi32(146);
+			e = select_sse2(_mm_cmpgt_epi32(e, emax), emax, e);
+			e = select_sse2(_mm_cmpgt_epi32(emin, e), emin, e);
+			__m128i scale = _mm_cvttps_epi32(_mm_castsi128_ps(_mm_slli_epi32(e, 23)));
+			__m128i even = _mm_mul_epu32(m, scale), odd = _mm_mul_epu32(_mm_srli_epi64(m, 32), _mm_srli_epi64(scale, 32));
+			__m128i mant = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(lo, odd));
+			__m128i rest = _mm_or_si128(_mm_and_si128(lo, even), _mm_slli_epi64(odd, 32));
+			__m128i value = _mm_add_epi32(_mm_add_epi32(sign, mant), _mm_slli_epi32(_mm_and_si128(_mm_sub_epi32(exp, 
+				_mm_set1_epi32(113)), _mm_cmpgt_epi32(exp, _mm_set1_epi32(113))), 10));
+			__m128i exact = _mm_cmpeq_epi32(rest, zero), inexact = _mm_andnot_si128(exact, one);
+			if(R == std::round_to_nearest)
+				value = _mm_add_epi32(value, _mm_and_si128(_mm_srli_epi32(rest, 31), 
+					_mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi32(_mm_slli_epi32(rest, 1), zero), one), value)));
+			else if(R == std::round_toward_infinity)
+				value = _mm_add_epi32(value, _mm_andnot_si128(_mm_srli_epi32(value, 15), inexact));
+			else if(R == std::round_toward_neg_infinity)
+				value = _mm_add_epi32(value, _mm_and_si128(_mm_srli_epi32(value, 15), inexact));
+			__m128i big = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x477FFFFF)), inf = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F7FFFFF));
+			__m128i nan = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000)), sign1 = _mm_srli_epi32(sign, 15), special = 
+				(R==std::round_toward_infinity) ? _mm_sub_epi32(_mm_add_epi32(sign, _mm_set1_epi32(0x7C00)), sign1) :
+				(R==std::round_toward_neg_infinity) ? _mm_add_epi32(_mm_add_epi32(sign, _mm_set1_epi32(0x7BFF)), sign1) :
+				(R==std::round_toward_zero) ? _mm_or_si128(sign, _mm_set1_epi32(0x7BFF)) : _mm_or_si128(sign, _mm_set1_epi32(0x7C00));
+			special = select_sse2(inf, _mm_or_si128(_mm_or_si128(sign, _mm_set1_epi32(0x7C00)), _mm_and_si128(nan, 
+				_mm_or_si128(_mm_set1_epi32(0x200), _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(0x3FF))))), special);
+		#if HALF_ERRHANDLING
+			__m128i rexp = _mm_and_si128(value, _mm_set1_epi32(0x7C00)), max = _mm_cmpeq_epi32(rexp, _mm_set1_epi32(0x7C00));
+			__m128i subn = _mm_andnot_si128(_mm_cmpeq_epi32(abs, zero), _mm_cmpeq_epi32(rexp, zero));
+			flags = _mm_or_si128(flags, _mm_and_si128(_mm_set1_epi32(FE_OVERFLOW), 
+				_mm_or_si128(_mm_andnot_si128(inf, big), _mm_andnot_si128(big, max))));
+			flags = _mm_or_si128(flags, _mm_and_si128(_mm_set1_epi32(FE_INEXACT), 
+				_mm_andnot_si128(_mm_or_si128(_mm_or_si128(big, max), _mm_or_si128(exact, subn)), _mm_set1_epi32(-1))));
+			flags = _mm_or_si128(flags, _mm_and_si128(_mm_set1_epi32(FE_UNDERFLOW), _mm_andnot_si128(big, 
+			#if HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT
+				_mm_andnot_si128(exact, subn))));
+			#else
+				subn)));
+			#endif
+		#endif
+			return select_sse2(big, special, value);
+		}
+
+		/// Convert array of IEEE single-precision to half-precision using SSE2.
+		/// This converts all values with integer operations, accumulating any exceptions and raising them once at the end.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P> HALF_TARGET_SSE2 void float2half_sse2(const float *src, uint16 *dst, std::size_t n)
+		{
+			__m128i flags = _mm_setzero_si128();
+			float in[8] = { 0.0f };
+			uint16 out[8];
+			for(std::size_t i=0; i<n; i+=8)
 			{
-				if(r < m+bit)
-					m >>= 1;
-				else
+				const float *a = src + i;
+				uint16 *b = dst + i;
+				if(n-i < 8)
 				{
-					r -= m + bit;
-					m = (m>>1) + bit;
+					std::memcpy(in, a, (n-i)*sizeof(float));
+					a = in;
+					b = out;
 				}
+				__m128i lo = float2half_sse2<R>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a)), flags);
+				__m128i hi = float2half_sse2<R>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a+4)), flags);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(b), policy_sse2<P>(_mm_packs_epi32(
+					_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16))));
+				if(b == out)
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
 			}
-			return m;
+		#if HALF_ERRHANDLING
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0x4E));
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0xB1));
+			raise(_mm_cvtsi128_si32(flags), _mm_cvtsi128_si32(flags)!=0);
+		#endif
 		}
 
-		/// Fixed point binary exponential.
-		/// This uses the BKM algorithm in E-mode.
-		/// \param m exponent in [0,1) as Q0.31
-		/// \param n number of iterations (at most 32)
-		/// \return 2 ^ \a m as Q1.31
-		inline uint32 exp2(uint32 m, unsigned int n = 32)
+		/// Narrow four IEEE double-precision values to single-precision using SSE2.
+		/// The values are rounded to odd, i.e. truncated with any discarded bits collected in the least significant bit. Values too 
+		/// large or too small for single-precision are clamped to its largest or smallest normal value, with zero staying zero. 
+		/// Since this keeps more than two extra bits, rounding the result to half-precision gives the same result and exceptions as 
+		/// rounding the original value directly.
+		/// \param a first two double-precision values as integers
+		/// \param b last two double-precision values as integers
+		/// \return single-precision values as integers
+		HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i double2float_sse2(__m128i a, __m128i b)
 		{
-			static const uint32 logs[] = {
-				0x80000000, 0x4AE00D1D, 0x2934F098, 0x15C01A3A, 0x0B31FB7D, 0x05AEB4DD, 0x02DCF2D1, 0x016FE50B,
-				0x00B84E23, 0x005C3E10, 0x002E24CA, 0x001713D6, 0x000B8A47, 0x0005C53B, 0x0002E2A3, 0x00017153,
-				0x0000B8AA, 0x00005C55, 0x00002E2B, 0x00001715, 0x00000B8B, 0x000005C5, 0x000002E3, 0x00000171,
-				0x000000B9, 0x0000005C, 0x0000002E, 0x00000017, 0x0000000C, 0x00000006, 0x00000003, 0x00000001 };
-			if(!m)
-				return 0x80000000;
-			uint32 mx = 0x80000000, my = 0;
-			for(unsigned int i=1; i<n; ++i)
+			const __m128i zero = _mm_setzero_si128();
+			__m128i hi = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), 0xDD));
+			__m128i lo = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b), 0x88));
+			__m128i abs = _mm_and_si128(hi, _mm_set1_epi32(0x7FFFFFFF)), inf = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7FEFFFFF));
+			__m128i bias = select_sse2(inf, _mm_set1_epi32(0x70000000), _mm_set1_epi32(0x38000000));
+			__m128i f = _mm_or_si128(_mm_slli_epi32(_mm_sub_epi32(abs, bias), 3), _mm_srli_epi32(lo, 29));
+			f = _mm_or_si128(f, _mm_andnot_si128(_mm_cmpeq_epi32(_mm_slli_epi32(lo, 3), zero), _mm_set1_epi32(1)));
+			f = select_sse2(_mm_andnot_si128(inf, _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47EFFFFF))), _mm_set1_epi32(0x7F7FFFFF), f);
+			f = select_sse2(_mm_cmpgt_epi32(_mm_set1_epi32(0x38100000), abs), 
+				_mm_andnot_si128(_mm_cmpeq_epi32(_mm_or_si128(abs, lo), zero), _mm_set1_epi32(0x800000)), f);
+			return _mm_or_si128(f, _mm_and_si128(hi, _mm_set1_epi32(0x80000000)));
+		}
+
+		/// Convert array of IEEE double-precision to half-precision using SSE2.
+		/// This converts all values with integer operations, accumulating any exceptions and raising them once at the end.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \param src double-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P> HALF_TARGET_SSE2 void float2half_sse2(const double *src, uint16 *dst, std::size_t n)
+		{
+			__m128i flags = _mm_setzero_si128();
+			double in[8] = { 0.0 };
+			uint16 out[8];
+			for(std::size_t i=0; i<n; i+=8)
 			{
-				uint32 mz = my + logs[i];
-				if(mz <= m)
+				const double *a = src + i;
+				uint16 *b = dst + i;
+				if(n-i < 8)
 				{
-					my = mz;
-					mx += mx >> i;
+					std::memcpy(in, a, (n-i)*sizeof(double));
+					a = in;
+					b = out;
 				}
+				__m128i lo = float2half_sse2<R>(double2float_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a)), 
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(a+2))), flags);
+				__m128i hi = float2half_sse2<R>(double2float_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a+4)), 
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(a+6))), flags);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(b), policy_sse2<P>(_mm_packs_epi32(
+					_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16))));
+				if(b == out)
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
 			}
-			return mx;
+		#if HALF_ERRHANDLING
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0x4E));
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0xB1));
+			raise(_mm_cvtsi128_si32(flags), _mm_cvtsi128_si32(flags)!=0);
+		#endif
 		}
 
-		/// Fixed point binary logarithm.
-		/// This uses the BKM algorithm in L-mode.
-		/// \param m mantissa in [1,2) as Q1.30
-		/// \param n number of iterations (at most 32)
-		/// \return log2(\a m) as Q0.31
-		inline uint32 log2(uint32 m, unsigned int n = 32)
+		/// Convert four half-precision values to IEEE single-precision using SSE2.
+		/// Subnormal values are normalized by a floating-point subtraction, which is always exact.
+		/// \param h half-precision values in lower 16 bits of each 32-bit lane
+		/// \return single-precision values
+		HALF_TARGET_SSE2 HALF_FORCEINLINE __m128 half2float_sse2(__m128i h)
 		{
-			static const uint32 logs[] = {
-				0x80000000, 0x4AE00D1D, 0x2934F098, 0x15C01A3A, 0x0B31FB7D, 0x05AEB4DD, 0x02DCF2D1, 0x016FE50B,
-				0x00B84E23, 0x005C3E10, 0x002E24CA, 0x001713D6, 0x000B8A47, 0x0005C53B, 0x0002E2A3, 0x00017153,
-				0x0000B8AA, 0x00005C55, 0x00002E2B, 0x00001715, 0x00000B8B, 0x000005C5, 0x000002E3, 0x00000171,
-				0x000000B9, 0x0000005C, 0x0000002E, 0x00000017, 0x0000000C, 0x00000006, 0x00000003, 0x00000001 };
-			if(m == 0x40000000)
-				return 0;
-			uint32 mx = 0x40000000, my = 0;
-			for(unsigned int i=1; i<n; ++i)
+			__m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+			__m128i bits = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13);
+			__m128i exp = _mm_and_si128(bits, _mm_set1_epi32(0x0F800000));
+			bits = _mm_add_epi32(bits, _mm_set1_epi32(0x38000000));
+			bits = _mm_add_epi32(bits, _mm_and_si128(_mm_cmpeq_epi32(exp, _mm_set1_epi32(0x0F800000)), _mm_set1_epi32(0x38000000)));
+			__m128i subn = _mm_cmpeq_epi32(exp, _mm_setzero_si128());
+			__m128i norm = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(0x800000))), 
+				_mm_castsi128_ps(_mm_set1_epi32(0x38800000))));
+			bits = _mm_or_si128(_mm_and_si128(subn, norm), _mm_andnot_si128(subn, bits));
+			return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+		}
+
+		/// Convert array of half-precision to IEEE single-precision using SSE2.
+		/// \param src half-precision values to convert
+		/// \param dst array to store single-precision values at
+		/// \param n number of values to convert
+		HALF_TARGET_SSE2 inline void half2float_sse2(const uint16 *src, float *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
 			{
-				uint32 mz = mx + (mx>>i);
-				if(mz <= m)
-				{
-					mx = mz;
-					my += logs[i];
-				}
+				__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i));
+				_mm_storeu_ps(dst+i, half2float_sse2(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+				_mm_storeu_ps(dst+i+4, half2float_sse2(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
 			}
-			return my;
+			half2float_scalar(src+i, dst+i, n-i);
 		}
 
-		/// Fixed point sine and cosine.
-		/// This uses the CORDIC algorithm in rotation mode.
-		/// \param mz angle in [-pi/2,pi/2] as Q1.30
-		/// \param n number of iterations (at most 31)
-		/// \return sine and cosine of \a mz as Q1.30
-		inline std::pair<uint32,uint32> sincos(uint32 mz, unsigned int n = 31)
+		/// Load four integers using SSE2.
+		/// \tparam T integer type to load (builtin integer type with at most 32 bits)
+		/// \param src integers to load
+		/// \return integers extended to 32 bits, with unsigned values beyond the signed range saturated
+		template<typename T> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i load_int_sse2(const T *src)
 		{
-			static const uint32 angles[] = {
-				0x3243F6A9, 0x1DAC6705, 0x0FADBAFD, 0x07F56EA7, 0x03FEAB77, 0x01FFD55C, 0x00FFFAAB, 0x007FFF55,
-				0x003FFFEB, 0x001FFFFD, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000, 0x00008000,
-				0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100, 0x00000080,
-				0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001 };
-			uint32 mx = 0x26DD3B6A, my = 0;
-			for(unsigned int i=0; i<n; ++i)
+			__m128i v;
+			if(sizeof(T) == 1)
+			{
+				int bits;
+				std::memcpy(&bits, src, sizeof(int));
+				v = _mm_cvtsi32_si128(bits);
+				v = _mm_unpacklo_epi16(_mm_unpacklo_epi8(v, v), _mm_unpacklo_epi8(v, v));
+				return std::numeric_limits<T>::is_signed ? _mm_srai_epi32(v, 24) : _mm_srli_epi32(v, 24);
+			}
+			if(sizeof(T) == 2)
 			{
-				uint32 sign = sign_mask(mz);
-				uint32 tx = mx - (arithmetic_shift(my, i)^sign) + sign;
-				uint32 ty = my + (arithmetic_shift(mx, i)^sign) - sign;
-				mx = tx; my = ty; mz -= (angles[i]^sign) - sign;
+				v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+				v = _mm_unpacklo_epi16(v, v);
+				return std::numeric_limits<T>::is_signed ? _mm_srai_epi32(v, 16) : _mm_srli_epi32(v, 16);
 			}
-			return std::make_pair(my, mx);
+			v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+			return std::numeric_limits<T>::is_signed ? v : select_sse2(_mm_srai_epi32(v, 31), _mm_set1_epi32(0x7FFFFFFF), v);
 		}
 
-		/// Fixed point arc tangent.
-		/// This uses the CORDIC algorithm in vectoring mode.
-		/// \param my y coordinate as Q0.30
-		/// \param mx x coordinate as Q0.30
-		/// \param n number of iterations (at most 31)
-		/// \return arc tangent of \a my / \a mx as Q1.30
-		inline uint32 atan2(uint32 my, uint32 mx, unsigned int n = 31)
+		/// Store eight integers using SSE2.
+		/// \tparam T integer type to store (builtin integer type with at most 32 bits)
+		/// \param dst array to store integers at
+		/// \param a first four integers to truncate to \a T
+		/// \param b last four integers to truncate to \a T
+		template<typename T> HALF_TARGET_SSE2 HALF_FORCEINLINE void store_int_sse2(T *dst, __m128i a, __m128i b)
 		{
-			static const uint32 angles[] = {
-				0x3243F6A9, 0x1DAC6705, 0x0FADBAFD, 0x07F56EA7, 0x03FEAB77, 0x01FFD55C, 0x00FFFAAB, 0x007FFF55,
-				0x003FFFEB, 0x001FFFFD, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000, 0x00008000,
-				0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100, 0x00000080,
-				0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001 };
-			uint32 mz = 0;
-			for(unsigned int i=0; i<n; ++i)
+			if(sizeof(T) == 4)
 			{
-				uint32 sign = sign_mask(my);
-				uint32 tx = mx + (arithmetic_shift(my, i)^sign) - sign;
-				uint32 ty = my - (arithmetic_shift(mx, i)^sign) + sign;
-				mx = tx; my = ty; mz += (angles[i]^sign) - sign;
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), a);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+4), b);
+				return;
 			}
-			return mz;
+			__m128i v = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+			if(sizeof(T) == 2)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+			else
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(_mm_and_si128(v, _mm_set1_epi16(0xFF)), _mm_setzero_si128()));
 		}
 
-		/// Reduce argument for trigonometric functions.
-		/// \param abs half-precision floating-point value
-		/// \param k value to take quarter period
-		/// \return \a abs reduced to [-pi/4,pi/4] as Q0.30
-		inline uint32 angle_arg(unsigned int abs, int &k)
+		/// Convert array of integers to half-precision using SSE2.
+		/// The integers are converted to single-precision first, which is exact for all values not overflowing anyway. This 
+		/// accumulates any exceptions and raises them once at the end.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \tparam T type to convert (builtin integer type with at most 32 bits)
+		/// \param src integral values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P,typename T> HALF_TARGET_SSE2 void int2half_sse2(const T *src, uint16 *dst, std::size_t n)
 		{
-			uint32 m = (abs&0x3FF) | ((abs>0x3FF)<<10);
-			int exp = (abs>>10) + (abs<=0x3FF) - 15;
-			if(abs < 0x3A48)
-				return k = 0, m << (exp+20);
-		#if HALF_ENABLE_CPP11_LONG_LONG
-			unsigned long long y = m * 0xA2F9836E4E442, mask = (1ULL<<(62-exp)) - 1, yi = (y+(mask>>1)) & ~mask, f = y - yi;
-			uint32 sign = -static_cast<uint32>(f>>63);
-			k = static_cast<int>(yi>>(62-exp));
-			return (multiply64(static_cast<uint32>((sign ? -f : f)>>(31-exp)), 0xC90FDAA2)^sign) - sign;
-		#else
-			uint32 yh = m*0xA2F98 + mulhi<std::round_toward_zero>(m, 0x36E4E442), yl = (m*0x36E4E442) & 0xFFFFFFFF;
-			uint32 mask = (static_cast<uint32>(1)<<(30-exp)) - 1, yi = (yh+(mask>>1)) & ~mask, sign = -static_cast<uint32>(yi>yh);
-			k = static_cast<int>(yi>>(30-exp));
-			uint32 fh = (yh^sign) + (yi^~sign) - ~sign, fl = (yl^sign) - sign;
-			return (multiply64((exp>-1) ? (((fh<<(1+exp))&0xFFFFFFFF)|((fl&0xFFFFFFFF)>>(31-exp))) : fh, 0xC90FDAA2)^sign) - sign;
+			__m128i flags = _mm_setzero_si128();
+			T in[8] = { 0 };
+			uint16 out[8];
+			for(std::size_t i=0; i<n; i+=8)
+			{
+				const T *a = src + i;
+				uint16 *b = dst + i;
+				if(n-i < 8)
+				{
+					std::memcpy(in, a, (n-i)*sizeof(T));
+					a = in;
+					b = out;
+				}
+				__m128i lo = float2half_sse2<R>(_mm_castps_si128(_mm_cvtepi32_ps(load_int_sse2(a))), flags);
+				__m128i hi = float2half_sse2<R>(_mm_castps_si128(_mm_cvtepi32_ps(load_int_sse2(a+4))), flags);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(b), policy_sse2<P>(_mm_packs_epi32(
+					_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16))));
+				if(b == out)
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
+			}
+		#if HALF_ERRHANDLING
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0x4E));
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0xB1));
+			raise(_mm_cvtsi128_si32(flags), _mm_cvtsi128_si32(flags)!=0);
 		#endif
 		}
 
-		/// Get arguments for atan2 function.
-		/// \param abs half-precision floating-point value
-		/// \return \a abs and sqrt(1 - \a abs^2) as Q0.30
-		inline std::pair<uint32,uint32> atan2_args(unsigned int abs)
+		/// Convert four single-precision values holding half-precision values to integers using SSE2.
+		/// The values are rounded based on their exactly computed fractional parts, independent from the current rounding mode. 
+		/// The results and exceptions are identical to those of half2int() rounding to even and raising inexact exceptions.
+		/// \tparam R rounding mode to use
+		/// \tparam T type to convert to (builtin integer type with at most 32 bits)
+		/// \param x single-precision values to convert
+		/// \param flags vector to accumulate exception flags in
+		/// \return rounded integral values, to be truncated to \a T
+		template<std::float_round_style R,typename T> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i half2int_sse2(__m128 x, __m128i &HALF_UNUSED_NOERR(flags))
 		{
-			int exp = -15;
-			for(; abs<0x400; abs<<=1,--exp) ;
-			exp += abs >> 10;
-			uint32 my = ((abs&0x3FF)|0x400) << 5, r = my * my;
-			int rexp = 2 * exp;
-			r = 0x40000000 - ((rexp>-31) ? ((r>>-rexp)|((r&((static_cast<uint32>(1)<<-rexp)-1))!=0)) : 1);
-			for(rexp=0; r<0x40000000; r<<=1,--rexp) ;
-			uint32 mx = sqrt<30>(r, rexp);
-			int d = exp - rexp;
-			if(d < 0)
-				return std::make_pair((d<-14) ? ((my>>(-d-14))+((my>>(-d-15))&1)) : (my<<(14+d)), (mx<<14)+(r<<13)/mx);
-			if(d > 0)
-				return std::make_pair(my<<14, (d>14) ? ((mx>>(d-14))+((mx>>(d-15))&1)) : ((d==14) ? mx : ((mx<<(14-d))+(r<<(13-d))/mx)));
-			return std::make_pair(my<<13, (mx<<13)+(r<<12)/mx);
+			const __m128 zero = _mm_setzero_ps(), sign = _mm_set1_ps(-0.0f);
+			__m128 abs = _mm_andnot_ps(sign, x);
+			__m128i i = _mm_cvttps_epi32(x);
+			__m128 f = _mm_sub_ps(x, _mm_cvtepi32_ps(i));
+			if(R == std::round_to_nearest)
+			{
+				__m128 af = _mm_andnot_ps(sign, f), half = _mm_set1_ps(0.5f);
+				__m128i up = _mm_castps_si128(_mm_or_ps(_mm_cmpgt_ps(af, half), 
+					_mm_and_ps(_mm_cmpeq_ps(af, half), _mm_castsi128_ps(_mm_srai_epi32(_mm_slli_epi32(i, 31), 31)))));
+				i = _mm_add_epi32(i, _mm_and_si128(up, _mm_or_si128(_mm_srai_epi32(_mm_castps_si128(f), 31), _mm_set1_epi32(1))));
+			}
+			else if(R == std::round_toward_infinity)
+				i = _mm_sub_epi32(i, _mm_castps_si128(_mm_cmpgt_ps(f, zero)));
+			else if(R == std::round_toward_neg_infinity)
+				i = _mm_add_epi32(i, _mm_castps_si128(_mm_cmplt_ps(f, zero)));
+			__m128i special = _mm_castps_si128(_mm_cmpnle_ps(abs, _mm_set1_ps(65504.0f))), neg = _mm_srai_epi32(_mm_castps_si128(x), 31);
+		#if HALF_ERRHANDLING
+			__m128i range = _mm_or_si128(_mm_cmplt_epi32(i, _mm_set1_epi32(static_cast<int>(std::numeric_limits<T>::min()))), 
+				_mm_cmpgt_epi32(i, _mm_set1_epi32((std::numeric_limits<T>::digits<31) ? 
+				static_cast<int>(std::numeric_limits<T>::max()) : std::numeric_limits<int>::max())));
+			if(!std::numeric_limits<T>::is_signed)
+				range = _mm_or_si128(range, neg);
+			__m128i tiny = _mm_castps_si128(_mm_cmplt_ps(abs, _mm_set1_ps(0.5f)));
+			__m128i invalid = _mm_or_si128(special, _mm_andnot_si128(tiny, range));
+			flags = _mm_or_si128(flags, _mm_and_si128(_mm_set1_epi32(FE_INVALID), invalid));
+			flags = _mm_or_si128(flags, _mm_and_si128(_mm_set1_epi32(FE_INEXACT), 
+				_mm_or_si128(tiny, _mm_andnot_si128(invalid, _mm_castps_si128(_mm_cmpneq_ps(f, zero))))));
+		#endif
+			return select_sse2(special, select_sse2(neg, _mm_set1_epi32(static_cast<int>(std::numeric_limits<T>::min())), 
+				_mm_set1_epi32(static_cast<int>(std::numeric_limits<T>::max()))), i);
 		}
 
-		/// Get exponentials for hyperbolic computation
-		/// \param abs half-precision floating-point value
-		/// \param exp variable to take unbiased exponent of larger result
-		/// \param n number of BKM iterations (at most 32)
-		/// \return exp(abs) and exp(-\a abs) as Q1.31 with same exponent
-		inline std::pair<uint32,uint32> hyperbolic_args(unsigned int abs, int &exp, unsigned int n = 32)
+		/// Convert array of half-precision to integers using SSE2.
+		/// This accumulates any exceptions and raises them once at the end.
+		/// \tparam R rounding mode to use
+		/// \tparam T type to convert to (builtin integer type with at most 32 bits)
+		/// \param src half-precision values to convert
+		/// \param dst array to store integral values at
+		/// \param n number of values to convert
+		/// \exception FE_INVALID if a value is not representable in type \a T
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,typename T> HALF_TARGET_SSE2 void half2int_sse2(const uint16 *src, T *dst, std::size_t n)
 		{
-			uint32 mx = detail::multiply64(static_cast<uint32>((abs&0x3FF)+((abs>0x3FF)<<10))<<21, 0xB8AA3B29), my;
-			int e = (abs>>10) + (abs<=0x3FF);
-			if(e < 14)
-			{
-				exp = 0;
-				mx >>= 14 - e;
-			}
-			else
+			__m128i flags = _mm_setzero_si128();
+			uint16 in[8] = { 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00 };
+			T out[8];
+			for(std::size_t i=0; i<n; i+=8)
 			{
-				exp = mx >> (45-e);
-				mx = (mx<<(e-14)) & 0x7FFFFFFF;
+				const uint16 *a = src + i;
+				T *b = dst + i;
+				if(n-i < 8)
+				{
+					std::memcpy(in, a, (n-i)*sizeof(uint16));
+					a = in;
+					b = out;
+				}
+				__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+				store_int_sse2(b, half2int_sse2<R,T>(half2float_sse2(_mm_unpacklo_epi16(h, _mm_setzero_si128())), flags), 
+					half2int_sse2<R,T>(half2float_sse2(_mm_unpackhi_epi16(h, _mm_setzero_si128())), flags));
+				if(b == out)
+					std::memcpy(dst+i, out, (n-i)*sizeof(T));
 			}
-			mx = exp2(mx, n);
-			int d = exp << 1, s;
-			if(mx > 0x80000000)
+		#if HALF_ERRHANDLING
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0x4E));
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0xB1));
+			raise(_mm_cvtsi128_si32(flags), _mm_cvtsi128_si32(flags)!=0);
+		#endif
+		}
+
+		/// Convert array of half-precision to IEEE double-precision using SSE2.
+		/// \param src half-precision values to convert
+		/// \param dst array to store double-precision values at
+		/// \param n number of values to convert
+		HALF_TARGET_SSE2 inline void half2float_sse2(const uint16 *src, double *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
 			{
-				my = divide64(0x80000000, mx, s);
-				my |= s;
-				++d;
+				__m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i));
+				__m128 lo = half2float_sse2(_mm_unpacklo_epi16(h, _mm_setzero_si128()));
+				__m128 hi = half2float_sse2(_mm_unpackhi_epi16(h, _mm_setzero_si128()));
+				_mm_storeu_pd(dst+i, _mm_cvtps_pd(lo));
+				_mm_storeu_pd(dst+i+2, _mm_cvtps_pd(_mm_movehl_ps(lo, lo)));
+				_mm_storeu_pd(dst+i+4, _mm_cvtps_pd(hi));
+				_mm_storeu_pd(dst+i+6, _mm_cvtps_pd(_mm_movehl_ps(hi, hi)));
 			}
-			else
-				my = mx;
-			return std::make_pair(mx, (d<31) ? ((my>>d)|((my&((static_cast<uint32>(1)<<d)-1))!=0)) : 1);
+			half2float_scalar(src+i, dst+i, n-i);
 		}
 
-		/// Postprocessing for binary exponential.
-		/// \tparam R rounding mode to use
-		/// \param m fractional part of as Q0.31
-		/// \param exp absolute value of unbiased exponent
-		/// \param esign sign of actual exponent
-		/// \param sign sign bit of result
-		/// \param n number of BKM iterations (at most 32)
-		/// \return value converted to half-precision
+		/// Advance four random number generators using SSE2.
+		/// \param s generator states (word-major)
+		/// \return previous outputs of generators
+		HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i random_sse2(__m128i *s)
+		{
+			__m128i r = _mm_add_epi32(s[0], s[3]), t = _mm_slli_epi32(s[1], 9);
+			r = _mm_add_epi32(_mm_or_si128(_mm_slli_epi32(r, 7), _mm_srli_epi32(r, 25)), s[0]);
+			s[2] = _mm_xor_si128(s[2], s[0]);
+			s[3] = _mm_xor_si128(s[3], s[1]);
+			s[1] = _mm_xor_si128(s[1], s[2]);
+			s[0] = _mm_xor_si128(s[0], s[3]);
+			s[2] = _mm_xor_si128(s[2], t);
+			s[3] = _mm_or_si128(_mm_slli_epi32(s[3], 11), _mm_srli_epi32(s[3], 21));
+			return r;
+		}
+
+		/// Convert four IEEE single-precision values to half-precision with stochastic rounding using SSE2.
+		/// This truncates the values like float2half_sse2(__m128i,__m128i&). Values losing all their bits are shifted left by 8 
+		/// bits first, so the upper half of the product holds the discarded bits instead. Those are then added to the random bits, 
+		/// with the carry rounding away from zero. The results and exceptions are identical to those of float2half_stochastic().
+		/// \param fbits single-precision values as integers
+		/// \param rnd random bits for each value
+		/// \param flags vector to accumulate exception flags in
+		/// \return half-precision values in lower 16 bits of each 32-bit lane
+		HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i float2half_stochastic_sse2(__m128i fbits, __m128i rnd, __m128i &HALF_UNUSED_NOERR(flags))
+		{
+			const __m128i zero = _mm_setzero_si128(), lo = _mm_set_epi32(0, -1, 0, -1), msb = _mm_set1_epi32(0x80000000);
+			__m128i sign = _mm_and_si128(_mm_srli_epi32(fbits, 16), _mm_set1_epi32(0x8000));
+			__m128i abs = _mm_and_si128(fbits, _mm_set1_epi32(0x7FFFFFFF)), exp = _mm_srli_epi32(abs, 23);
+			__m128i m = _mm_or_si128(_mm_and_si128(abs, _mm_set1_epi32(0x7FFFFF)), 
+				_mm_andnot_si128(_mm_cmpeq_epi32(exp, zero), _mm_set1_epi32(0x800000)));
+			__m128i far = _mm_cmpgt_epi32(_mm_set1_epi32(94), exp), emin = _mm_set1_epi32(127), emax = _mm_set1_epi32(146);
+			__m128i en = _mm_add_epi32(exp, _mm_set1_epi32(33)), ef = _mm_add_epi32(exp, _mm_set1_epi32(57));
+			en = select_sse2(_mm_cmpgt_epi32(en, emax), emax, en);
+			ef = select_sse2(_mm_cmpgt_epi32(emin, ef), emin, ef);
+			__m128i scale = _mm_cvttps_epi32(_mm_castsi128_ps(_mm_slli_epi32(select_sse2(far, ef, en), 23)));
+			__m128i x = select_sse2(far, _mm_slli_epi32(m, 8), m);
+			__m128i even = _mm_mul_epu32(x, scale), odd = _mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(scale, 32));
+			__m128i mant = _mm_or_si128(_mm_srli_epi64(even, 32), _mm_andnot_si128(lo, odd));
+			__m128i rest = select_sse2(far, mant, _mm_or_si128(_mm_and_si128(lo, even), _mm_slli_epi64(odd, 32)));
+			__m128i value = _mm_add_epi32(_mm_add_epi32(sign, _mm_andnot_si128(far, mant)), _mm_slli_epi32(_mm_and_si128(
+				_mm_sub_epi32(exp, _mm_set1_epi32(113)), _mm_cmpgt_epi32(exp, _mm_set1_epi32(113))), 10));
+			value = _mm_sub_epi32(value, _mm_cmpgt_epi32(_mm_xor_si128(rest, msb), _mm_xor_si128(_mm_add_epi32(rest, rnd), msb)));
+			__m128i big = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x477FFFFF)), special = _mm_or_si128(_mm_or_si128(sign, 
+				_mm_set1_epi32(0x7C00)), _mm_and_si128(_mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000)), 
+				_mm_or_si128(_mm_set1_epi32(0x200), _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(0x3FF)))));
+		#if HALF_ERRHANDLING
+			__m128i exact = select_sse2(far, _mm_cmpeq_epi32(m, zero), _mm_cmpeq_epi32(rest, zero));
+			__m128i inf = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F7FFFFF)), rexp = _mm_and_si128(value, _mm_set1_epi32(0x7C00));
+			__m128i max = _mm_cmpeq_epi32(rexp, _mm_set1_epi32(0x7C00));
+			__m128i subn = _mm_andnot_si128(_mm_cmpeq_epi32(abs, zero), _mm_cmpeq_epi32(rexp, zero));
+			flags = _mm_or_si128(flags, _mm_and_si128(_mm_set1_epi32(FE_OVERFLOW), 
+				_mm_or_si128(_mm_andnot_si128(inf, big), _mm_andnot_si128(big, max))));
+			flags = _mm_or_si128(flags, _mm_and_si128(_mm_set1_epi32(FE_INEXACT), 
+				_mm_andnot_si128(_mm_or_si128(_mm_or_si128(big, max), _mm_or_si128(exact, subn)), _mm_set1_epi32(-1))));
+			flags = _mm_or_si128(flags, _mm_and_si128(_mm_set1_epi32(FE_UNDERFLOW), _mm_andnot_si128(big, 
+			#if HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT
+				_mm_andnot_si128(exact, subn))));
+			#else
+				subn)));
+			#endif
+		#endif
+			return select_sse2(big, special, value);
+		}
+
+		/// Convert array of IEEE single-precision to half-precision with stochastic rounding using SSE2.
+		/// The values are converted one by one until the buffered random numbers are used up. Whole blocks of values are then 
+		/// converted with the generators advanced in registers, accumulating any exceptions and raising them once at the end. 
+		/// This consumes the random numbers in the same order as float2half_stochastic_scalar().
+		/// \tparam P conversion policies to apply
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \param state random number generator to use
 		/// \exception FE_OVERFLOW on overflows
 		/// \exception FE_UNDERFLOW on underflows
-		/// \exception FE_INEXACT if value had to be rounded or \a I is `true`
-		template<std::float_round_style R> unsigned int exp2_post(uint32 m, int exp, bool esign, unsigned int sign = 0, unsigned int n = 32)
+		/// \exception FE_INEXACT if values had to be rounded
+		template<unsigned int P> HALF_TARGET_SSE2 void float2half_stochastic_sse2(const float *src, uint16 *dst, std::size_t n, random_state &state)
 		{
-			if(esign)
+			std::size_t i = (std::min)(n, static_cast<std::size_t>(8-state.pos));
+			float2half_stochastic_scalar<P>(src, dst, i, state);
+			if(n-i >= 8)
 			{
-				exp = -exp - (m!=0);
-				if(exp < -25)
-					return underflow<R>(sign);
-				else if(exp == -25)
-					return rounded<R,false>(sign, 1, m!=0);
+				__m128i flags = _mm_setzero_si128(), s[8];
+				for(unsigned int j=0; j<4; ++j)
+				{
+					s[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state.s[j]));
+					s[j+4] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state.s[j]+4));
+				}
+				for(; n-i>=8; i+=8)
+				{
+					__m128i lo = float2half_stochastic_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i)), random_sse2(s), flags);
+					__m128i hi = float2half_stochastic_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i+4)), random_sse2(s+4), flags);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), policy_sse2<P>(_mm_packs_epi32(
+						_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16))));
+				}
+				for(unsigned int j=0; j<4; ++j)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(state.s[j]), s[j]);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(state.s[j]+4), s[j+4]);
+				}
+			#if HALF_ERRHANDLING
+				flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0x4E));
+				flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0xB1));
+				raise(_mm_cvtsi128_si32(flags), _mm_cvtsi128_si32(flags)!=0);
+			#endif
 			}
-			else if(exp > 15)
-				return overflow<R>(sign);
-			if(!m)
-				return sign | (((exp+=15)>0) ? (exp<<10) : check_underflow(0x200>>-exp));
-			m = exp2(m, n);
-			int s = 0;
-			if(esign)
-				m = divide64(0x80000000, m, s);
-			return fixed2half<R,31,false,false,true>(m, exp+14, sign, s);
+			float2half_stochastic_scalar<P>(src+i, dst+i, n-i, state);
 		}
 
-		/// Postprocessing for binary logarithm.
+		/// Convert large array with non-temporal stores using SSE2.
+		/// The values are converted by the kernel in blocks of 8 KiB into a buffer in the L1 cache, which is then written to the 
+		/// destination bypassing the caches. The source is read sequentially, so it is left to the hardware prefetcher.
+		/// \tparam F kernel type
+		/// \tparam S source type
+		/// \tparam D destination type
+		/// \param kernel kernel to convert blocks of values with
+		/// \param src values to convert
+		/// \param dst array to store converted values at
+		/// \param n number of values to convert
+		template<typename F,typename S,typename D> HALF_TARGET_SSE2 void stream_sse2(F kernel, const S *src, D *dst, std::size_t n)
+		{
+			__m128i buf[512];
+			const std::size_t block = 8192 / sizeof(D);
+			std::size_t i = (std::min)(n, ((0-reinterpret_cast<std::size_t>(dst))&15)/sizeof(D));
+			kernel(src, dst, i);
+			for(; i<n; i+=block)
+			{
+				std::size_t m = (std::min)(n-i, block), bytes = m * sizeof(D);
+				kernel(src+i, reinterpret_cast<D*>(buf), m);
+				__m128i *out = reinterpret_cast<__m128i*>(dst+i);
+				for(std::size_t j=0; j<bytes/16; ++j)
+					_mm_stream_si128(out+j, buf[j]);
+				std::memcpy(out+bytes/16, buf+bytes/16, bytes%16);
+			}
+			_mm_sfence();
+		}
+	#endif
+
+	#if HALF_SIMD_AVX2 || HALF_SIMD_AVX512
+		/// Apply conversion policies to sixteen half-precision values using AVX2.
+		/// \tparam P [conversion policies](\ref half_float::conversion_policy) to apply
+		/// \param h half-precision values as rounded
+		/// \return half-precision values with policies applied
+		template<unsigned int P> HALF_TARGET_AVX2 HALF_FORCEINLINE __m256i policy_avx2(__m256i h)
+		{
+			__m256i abs = _mm256_and_si256(h, _mm256_set1_epi16(0x7FFF));
+			if(P & policy_scrub_nan)
+				h = _mm256_andnot_si256(_mm256_cmpgt_epi16(abs, _mm256_set1_epi16(0x7C00)), h);
+			if(P & policy_saturate)
+				h = _mm256_add_epi16(h, _mm256_cmpeq_epi16(abs, _mm256_set1_epi16(0x7C00)));
+			if(P & policy_flush_subnormals)
+				h = _mm256_andnot_si256(_mm256_and_si256(_mm256_cmpeq_epi16(_mm256_and_si256(h, _mm256_set1_epi16(0x7C00)), 
+					_mm256_setzero_si256()), _mm256_set1_epi16(0x7FFF)), h);
+			return h;
+		}
+	#endif
+
+	#if HALF_SIMD_AVX2
+		/// Convert eight IEEE single-precision values to half-precision using AVX2.
+		/// This is the AVX2 version of float2half_sse2(__m128i,__m128i&) using variable shifts, with identical results and exceptions.
 		/// \tparam R rounding mode to use
-		/// \tparam L logarithm for base transformation as Q1.31
-		/// \param m fractional part of logarithm as Q0.31
-		/// \param ilog signed integer part of logarithm
-		/// \param exp biased exponent of result
-		/// \param sign sign bit of result
-		/// \return value base-transformed and converted to half-precision
-		/// \exception FE_OVERFLOW on overflows
-		/// \exception FE_UNDERFLOW on underflows
-		/// \exception FE_INEXACT if no other exception occurred
-		template<std::float_round_style R,uint32 L> unsigned int log2_post(uint32 m, int ilog, int exp, unsigned int sign = 0)
+		/// \param fbits single-precision values as integers
+		/// \param flags vector to accumulate exception flags in
+		/// \return half-precision values in lower 16 bits of each 32-bit lane
+		template<std::float_round_style R> HALF_TARGET_AVX2 HALF_FORCEINLINE __m256i float2half_avx2(__m256i fbits, __m256i &HALF_UNUSED_NOERR(flags))
 		{
-			uint32 msign = sign_mask(ilog);
-			m = (((static_cast<uint32>(ilog)<<27)+(m>>4))^msign) - msign;
-			if(!m)
-				return 0;
-			for(; m<0x80000000; m<<=1,--exp) ;
-			int i = m >= L, s;
-			exp += i;
-			m >>= 1 + i;
-			sign ^= msign & 0x8000;
-			if(exp < -11)
-				return underflow<R>(sign);
-			m = divide64(m, L, s);
-			return fixed2half<R,30,false,false,true>(m, exp, sign, 1);
+			const __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi32(1);
+			__m256i sign = _mm256_and_si256(_mm256_srli_epi32(fbits, 16), _mm256_set1_epi32(0x8000));
+			__m256i abs = _mm256_and_si256(fbits, _mm256_set1_epi32(0x7FFFFFFF)), exp = _mm256_srli_epi32(abs, 23);
+			__m256i m = _mm256_or_si256(_mm256_and_si256(abs, _mm256_set1_epi32(0x7FFFFF)), 
+				_mm256_andnot_si256(_mm256_cmpeq_epi32(exp, zero), _mm256_set1_epi32(0x800000)));
+			__m256i i = _mm256_max_epi32(_mm256_min_epi32(_mm256_sub_epi32(_mm256_set1_epi32(126), exp), 
+				_mm256_set1_epi32(25)), _mm256_set1_epi32(13));
+			__m256i rest = _mm256_sllv_epi32(m, _mm256_sub_epi32(_mm256_set1_epi32(32), i));
+			__m256i value = _mm256_add_epi32(_mm256_add_epi32(sign, _mm256_srlv_epi32(m, i)), 
+				_mm256_slli_epi32(_mm256_max_epi32(_mm256_sub_epi32(exp, _mm256_set1_epi32(113)), zero), 10));
+			__m256i exact = _mm256_cmpeq_epi32(rest, zero), inexact = _mm256_andnot_si256(exact, one);
+			if(R == std::round_to_nearest)
+				value = _mm256_add_epi32(value, _mm256_and_si256(_mm256_srli_epi32(rest, 31), 
+					_mm256_or_si256(_mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_slli_epi32(rest, 1), zero), one), value)));
+			else if(R == std::round_toward_infinity)
+				value = _mm256_add_epi32(value, _mm256_andnot_si256(_mm256_srli_epi32(value, 15), inexact));
+			else if(R == std::round_toward_neg_infinity)
+				value = _mm256_add_epi32(value, _mm256_and_si256(_mm256_srli_epi32(value, 15), inexact));
+			__m256i big = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x477FFFFF)), inf = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x7F7FFFFF));
+			__m256i nan = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x7F800000)), sign1 = _mm256_srli_epi32(sign, 15), special = 
+				(R==std::round_toward_infinity) ? _mm256_sub_epi32(_mm256_add_epi32(sign, _mm256_set1_epi32(0x7C00)), sign1) :
+				(R==std::round_toward_neg_infinity) ? _mm256_add_epi32(_mm256_add_epi32(sign, _mm256_set1_epi32(0x7BFF)), sign1) :
+				(R==std::round_toward_zero) ? _mm256_or_si256(sign, _mm256_set1_epi32(0x7BFF)) : _mm256_or_si256(sign, _mm256_set1_epi32(0x7C00));
+			special = _mm256_blendv_epi8(special, _mm256_or_si256(_mm256_or_si256(sign, _mm256_set1_epi32(0x7C00)), _mm256_and_si256(nan, 
+				_mm256_or_si256(_mm256_set1_epi32(0x200), _mm256_and_si256(_mm256_srli_epi32(abs, 13), _mm256_set1_epi32(0x3FF))))), inf);
+		#if HALF_ERRHANDLING
+			__m256i rexp = _mm256_and_si256(value, _mm256_set1_epi32(0x7C00)), max = _mm256_cmpeq_epi32(rexp, _mm256_set1_epi32(0x7C00));
+			__m256i subn = _mm256_andnot_si256(_mm256_cmpeq_epi32(abs, zero), _mm256_cmpeq_epi32(rexp, zero));
+			flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_set1_epi32(FE_OVERFLOW), 
+				_mm256_or_si256(_mm256_andnot_si256(inf, big), _mm256_andnot_si256(big, max))));
+			flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_set1_epi32(FE_INEXACT), 
+				_mm256_andnot_si256(_mm256_or_si256(_mm256_or_si256(big, max), _mm256_or_si256(exact, subn)), _mm256_set1_epi32(-1))));
+			flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_set1_epi32(FE_UNDERFLOW), _mm256_andnot_si256(big, 
+			#if HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT
+				_mm256_andnot_si256(exact, subn))));
+			#else
+				subn)));
+			#endif
+		#endif
+			return _mm256_blendv_epi8(value, special, big);
 		}
 
-		/// Hypotenuse square root and postprocessing.
+		/// Convert array of IEEE single-precision to half-precision using AVX2.
+		/// This converts all values with integer operations, accumulating any exceptions and raising them once at the end.
 		/// \tparam R rounding mode to use
-		/// \param r mantissa as Q2.30
-		/// \param exp biased exponent
-		/// \return square root converted to half-precision
+		/// \tparam P conversion policies to apply
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
 		/// \exception FE_OVERFLOW on overflows
 		/// \exception FE_UNDERFLOW on underflows
-		/// \exception FE_INEXACT if value had to be rounded
-		template<std::float_round_style R> unsigned int hypot_post(uint32 r, int exp)
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P> HALF_TARGET_AVX2 void float2half_avx2(const float *src, uint16 *dst, std::size_t n)
 		{
-			int i = r >> 31;
-			if((exp+=i) > 46)
-				return overflow<R>();
-			if(exp < -34)
-				return underflow<R>();
-			r = (r>>i) | (r&i);
-			uint32 m = sqrt<30>(r, exp+=15);
-			return fixed2half<R,15,false,false,false>(m, exp-1, 0, r!=0);
+			__m256i flags = _mm256_setzero_si256();
+			float in[16] = { 0.0f };
+			uint16 out[16];
+			for(std::size_t i=0; i<n; i+=16)
+			{
+				const float *a = src + i;
+				uint16 *b = dst + i;
+				if(n-i < 16)
+				{
+					std::memcpy(in, a, (n-i)*sizeof(float));
+					a = in;
+					b = out;
+				}
+				__m256i lo = float2half_avx2<R>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a)), flags);
+				__m256i hi = float2half_avx2<R>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a+8)), flags);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(b), policy_avx2<P>(_mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8)));
+				if(b == out)
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
+			}
+		#if HALF_ERRHANDLING
+			__m128i flags4 = _mm_or_si128(_mm256_castsi256_si128(flags), _mm256_extracti128_si256(flags, 1));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0x4E));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0xB1));
+			raise(_mm_cvtsi128_si32(flags4), _mm_cvtsi128_si32(flags4)!=0);
+		#endif
 		}
 
-		/// Division and postprocessing for tangents.
+		/// Convert array of IEEE single-precision to half-precision using F16C.
 		/// \tparam R rounding mode to use
-		/// \param my dividend as Q1.31
-		/// \param mx divisor as Q1.31
-		/// \param exp biased exponent of result
-		/// \param sign sign bit of result
-		/// \return quotient converted to half-precision
-		/// \exception FE_OVERFLOW on overflows
-		/// \exception FE_UNDERFLOW on underflows
-		/// \exception FE_INEXACT if no other exception occurred
-		template<std::float_round_style R> unsigned int tangent_post(uint32 my, uint32 mx, int exp, unsigned int sign = 0)
+		/// \tparam P conversion policies to apply
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		template<std::float_round_style R,unsigned int P> HALF_TARGET_AVX2 void float2half_f16c(const float *src, uint16 *dst, std::size_t n)
 		{
-			int i = my >= mx, s;
-			exp += i;
-			if(exp > 29)
-				return overflow<R>(sign);
-			if(exp < -11)
-				return underflow<R>(sign);
-			uint32 m = divide64(my>>(i+1), mx, s);
-			return fixed2half<R,30,false,false,true>(m, exp, sign, s);
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), policy_sse2<P>(_mm256_cvtps_ph(_mm256_loadu_ps(src+i), f16c_rounding<R>::value)));
+			float2half_scalar<R,P>(src+i, dst+i, n-i);
 		}
 
-		/// Area function and postprocessing.
-		/// This computes the value directly in Q2.30 using the representation `asinh|acosh(x) = log(x+sqrt(x^2+|-1))`.
+		/// Narrow eight IEEE double-precision values to single-precision using AVX2.
+		/// This is the AVX2 version of double2float_sse2() with identical results.
+		/// \param a first four double-precision values as integers
+		/// \param b last four double-precision values as integers
+		/// \return single-precision values as integers
+		HALF_TARGET_AVX2 HALF_FORCEINLINE __m256i double2float_avx2(__m256i a, __m256i b)
+		{
+			const __m256i zero = _mm256_setzero_si256();
+			__m256i hi = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(
+				_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), 0xDD)), 0xD8);
+			__m256i lo = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(
+				_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), 0x88)), 0xD8);
+			__m256i abs = _mm256_and_si256(hi, _mm256_set1_epi32(0x7FFFFFFF)), inf = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x7FEFFFFF));
+			__m256i bias = _mm256_blendv_epi8(_mm256_set1_epi32(0x38000000), _mm256_set1_epi32(0x70000000), inf);
+			__m256i f = _mm256_or_si256(_mm256_slli_epi32(_mm256_sub_epi32(abs, bias), 3), _mm256_srli_epi32(lo, 29));
+			f = _mm256_or_si256(f, _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_slli_epi32(lo, 3), zero), _mm256_set1_epi32(1)));
+			f = _mm256_blendv_epi8(f, _mm256_set1_epi32(0x7F7FFFFF), 
+				_mm256_andnot_si256(inf, _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x47EFFFFF))));
+			f = _mm256_blendv_epi8(f, _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_or_si256(abs, lo), zero), 
+				_mm256_set1_epi32(0x800000)), _mm256_cmpgt_epi32(_mm256_set1_epi32(0x38100000), abs));
+			return _mm256_or_si256(f, _mm256_and_si256(hi, _mm256_set1_epi32(0x80000000)));
+		}
+
+		/// Convert array of IEEE double-precision to half-precision using AVX2.
+		/// This converts all values with integer operations, accumulating any exceptions and raising them once at the end.
 		/// \tparam R rounding mode to use
-		/// \tparam S `true` for asinh, `false` for acosh
-		/// \param arg half-precision argument
-		/// \return asinh|acosh(\a arg) converted to half-precision
+		/// \tparam P conversion policies to apply
+		/// \param src double-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
 		/// \exception FE_OVERFLOW on overflows
 		/// \exception FE_UNDERFLOW on underflows
-		/// \exception FE_INEXACT if no other exception occurred
-		template<std::float_round_style R,bool S> unsigned int area(unsigned int arg)
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P> HALF_TARGET_AVX2 void float2half_avx2(const double *src, uint16 *dst, std::size_t n)
 		{
-			int abs = arg & 0x7FFF, expx = (abs>>10) + (abs<=0x3FF) - 15, expy = -15, ilog, i;
-			uint32 mx = static_cast<uint32>((abs&0x3FF)|((abs>0x3FF)<<10)) << 20, my, r;
-			for(; abs<0x400; abs<<=1,--expy) ;
-			expy += abs >> 10;
-			r = ((abs&0x3FF)|0x400) << 5;
-			r *= r;
-			i = r >> 31;
-			expy = 2*expy + i;
-			r >>= i;
-			if(S)
+			__m256i flags = _mm256_setzero_si256();
+			double in[16] = { 0.0 };
+			uint16 out[16];
+			for(std::size_t i=0; i<n; i+=16)
 			{
-				if(expy < 0)
-				{
-					r = 0x40000000 + ((expy>-30) ? ((r>>-expy)|((r&((static_cast<uint32>(1)<<-expy)-1))!=0)) : 1);
-					expy = 0;
-				}
-				else
+				const double *a = src + i;
+				uint16 *b = dst + i;
+				if(n-i < 16)
 				{
-					r += 0x40000000 >> expy;
-					i = r >> 31;
-					r = (r>>i) | (r&i);
-					expy += i;
+					std::memcpy(in, a, (n-i)*sizeof(double));
+					a = in;
+					b = out;
 				}
+				__m256i lo = float2half_avx2<R>(double2float_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a)), 
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a+4))), flags);
+				__m256i hi = float2half_avx2<R>(double2float_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a+8)), 
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a+12))), flags);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(b), policy_avx2<P>(_mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8)));
+				if(b == out)
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
 			}
-			else
+		#if HALF_ERRHANDLING
+			__m128i flags4 = _mm_or_si128(_mm256_castsi256_si128(flags), _mm256_extracti128_si256(flags, 1));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0x4E));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0xB1));
+			raise(_mm_cvtsi128_si32(flags4), _mm_cvtsi128_si32(flags4)!=0);
+		#endif
+		}
+
+		/// Convert array of IEEE double-precision to half-precision using F16C.
+		/// The values are narrowed to single-precision with double2float_avx2() first, which keeps the rounding exact.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \param src double-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		template<std::float_round_style R,unsigned int P> HALF_TARGET_AVX2 void float2half_f16c(const double *src, uint16 *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), policy_sse2<P>(_mm256_cvtps_ph(_mm256_castsi256_ps(double2float_avx2(
+					_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src+i)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src+i+4)))), 
+					f16c_rounding<R>::value)));
+			float2half_scalar<R,P>(src+i, dst+i, n-i);
+		}
+
+		/// Convert array of half-precision to IEEE single-precision using F16C.
+		/// \param src half-precision values to convert
+		/// \param dst array to store single-precision values at
+		/// \param n number of values to convert
+		HALF_TARGET_AVX2 inline void half2float_avx2(const uint16 *src, float *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+				_mm256_storeu_ps(dst+i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i))));
+			half2float_scalar(src+i, dst+i, n-i);
+		}
+
+		/// Load eight integers using AVX2.
+		/// \tparam T integer type to load (builtin integer type with at most 32 bits)
+		/// \param src integers to load
+		/// \return integers extended to 32 bits, with unsigned values beyond the signed range saturated
+		template<typename T> HALF_TARGET_AVX2 HALF_FORCEINLINE __m256i load_int_avx2(const T *src)
+		{
+			if(sizeof(T) == 1)
 			{
-				r -= 0x40000000 >> expy;
-				for(; r<0x40000000; r<<=1,--expy) ;
+				__m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+				return std::numeric_limits<T>::is_signed ? _mm256_cvtepi8_epi32(v) : _mm256_cvtepu8_epi32(v);
 			}
-			my = sqrt<30>(r, expy);
-			my = (my<<15) + (r<<14)/my;
-			if(S)
+			if(sizeof(T) == 2)
 			{
-				mx >>= expy - expx;
-				ilog = expy;
+				__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+				return std::numeric_limits<T>::is_signed ? _mm256_cvtepi16_epi32(v) : _mm256_cvtepu16_epi32(v);
+			}
+			__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+			return std::numeric_limits<T>::is_signed ? v : _mm256_castps_si256(_mm256_blendv_ps(
+				_mm256_castsi256_ps(v), _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF)), _mm256_castsi256_ps(v)));
+		}
+
+		/// Store sixteen integers using AVX2.
+		/// \tparam T integer type to store (builtin integer type with at most 32 bits)
+		/// \param dst array to store integers at
+		/// \param a first eight integers to truncate to \a T
+		/// \param b last eight integers to truncate to \a T
+		template<typename T> HALF_TARGET_AVX2 HALF_FORCEINLINE void store_int_avx2(T *dst, __m256i a, __m256i b)
+		{
+			if(sizeof(T) == 4)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), a);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+8), b);
+				return;
 			}
+			__m256i v = _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16), 
+				_mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16)), 0xD8);
+			if(sizeof(T) == 2)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
 			else
 			{
-				my >>= expx - expy;
-				ilog = expx;
+				v = _mm256_and_si256(v, _mm256_set1_epi16(0xFF));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
 			}
-			my += mx;
-			i = my >> 31;
-			static const int G = S && (R==std::round_to_nearest);
-			return log2_post<R,0xB8AA3B2A>(log2(my>>i, 26+S+G)+(G<<3), ilog+i, 17, arg&(static_cast<unsigned>(S)<<15));
 		}
 
-		/// Class for 1.31 unsigned floating-point computation
-		struct f31
+		/// Convert array of integers to half-precision using AVX2.
+		/// The integers are converted to single-precision first, which is exact for all values not overflowing anyway. These are 
+		/// converted with F16C or, with enabled exception handling, with float2half_avx2(__m256i,__m256i&). Indeterminate rounding 
+		/// truncates like int2half() instead of using the current rounding mode, with integers beyond 16 bits still overflowing to 
+		/// infinity.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \tparam T type to convert (builtin integer type with at most 32 bits)
+		/// \param src integral values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P,typename T> HALF_TARGET_AVX2 void int2half_avx2(const T *src, uint16 *dst, std::size_t n)
 		{
-			/// Constructor.
-			/// \param mant mantissa as 1.31
-			/// \param e exponent
-			HALF_CONSTEXPR f31(uint32 mant, int e) : m(mant), exp(e) {}
-
-			/// Constructor.
-			/// \param abs unsigned half-precision value
-			f31(unsigned int abs) : exp(-15)
+		#if HALF_ERRHANDLING
+			__m256i flags = _mm256_setzero_si256();
+			T in[16] = { 0 };
+			uint16 out[16];
+			for(std::size_t i=0; i<n; i+=16)
 			{
-				for(; abs<0x400; abs<<=1,--exp) ;
-				m = static_cast<uint32>((abs&0x3FF)|0x400) << 21;
-				exp += (abs>>10);
+				const T *a = src + i;
+				uint16 *b = dst + i;
+				if(n-i < 16)
+				{
+					std::memcpy(in, a, (n-i)*sizeof(T));
+					a = in;
+					b = out;
+				}
+				__m256i lo = float2half_avx2<R>(_mm256_castps_si256(_mm256_cvtepi32_ps(load_int_avx2(a))), flags);
+				__m256i hi = float2half_avx2<R>(_mm256_castps_si256(_mm256_cvtepi32_ps(load_int_avx2(a+8))), flags);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(b), policy_avx2<P>(_mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8)));
+				if(b == out)
+					std::memcpy(dst+i, out, (n-i)*sizeof(uint16));
 			}
-
-			/// Addition operator.
-			/// \param a first operand
-			/// \param b second operand
-			/// \return \a a + \a b
-			friend f31 operator+(f31 a, f31 b)
+			__m128i flags4 = _mm_or_si128(_mm256_castsi256_si128(flags), _mm256_extracti128_si256(flags, 1));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0x4E));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0xB1));
+			raise(_mm_cvtsi128_si32(flags4), _mm_cvtsi128_si32(flags4)!=0);
+		#else
+			enum { rounding = (R==std::round_indeterminate) ? _MM_FROUND_TO_ZERO : f16c_rounding<R>::value };
+			const __m256i limit = _mm256_set1_epi32(0xFFFF), neg_limit = _mm256_set1_epi32(-0xFFFF);
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
 			{
-				if(b.exp > a.exp)
-					std::swap(a, b);
-				int d = a.exp - b.exp;
-				uint32 m = a.m + ((d<32) ? (b.m>>d) : 0);
-				int i = (m&0xFFFFFFFF) < a.m;
-				return f31(((m+i)>>i)|0x80000000, a.exp+i);
+				__m256i v = load_int_avx2(src+i);
+				__m128i h = _mm256_cvtps_ph(_mm256_cvtepi32_ps(v), rounding);
+				if(R == std::round_indeterminate)
+				{
+					__m256i over = _mm256_or_si256(_mm256_cmpgt_epi32(v, limit), _mm256_cmpgt_epi32(neg_limit, v));
+					h = _mm_sub_epi16(h, _mm_packs_epi32(_mm256_castsi256_si128(over), _mm256_extracti128_si256(over, 1)));
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), policy_sse2<P>(h));
 			}
+			int2half_scalar<R,P>(src+i, dst+i, n-i);
+		#endif
+		}
 
-			/// Subtraction operator.
-			/// \param a first operand
-			/// \param b second operand
-			/// \return \a a - \a b
-			friend f31 operator-(f31 a, f31 b)
+		/// Convert eight single-precision values holding half-precision values to integers using AVX2.
+		/// This is the AVX2 version of half2int_sse2(__m128,__m128i&) with identical results and exceptions.
+		/// \tparam R rounding mode to use
+		/// \tparam T type to convert to (builtin integer type with at most 32 bits)
+		/// \param x single-precision values to convert
+		/// \param flags vector to accumulate exception flags in
+		/// \return rounded integral values, to be truncated to \a T
+		template<std::float_round_style R,typename T> HALF_TARGET_AVX2 HALF_FORCEINLINE __m256i half2int_avx2(__m256 x, __m256i &HALF_UNUSED_NOERR(flags))
+		{
+			const __m256 zero = _mm256_setzero_ps(), sign = _mm256_set1_ps(-0.0f);
+			__m256 abs = _mm256_andnot_ps(sign, x);
+			__m256i i = _mm256_cvttps_epi32(x);
+			__m256 f = _mm256_sub_ps(x, _mm256_cvtepi32_ps(i));
+			if(R == std::round_to_nearest)
 			{
-				int d = a.exp - b.exp, exp = a.exp;
-				uint32 m = a.m - ((d<32) ? (b.m>>d) : 0);
-				if(!m)
-					return f31(0, -32);
-				for(; m<0x80000000; m<<=1,--exp) ;
-				return f31(m, exp);
+				__m256 af = _mm256_andnot_ps(sign, f), half = _mm256_set1_ps(0.5f);
+				__m256i up = _mm256_castps_si256(_mm256_or_ps(_mm256_cmp_ps(af, half, _CMP_GT_OQ), 
+					_mm256_and_ps(_mm256_cmp_ps(af, half, _CMP_EQ_OQ), _mm256_castsi256_ps(_mm256_slli_epi32(i, 31)))));
+				i = _mm256_add_epi32(i, _mm256_and_si256(_mm256_srai_epi32(up, 31), 
+					_mm256_or_si256(_mm256_srai_epi32(_mm256_castps_si256(f), 31), _mm256_set1_epi32(1))));
 			}
+			else if(R == std::round_toward_infinity)
+				i = _mm256_sub_epi32(i, _mm256_castps_si256(_mm256_cmp_ps(f, zero, _CMP_GT_OQ)));
+			else if(R == std::round_toward_neg_infinity)
+				i = _mm256_add_epi32(i, _mm256_castps_si256(_mm256_cmp_ps(f, zero, _CMP_LT_OQ)));
+			__m256i special = _mm256_castps_si256(_mm256_cmp_ps(abs, _mm256_set1_ps(65504.0f), _CMP_NLE_UQ));
+		#if HALF_ERRHANDLING
+			__m256i range = _mm256_or_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int>(std::numeric_limits<T>::min())), i), 
+				_mm256_cmpgt_epi32(i, _mm256_set1_epi32((std::numeric_limits<T>::digits<31) ? 
+				static_cast<int>(std::numeric_limits<T>::max()) : std::numeric_limits<int>::max())));
+			if(!std::numeric_limits<T>::is_signed)
+				range = _mm256_or_si256(range, _mm256_srai_epi32(_mm256_castps_si256(x), 31));
+			__m256i tiny = _mm256_castps_si256(_mm256_cmp_ps(abs, _mm256_set1_ps(0.5f), _CMP_LT_OQ));
+			__m256i invalid = _mm256_or_si256(special, _mm256_andnot_si256(tiny, range));
+			flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_set1_epi32(FE_INVALID), invalid));
+			flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_set1_epi32(FE_INEXACT), 
+				_mm256_or_si256(tiny, _mm256_andnot_si256(invalid, _mm256_castps_si256(_mm256_cmp_ps(f, zero, _CMP_NEQ_UQ))))));
+		#endif
+			return _mm256_blendv_epi8(i, _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(_mm256_set1_epi32(
+				static_cast<int>(std::numeric_limits<T>::max()))), _mm256_castsi256_ps(_mm256_set1_epi32(
+				static_cast<int>(std::numeric_limits<T>::min()))), x)), special);
+		}
 
-			/// Multiplication operator.
-			/// \param a first operand
-			/// \param b second operand
-			/// \return \a a * \a b
-			friend f31 operator*(f31 a, f31 b)
+		/// Convert array of half-precision to integers using AVX2.
+		/// This accumulates any exceptions and raises them once at the end.
+		/// \tparam R rounding mode to use
+		/// \tparam T type to convert to (builtin integer type with at most 32 bits)
+		/// \param src half-precision values to convert
+		/// \param dst array to store integral values at
+		/// \param n number of values to convert
+		/// \exception FE_INVALID if a value is not representable in type \a T
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,typename T> HALF_TARGET_AVX2 void half2int_avx2(const uint16 *src, T *dst, std::size_t n)
+		{
+			__m256i flags = _mm256_setzero_si256();
+			uint16 in[16] = { 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 
+							  0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00, 0x3C00 };
+			T out[16];
+			for(std::size_t i=0; i<n; i+=16)
 			{
-				uint32 m = multiply64(a.m, b.m);
-				int i = m >> 31;
-				return f31(m<<(1-i), a.exp + b.exp + i);
+				const uint16 *a = src + i;
+				T *b = dst + i;
+				if(n-i < 16)
+				{
+					std::memcpy(in, a, (n-i)*sizeof(uint16));
+					a = in;
+					b = out;
+				}
+				store_int_avx2(b, half2int_avx2<R,T>(_mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a))), flags), 
+					half2int_avx2<R,T>(_mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a+8))), flags));
+				if(b == out)
+					std::memcpy(dst+i, out, (n-i)*sizeof(T));
 			}
+		#if HALF_ERRHANDLING
+			__m128i flags4 = _mm_or_si128(_mm256_castsi256_si128(flags), _mm256_extracti128_si256(flags, 1));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0x4E));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0xB1));
+			raise(_mm_cvtsi128_si32(flags4), _mm_cvtsi128_si32(flags4)!=0);
+		#endif
+		}
 
-			/// Division operator.
-			/// \param a first operand
-			/// \param b second operand
-			/// \return \a a / \a b
-			friend f31 operator/(f31 a, f31 b)
+		/// Convert array of half-precision to IEEE double-precision using F16C.
+		/// \param src half-precision values to convert
+		/// \param dst array to store double-precision values at
+		/// \param n number of values to convert
+		HALF_TARGET_AVX2 inline void half2float_avx2(const uint16 *src, double *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
 			{
-				int i = a.m >= b.m, s;
-				uint32 m = divide64((a.m+i)>>i, b.m, s);
-				return f31(m, a.exp - b.exp + i - 1);
+				__m256 f = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i)));
+				_mm256_storeu_pd(dst+i, _mm256_cvtps_pd(_mm256_castps256_ps128(f)));
+				_mm256_storeu_pd(dst+i+4, _mm256_cvtps_pd(_mm256_extractf128_ps(f, 1)));
 			}
+			half2float_scalar(src+i, dst+i, n-i);
+		}
 
-			uint32 m;			///< mantissa as 1.31.
-			int exp;			///< exponent.
-		};
+		/// Advance eight random number generators using AVX2.
+		/// \param s generator states (word-major)
+		/// \return previous outputs of generators
+		HALF_TARGET_AVX2 HALF_FORCEINLINE __m256i random_avx2(__m256i *s)
+		{
+			__m256i r = _mm256_add_epi32(s[0], s[3]), t = _mm256_slli_epi32(s[1], 9);
+			r = _mm256_add_epi32(_mm256_or_si256(_mm256_slli_epi32(r, 7), _mm256_srli_epi32(r, 25)), s[0]);
+			s[2] = _mm256_xor_si256(s[2], s[0]);
+			s[3] = _mm256_xor_si256(s[3], s[1]);
+			s[1] = _mm256_xor_si256(s[1], s[2]);
+			s[0] = _mm256_xor_si256(s[0], s[3]);
+			s[2] = _mm256_xor_si256(s[2], t);
+			s[3] = _mm256_or_si256(_mm256_slli_epi32(s[3], 11), _mm256_srli_epi32(s[3], 21));
+			return r;
+		}
 
-		/// Error function and postprocessing.
-		/// This computes the value directly in Q1.31 using the approximations given 
-		/// [here](https://en.wikipedia.org/wiki/Error_function#Approximation_with_elementary_functions).
-		/// \tparam R rounding mode to use
-		/// \tparam C `true` for comlementary error function, `false` else
-		/// \param arg half-precision function argument
-		/// \return approximated value of error function in half-precision
-		/// \exception FE_OVERFLOW on overflows
-		/// \exception FE_UNDERFLOW on underflows
-		/// \exception FE_INEXACT if no other exception occurred
-		template<std::float_round_style R,bool C> unsigned int erf(unsigned int arg)
+		/// Convert eight IEEE single-precision values to half-precision with stochastic rounding using AVX2.
+		/// This is the AVX2 version of float2half_stochastic_sse2(__m128i,__m128i,__m128i&) using variable shifts, which already 
+		/// give zero for shift counts out of range, with identical results and exceptions.
+		/// \param fbits single-precision values as integers
+		/// \param rnd random bits for each value
+		/// \param flags vector to accumulate exception flags in
+		/// \return half-precision values in lower 16 bits of each 32-bit lane
+		HALF_TARGET_AVX2 HALF_FORCEINLINE __m256i float2half_stochastic_avx2(__m256i fbits, __m256i rnd, __m256i &HALF_UNUSED_NOERR(flags))
 		{
-			unsigned int abs = arg & 0x7FFF, sign = arg & 0x8000;
-			f31 x(abs), x2 = x * x * f31(0xB8AA3B29, 0), t = f31(0x80000000, 0) / (f31(0x80000000, 0)+f31(0xA7BA054A, -2)*x), t2 = t * t;
-			f31 e = ((f31(0x87DC2213, 0)*t2+f31(0xB5F0E2AE, 0))*t2+f31(0x82790637, -2)-(f31(0xBA00E2B8, 0)*t2+f31(0x91A98E62, -2))*t) * t /
-					((x2.exp<0) ? f31(exp2((x2.exp>-32) ? (x2.m>>-x2.exp) : 0, 30), 0) : f31(exp2((x2.m<<x2.exp)&0x7FFFFFFF, 22), x2.m>>(31-x2.exp)));
-			return (!C || sign) ? fixed2half<R,31,false,true,true>(0x80000000-(e.m>>(C-e.exp)), 14+C, sign&(C-1U)) :
-					(e.exp<-25) ? underflow<R>() : fixed2half<R,30,false,false,true>(e.m>>1, e.exp+14, 0, e.m&1);
+			const __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi32(1), c32 = _mm256_set1_epi32(32);
+			__m256i sign = _mm256_and_si256(_mm256_srli_epi32(fbits, 16), _mm256_set1_epi32(0x8000));
+			__m256i abs = _mm256_and_si256(fbits, _mm256_set1_epi32(0x7FFFFFFF)), exp = _mm256_srli_epi32(abs, 23);
+			__m256i m = _mm256_or_si256(_mm256_and_si256(abs, _mm256_set1_epi32(0x7FFFFF)), 
+				_mm256_andnot_si256(_mm256_cmpeq_epi32(exp, zero), _mm256_set1_epi32(0x800000)));
+			__m256i i = _mm256_max_epi32(_mm256_min_epi32(_mm256_sub_epi32(_mm256_set1_epi32(126), exp), 
+				_mm256_set1_epi32(56)), _mm256_set1_epi32(13));
+			__m256i mant = _mm256_srlv_epi32(m, i);
+			__m256i rest = _mm256_or_si256(_mm256_sllv_epi32(m, _mm256_sub_epi32(c32, i)), _mm256_srlv_epi32(m, _mm256_sub_epi32(i, c32)));
+			__m256i value = _mm256_add_epi32(_mm256_add_epi32(sign, mant), 
+				_mm256_slli_epi32(_mm256_max_epi32(_mm256_sub_epi32(exp, _mm256_set1_epi32(113)), zero), 10));
+			__m256i sum = _mm256_add_epi32(rest, rnd);
+			value = _mm256_add_epi32(value, _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(sum, rest), sum), one));
+			__m256i big = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x477FFFFF)), special = _mm256_or_si256(_mm256_or_si256(sign, 
+				_mm256_set1_epi32(0x7C00)), _mm256_and_si256(_mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x7F800000)), 
+				_mm256_or_si256(_mm256_set1_epi32(0x200), _mm256_and_si256(_mm256_srli_epi32(abs, 13), _mm256_set1_epi32(0x3FF)))));
+		#if HALF_ERRHANDLING
+			__m256i exact = _mm256_cmpeq_epi32(_mm256_sllv_epi32(mant, i), m);
+			__m256i inf = _mm256_cmpgt_epi32(abs, _mm256_set1_epi32(0x7F7FFFFF)), rexp = _mm256_and_si256(value, _mm256_set1_epi32(0x7C00));
+			__m256i max = _mm256_cmpeq_epi32(rexp, _mm256_set1_epi32(0x7C00));
+			__m256i subn = _mm256_andnot_si256(_mm256_cmpeq_epi32(abs, zero), _mm256_cmpeq_epi32(rexp, zero));
+			flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_set1_epi32(FE_OVERFLOW), 
+				_mm256_or_si256(_mm256_andnot_si256(inf, big), _mm256_andnot_si256(big, max))));
+			flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_set1_epi32(FE_INEXACT), 
+				_mm256_andnot_si256(_mm256_or_si256(_mm256_or_si256(big, max), _mm256_or_si256(exact, subn)), _mm256_set1_epi32(-1))));
+			flags = _mm256_or_si256(flags, _mm256_and_si256(_mm256_set1_epi32(FE_UNDERFLOW), _mm256_andnot_si256(big, 
+			#if HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT
+				_mm256_andnot_si256(exact, subn))));
+			#else
+				subn)));
+			#endif
+		#endif
+			return _mm256_blendv_epi8(value, special, big);
 		}
 
-		/// Gamma function and postprocessing.
-		/// This approximates the value of either the gamma function or its logarithm directly in Q1.31.
-		/// \tparam R rounding mode to use
-		/// \tparam L `true` for lograithm of gamma function, `false` for gamma function
-		/// \param arg half-precision floating-point value
-		/// \return lgamma/tgamma(\a arg) in half-precision
+		/// Convert array of IEEE single-precision to half-precision with stochastic rounding using AVX2.
+		/// This works like float2half_stochastic_sse2(const float*,uint16*,std::size_t,random_state&), but advances all 
+		/// generators at once.
+		/// \tparam P conversion policies to apply
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \param state random number generator to use
 		/// \exception FE_OVERFLOW on overflows
 		/// \exception FE_UNDERFLOW on underflows
-		/// \exception FE_INEXACT if \a arg is not a positive integer
-		template<std::float_round_style R,bool L> unsigned int gamma(unsigned int arg)
+		/// \exception FE_INEXACT if values had to be rounded
+		template<unsigned int P> HALF_TARGET_AVX2 void float2half_stochastic_avx2(const float *src, uint16 *dst, std::size_t n, random_state &state)
 		{
-/*			static const double p[] ={ 2.50662827563479526904, 225.525584619175212544, -268.295973841304927459, 80.9030806934622512966, -5.00757863970517583837, 0.0114684895434781459556 };
-			double t = arg + 4.65, s = p[0];
-			for(unsigned int i=0; i<5; ++i)
-				s += p[i+1] / (arg+i);
-			return std::log(s) + (arg-0.5)*std::log(t) - t;
-*/			static const f31 pi(0xC90FDAA2, 1), lbe(0xB8AA3B29, 0);
-			unsigned int abs = arg & 0x7FFF, sign = arg & 0x8000;
-			bool bsign = sign != 0;
-			f31 z(abs), x = sign ? (z+f31(0x80000000, 0)) : z, t = x + f31(0x94CCCCCD, 2), s =
-				f31(0xA06C9901, 1) + f31(0xBBE654E2, -7)/(x+f31(0x80000000, 2)) + f31(0xA1CE6098, 6)/(x+f31(0x80000000, 1))
-				+ f31(0xE1868CB7, 7)/x - f31(0x8625E279, 8)/(x+f31(0x80000000, 0)) - f31(0xA03E158F, 2)/(x+f31(0xC0000000, 1));
-			int i = (s.exp>=2) + (s.exp>=4) + (s.exp>=8) + (s.exp>=16);
-			s = f31((static_cast<uint32>(s.exp)<<(31-i))+(log2(s.m>>1, 28)>>i), i) / lbe;
-			if(x.exp != -1 || x.m != 0x80000000)
-			{
-				i = (t.exp>=2) + (t.exp>=4) + (t.exp>=8);
-				f31 l = f31((static_cast<uint32>(t.exp)<<(31-i))+(log2(t.m>>1, 30)>>i), i) / lbe;
-				s = (x.exp<-1) ? (s-(f31(0x80000000, -1)-x)*l) : (s+(x-f31(0x80000000, -1))*l);
-			}
-			s = x.exp ? (s-t) : (t-s);
-			if(bsign)
-			{
-				if(z.exp >= 0)
-				{
-					sign &= (L|((z.m>>(31-z.exp))&1)) - 1;
-					for(z=f31((z.m<<(1+z.exp))&0xFFFFFFFF, -1); z.m<0x80000000; z.m<<=1,--z.exp) ;
-				}
-				if(z.exp == -1)
-					z = f31(0x80000000, 0) - z;
-				if(z.exp < -1)
-				{
-					z = z * pi;
-					z.m = sincos(z.m>>(1-z.exp), 30).first;
-					for(z.exp=1; z.m<0x80000000; z.m<<=1,--z.exp) ;
-				}
-				else
-					z = f31(0x80000000, 0);
-			}
-			if(L)
+			std::size_t i = (std::min)(n, static_cast<std::size_t>(8-state.pos));
+			float2half_stochastic_scalar<P>(src, dst, i, state);
+			if(n-i >= 8)
 			{
-				if(bsign)
-				{
-					f31 l(0x92868247, 0);
-					if(z.exp < 0)
-					{
-						uint32 m = log2((z.m+1)>>1, 27);
-						z = f31(-((static_cast<uint32>(z.exp)<<26)+(m>>5)), 5);
-						for(; z.m<0x80000000; z.m<<=1,--z.exp) ;
-						l = l + z / lbe;
-					}
-					sign = static_cast<unsigned>(x.exp&&(l.exp<s.exp||(l.exp==s.exp&&l.m<s.m))) << 15;
-					s = sign ? (s-l) : x.exp ? (l-s) : (l+s);
-				}
-				else
+				__m256i flags = _mm256_setzero_si256(), s[4];
+				for(unsigned int j=0; j<4; ++j)
+					s[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state.s[j]));
+				for(; n-i>=8; i+=8)
 				{
-					sign = static_cast<unsigned>(x.exp==0) << 15;
-					if(s.exp < -24)
-						return underflow<R>(sign);
-					if(s.exp > 15)
-						return overflow<R>(sign);
+					__m256i h = float2half_stochastic_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src+i)), random_avx2(s), flags);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), policy_sse2<P>(_mm_packus_epi32(
+						_mm256_castsi256_si128(h), _mm256_extracti128_si256(h, 1))));
 				}
+				for(unsigned int j=0; j<4; ++j)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(state.s[j]), s[j]);
+			#if HALF_ERRHANDLING
+				__m128i flags4 = _mm_or_si128(_mm256_castsi256_si128(flags), _mm256_extracti128_si256(flags, 1));
+				flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0x4E));
+				flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0xB1));
+				raise(_mm_cvtsi128_si32(flags4), _mm_cvtsi128_si32(flags4)!=0);
+			#endif
 			}
-			else
+			float2half_stochastic_scalar<P>(src+i, dst+i, n-i, state);
+		}
+	#endif
+
+	#if HALF_SIMD_AVX512
+		/// Convert array of IEEE single-precision to half-precision using AVX-512.
+		/// The AVX-512 kernels use the zero-masking forms of intrinsics, whose unmasked forms pass undefined vectors through, 
+		/// which triggers uninitialized-value warnings with GCC.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		template<std::float_round_style R,unsigned int P> HALF_TARGET_AVX512 void float2half_avx512(const float *src, uint16 *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+16<=n; i+=16)
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+i), policy_avx2<P>(_mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(src+i), 
+					f16c_rounding<R>::value)));
+			float2half_scalar<R,P>(src+i, dst+i, n-i);
+		}
+
+		/// Narrow eight IEEE double-precision values to single-precision using AVX-512.
+		/// This is the 64-bit integer version of double2float_sse2() with identical results.
+		/// \param bits double-precision values as integers
+		/// \return single-precision values as integers
+		HALF_TARGET_AVX512 HALF_FORCEINLINE __m256i double2float_avx512(__m512i bits)
+		{
+			__m512i abs = _mm512_maskz_srli_epi64(0xFF, _mm512_maskz_slli_epi64(0xFF, bits, 1), 1), g = _mm512_maskz_srli_epi64(0xFF, abs, 29);
+			g = _mm512_mask_or_epi64(g, _mm512_test_epi64_mask(bits, _mm512_set1_epi64(0x1FFFFFFF)), g, _mm512_set1_epi64(1));
+			__m512i f = _mm512_maskz_min_epi64(0xFF, _mm512_sub_epi64(g, _mm512_maskz_slli_epi64(0xFF, _mm512_set1_epi64(0x380), 23)), 
+				_mm512_set1_epi64(0x7F7FFFFF));
+			f = _mm512_mask_mov_epi64(f, _mm512_cmplt_epi64_mask(f, _mm512_set1_epi64(0x800000)), 
+				_mm512_maskz_mov_epi64(_mm512_test_epi64_mask(abs, abs), _mm512_set1_epi64(0x800000)));
+			f = _mm512_mask_sub_epi64(f, _mm512_cmpeq_epi64_mask(_mm512_maskz_srli_epi64(0xFF, abs, 52), _mm512_set1_epi64(0x7FF)), 
+				g, _mm512_maskz_slli_epi64(0xFF, _mm512_set1_epi64(0x700), 23));
+			return _mm512_maskz_cvtepi64_epi32(0xFF, _mm512_or_si512(f, _mm512_and_si512(_mm512_maskz_srli_epi64(0xFF, bits, 32), 
+				_mm512_set1_epi64(0x80000000))));
+		}
+
+		/// Convert array of IEEE double-precision to half-precision using AVX-512.
+		/// The values are narrowed to single-precision with double2float_avx512() first, which keeps the rounding exact.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \param src double-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		template<std::float_round_style R,unsigned int P> HALF_TARGET_AVX512 void float2half_avx512(const double *src, uint16 *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+16<=n; i+=16)
 			{
-				s = s * lbe;
-				uint32 m;
-				if(s.exp < 0)
-				{
-					m = s.m >> -s.exp;
-					s.exp = 0;
-				}
-				else
-				{
-					m = (s.m<<s.exp) & 0x7FFFFFFF;
-					s.exp = (s.m>>(31-s.exp));
-				}
-				s.m = exp2(m, 27);
-				if(!x.exp)
-					s = f31(0x80000000, 0) / s;
-				if(bsign)
-				{
-					if(z.exp < 0)
-						s = s * z;
-					s = pi / s;
-					if(s.exp < -24)
-						return underflow<R>(sign);
-				}
-				else if(z.exp > 0 && !(z.m&((1<<(31-z.exp))-1)))
-					return ((s.exp+14)<<10) + (s.m>>21);
-				if(s.exp > 15)
-					return overflow<R>(sign);
+				__m256i lo = double2float_avx512(_mm512_loadu_si512(src+i)), hi = double2float_avx512(_mm512_loadu_si512(src+i+8));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+i), policy_avx2<P>(_mm512_maskz_cvtps_ph(0xFFFF, _mm512_castsi512_ps(
+					_mm512_maskz_inserti64x4(0xFF, _mm512_castsi256_si512(lo), hi, 1)), f16c_rounding<R>::value)));
 			}
-			return fixed2half<R,31,false,false,true>(s.m, s.exp+14, sign);
+			float2half_scalar<R,P>(src+i, dst+i, n-i);
 		}
-		/// \}
-
-		template<typename,typename,std::float_round_style> struct half_caster;
-	}
 
-	/// Half-precision floating-point type.
-	/// This class implements an IEEE-conformant half-precision floating-point type with the usual arithmetic 
-	/// operators and conversions. It is implicitly convertible to single-precision floating-point, which makes artihmetic 
-	/// expressions and functions with mixed-type operands to be of the most precise operand type.
-	///
-	/// According to the C++98/03 definition, the half type is not a POD type. But according to C++11's less strict and 
-	/// extended definitions it is both a standard layout type and a trivially copyable type (even if not a POD type), which 
-	/// means it can be standard-conformantly copied using raw binary copies. But in this context some more words about the 
-	/// actual size of the type. Although the half is representing an IEEE 16-bit type, it does not neccessarily have to be of 
-	/// exactly 16-bits size. But on any reasonable implementation the actual binary representation of this type will most 
-	/// probably not ivolve any additional "magic" or padding beyond the simple binary representation of the underlying 16-bit 
-	/// IEEE number, even if not strictly guaranteed by the standard. But even then it only has an actual size of 16 bits if 
-	/// your C++ implementation supports an unsigned integer type of exactly 16 bits width. But this should be the case on 
-	/// nearly any reasonable platform.
-	///
-	/// So if your C++ implementation is not totally exotic or imposes special alignment requirements, it is a reasonable 
-	/// assumption that the data of a half is just comprised of the 2 bytes of the underlying IEEE representation.
-	class half
-	{
-	public:
-		/// \name Construction and assignment
-		/// \{
+		/// Convert array of half-precision to IEEE single-precision using AVX-512.
+		/// \param src half-precision values to convert
+		/// \param dst array to store single-precision values at
+		/// \param n number of values to convert
+		HALF_TARGET_AVX512 inline void half2float_avx512(const uint16 *src, float *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+16<=n; i+=16)
+				_mm512_storeu_ps(dst+i, _mm512_maskz_cvtph_ps(0xFFFF, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src+i))));
+			half2float_scalar(src+i, dst+i, n-i);
+		}
 
-		/// Default constructor.
-		/// This initializes the half to 0. Although this does not match the builtin types' default-initialization semantics 
-		/// and may be less efficient than no initialization, it is needed to provide proper value-initialization semantics.
-		HALF_CONSTEXPR half() HALF_NOEXCEPT : data_() {}
+		/// Convert array of half-precision to IEEE double-precision using AVX-512.
+		/// \param src half-precision values to convert
+		/// \param dst array to store double-precision values at
+		/// \param n number of values to convert
+		HALF_TARGET_AVX512 inline void half2float_avx512(const uint16 *src, double *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+16<=n; i+=16)
+			{
+				_mm512_storeu_pd(dst+i, _mm512_maskz_cvtps_pd(0xFF, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i)))));
+				_mm512_storeu_pd(dst+i+8, _mm512_maskz_cvtps_pd(0xFF, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+i+8)))));
+			}
+			half2float_scalar(src+i, dst+i, n-i);
+		}
+	#endif
 
-		/// Conversion constructor.
-		/// \param rhs float to convert
-		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-		explicit half(float rhs) : data_(static_cast<detail::uint16>(detail::float2half<round_style>(rhs))) {}
-	
-		/// Conversion to single-precision.
-		/// \return single precision value representing expression value
-		operator float() const { return detail::half2float<float>(data_); }
+		/// Stochastic rounding kernel.
+		/// This binds a random number generator to a stochastic rounding kernel for converting blocks of values.
+		struct stochastic_kernel
+		{
+			/// Kernel function type.
+			typedef void (*kernel)(const float*, uint16*, std::size_t, random_state&);
 
-		/// Assignment operator.
-		/// \param rhs single-precision value to copy from
-		/// \return reference to this half
-		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-		half& operator=(float rhs) { data_ = static_cast<detail::uint16>(detail::float2half<round_style>(rhs)); return *this; }
+			/// Constructor.
+			/// \param fn kernel to call
+			/// \param rng random number generator to use
+			stochastic_kernel(kernel fn, random_state &rng) : fn_(fn), rng_(&rng) {}
 
-		/// \}
-		/// \name Arithmetic updates
-		/// \{
+			/// Convert values.
+			/// \param src single-precision values to convert
+			/// \param dst array to store half-precision values at
+			/// \param n number of values to convert
+			void operator()(const float *src, uint16 *dst, std::size_t n) const { fn_(src, dst, n, *rng_); }
 
-		/// Arithmetic assignment.
-		/// \tparam T type of concrete half expression
-		/// \param rhs half expression to add
-		/// \return reference to this half
-		/// \exception FE_... according to operator+(half,half)
-		half& operator+=(half rhs) { return *this = *this + rhs; }
+		private:
+			/// Kernel to call.
+			kernel fn_;
 
-		/// Arithmetic assignment.
-		/// \tparam T type of concrete half expression
-		/// \param rhs half expression to subtract
-		/// \return reference to this half
-		/// \exception FE_... according to operator-(half,half)
-		half& operator-=(half rhs) { return *this = *this - rhs; }
+			/// Random number generator to use.
+			random_state *rng_;
+		};
 
-		/// Arithmetic assignment.
-		/// \tparam T type of concrete half expression
-		/// \param rhs half expression to multiply with
-		/// \return reference to this half
-		/// \exception FE_... according to operator*(half,half)
-		half& operator*=(half rhs) { return *this = *this * rhs; }
+		/// Run batch conversion kernel on part of an array.
+		/// \tparam F kernel type
+		/// \tparam S source type
+		/// \tparam D destination type
+		/// \param kernel kernel to convert values with
+		/// \param src values to convert
+		/// \param dst array to store converted values at
+		/// \param n number of values to convert
+		/// \param stream `true` to write results with non-temporal stores, `false` to call kernel directly
+		template<typename F,typename S,typename D> void convert_part(F kernel, const S *src, D *dst, std::size_t n, bool stream)
+		{
+		#if HALF_SIMD_SSE2
+			if(stream)
+			{
+				stream_sse2(kernel, src, dst, n);
+				return;
+			}
+		#endif
+			kernel(src, dst, n);
+		}
 
-		/// Arithmetic assignment.
-		/// \tparam T type of concrete half expression
-		/// \param rhs half expression to divide by
-		/// \return reference to this half
-		/// \exception FE_... according to operator/(half,half)
-		half& operator/=(half rhs) { return *this = *this / rhs; }
+		/// Run batch conversion kernel.
+		/// Arrays exceeding the [streaming threshold](\ref HALF_STREAMING_THRESHOLD) are converted blockwise with non-temporal 
+		/// stores if SSE2 is available and the destination can be aligned, otherwise the kernel converts the whole array at once.
+		/// With multiple threads large arrays are split into equal parts converted concurrently by the 
+		/// [thread pool](\ref parallel_pool). Since only exception flags can be collected from other threads, conversions are 
+		/// always run on the calling thread when exceptions are propagated in any other way or flags are not thread-local.
+		/// \tparam F kernel type
+		/// \tparam S source type
+		/// \tparam D destination type
+		/// \param kernel kernel to convert values with
+		/// \param src values to convert
+		/// \param dst array to store converted values at
+		/// \param n number of values to convert
+		/// \param threads maximum number of threads to use
+		template<typename F,typename S,typename D> void simd_convert(F kernel, const S *src, D *dst, std::size_t n, unsigned int threads = 1)
+		{
+			bool stream = HALF_SIMD_SSE2 && simd_level() && n*(sizeof(S)+sizeof(D)) >= load_setting(stream_threshold()) && 
+				!(((0-reinterpret_cast<std::size_t>(dst))&15)%sizeof(D));
+		#if HALF_ENABLE_PARALLEL && HALF_ENABLE_CPP11_THREAD && HALF_ENABLE_CPP11_THREAD_LOCAL && !HALF_ERRHANDLING_ERRNO && \
+			!HALF_ERRHANDLING_FENV && !HALF_ERRHANDLING_THROWS
+			threads = static_cast<unsigned int>((std::min)(static_cast<std::size_t>(threads), n>>16));
+			if(threads > 1)
+			{
+				std::size_t part = ((n-1)/threads+64) & ~static_cast<std::size_t>(63);
+				int flags = parallel_pool().run([=](unsigned int i) { std::size_t begin = (std::min)(i*part, n); 
+					convert_part(kernel, src+begin, dst+begin, (std::min)(part, n-begin), stream); }, threads);
+				raise(flags, flags!=0);
+				return;
+			}
+		#else
+			static_cast<void>(threads);
+		#endif
+			convert_part(kernel, src, dst, n, stream);
+		}
 
-		/// Arithmetic assignment.
-		/// \param rhs single-precision value to add
-		/// \return reference to this half
-		/// \exception FE_... according to operator=()
-		half& operator+=(float rhs) { return *this = *this + rhs; }
+		/// Convert array of IEEE single-precision to half-precision.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level). The F16C instructions don't raise any exceptions, 
+		/// so with enabled exception handling the integer implementations are used instead.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \param threads maximum number of threads to use
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P> void float2half_n(const float *src, uint16 *dst, std::size_t n, unsigned int threads = 1)
+		{
+			typedef void (*kernel)(const float*, uint16*, std::size_t);
+			static const kernel kernels[4] = { &float2half_scalar<R,P>,
+			#if HALF_SIMD_SSE2
+				&float2half_sse2<R,P>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2 && HALF_ERRHANDLING
+				&float2half_avx2<R,P>,
+			#elif HALF_SIMD_AVX2
+				&float2half_f16c<R,P>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX512 && !HALF_ERRHANDLING
+				&float2half_avx512<R,P> };
+			#else
+				0 };
+			#endif
+			simd_convert(simd_kernel(kernels), src, dst, n, threads);
+		}
 
-		/// Arithmetic assignment.
-		/// \param rhs single-precision value to subtract
-		/// \return reference to this half
-		/// \exception FE_... according to operator=()
-		half& operator-=(float rhs) { return *this = *this - rhs; }
+		/// Convert array of IEEE double-precision to half-precision.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level). The values are always rounded directly to 
+		/// half-precision, the F16C instructions are only used on values exactly narrowed to single-precision.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \param src double-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \param threads maximum number of threads to use
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P> void float2half_n(const double *src, uint16 *dst, std::size_t n, unsigned int threads = 1)
+		{
+			typedef void (*kernel)(const double*, uint16*, std::size_t);
+			static const kernel kernels[4] = { &float2half_scalar<R,P>,
+			#if HALF_SIMD_SSE2
+				&float2half_sse2<R,P>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2 && HALF_ERRHANDLING
+				&float2half_avx2<R,P>,
+			#elif HALF_SIMD_AVX2
+				&float2half_f16c<R,P>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX512 && !HALF_ERRHANDLING
+				&float2half_avx512<R,P> };
+			#else
+				0 };
+			#endif
+			simd_convert(simd_kernel(kernels), src, dst, n, threads);
+		}
 
-		/// Arithmetic assignment.
-		/// \param rhs single-precision value to multiply with
-		/// \return reference to this half
-		/// \exception FE_... according to operator=()
-		half& operator*=(float rhs) { return *this = *this * rhs; }
+		/// Convert array of IEEE single-precision to half-precision with stochastic rounding.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level). All of them consume the random numbers in the same
+		/// order, so the results only depend on the generator state and not on the instruction sets used.
+		/// \tparam P conversion policies to apply
+		/// \param src single-precision values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \param state random number generator to use
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<unsigned int P> void float2half_stochastic_n(const float *src, uint16 *dst, std::size_t n, random_state &state)
+		{
+			typedef void (*kernel)(const float*, uint16*, std::size_t, random_state&);
+			static const kernel kernels[4] = { &float2half_stochastic_scalar<P>,
+			#if HALF_SIMD_SSE2
+				&float2half_stochastic_sse2<P>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2
+				&float2half_stochastic_avx2<P>,
+			#else
+				0,
+			#endif
+				0 };
+			simd_convert(stochastic_kernel(simd_kernel(kernels), state), src, dst, n);
+		}
 
-		/// Arithmetic assignment.
-		/// \param rhs single-precision value to divide by
-		/// \return reference to this half
-		/// \exception FE_... according to operator=()
-		half& operator/=(float rhs) { return *this = *this / rhs; }
+		/// Convert array of half-precision to IEEE single-precision.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level).
+		/// \param src half-precision values to convert
+		/// \param dst array to store single-precision values at
+		/// \param n number of values to convert
+		/// \param threads maximum number of threads to use
+		inline void half2float_n(const uint16 *src, float *dst, std::size_t n, unsigned int threads = 1)
+		{
+			typedef void (*kernel)(const uint16*, float*, std::size_t);
+			static const kernel kernels[4] = { &half2float_scalar,
+			#if HALF_SIMD_SSE2
+				&half2float_sse2,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2
+				&half2float_avx2,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX512
+				&half2float_avx512 };
+			#else
+				0 };
+			#endif
+			simd_convert(simd_kernel(kernels), src, dst, n, threads);
+		}
 
-		/// \}
-		/// \name Increment and decrement
-		/// \{
+		/// Convert array of half-precision to IEEE double-precision.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level).
+		/// \param src half-precision values to convert
+		/// \param dst array to store double-precision values at
+		/// \param n number of values to convert
+		/// \param threads maximum number of threads to use
+		inline void half2float_n(const uint16 *src, double *dst, std::size_t n, unsigned int threads = 1)
+		{
+			typedef void (*kernel)(const uint16*, double*, std::size_t);
+			static const kernel kernels[4] = { &half2float_scalar,
+			#if HALF_SIMD_SSE2
+				&half2float_sse2,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2
+				&half2float_avx2,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX512
+				&half2float_avx512 };
+			#else
+				0 };
+			#endif
+			simd_convert(simd_kernel(kernels), src, dst, n, threads);
+		}
 
-		/// Prefix increment.
-		/// \return incremented half value
-		/// \exception FE_... according to operator+(half,half)
-		half& operator++() { return *this = *this + half(detail::binary, 0x3C00); }
+		/// Convert array of integers to half-precision.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level) for types of at most 32 bits.
+		/// \tparam R rounding mode to use
+		/// \tparam P conversion policies to apply
+		/// \tparam T type to convert (builtin integer type)
+		/// \param src integral values to convert
+		/// \param dst array to store half-precision values at
+		/// \param n number of values to convert
+		/// \param threads maximum number of threads to use
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,unsigned int P,typename T> void int2half_n(const T *src, uint16 *dst, std::size_t n, unsigned int threads = 1)
+		{
+			typedef void (*kernel)(const T*, uint16*, std::size_t);
+			static const kernel kernels[4] = { &int2half_scalar<R,P,T>,
+			#if HALF_SIMD_SSE2
+				(sizeof(T)<=sizeof(int)) ? static_cast<kernel>(&int2half_sse2<R,P,T>) : 0,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2
+				(sizeof(T)<=sizeof(int)) ? static_cast<kernel>(&int2half_avx2<R,P,T>) : 0,
+			#else
+				0,
+			#endif
+				0 };
+			simd_convert(simd_kernel(kernels), src, dst, n, threads);
+		}
 
-		/// Prefix decrement.
-		/// \return decremented half value
-		/// \exception FE_... according to operator-(half,half)
-		half& operator--() { return *this = *this + half(detail::binary, 0xBC00); }
+		/// Convert array of half-precision to integers.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level) for types of at most 32 bits.
+		/// \tparam R rounding mode to use
+		/// \tparam T type to convert to (builtin integer type)
+		/// \param src half-precision values to convert
+		/// \param dst array to store integral values at
+		/// \param n number of values to convert
+		/// \param threads maximum number of threads to use
+		/// \exception FE_INVALID if a value is not representable in type \a T
+		/// \exception FE_INEXACT if values had to be rounded
+		template<std::float_round_style R,typename T> void half2int_n(const uint16 *src, T *dst, std::size_t n, unsigned int threads = 1)
+		{
+			typedef void (*kernel)(const uint16*, T*, std::size_t);
+			static const kernel kernels[4] = { &half2int_scalar<R,T>,
+			#if HALF_SIMD_SSE2
+				(sizeof(T)<=sizeof(int)) ? static_cast<kernel>(&half2int_sse2<R,T>) : 0,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2
+				(sizeof(T)<=sizeof(int)) ? static_cast<kernel>(&half2int_avx2<R,T>) : 0,
+			#else
+				0,
+			#endif
+				0 };
+			simd_convert(simd_kernel(kernels), src, dst, n, threads);
+		}
 
-		/// Postfix increment.
-		/// \return non-incremented half value
-		/// \exception FE_... according to operator+(half,half)
-		half operator++(int) { half out(*this); ++*this; return out; }
+		/// Convert array of half-precision to extended precision.
+		/// This converts blocks of values to double-precision first, which is always exact and avoids subnormal operands.
+		/// \param src half-precision values to convert
+		/// \param dst array to store long double values at
+		/// \param n number of values to convert
+		inline void half2float_n(const uint16 *src, long double *dst, std::size_t n)
+		{
+			double buf[256];
+			for(std::size_t i=0; i<n; i+=256)
+			{
+				std::size_t m = (std::min)(n-i, static_cast<std::size_t>(256));
+				half2float_n(src+i, buf, m);
+				for(std::size_t j=0; j<m; ++j)
+					dst[i+j] = buf[j];
+			}
+		}
 
-		/// Postfix decrement.
-		/// \return non-decremented half value
-		/// \exception FE_... according to operator-(half,half)
-		half operator--(int) { half out(*this); --*this; return out; }
 		/// \}
-	
-	private:
-		/// Rounding mode to use
-		static const std::float_round_style round_style = (std::float_round_style)(HALF_ROUND_STYLE);
-
-		/// Constructor.
-		/// \param bits binary representation to set half to
-		HALF_CONSTEXPR half(detail::binary_t, unsigned int bits) HALF_NOEXCEPT : data_(static_cast<detail::uint16>(bits)) {}
+		/// \name Mathematics
+		/// \{
 
-		/// Internal binary representation
-		detail::uint16 data_;
+		/// Half precision positive modulus.
+		/// \tparam Q `true` to compute full quotient, `false` else
+		/// \tparam R `true` to compute signed remainder, `false` for positive remainder
+		/// \param x first operand as positive finite half-precision value
+		/// \param y second operand as positive finite half-precision value
+		/// \param quo adress to store quotient at, `nullptr` if \a Q `false`
+		/// \return modulus of \a x / \a y
+		template<bool Q,bool R> unsigned int mod(unsigned int x, unsigned int y, int *quo = NULL)
+		{
+			unsigned int q = 0;
+			if(x > y)
+			{
+				int absx = x, absy = y, expx = 0, expy = 0;
+			#if !HALF_FLUSH_DENORMALS
+				expx -= normalize<10>(absx);
+				expy -= normalize<10>(absy);
+			#endif
+				expx += absx >> 10;
+				expy += absy >> 10;
+				uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
+				int d = expx - expy, i;
+				do
+				{
+					i = (d<20) ? d : 20;
+					uint32 m = mx << i;
+					q = (q<<i) + static_cast<unsigned int>(m/my);
+					mx = m % my;
+				} while(d -= i);
+				if(!Q && !mx)
+					return 0;
+				if(Q)
+				{
+					q &= (1<<(std::numeric_limits<int>::digits-1)) - 1;
+					if(!mx)
+						return *quo = q, 0;
+				}
+				expy -= normalize<10>(mx);
+				x = (expy>0) ? ((expy<<10)|(mx&0x3FF)) : (mx>>(1-expy));
+			}
+			if(R)
+			{
+				unsigned int a, b;
+				if(y < 0x800)
+				{
+					a = (x<0x400) ? (x<<1) : (x+0x400);
+					b = y;
+				}
+				else
+				{
+					a = x;
+					b = y - 0x400;
+				}
+				if(a > b || (a == b && (q&1)))
+				{
+					int exp = (y>>10) + (y<=0x3FF), d = exp - (x>>10) - (x<=0x3FF);
+					int m = (((y&0x3FF)|((y>0x3FF)<<10))<<1) - (((x&0x3FF)|((x>0x3FF)<<10))<<(1-d));
+					exp -= normalize<11>(m, exp-1);
+					x = 0x8000 + ((exp-1)<<10) + (m>>1);
+					q += Q;
+				}
+			}
+			if(Q)
+				*quo = q;
+			return x;
+		}
+
+		/// Fixed point square root.
+		/// \tparam F number of fractional bits
+		/// \param r radicand in Q1.F fixed point format
+		/// \param exp exponent
+		/// \return square root as Q1.F/2
+		template<unsigned int F> uint32 sqrt(uint32 &r, int &exp)
+		{
+			int i = exp & 1;
+			r <<= i;
+			exp = (exp-i) / 2;
+			uint32 m = 0;
+			for(uint32 bit=static_cast<uint32>(1)<<F; bit; bit>>=2)
+			{
+				if(r < m+bit)
+					m >>= 1;
+				else
+				{
+					r -= m + bit;
+					m = (m>>1) + bit;
+				}
+			}
+			return m;
+		}
+
+		/// Fixed point binary exponential.
+		/// This uses the BKM algorithm in E-mode.
+		/// \param m exponent in [0,1) as Q0.31
+		/// \param n number of iterations (at most 32)
+		/// \return 2 ^ \a m as Q1.31
+		inline uint32 exp2(uint32 m, unsigned int n = 32)
+		{
+			static const uint32 logs[] = {
+				0x80000000, 0x4AE00D1D, 0x2934F098, 0x15C01A3A, 0x0B31FB7D, 0x05AEB4DD, 0x02DCF2D1, 0x016FE50B,
+				0x00B84E23, 0x005C3E10, 0x002E24CA, 0x001713D6, 0x000B8A47, 0x0005C53B, 0x0002E2A3, 0x00017153,
+				0x0000B8AA, 0x00005C55, 0x00002E2B, 0x00001715, 0x00000B8B, 0x000005C5, 0x000002E3, 0x00000171,
+				0x000000B9, 0x0000005C, 0x0000002E, 0x00000017, 0x0000000C, 0x00000006, 0x00000003, 0x00000001 };
+			if(!m)
+				return 0x80000000;
+			uint32 mx = 0x80000000, my = 0;
+			for(unsigned int i=1; i<n; ++i)
+			{
+				uint32 mz = my + logs[i];
+				if(mz <= m)
+				{
+					my = mz;
+					mx += mx >> i;
+				}
+			}
+			return mx;
+		}
+
+		/// Fixed point binary logarithm.
+		/// This uses the BKM algorithm in L-mode.
+		/// \param m mantissa in [1,2) as Q1.30
+		/// \param n number of iterations (at most 32)
+		/// \return log2(\a m) as Q0.31
+		inline uint32 log2(uint32 m, unsigned int n = 32)
+		{
+			static const uint32 logs[] = {
+				0x80000000, 0x4AE00D1D, 0x2934F098, 0x15C01A3A, 0x0B31FB7D, 0x05AEB4DD, 0x02DCF2D1, 0x016FE50B,
+				0x00B84E23, 0x005C3E10, 0x002E24CA, 0x001713D6, 0x000B8A47, 0x0005C53B, 0x0002E2A3, 0x00017153,
+				0x0000B8AA, 0x00005C55, 0x00002E2B, 0x00001715, 0x00000B8B, 0x000005C5, 0x000002E3, 0x00000171,
+				0x000000B9, 0x0000005C, 0x0000002E, 0x00000017, 0x0000000C, 0x00000006, 0x00000003, 0x00000001 };
+			if(m == 0x40000000)
+				return 0;
+			uint32 mx = 0x40000000, my = 0;
+			for(unsigned int i=1; i<n; ++i)
+			{
+				uint32 mz = mx + (mx>>i);
+				if(mz <= m)
+				{
+					mx = mz;
+					my += logs[i];
+				}
+			}
+			return my;
+		}
+
+		/// Fixed point sine and cosine.
+		/// This looks up sine and cosine at the next lower multiple of 1/64 as Q1.63 and corrects them with the Taylor 
+		/// polynomials of the remaining angle in 64-bit fixed point, which is accurate to about 2^-51 before rounding.
+		/// \param mz angle in [-pi/2,pi/2] as Q1.30
+		/// \return sine and cosine of \a mz as Q1.30
+		inline std::pair<uint32,uint32> sincos(uint32 mz)
+		{
+			static const uint32 table[] = {
+				0x00000000, 0x00000000, 0x80000000, 0x00000000, 0x01FFFAAA, 0xAEEEED4E, 0x7FFC0005, 0x55527D28,
+				0x03FFD555, 0xDDDD0DD1, 0x7FF00055, 0x549F4AC4, 0x05FF7004, 0x0CBEEA2A, 0x7FDC01AF, 0xF7E67B3A,
+				0x07FEAABB, 0xBB53B6AD, 0x7FC00555, 0x27D34D32, 0x09FD6589, 0x68BAAD4D, 0x7F9C0D04, 0xA7BDBB8D,
+				0x0BFB8081, 0x92A8720D, 0x7F701AFD, 0xF9AE6D31, 0x0DF8DBC2, 0xB41C8EBD, 0x7F3C3200, 0x3A66C47A,
+				0x0FF55777, 0x43771AE5, 0x7F005549, 0xF56F4DB6, 0x11F0D3D7, 0xAFCEAEA4, 0x7EBC8898, 0xF12F4BD5,
+				0x13EB312C, 0x5D66CB51, 0x7E70D029, 0xF310A1C5, 0x15E44FCF, 0xA126F2A4, 0x7E1D30B8, 0x7BB3D639,
+				0x17DC102F, 0xBAF2B515, 0x7DC1AF7E, 0x7B386E96, 0x19D252D0, 0xCEC31233, 0x7D5E5233, 0xFD9E5C78,
+				0x1BC6F84E, 0xDC619967, 0x7CF31F0E, 0xCF45B7B7, 0x1DB9E15F, 0xB5A5CFB3, 0x7C801CC2, 0x19927CDC,
+				0x1FAAEED4, 0xF31576BA, 0x7C05527D, 0xF7BA85D3, 0x219A019D, 0xE6C86B30, 0x7B82C7EF, 0x03C46FE4,
+				0x2386FAC9, 0x8D70ECA3, 0x7AF8853D, 0xDBBE9EFD, 0x2571BB88, 0x7D693E45, 0x7A66930E, 0x9F360ADD,
+				0x275A252E, 0xD3A7B001, 0x79CCFA80, 0x64F4FE9B, 0x29401936, 0x1E7A40C1, 0x792BC52C, 0xA9126E97,
+				0x2B23793F, 0x45EB2E5F, 0x7882FD26, 0xB35B03D3, 0x2D042714, 0x71AFED13, 0x77D2ACFA, 0xF61D761D,
+				0x2EE204AA, 0xEC8427A4, 0x771ADFAE, 0x65644829, 0x30BCF425, 0x04D292C5, 0x765BA0BD, 0xC6A771FF,
+				0x3294D7D3, 0xEA8D894B, 0x7594FC1C, 0xF900FE89, 0x34699239, 0x8A1993CB, 0x74C6FE36, 0x35F018F3,
+				0x363B060A, 0x642C2D28, 0x73F1B3E9, 0x4AB67D8B, 0x3809162F, 0x62814646, 0x73152A8A, 0xCA5CB853,
+				0x39D3A5C7, 0xA94A3DB4, 0x72316FE3, 0x386A10D5, 0x3B9A982A, 0x65393486, 0x7146922E, 0x2C5D77B9,
+				0x3D5DD0E8, 0x960BDFD0, 0x7054A019, 0x6DF53E76, 0x3F1D33CE, 0xD5792E33, 0x6F5BA8C4, 0x0A53D498,
+				0x40D8A4E7, 0x1A6552D2, 0x6E5BBBBD, 0x62103828, 0x4290087A, 0x78400290, 0x6D54E904, 0x30413831,
+				0x44434312, 0xDA70EDD9, 0x6C474105, 0x8A93188E, 0x45F2397C, 0xBBB6C04D, 0x6B32D49B, 0xDA77958F,
+				0x479CD0C8, 0xD95D3091, 0x6A17B50D, 0xCF80B466, 0x4942EE4D, 0xE22EECF5, 0x68F5F40D, 0x4AF73A97,
+				0x4AE477AA, 0x21087605, 0x67CDA3B6, 0x44BE12E2, 0x4C8152C5, 0x22F13DF6, 0x669ED68D, 0xA9945172,
+				0x4E1965D1, 0x58A0AB77, 0x65699F80, 0x32C7F2F4, 0x4FAC974D, 0xB354E7C8, 0x642E11E1, 0x376BDB78,
+				0x513ACE07, 0x3CE1AAC1, 0x62EC4169, 0x77240186, 0x52C3F11A, 0xAADD8404, 0x61A44235, 0xDE9B1899,
+				0x5447E7F5, 0xECD46EA3, 0x605628C6, 0x45B57388, 0x55C69A59, 0xB566CC39, 0x5F0209FC, 0x27953B8E,
+				0x573FF05A, 0xFE3C3596, 0x5DA7FB19, 0x54847B9F, 0x58B3D264, 0x86B1E212, 0x5C4811BE, 0x9DD9E142,
+				0x5A222938, 0x4D2CBA94, 0x5AE263EA, 0x7BED748A, 0x5B8ADDF1, 0x02F78378, 0x597707F7, 0xAE32E7CD,
+				0x5CEDDA03, 0x7A95DF6E, 0x5806149B, 0xD58F7D46, 0x5E4B0740, 0x10754654, 0x568FA0E6, 0x0901DD42,
+				0x5FA24FD4, 0x0DE5650E, 0x5513C43D, 0x64B29218, 0x60F39E4B, 0x0641B706, 0x5392965F, 0x938438E6,
+				0x623EDD90, 0x2E3686B6, 0x520C2F5F, 0x533ACDDF, 0x6383F8EF, 0xAD0BE132, 0x5080A7A2, 0xF351D199,
+				0x64C2DC17, 0xE7E167FB, 0x4EF017E2, 0xCE9959DA, 0x65FB731A, 0xC6C64D93, 0x4D5A9927, 0xBFB273F5,
+				0x672DAA6E, 0xF3992B58, 0x4BC044C9, 0x908390C7, 0x68596EF1, 0x129BC2DA, 0x4A21346D, 0x64BE02F6,
+				0x697EADE4, 0xF4A72174, 0x487D8204, 0x1F8DE6F5, 0x6A9D54F6, 0xC2ED0311, 0x46D547C8, 0xC48E19A8,
+				0x6BB5523C, 0x2433B810, 0x4528A03E, 0xD41A2E48, 0x6CC69435, 0x5B7A3AB2, 0x4377A630, 0xA3189E4F,
+				0x6DD109CE, 0x5FF289DA, 0x41C274AD, 0xAE57B68E, 0x6ED4A25F, 0xEE40C995, 0x40092708, 0xE9980B99,
+				0x6FD14DB0, 0x92EE1597, 0x3E4BD8D7, 0x0A5F84A2, 0x70C6FBF5, 0xADFE5E89, 0x3C8AA5EC, 0xCEB04F7E,
+				0x71B59DD4, 0x6F9918E8, 0x3AC5AA5D, 0x3FBF523E, 0x729D2462, 0xCDB4F2FE, 0x38FD0277, 0xF0C5EEC8,
+				0x737D8128, 0x72B7374A, 0x3730CAC7, 0x3A0B2B36, 0x7456A61F, 0xA4F7F17D, 0x3561200E, 0x70408E45,
+				0x752885B6, 0x271C5DD4, 0x338E1F48, 0x184F39D3, 0x75F312CE, 0x11399D3F, 0x31B7E5A4, 0x17B20686,
+				0x76B640BE, 0xA2B21C3D, 0x2FDE9085, 0xE1799AC1, 0x77720355, 0x0CC08EA5, 0x2E023D82, 0xA017AC90,
+				0x78264ED5, 0x35A3D7C1, 0x2C230A5F, 0x5C0ED1A3, 0x78D317FA, 0x745FAC07, 0x2A41150F, 0x1FA47239,
+				0x797853F8, 0x4506307C, 0x285C7BB1, 0x17B2A3B2, 0x7A15F87A, 0xF57F5331, 0x26755C8E, 0xB1B7DD8B,
+				0x7AABFBA8, 0x4AC31075, 0x248BD619, 0xB742A78E, 0x7B3A5420, 0x1E7C512B, 0x22A006EA, 0x66D78A66,
+				0x7BC0F8FC, 0xF50A8810, 0x20B20DBD, 0x8A6FB404, 0x7C3FE1D4, 0x8BD8AE02, 0x1EC20972, 0x8BAEE7C7,
+				0x7CB706B8, 0x6000B7C8, 0x1CD01909, 0x85EF76DD, 0x7D266036, 0x2D331B3B, 0x1ADC5BA1, 0x56431FF4,
+				0x7D8DE758, 0x64DA756B, 0x18E6F075, 0xA987D603, 0x7DED95A6, 0x9D73DF75, 0x16EFF6DD, 0x08AF8CB9,
+				0x7E456525, 0xFA14FCB3, 0x14F78E46, 0xE35A45E7, 0x7E955059, 0x8A1949C8, 0x12FDD639, 0x98E1B621,
+				0x7EDD5242, 0xA0F0B1D9, 0x1102EE50, 0x7FF5EFA2, 0x7F1D6661, 0x2609ECFF, 0x0F06F639, 0xECEA9996,
+				0x7F5588B3, 0xDCD3A957, 0x0D0A0DB5, 0x36D44EBB, 0x7F85B5B8, 0xA4CFFEAC, 0x0B0C5490, 0xBB95D15A,
+				0x7FADEA6C, 0xB1B62B79, 0x090DEAA7, 0xE2FCD3A1, 0x7FCE244C, 0xBB9F1940, 0x070EEFE1, 0x210E226A,
+				0x7FE66155, 0x2739A557, 0x050F842B, 0xF7A10D70, 0x7FF6A002, 0x26042B0C, 0x030FC77E, 0xF769F325,
+				0x7FFEDF4F, 0xCE894B69, 0x010FD9D5, 0xC093DF4F };
+			uint32 sign = sign_mask(mz), a = (mz^sign) - sign, i = (a>>24) << 2, d = (a&0xFFFFFF) << 8, e0, e1 = mulhilo(d, d, e0);
+			uint32 d3 = multiply64(e1, d), d4 = multiply64(e1, e1), e6 = multiply64(multiply64(d4, e1), 0xB60B60B6);
+			uint32 t5 = multiply64(multiply64(d3, e1), 0x88888889), t1 = d, t0 = 0, p0, p1 = mulhilo(d4, 0x0AAAAAAB, p0);
+			sub64(e1, e0, p1>>11, ((p1<<21)|(p0>>11))&0xFFFFFFFF);
+			add64(e1, e0, 0, e6);
+			p1 = mulhilo(d3, 0x2AAAAAAB, p0);
+			sub64(t1, t0, p1>>12, ((p1<<20)|(p0>>12))&0xFFFFFFFF);
+			add64(t1, t0, t5>>30, (t5<<2)&0xFFFFFFFF);
+			uint32 s0, s1 = mulhi64(table[i+2], table[i+3], t1, t0, 6, s0), c0 = table[i+3], c1 = table[i+2];
+			add64(s1, s0, table[i], table[i+1]);
+			p1 = mulhi64(table[i], table[i+1], e1, e0, 13, p0);
+			sub64(s1, s0, p1, p0);
+			p1 = mulhi64(table[i], table[i+1], t1, t0, 6, p0);
+			sub64(c1, c0, p1, p0);
+			p1 = mulhi64(table[i+2], table[i+3], e1, e0, 13, p0);
+			sub64(c1, c0, p1, p0);
+			return std::make_pair((((s1+1)>>1)^sign) - sign, (c1+1)>>1);
+		}
+
+		/// Fixed point arc tangent.
+		/// This looks up the arc tangent of the next lower multiple t of 1/64 of the quotient q as Q1.62 and adds the arc 
+		/// tangent of (q-t)/(1+qt) computed by its Taylor polynomial in 64-bit fixed point. The result is accurate to about 
+		/// 2^-49 and lowered by 2^-48, so that truncating it never rounds up.
+		/// \param my y coordinate as Q0.30
+		/// \param mx x coordinate as Q0.30
+		/// \param lo variable to store lower 32 bit of result
+		/// \return arc tangent of \a my / \a mx as Q1.30
+		inline uint32 atan2(uint32 my, uint32 mx, uint32 &lo)
+		{
+			static const uint32 angles[] = {
+				0x00000000, 0x00000000, 0x00FFFAAA, 0xDDDB94D5, 0x01FFD55B, 0xBA97624A, 0x02FF7030, 0x861B453F,
+				0x03FEAB76, 0xE59FBD38, 0x04FD67C3, 0x9F15675A, 0x05FB8609, 0x80BC43A3, 0x06F8E7AF, 0x9BC1F0DF,
+				0x07F56EA6, 0xAB0BDB71, 0x08F0FD7D, 0x821B9372, 0x09EB7774, 0x6331362C, 0x0AE4C08F, 0x1F6134EF,
+				0x0BDCBDA5, 0xE72D8113, 0x0CD35474, 0xB643130E, 0x0DC86BA9, 0x49305102, 0x0EBBEAEF, 0x902B9B38,
+				0x0FADBAFC, 0x96406EB1, 0x109DC597, 0xD8636258, 0x118BF5A3, 0x0BF17826, 0x12783720, 0x57EF45BE,
+				0x13627737, 0x07EBCBCD, 0x144AA436, 0xC2AF09A8, 0x1530AD99, 0x51CD49DB, 0x16148403, 0x09CFE196,
+				0x16F61941, 0xE4DEF08E, 0x17D5604B, 0x63B3F75A, 0x18B24D39, 0x4A1B256D, 0x198CD545, 0x4D6B1867,
+				0x1A64EEC3, 0xCC23FCB6, 0x1B3A911D, 0xA65C6C6B, 0x1C0DB4C9, 0x4EC9EF8C, 0x1CDE5343, 0x2C135097,
+				0x1DAC6705, 0x61BB4F68, 0x1E77EB7F, 0x175A3443, 0x1F40DD0B, 0x541417CB, 0x200738E7, 0x83481726,
+				0x20CAFD29, 0xB6619F8A, 0x218C28B6, 0xB687B419, 0x224ABB37, 0xF7A551ED, 0x2306B511, 0x7CF826E3,
+				0x23C01757, 0xBDFD67E6, 0x2476E3C5, 0x993CD438, 0x252B1CB2, 0x611C61BD, 0x25DCC508, 0x0D9794E2,
+				0x268BE039, 0x9C6F7688, 0x27387239, 0xA82E336E, 0x27E27F71, 0x3D2DE87B, 0x288A0CB6, 0xF2B6AB82,
+				0x292F1F46, 0x4D3DC249, 0x29D1BCB7, 0x6DD808A5, 0x2A71EAF7, 0x120C3D72, 0x2B0FB03E, 0xE65F75A8,
+				0x2BAB130E, 0x2D363020, 0x2C441A22, 0xBAF71BDA, 0x2CDACC72, 0x47C10DA4, 0x2D6F3124, 0x167B312B,
+				0x2E014F8A, 0xF08C679C, 0x2E912F1F, 0x751C1E0B, 0x2F1ED77A, 0xBA62BCA0, 0x2FAA5051, 0x3F4126AB,
+				0x3033A16E, 0x2B149990, 0x30BAD2AE, 0xD9858A2D, 0x313FEBFE, 0xAFE3EF55, 0x31C2F553, 0x3980BB84 };
+			if(my == mx)
+				return lo = 0x885A308D, 0x3243F6A8;
+			bool swap = my > mx;
+			if(swap)
+				std::swap(my, mx);
+			int s;
+			uint32 q1 = divide64(my, mx, s), q0 = divide64((0-q1*mx)&0xFFFFFFFF, mx, s), i = q1 >> 26, dl, dh = 0x80000000 + mulhilo(q1, i<<25, dl);
+			uint32 nh = ((q1&0x3FFFFFF)<<5) | (q0>>27), nl = (q0<<5) & 0xFFFFFFFF;
+			add64(dh, dl, 0, multiply64(q0, i<<25));
+			uint32 uh = divide64(nh, dh, s), r = (0-uh*dh) & 0xFFFFFFFF;
+			for(; nl>=dh-r; ++uh,r=0)
+				nl -= dh - r;
+			uint32 ul = divide64(r+nl, dh, s), c = divide64(multiply64(uh, dl)>>1, dh, s);
+			sub64(uh, ul, c>>31, (c<<1)&0xFFFFFFFF);
+			uint32 u = uh + (ul>>31), u2 = multiply64(u, u), u3 = multiply64(u2, u), u5 = multiply64(u3, u2), p0, p1 = mulhilo(u3, 0x55555555, p0);
+			uint32 t5 = multiply64(u5, 0xCCCCCCCD), mh = angles[2*i], ml = angles[2*i+1];
+			sub64(uh, ul, p1>>12, ((p1<<20)|(p0>>12))&0xFFFFFFFF);
+			add64(uh, ul, t5>>26, (t5<<6)&0xFFFFFFFF);
+			sub64(uh, ul, 0, multiply64(multiply64(u5, u2), 0x02492492));
+			add64(mh, ml, uh>>8, ((uh<<24)|(ul>>8))&0xFFFFFFFF);
+			if(swap)
+			{
+				uint32 h = 0x6487ED51, l = 0x10B4611A;
+				sub64(h, l, mh, ml);
+				mh = h;
+				ml = l;
+			}
+			sub64(mh, ml, 0, 0x4000);
+			return lo = ml, mh;
+		}
+
+		/// Reduce argument for trigonometric functions.
+		/// \param abs half-precision floating-point value
+		/// \param k value to take quarter period
+		/// \return \a abs reduced to [-pi/4,pi/4] as Q0.30
+		inline uint32 angle_arg(unsigned int abs, int &k)
+		{
+			uint32 m = (abs&0x3FF) | ((abs>0x3FF)<<10);
+			int exp = (abs>>10) + (abs<=0x3FF) - 15;
+			if(abs < 0x3A48)
+				return k = 0, m << (exp+20);
+		#if HALF_ENABLE_CPP11_LONG_LONG
+			unsigned long long y = m * 0xA2F9836E4E442, mask = (1ULL<<(62-exp)) - 1, yi = (y+(mask>>1)) & ~mask, f = y - yi;
+			uint32 sign = -static_cast<uint32>(f>>63);
+			k = static_cast<int>(yi>>(62-exp));
+			return (multiply64(static_cast<uint32>((sign ? -f : f)>>(31-exp)), 0xC90FDAA2)^sign) - sign;
+		#else
+			uint32 yh = m*0xA2F98 + mulhi<std::round_toward_zero>(m, 0x36E4E442), yl = (m*0x36E4E442) & 0xFFFFFFFF;
+			uint32 mask = (static_cast<uint32>(1)<<(30-exp)) - 1, yi = (yh+(mask>>1)) & ~mask, sign = -static_cast<uint32>(yi>yh);
+			k = static_cast<int>(yi>>(30-exp));
+			uint32 fh = (yh^sign) + (yi^~sign) - ~sign, fl = (yl^sign) - sign;
+			return (multiply64((exp>-1) ? (((fh<<(1+exp))&0xFFFFFFFF)|((fl&0xFFFFFFFF)>>(31-exp))) : fh, 0xC90FDAA2)^sign) - sign;
+		#endif
+		}
+
+		/// Get arguments for atan2 function.
+		/// \param abs half-precision floating-point value
+		/// \return \a abs and sqrt(1 - \a abs^2) as Q0.30
+		inline std::pair<uint32,uint32> atan2_args(unsigned int abs)
+		{
+			int exp = -15;
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(abs);
+		#endif
+			exp += abs >> 10;
+			uint32 my = ((abs&0x3FF)|0x400) << 5, r = my * my;
+			int rexp = 2 * exp;
+			r = 0x40000000 - ((rexp>-31) ? ((r>>-rexp)|((r&((static_cast<uint32>(1)<<-rexp)-1))!=0)) : 1);
+			rexp = -normalize<30>(r);
+			uint32 mx = sqrt<30>(r, rexp);
+			int d = exp - rexp;
+			if(d < 0)
+				return std::make_pair((d<-14) ? ((my>>(-d-14))+((my>>(-d-15))&1)) : (my<<(14+d)), (mx<<14)+(r<<13)/mx);
+			if(d > 0)
+				return std::make_pair(my<<14, (d>14) ? ((mx>>(d-14))+((mx>>(d-15))&1)) : ((d==14) ? mx : ((mx<<(14-d))+(r<<(13-d))/mx)));
+			return std::make_pair(my<<13, (mx<<13)+(r<<12)/mx);
+		}
+
+		/// Get exponentials for hyperbolic computation
+		/// \param abs half-precision floating-point value
+		/// \param exp variable to take unbiased exponent of larger result
+		/// \param n number of BKM iterations (at most 32)
+		/// \return exp(abs) and exp(-\a abs) as Q1.31 with same exponent
+		inline std::pair<uint32,uint32> hyperbolic_args(unsigned int abs, int &exp, unsigned int n = 32)
+		{
+			uint32 mx = detail::multiply64(static_cast<uint32>((abs&0x3FF)+((abs>0x3FF)<<10))<<21, 0xB8AA3B29), my;
+			int e = (abs>>10) + (abs<=0x3FF);
+			if(e < 14)
+			{
+				exp = 0;
+				mx >>= 14 - e;
+			}
+			else
+			{
+				exp = mx >> (45-e);
+				mx = (mx<<(e-14)) & 0x7FFFFFFF;
+			}
+			mx = exp2(mx, n);
+			int d = exp << 1, s;
+			if(mx > 0x80000000)
+			{
+				my = divide64(0x80000000, mx, s);
+				my |= s;
+				++d;
+			}
+			else
+				my = mx;
+			return std::make_pair(mx, (d<31) ? ((my>>d)|((my&((static_cast<uint32>(1)<<d)-1))!=0)) : 1);
+		}
+
+		/// Postprocessing for binary exponential.
+		/// \tparam R rounding mode to use
+		/// \param m fractional part of as Q0.31
+		/// \param exp absolute value of unbiased exponent
+		/// \param esign sign of actual exponent
+		/// \param sign sign bit of result
+		/// \param n number of BKM iterations (at most 32)
+		/// \return value converted to half-precision
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if value had to be rounded or \a I is `true`
+		template<std::float_round_style R> unsigned int exp2_post(uint32 m, int exp, bool esign, unsigned int sign = 0, unsigned int n = 32)
+		{
+			if(esign)
+			{
+				exp = -exp - (m!=0);
+				if(exp < -25)
+					return underflow<R>(sign);
+				else if(exp == -25)
+					return rounded<R,false>(sign, 1, m!=0);
+			}
+			else if(exp > 15)
+				return overflow<R>(sign);
+			if(!m)
+				return sign | (((exp+=15)>0) ? (exp<<10) : check_underflow(0x200>>-exp));
+			m = exp2(m, n);
+			int s = 0;
+			if(esign)
+				m = divide64(0x80000000, m, s);
+			return fixed2half<R,31,false,false,true>(m, exp+14, sign, s);
+		}
+
+		/// Postprocessing for binary logarithm.
+		/// \tparam R rounding mode to use
+		/// \tparam L logarithm for base transformation as Q1.31
+		/// \param m fractional part of logarithm as Q0.31
+		/// \param ilog signed integer part of logarithm
+		/// \param exp biased exponent of result
+		/// \param sign sign bit of result
+		/// \return value base-transformed and converted to half-precision
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if no other exception occurred
+		template<std::float_round_style R,uint32 L> unsigned int log2_post(uint32 m, int ilog, int exp, unsigned int sign = 0)
+		{
+			uint32 msign = sign_mask(ilog);
+			m = (((static_cast<uint32>(ilog)<<27)+(m>>4))^msign) - msign;
+			if(!m)
+				return 0;
+			exp -= normalize<31>(m);
+			int i = m >= L, s;
+			exp += i;
+			m >>= 1 + i;
+			sign ^= msign & 0x8000;
+			if(exp < -11)
+				return underflow<R>(sign);
+			m = divide64(m, L, s);
+			return fixed2half<R,30,false,false,true>(m, exp, sign, 1);
+		}
+
+		/// Hypotenuse square root and postprocessing.
+		/// \tparam R rounding mode to use
+		/// \param r mantissa as Q2.30
+		/// \param exp biased exponent
+		/// \return square root converted to half-precision
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if value had to be rounded
+		template<std::float_round_style R> unsigned int hypot_post(uint32 r, int exp)
+		{
+			int i = r >> 31;
+			if((exp+=i) > 46)
+				return overflow<R>();
+			if(exp < -34)
+				return underflow<R>();
+			r = (r>>i) | (r&i);
+			uint32 m = sqrt<30>(r, exp+=15);
+			return fixed2half<R,15,false,false,false>(m, exp-1, 0, r!=0);
+		}
+
+		/// Division and postprocessing for tangents.
+		/// \tparam R rounding mode to use
+		/// \param my dividend as Q1.31
+		/// \param mx divisor as Q1.31
+		/// \param exp biased exponent of result
+		/// \param sign sign bit of result
+		/// \return quotient converted to half-precision
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if no other exception occurred
+		template<std::float_round_style R> unsigned int tangent_post(uint32 my, uint32 mx, int exp, unsigned int sign = 0)
+		{
+			int i = my >= mx, s;
+			exp += i;
+			if(exp > 29)
+				return overflow<R>(sign);
+			if(exp < -11)
+				return underflow<R>(sign);
+			uint32 m = divide64(my>>(i+1), mx, s);
+			return fixed2half<R,30,false,false,true>(m, exp, sign, s);
+		}
+
+		/// Area function and postprocessing.
+		/// This computes the value directly in Q2.30 using the representation `asinh|acosh(x) = log(x+sqrt(x^2+|-1))`.
+		/// \tparam R rounding mode to use
+		/// \tparam S `true` for asinh, `false` for acosh
+		/// \param arg half-precision argument
+		/// \return asinh|acosh(\a arg) converted to half-precision
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if no other exception occurred
+		template<std::float_round_style R,bool S> unsigned int area(unsigned int arg)
+		{
+			int abs = arg & 0x7FFF, expx = (abs>>10) + (abs<=0x3FF) - 15, expy = -15, ilog, i;
+			uint32 mx = static_cast<uint32>((abs&0x3FF)|((abs>0x3FF)<<10)) << 20, my, r;
+		#if !HALF_FLUSH_DENORMALS
+			expy -= normalize<10>(abs);
+		#endif
+			expy += abs >> 10;
+			r = ((abs&0x3FF)|0x400) << 5;
+			r *= r;
+			i = r >> 31;
+			expy = 2*expy + i;
+			r >>= i;
+			if(S)
+			{
+				if(expy < 0)
+				{
+					r = 0x40000000 + ((expy>-30) ? ((r>>-expy)|((r&((static_cast<uint32>(1)<<-expy)-1))!=0)) : 1);
+					expy = 0;
+				}
+				else
+				{
+					r += 0x40000000 >> expy;
+					i = r >> 31;
+					r = (r>>i) | (r&i);
+					expy += i;
+				}
+			}
+			else
+			{
+				r -= 0x40000000 >> expy;
+				expy -= normalize<30>(r);
+			}
+			my = sqrt<30>(r, expy);
+			my = (my<<15) + (r<<14)/my;
+			if(S)
+			{
+				mx >>= expy - expx;
+				ilog = expy;
+			}
+			else
+			{
+				my >>= expx - expy;
+				ilog = expx;
+			}
+			my += mx;
+			i = my >> 31;
+			static const int G = S && (R==std::round_to_nearest);
+			return log2_post<R,0xB8AA3B2A>(log2(my>>i, 26+S+G)+(G<<3), ilog+i, 17, arg&(static_cast<unsigned>(S)<<15));
+		}
+
+		/// Class for signed 1.63 floating-point computation
+		struct f63
+		{
+			/// Constructor.
+			/// \param h upper 32 bit of mantissa as Q1.63, normalized by the constructor if needed
+			/// \param l lower 32 bit of mantissa
+			/// \param e exponent
+			/// \param s `true` for negative value, `false` else
+			f63(uint32 h, uint32 l, int e, bool s = false) : hi(h), lo(l), exp(e), sign(s)
+			{
+				if(!hi)
+				{
+					hi = lo;
+					lo = 0;
+					exp -= 32;
+				}
+				if(hi)
+				{
+					int n = clz(hi);
+					hi = ((hi<<n)|(lo>>(31-n)>>1)) & 0xFFFFFFFF;
+					lo = (lo<<n) & 0xFFFFFFFF;
+					exp -= n;
+				}
+			}
+
+			/// Constructor.
+			/// \param abs unsigned half-precision value
+			explicit f63(unsigned int abs) : lo(0), exp(-15-normalize<10>(abs)), sign(false)
+			{
+				hi = static_cast<uint32>((abs&0x3FF)|0x400) << 21;
+				exp += abs >> 10;
+			}
+
+			/// Addition operator.
+			/// \param a first operand
+			/// \param b second operand
+			/// \return \a a + \a b
+			friend f63 operator+(f63 a, f63 b)
+			{
+				if(!b.hi)
+					return a;
+				if(!a.hi)
+					return b;
+				if(b.exp > a.exp || (b.exp == a.exp && (b.hi > a.hi || (b.hi == a.hi && b.lo > a.lo))))
+					std::swap(a, b);
+				shr64(b.hi, b.lo, a.exp-b.exp);
+				if(a.sign != b.sign)
+				{
+					sub64(a.hi, a.lo, b.hi, b.lo);
+					return f63(a.hi, a.lo, a.exp, a.sign);
+				}
+				uint32 lo = (a.lo+b.lo) & 0xFFFFFFFF, c = (a.hi&1) + (b.hi&1) + (lo<b.lo);
+				return f63((a.hi>>1)+(b.hi>>1)+(c>>1), ((c&1)<<31)|(lo>>1), a.exp+1, a.sign);
+			}
+
+			/// Subtraction operator.
+			/// \param a first operand
+			/// \param b second operand
+			/// \return \a a - \a b
+			friend f63 operator-(f63 a, f63 b)
+			{
+				b.sign = !b.sign;
+				return a + b;
+			}
+
+			/// Multiplication operator.
+			/// \param a first operand
+			/// \param b second operand
+			/// \return \a a * \a b
+			friend f63 operator*(f63 a, f63 b)
+			{
+				uint32 lo, hi = mulhi64(a.hi, a.lo, b.hi, b.lo, 0, lo);
+				return f63(hi, lo, a.exp+b.exp+1, a.sign!=b.sign);
+			}
+
+			/// Division operator.
+			/// This multiplies with the reciprocal of the upper 32 bit of the divisor, refined by a Newton step if the lower 
+			/// 32 bit are non-zero.
+			/// \param a dividend
+			/// \param b non-zero divisor
+			/// \return \a a / \a b
+			friend f63 operator/(f63 a, f63 b)
+			{
+				int s;
+				uint32 hi = divide64(0x40000000, b.hi, s), lo = divide64((0-hi*b.hi)&0xFFFFFFFF, b.hi, s);
+				f63 r(hi, lo, -b.exp, b.sign);
+				if(b.lo)
+					r = r + r*(f63(0x80000000, 0, 0)-b*r);
+				return a * r;
+			}
+
+			uint32 hi;			///< upper 32 bit of mantissa as Q1.63.
+			uint32 lo;			///< lower 32 bit of mantissa.
+			int exp;			///< exponent.
+			bool sign;			///< `true` for negative value.
+		};
+
+		/// Polynomial in 64-bit fixed point.
+		/// This uses Horner's method with truncated products, correcting the unsigned products of negative partial sums.
+		/// \param c coefficients in two's complement as upper and lower 32 bit each, starting at the highest degree
+		/// \param n degree of polynomial
+		/// \param xh upper 32 bit of argument as Q0.64
+		/// \param xl lower 32 bit of argument
+		/// \param lo variable to store lower 32 bit of result
+		/// \return upper 32 bit of result in fixed point format of coefficients
+		inline uint32 polynomial(const uint32 *c, int n, uint32 xh, uint32 xl, uint32 &lo)
+		{
+			uint32 hi = *c++;
+			lo = *c++;
+			for(; n>0; --n,c+=2)
+			{
+				uint32 s = (0-(hi>>31)) & 0xFFFFFFFF;
+				hi = mulhi64(hi, lo, xh, xl, 0, lo);
+				sub64(hi, lo, xh&s, xl&s);
+				add64(hi, lo, c[0], c[1]);
+				hi &= 0xFFFFFFFF;
+			}
+			return hi;
+		}
+
+		/// Exponential function in 64-bit fixed point.
+		/// This splits the binary logarithm into integer and fraction, looks up the power of 2 at the next lower multiple of 
+		/// 1/32 of the fraction and corrects it with a Taylor polynomial of degree 7. The relative error is below 
+		/// \f$2^{-56}\f$.
+		/// \param arg exponent of magnitude below 22
+		/// \return exponential of \a arg
+		inline f63 exp(f63 arg)
+		{
+			static const uint32 table[] = {
+				0x80000000, 0x00000000, 0x82CD8698, 0xAC2BA1D7, 0x85AAC367, 0xCC487B15, 0x88980E80, 0x92DA8527,
+				0x8B95C1E3, 0xEA8BD6E7, 0x8EA4398B, 0x45CD53C0, 0x91C3D373, 0xAB11C336, 0x94F4EFA8, 0xFEF70961,
+				0x9837F051, 0x8DB8A96F, 0x9B8D39B9, 0xD54E5539, 0x9EF53260, 0x91A111AE, 0xA2704303, 0x0C496819,
+				0xA5FED6A9, 0xB15138EA, 0xA9A15AB4, 0xEA7C0EF8, 0xAD583EEA, 0x42A14AC6, 0xB123F581, 0xD2AC2590,
+				0xB504F333, 0xF9DE6484, 0xB8FBAF47, 0x62FB9EE9, 0xBD08A39F, 0x580C36BF, 0xC12C4CCA, 0x66709456,
+				0xC5672A11, 0x5506DADD, 0xC9B9BD86, 0x6E2F27A3, 0xCE248C15, 0x1F8480E4, 0xD2A81D91, 0xF12AE45A,
+				0xD744FCCA, 0xD69D6AF4, 0xDBFBB797, 0xDAF23755, 0xE0CCDEEC, 0x2A94E111, 0xE5B906E7, 0x7C8348A8,
+				0xEAC0C6E7, 0xDD24392F, 0xEFE4B99B, 0xDCDAF5CB, 0xF5257D15, 0x2486CC2C, 0xFA83B2DB, 0x722A033A };
+			static const uint32 coeffs[] = {
+				0x00034034, 0x03403403, 0x0016C16C, 0x16C16C17, 0x00888888, 0x88888889, 0x02AAAAAA, 0xAAAAAAAB,
+				0x0AAAAAAA, 0xAAAAAAAB, 0x20000000, 0x00000000, 0x40000000, 0x00000000, 0x40000000, 0x00000000 };
+			f63 v = arg * f63(0xB8AA3B29, 0x5C17F0BC, 0);
+			uint32 hi = v.hi, lo = v.lo;
+			shr64(hi, lo, 5-v.exp);
+			if(v.sign)
+			{
+				lo = (0-lo) & 0xFFFFFFFF;
+				hi = (~hi+(lo==0)) & 0xFFFFFFFF;
+			}
+			int k = static_cast<int>(hi>>26) - static_cast<int>((hi>>25)&0x40);
+			hi = ((hi<<6)|(lo>>26)) & 0xFFFFFFFF;
+			lo = (lo<<6) & 0xFFFFFFFF;
+			const uint32 *entry = table + ((hi>>26)&0x3E);
+			hi = mulhi64(hi&0x7FFFFFF, lo, 0xB17217F7, 0xD1CF79AC, 0, lo);
+			hi = polynomial(coeffs, 7, hi, lo, lo);
+			hi = mulhi64(entry[0], entry[1], hi, lo, 0, lo);
+			return f63(hi, lo, k+2);
+		}
+
+		/// Natural logarithm in 64-bit fixed point.
+		/// This multiplies the mantissa with a tabulated reciprocal slightly below that of the next higher multiple of 1/32 and 
+		/// computes the logarithm of the product with a Taylor polynomial of degree 10. The absolute error is below 
+		/// \f$2^{-57}\f$.
+		/// \param arg positive argument
+		/// \return natural logarithm of \a arg
+		inline f63 log(f63 arg)
+		{
+			static const uint32 table[] = {
+				0xF83E0F83, 0x01F829B1, 0x21833005, 0xF0F0F0F0, 0x03E14618, 0x422C54CC, 0xEA0EA0EA, 0x05BC34A2, 0xBD5AD2E7,
+				0xE38E38E3, 0x0789C1DB, 0xB2BCB97B, 0xDD67C8A6, 0x094AA97C, 0x13FA91A6, 0xD79435E5, 0x0AFF9838, 0x57C9E9E4,
+				0xD20D20D2, 0x0CA92D4E, 0x7E2B5A3B, 0xCCCCCCCC, 0x0E47FBE4, 0x0D4D10D6, 0xC7CE0C7C, 0x0FDC8C36, 0xF71F1547,
+				0xC30C30C3, 0x11675CAB, 0xAFA60E04, 0xBE82FA0B, 0x12E8E2BB, 0x2F1D309C, 0xBA2E8BA2, 0x14618BC2, 0x6C5EC27D,
+				0xB60B60B6, 0x15D1BDBF, 0x5C09CA51, 0xB21642C8, 0x1739D7F6, 0xDBD0069D, 0xAE4C415C, 0x189A3386, 0xF9425AB6,
+				0xAAAAAAAA, 0x19F323EC, 0xFF984BF3, 0xA72F0539, 0x1B44F77B, 0xFA8F628D, 0xA3D70A3D, 0x1C8FF7C7, 0xC69A21AC,
+				0xA0A0A0A0, 0x1DD46A05, 0x01C4A0BF, 0x9D89D89D, 0x1F128F5F, 0xE706ECB3, 0x9A90E7D9, 0x204AA54B, 0x71A1FD8D,
+				0x97B425ED, 0x217CE5C8, 0x4E55056D, 0x94F2094F, 0x22A987A5, 0xF7ABD353, 0x92492492, 0x23D0BEBD, 0x0081A07C,
+				0x8FB823EE, 0x24F2BC25, 0x176235D7, 0x8D3DCB08, 0x260FAE66, 0xFE217C40, 0x8AD8F2FB, 0x2727C1A6, 0xFA543354,
+				0x88888888, 0x283B1FD0, 0xCCE55CC9, 0x864B8A7D, 0x2949F0BB, 0xCE7D7605, 0x84210842, 0x2A545A4C, 0xBF8B55DD,
+				0x82082082, 0x2B5A8098, 0x6F3E59F6, 0x80000000, 0x2C5C85FD, 0xF473DE6B };
+			static const uint32 coeffs[] = {
+				0x06666666, 0x66666666, 0x071C71C7, 0x1C71C71C, 0x08000000, 0x00000000, 0x09249249, 0x24924925,
+				0x0AAAAAAA, 0xAAAAAAAB, 0x0CCCCCCC, 0xCCCCCCCD, 0x10000000, 0x00000000, 0x15555555, 0x55555555,
+				0x20000000, 0x00000000, 0x40000000, 0x00000000 };
+			const uint32 *entry = table + 3*((arg.hi>>26)&0x1F);
+			uint32 vl, vh = mulhilo(arg.hi, entry[0], vl), ph = 0x80000000, pl = 0;
+			add64(vh, vl, 0, mulhi<std::round_toward_zero>(arg.lo, entry[0]));
+			sub64(ph, pl, vh, vl);
+			vh = ((ph<<1)|(pl>>31)) & 0xFFFFFFFF;
+			vl = (pl<<1) & 0xFFFFFFFF;
+			ph = polynomial(coeffs, 9, vh, vl, pl);
+			ph = mulhi64(vh, vl, ph, pl, 0, pl);
+			vh = entry[1];
+			vl = entry[2];
+			bool sign = ph > vh || (ph == vh && pl > vl);
+			if(sign)
+			{
+				std::swap(ph, vh);
+				std::swap(pl, vl);
+			}
+			sub64(vh, vl, ph, pl);
+			int exp = arg.exp;
+			return f63(static_cast<uint32>((exp<0) ? -exp : exp), 0, 31, exp<0) * f63(0xB17217F7, 0xD1CF79AC, -1) + f63(vh, vl, 1, sign);
+		}
+
+		/// Sine of multiple of pi in 64-bit fixed point.
+		/// This evaluates the Taylor polynomial of degree 23 with a relative error below \f$2^{-58}\f$.
+		/// \param arg argument in (0,0.5] with 32-bit mantissa
+		/// \return sine of pi times \a arg
+		inline f63 sinpi(f63 arg)
+		{
+			static const uint32 coeffs[] = {
+				0xFFFFFFFF, 0xFF46F504, 0x00000000, 0x250EE042, 0xFFFFFFF9, 0xD6FEF7B8, 0x000000D5, 0x761957CA,
+				0xFFFFE905, 0x2460EAA9, 0x0001E8F4, 0x34D018D6, 0xFFE1CF8B, 0x021778E1, 0x01507834, 0x87EE781C,
+				0xF6696998, 0xCEA13D21, 0x28CD78CE, 0xEB55C3A5, 0xAD510C67, 0x6906B505, 0x3243F6A8, 0x885A308D };
+			uint32 lo, hi = mulhilo(arg.hi, arg.hi, lo);
+			shr64(hi, lo, -2-2*arg.exp);
+			hi = polynomial(coeffs, 11, hi, lo, lo);
+			return arg * f63(hi, lo, 3);
+		}
+
+		/// Error function in 64-bit fixed point.
+		/// This approximates erf(x)/x by a minimax polynomial in x^2 for |x| <= 1 and erfc(x)e^(x^2) by a minimax polynomial in 
+		/// 1/x otherwise, both with a relative error below \f$2^{-42}\f$.
+		/// \tparam C `true` for complementary error function, `false` else
+		/// \param arg half-precision function argument of magnitude in (0,4)
+		/// \return function value
+		template<bool C> f63 erf_fixed(unsigned int arg)
+		{
+			static const uint32 small[] = {
+				0xFFFF1F68, 0xCCCCCCCD, 0x00066AFE, 0x80000000, 0xFFE0F974, 0xDCCCCCCC, 0x007E5031, 0xF8000004,
+				0xFE3FD7A5, 0xAA599990, 0x05596E7D, 0xBF266680, 0xF23E98F5, 0x73B0CC80, 0x1CE2F219, 0x77372700,
+				0xCFDB1729, 0xFB352800, 0x48375D41, 0x0A6C4800 };
+			static const uint32 large[] = {
+				0x0028DCB4, 0x2AF35A96, 0xFE3F8720, 0xFFAB58C0, 0x08F5147C, 0x28A12580, 0xE3B5095C, 0xAFC0F500,
+				0x3DA9FEF5, 0x44B30A00, 0x9E0C7771, 0xBBCEBC00, 0x746E5547, 0x67DEB000, 0x97E9D756, 0x70759C00,
+				0x44892A65, 0xB5AD7400, 0xE1162E74, 0x3CF1E200, 0x07734129, 0xB504BDC0, 0x002E6A85, 0x37FD6DB0,
+				0x0037FC6B, 0xC42D7C48, 0xFED9A794, 0x47D409E0, 0x00005261, 0x179F2AE1, 0x0241B8DF, 0x0F45C360,
+				0xFFFFFFFC, 0x2136AE65 };
+			unsigned int abs = arg & 0x7FFF;
+			bool sign = (arg&0x8000) != 0;
+			f63 one(0x80000000, 0, 0), x(abs), e = one;
+			if(abs <= 0x3C00)
+			{
+				uint32 lo = 0, hi = 0x80000000;
+				if(x.exp)
+				{
+					hi = mulhilo(x.hi, x.hi, lo);
+					shr64(hi, lo, -1-2*x.exp);
+				}
+				hi = polynomial(small, 9, hi, lo, lo);
+				e = x * f63(hi, lo, 1);
+				if(C)
+					return sign ? (one+e) : (one-e);
+			}
+			else
+			{
+				int s, n = (abs>>10) - 15;
+				uint32 m = (abs&0x3FF) | 0x400, hi = divide64(0x400>>n, m, s), lo = divide64((0-hi*m)&0xFFFFFFFF, m, s);
+				hi = polynomial(large, 16, hi, lo, lo);
+				x = x * x;
+				x.sign = true;
+				e = exp(x) * f63(hi, lo, 5);
+				if(C)
+					return sign ? (f63(0x80000000, 0, 1)-e) : e;
+				e = one - e;
+			}
+			e.sign = sign;
+			return e;
+		}
+
+		/// Gamma function in 64-bit fixed point.
+		/// Below 10 this looks up a minimax polynomial of degree 13 for the gamma function on the quarter of [1,2) holding the 
+		/// fractional part, with a relative error below \f$2^{-57}\f$, and shifts it to the argument with the recurrence 
+		/// relation, so only the logarithm needs a call to log(). Above that it evaluates Stirling's series up to the 13th 
+		/// power. It uses the reflection formula for negative arguments. The error is below \f$2^{-50}\f$ relative to the 
+		/// magnitude of the result or, for logarithms, to 1.
+		/// \tparam L `true` for logarithm of gamma function, `false` for gamma function
+		/// \param arg half-precision function argument, no pole
+		/// \return function value
+		template<bool L> f63 gamma_fixed(unsigned int arg)
+		{
+			static const uint32 coeffs[] = {
+				0x01A41A41, 0xA41A41A4, 0xFF82553C, 0x999B0E0E, 0x00372A3C, 0x5631FE47, 0xFFD8FD8F, 0xD8FD8FD9,
+				0x00340340, 0x34034034, 0xFF49F49F, 0x49F49F4A, 0x15555555, 0x55555555 };
+			static const uint32 table[] = {
+				0xFFFFFFFC, 0xC9B7C6FC, 0x00000023, 0x54AC3DCF, 0xFFFFFF2C, 0x705CCDF2, 0x000003CF, 0x4AC8089B,
+				0xFFFFF029, 0x48860606, 0x00003FCC, 0x4DC18F9D, 0xFFFF010E, 0x31F1F291, 0x0003F8F9, 0xD0183939,
+				0xFFF049BF, 0xF80D5B21, 0x003ED4A1, 0xFD082CE5, 0xFF17AF73, 0x876FED58, 0x03F4CB18, 0x4758A776,
+				0xF6C3B981, 0xC8251AE6, 0x3FFFFFFF, 0xFFFFFFE6, 0xFFFFFFFF, 0xCF30472C, 0x00000002, 0x49A5D78A,
+				0xFFFFFFF0, 0x657A8AFD, 0x00000055, 0xA2ED8B17, 0xFFFFFE4B, 0x2BE502D0, 0x0000088C, 0x08351795,
+				0xFFFFD57E, 0xF1FDD70D, 0x0000D47E, 0xEA9948C2, 0xFFFBFE30, 0x72743CEE, 0x0014F1D1, 0x269B51E8,
+				0xFFAC99C2, 0xAA21AD37, 0x0243A9D0, 0x0E2FAAFF, 0xFCB38CE8, 0xE8B0AACE, 0x3A027F88, 0xFDDDD478,
+				0xFFFFFFFF, 0xFB559E64, 0x00000000, 0x3CA1D5FA, 0xFFFFFFFE, 0x2E90226B, 0x0000000B, 0xA128A085,
+				0xFFFFFFB9, 0x974D9963, 0x000001A7, 0x3F73B881, 0xFFFFF645, 0x890A89B2, 0x00003C04, 0x54BEDC52,
+				0xFFFEC277, 0x3084964D, 0x000941DE, 0x9B9A420D, 0xFFE48853, 0xE35E0DC2, 0x01A8C4DB, 0xA620CBB5,
+				0x00847544, 0x772B0DB2, 0x38B7F123, 0x69DED54F, 0xFFFFFFFF, 0xFF5FF8EB, 0x00000000, 0x08BFBFFD,
+				0xFFFFFFFF, 0xB542734F, 0x00000002, 0x249E7235, 0xFFFFFFF1, 0x138B7921, 0x0000006A, 0xBCF992EC,
+				0xFFFFFD50, 0xB1F24B6E, 0x00001619, 0x792290D8, 0xFFFFA102, 0x90F97CA8, 0x000596A3, 0x81DE810C,
+				0x0000CE40, 0x8BC2E33A, 0x01845FC5, 0xD28F652D, 0x03A39AE9, 0xBE58AF1D, 0x3AD1EBA1, 0xF2E28407 };
+			unsigned int abs = arg & 0x7FFF, n = 0;
+			f63 one(0x80000000, 0, 0), x(abs), z = (arg&0x8000) ? (x+one) : x, s = one, y = one;
+			if(arg & 0x8000)
+			{
+				int e = (abs>>10) - 15;
+				if(e < -1)
+					s = sinpi(x);
+				else
+				{
+					uint32 m = (abs&0x3FF) | 0x400, f = (m<<(22+e)) & 0xFFFFFFFF;
+					n = m >> (10-e);
+					s = sinpi(f63((f&0x80000000) ? ((0-f)&0xFFFFFFFF) : f, 0, -1));
+				}
+			}
+			if(z.exp < 3 || (z.exp == 3 && z.hi < 0xA0000000))
+			{
+				uint32 zh = z.hi, zl = z.lo, lo, hi;
+				shr64(zh, zl, 3-z.exp);
+				hi = polynomial(table+28*((zh>>26)&3), 13, ((zh<<6)|(zl>>26))&0xFFFFFFFF, (zl<<6)&0xFFFFFFFF, lo);
+				y = f63(hi, lo, 1);
+				if(zh < 0x10000000)
+					y = y / z;
+				for(uint32 i=0x10000000; i<(zh&0xF0000000); i+=0x10000000)
+					y = y * f63(zh-i, zl, 3);
+				if(arg & 0x8000)
+				{
+					y = s * y;
+					if(L)
+						return f63(0x92868247, 0x3D0DE85F, 0) - log(y);
+					y = f63(0xC90FDAA2, 0x2168C235, 1) / y;
+					y.sign = !(n&1);
+					return y;
+				}
+				return L ? log(y) : y;
+			}
+			int e;
+			uint32 rh = divide64(0x40000000, z.hi, e), rl = divide64((0-rh*z.hi)&0xFFFFFFFF, z.hi, e), lo, hi;
+			shr64(rh, rl, z.exp-1);
+			hi = mulhi64(rh, rl, rh, rl, 0, lo);
+			hi = polynomial(coeffs, 6, hi, lo, lo);
+			hi = mulhi64(rh, rl, hi, lo, 0, lo);
+			y = (z-f63(0x80000000, 0, -1))*log(z) - z + f63(hi, lo, -1);
+			if(arg & 0x8000)
+			{
+				y = f63(0xE735D92D, 0x5098AE23, -3) - log(s) - y;
+				if(!L)
+				{
+					y = exp(y);
+					y.sign = !(n&1);
+				}
+				return y;
+			}
+			y = y + f63(0xEB3F8E43, 0x25F5A535, -1);
+			return L ? y : exp(y);
+		}
+
+		/// Postprocessing for error and gamma functions.
+		/// \tparam R rounding mode to use
+		/// \param arg inexact function value
+		/// \return value rounded to half-precision
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if no other exception occurred
+		template<std::float_round_style R> unsigned int special_post(f63 arg)
+		{
+			unsigned int sign = static_cast<unsigned>(arg.sign) << 15;
+			if(arg.exp > 15)
+				return overflow<R>(sign);
+			if(arg.exp < -25)
+				return underflow<R>(sign);
+			return fixed2half<R,30,false,false,true>(arg.hi>>1, arg.exp+14, sign, 1);
+		}
+
+		/// Error function and postprocessing.
+		/// This computes the value with erf_fixed() using only integer arithmetic, so the results are identical in all 
+		/// configurations. The tests check for every argument that the value is within \f$2^{-41}\f$ relative to the exact one 
+		/// and any value within \f$2^{-38}\f$ rounds the same in all rounding modes, so the results are correctly rounded.
+		/// \tparam R rounding mode to use
+		/// \tparam C `true` for complementary error function, `false` else
+		/// \param arg half-precision function argument
+		/// \return approximated value of error function in half-precision
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if no other exception occurred
+		template<std::float_round_style R,bool C> unsigned int erf(unsigned int arg)
+		{
+			return special_post<R>(erf_fixed<C>(arg));
+		}
+
+		/// Gamma function and postprocessing.
+		/// This computes positive integer arguments of the gamma function exactly as factorials and other values with 
+		/// gamma_fixed() using only integer arithmetic, so the results are identical in all configurations. The tests check 
+		/// this like for erf(), with the errors of small logarithms taken relative to 1, so the results are correctly rounded.
+		/// \tparam R rounding mode to use
+		/// \tparam L `true` for logarithm of gamma function, `false` for gamma function
+		/// \param arg half-precision floating-point value
+		/// \return lgamma/tgamma(\a arg) in half-precision
+		/// \exception FE_OVERFLOW on overflows
+		/// \exception FE_UNDERFLOW on underflows
+		/// \exception FE_INEXACT if \a arg is not a positive integer
+		template<std::float_round_style R,bool L> unsigned int gamma(unsigned int arg)
+		{
+			if(!L && arg >= 0x3C00 && arg < 0x6400 && !(arg&((1<<(25-(arg>>10)))-1)))
+			{
+				uint32 f = 1;
+				for(uint32 i=2, n=((arg&0x3FF)|0x400)>>(25-(arg>>10)); i<n; ++i)
+					f *= i;
+				return int2half<R>(f);
+			}
+			return special_post<R>(gamma_fixed<L>(arg));
+		}
+
+		/// Exponential function.
+		/// This computes the results of exp<R>() and is used to build its [function table](\ref HALF_ENABLE_UNARY_TABLES).
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to exp<R>()
+		template<std::float_round_style R> unsigned int exp_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::exp(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, e = (abs>>10) + (abs<=0x3FF), exp;
+			if(!abs)
+				return 0x3C00;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? (0x7C00&((arg>>15)-1U)) : signal(arg));
+			if(abs >= 0x4C80)
+				return flush_result((arg&0x8000) ? underflow<R>() : overflow<R>());
+			uint32 m = multiply64(static_cast<uint32>((abs&0x3FF)+((abs>0x3FF)<<10))<<21, 0xB8AA3B29);
+			if(e < 14)
+			{
+				exp = 0;
+				m >>= 14 - e;
+			}
+			else
+			{
+				exp = m >> (45-e);
+				m = (m<<(e-14)) & 0x7FFFFFFF;
+			}
+			return flush_result(exp2_post<R>(m, exp, (arg&0x8000)!=0, 0, 26));
+		#endif
+		}
+
+		/// Binary exponential.
+		/// This computes the results of exp2<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to exp2<R>()
+		template<std::float_round_style R> unsigned int exp2_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::exp2(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, e = (abs>>10) + (abs<=0x3FF), exp = (abs&0x3FF) + ((abs>0x3FF)<<10);
+			if(!abs)
+				return 0x3C00;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? (0x7C00&((arg>>15)-1U)) : signal(arg));
+			if(abs >= 0x4E40)
+				return flush_result((arg&0x8000) ? underflow<R>() : overflow<R>());
+			return flush_result(exp2_post<R>(
+				(static_cast<uint32>(exp)<<(6+e))&0x7FFFFFFF, exp>>(25-e), (arg&0x8000)!=0, 0, 28));
+		#endif
+		}
+
+		/// Exponential minus one.
+		/// This computes the results of expm1<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to expm1<R>()
+		template<std::float_round_style R> unsigned int expm1_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::expm1(half2float<internal_t>(arg))));
+		#else
+			unsigned int abs = arg & 0x7FFF, sign = arg & 0x8000, e = (abs>>10) + (abs<=0x3FF), exp;
+			if(!abs)
+				return arg;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? (0x7C00+(sign>>1)) : signal(arg));
+			if(abs >= 0x4A00)
+				return flush_result((arg&0x8000) ? rounded<R,true>(0xBBFF, 1, 1) : overflow<R>());
+			uint32 m = multiply64(static_cast<uint32>((abs&0x3FF)+((abs>0x3FF)<<10))<<21, 0xB8AA3B29);
+			if(e < 14)
+			{
+				exp = 0;
+				m >>= 14 - e;
+			}
+			else
+			{
+				exp = m >> (45-e);
+				m = (m<<(e-14)) & 0x7FFFFFFF;
+			}
+			m = exp2(m);
+			if(sign)
+			{
+				int s = 0;
+				if(m > 0x80000000)
+				{
+					++exp;
+					m = divide64(0x80000000, m, s);
+				}
+				m = 0x80000000 - ((m>>exp)|((m&((static_cast<uint32>(1)<<exp)-1))!=0)|s);
+				exp = 0;
+			}
+			else
+				m -= (exp<31) ? (0x80000000>>exp) : 1;
+			exp += 14;
+			exp -= normalize<31>(m, exp);
+			if(exp > 29)
+				return flush_result(overflow<R>());
+			return flush_result(rounded<R,true>(sign+(exp<<10)+(m>>21), (m>>20)&1, (m&0xFFFFF)!=0));
+		#endif
+		}
+
+		/// Natural logarithm.
+		/// This computes the results of log<R>() and is used to build its [function table](\ref HALF_ENABLE_UNARY_TABLES).
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to log<R>()
+		template<std::float_round_style R> unsigned int log_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::log(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, exp = -15;
+			if(!abs)
+				return pole(0x8000);
+			if(arg & 0x8000)
+				return flush_result((arg<=0xFC00) ? invalid() : signal(arg));
+			if(abs >= 0x7C00)
+				return (abs==0x7C00) ? arg : signal(arg);
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(abs);
+		#endif
+			exp += abs >> 10;
+			return flush_result(log2_post<R,0xB8AA3B2A>(
+				log2(static_cast<uint32>((abs&0x3FF)|0x400)<<20, 27)+8, exp, 17));
+		#endif
+		}
+
+		/// Common logarithm.
+		/// This computes the results of log10<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to log10<R>()
+		template<std::float_round_style R> unsigned int log10_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::log10(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, exp = -15;
+			if(!abs)
+				return pole(0x8000);
+			if(arg & 0x8000)
+				return flush_result((arg<=0xFC00) ? invalid() : signal(arg));
+			if(abs >= 0x7C00)
+				return (abs==0x7C00) ? arg : signal(arg);
+			switch(abs)
+			{
+				case 0x4900: return 0x3C00;
+				case 0x5640: return 0x4000;
+				case 0x63D0: return 0x4200;
+				case 0x70E2: return 0x4400;
+			}
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(abs);
+		#endif
+			exp += abs >> 10;
+			return flush_result(log2_post<R,0xD49A784C>(
+				log2(static_cast<uint32>((abs&0x3FF)|0x400)<<20, 27)+8, exp, 16));
+		#endif
+		}
+
+		/// Binary logarithm.
+		/// This computes the results of log2<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to log2<R>()
+		template<std::float_round_style R> unsigned int log2_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::log2(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, exp = -15, s = 0;
+			if(!abs)
+				return pole(0x8000);
+			if(arg & 0x8000)
+				return flush_result((arg<=0xFC00) ? invalid() : signal(arg));
+			if(abs >= 0x7C00)
+				return (abs==0x7C00) ? arg : signal(arg);
+			if(abs == 0x3C00)
+				return 0;
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(abs);
+		#endif
+			exp += (abs>>10);
+			if(!(abs&0x3FF))
+			{
+				unsigned int value = static_cast<unsigned>(exp<0) << 15, m = std::abs(exp) << 6;
+				exp = 18 - normalize<10>(m);
+				return flush_result(value+(exp<<10)+m);
+			}
+			uint32 ilog = exp, sign = sign_mask(ilog), m = 
+				(((ilog<<27)+(log2(static_cast<uint32>((abs&0x3FF)|0x400)<<20, 28)>>4))^sign) - sign;
+			if(!m)
+				return 0;
+			exp = 14 - normalize<27>(m, 14);
+			for(; m>0xFFFFFFF; m>>=1,++exp)
+				s |= m & 1;
+			return flush_result(fixed2half<R,27,false,false,true>(m, exp, sign&0x8000, s));
+		#endif
+		}
+
+		/// Natural logarithm plus one.
+		/// This computes the results of log1p<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to log1p<R>()
+		template<std::float_round_style R> unsigned int log1p_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::log1p(half2float<internal_t>(arg))));
+		#else
+			if(arg >= 0xBC00)
+				return flush_result((arg==0xBC00) ? pole(0x8000) : (arg<=0xFC00) ? invalid() : signal(arg));
+			int abs = arg & 0x7FFF, exp = -15;
+			if(!abs || abs >= 0x7C00)
+				return (abs>0x7C00) ? signal(arg) : arg;
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(abs);
+		#endif
+			exp += abs >> 10;
+			uint32 m = static_cast<uint32>((abs&0x3FF)|0x400) << 20;
+			if(arg & 0x8000)
+			{
+				m = 0x40000000 - (m>>-exp);
+				exp = -normalize<30>(m);
+			}
+			else
+			{
+				if(exp < 0)
+				{
+					m = 0x40000000 + (m>>-exp);
+					exp = 0;
+				}
+				else
+				{
+					m += 0x40000000 >> exp;
+					int i = m >> 31;
+					m >>= i;
+					exp += i;
+				}
+			}
+			return flush_result(log2_post<R,0xB8AA3B2A>(log2(m), exp, 17));
+		#endif
+		}
+
+		/// Cubic root.
+		/// This computes the results of cbrt<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to cbrt<R>()
+		template<std::float_round_style R> unsigned int cbrt_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::cbrt(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, exp = -15;
+			if(!abs || abs == 0x3C00 || abs >= 0x7C00)
+				return (abs>0x7C00) ? signal(arg) : arg;
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(abs);
+		#endif
+			uint32 ilog = exp + (abs>>10), sign = sign_mask(ilog), f, m = 
+				(((ilog<<27)+(log2(static_cast<uint32>((abs&0x3FF)|0x400)<<20, 24)>>4))^sign) - sign;
+			exp = 2 - normalize<31>(m);
+			m = multiply64(m, 0xAAAAAAAB);
+			int i = m >> 31, s;
+			exp += i;
+			m <<= 1 - i;
+			if(exp < 0)
+			{
+				f = m >> -exp;
+				exp = 0;
+			}
+			else
+			{
+				f = (m<<exp) & 0x7FFFFFFF;
+				exp = m >> (31-exp);
+			}
+			m = exp2(f, (R==std::round_to_nearest) ? 29 : 26);
+			if(sign)
+			{
+				if(m > 0x80000000)
+				{
+					m = divide64(0x80000000, m, s);
+					++exp;
+				}
+				exp = -exp;
+			}
+			return flush_result((R==std::round_to_nearest) ?
+				fixed2half<R,31,false,false,false>(m, exp+14, arg&0x8000) :
+				fixed2half<R,23,false,false,false>((m+0x80)>>8, exp+14, arg&0x8000));
+		#endif
+		}
+
+		/// Sine function.
+		/// This computes the results of sin<R>() and is used to build its [function table](\ref HALF_ENABLE_UNARY_TABLES).
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to sin<R>()
+		template<std::float_round_style R> unsigned int sin_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::sin(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, k;
+			if(!abs)
+				return arg;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? invalid() : signal(arg));
+			if(abs < 0x2900)
+				return flush_result(rounded<R,true>(arg-1, 1, 1));
+			if(R != std::round_to_nearest)
+				switch(abs)
+				{
+					case 0x48B7: return flush_result(rounded<R,true>((~arg&0x8000)|0x1D07, 1, 1));
+					case 0x598C: return flush_result(rounded<R,true>((arg&0x8000)|0x3BFF, 1, 1));
+					case 0x6A64: return flush_result(rounded<R,true>((~arg&0x8000)|0x3BFE, 1, 1));
+					case 0x6D8C: return flush_result(rounded<R,true>((arg&0x8000)|0x0FE6, 1, 1));
+				}
+			std::pair<uint32,uint32> sc = sincos(angle_arg(abs, k));
+			uint32 sign = -static_cast<uint32>(((k>>1)&1)^(arg>>15));
+			return flush_result(fixed2half<R,30,true,true,true>((((k&1) ? sc.second : sc.first)^sign) - sign));
+		#endif
+		}
+
+		/// Cosine function.
+		/// This computes the results of cos<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to cos<R>()
+		template<std::float_round_style R> unsigned int cos_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::cos(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, k;
+			if(!abs)
+				return 0x3C00;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? invalid() : signal(arg));
+			if(abs < 0x2500)
+				return flush_result(rounded<R,true>(0x3BFF, 1, 1));
+			if(R != std::round_to_nearest)
+				switch(abs)
+				{
+					case 0x598C: return flush_result(rounded<R,true>(0x80FC, 1, 1));
+					case 0x5D8C: return flush_result(rounded<R,true>(0xBBFF, 1, 1));
+				}
+			std::pair<uint32,uint32> sc = sincos(angle_arg(abs, k));
+			uint32 sign = -static_cast<uint32>(((k>>1)^k)&1);
+			return flush_result(fixed2half<R,30,true,true,true>((((k&1) ? sc.first : sc.second)^sign) - sign));
+		#endif
+		}
+
+		/// Tangent function.
+		/// This computes the results of tan<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to tan<R>()
+		template<std::float_round_style R> unsigned int tan_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::tan(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, exp = 13, k;
+			if(!abs)
+				return arg;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? invalid() : signal(arg));
+			if(abs < 0x2700)
+				return flush_result(rounded<R,true>(arg, 0, 1));
+			if(R != std::round_to_nearest)
+				switch(abs)
+				{
+					case 0x658C: return flush_result(rounded<R,true>((arg&0x8000)|0x07E6, 1, 1));
+					case 0x7330: return flush_result(rounded<R,true>((~arg&0x8000)|0x4B62, 1, 1));
+				}
+			std::pair<uint32,uint32> sc = sincos(angle_arg(abs, k));
+			if(k & 1)
+				sc = std::make_pair(-sc.second, sc.first);
+			uint32 signy = sign_mask(sc.first), signx = sign_mask(sc.second);
+			uint32 my = (sc.first^signy) - signy, mx = (sc.second^signx) - signx;
+			exp -= normalize<31>(my);
+			exp += normalize<31>(mx);
+			return flush_result(tangent_post<R>(my, mx, exp, (signy^signx^arg)&0x8000));
+		#endif
+		}
+
+		/// Arc tangent function.
+		/// This computes the results of atan<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to atan<R>()
+		template<std::float_round_style R> unsigned int atan_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::atan(half2float<internal_t>(arg))));
+		#else
+			unsigned int abs = arg & 0x7FFF, sign = arg & 0x8000;
+			if(!abs)
+				return arg;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? rounded<R,true>(sign|0x3E48, 0, 1) : signal(arg));
+			if(abs <= 0x2700)
+				return flush_result(rounded<R,true>(arg-1, 1, 1));
+			int exp = (abs>>10) + (abs<=0x3FF);
+			uint32 my = (abs&0x3FF) | ((abs>0x3FF)<<10);
+			uint32 lo, m = (exp>15) ?	atan2(my<<19, 0x20000000>>(exp-15), lo) :
+												atan2(my<<(exp+4), 0x20000000, lo);
+			return flush_result(fixed2half<R,30,false,true,true>(m, 14, sign, lo!=0));
+		#endif
+		}
+
+		/// Hyperbolic sine.
+		/// This computes the results of sinh<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to sinh<R>()
+		template<std::float_round_style R> unsigned int sinh_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::sinh(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, exp;
+			if(!abs || abs >= 0x7C00)
+				return (abs>0x7C00) ? signal(arg) : arg;
+			if(abs <= 0x2900)
+				return flush_result(rounded<R,true>(arg, 0, 1));
+			std::pair<uint32,uint32> mm = hyperbolic_args(abs, exp, (R==std::round_to_nearest) ? 29 : 27);
+			uint32 m = mm.first - mm.second;
+			exp += 13;
+			exp -= normalize<31>(m, exp);
+			unsigned int sign = arg & 0x8000;
+			if(exp > 29)
+				return flush_result(overflow<R>(sign));
+			return flush_result(fixed2half<R,31,false,false,true>(m, exp, sign));
+		#endif
+		}
+
+		/// Hyperbolic cosine.
+		/// This computes the results of cosh<R>().
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to cosh<R>()
+		template<std::float_round_style R> unsigned int cosh_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::cosh(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, exp;
+			if(!abs)
+				return 0x3C00;
+			if(abs >= 0x7C00)
+				return flush_result((abs>0x7C00) ? signal(arg) : 0x7C00);
+			std::pair<uint32,uint32> mm = hyperbolic_args(abs, exp, (R==std::round_to_nearest) ? 23 : 26);
+			uint32 m = mm.first + mm.second, i = (~m&0xFFFFFFFF) >> 31;
+			m = (m>>i) | (m&i) | 0x80000000;
+			if((exp+=13+i) > 29)
+				return flush_result(overflow<R>());
+			return flush_result(fixed2half<R,31,false,false,true>(m, exp));
+		#endif
+		}
+
+		/// Hyperbolic tangent.
+		/// This computes the results of tanh<R>() and is used to build its [function table](\ref HALF_ENABLE_UNARY_TABLES).
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to tanh<R>()
+		template<std::float_round_style R> unsigned int tanh_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::tanh(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF, exp;
+			if(!abs)
+				return arg;
+			if(abs >= 0x7C00)
+				return flush_result((abs>0x7C00) ? signal(arg) : (arg-0x4000));
+			if(abs >= 0x4500)
+				return flush_result(rounded<R,true>((arg&0x8000)|0x3BFF, 1, 1));
+			if(abs < 0x2700)
+				return flush_result(rounded<R,true>(arg-1, 1, 1));
+			if(R != std::round_to_nearest && abs == 0x2D3F)
+				return flush_result(rounded<R,true>(arg-3, 0, 1));
+			std::pair<uint32,uint32> mm = hyperbolic_args(abs, exp, 27);
+			uint32 my = mm.first - mm.second - (R!=std::round_to_nearest), mx = mm.first + mm.second, i = (~mx&0xFFFFFFFF) >> 31;
+			exp = 13 - normalize<31>(my);
+			mx = (mx>>i) | 0x80000000;
+			return flush_result(tangent_post<R>(my, mx, exp-i, arg&0x8000));
+		#endif
+		}
+
+		/// Error function.
+		/// This computes the results of erf<R>() and is used to build its [function table](\ref HALF_ENABLE_UNARY_TABLES).
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to erf<R>()
+		template<std::float_round_style R> unsigned int erf_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::erf(half2float<internal_t>(arg))));
+		#else
+			unsigned int abs = arg & 0x7FFF;
+			if(!abs || abs >= 0x7C00)
+				return (abs>=0x7C00) ? flush_result((abs==0x7C00) ? (arg-0x4000) : signal(arg)) : arg;
+			if(abs >= 0x4200)
+				return flush_result(rounded<R,true>((arg&0x8000)|0x3BFF, 1, 1));
+			return flush_result(erf<R,false>(arg));
+		#endif
+		}
+
+		/// Complementary error function.
+		/// This computes the results of erfc<R>() and is used to build its [function table](\ref HALF_ENABLE_UNARY_TABLES).
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to erfc<R>()
+		template<std::float_round_style R> unsigned int erfc_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::erfc(half2float<internal_t>(arg))));
+		#else
+			unsigned int abs = arg & 0x7FFF, sign = arg & 0x8000;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? (sign>>1) : signal(arg));
+			if(!abs)
+				return 0x3C00;
+			if(abs >= 0x4400)
+				return flush_result(rounded<R,true>((sign>>1)-(sign>>15), sign>>15, 1));
+			return flush_result(erf<R,true>(arg));
+		#endif
+		}
+
+		/// Natural logarithm of gamma function.
+		/// This computes the results of lgamma<R>() and is used to build its [function table](\ref HALF_ENABLE_UNARY_TABLES).
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to lgamma<R>()
+		template<std::float_round_style R> unsigned int lgamma_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::lgamma(half2float<internal_t>(arg))));
+		#else
+			int abs = arg & 0x7FFF;
+			if(abs >= 0x7C00)
+				return flush_result((abs==0x7C00) ? 0x7C00 : signal(arg));
+			if(!abs || arg >= 0xE400 || (arg >= 0xBC00 && !(abs&((1<<(25-(abs>>10)))-1))))
+				return pole();
+			if(arg == 0x3C00 || arg == 0x4000)
+				return 0;
+			return flush_result(gamma<R,true>(arg));
+		#endif
+		}
+
+		/// Gamma function.
+		/// This computes the results of tgamma<R>() and is used to build its [function table](\ref HALF_ENABLE_UNARY_TABLES).
+		/// \tparam R rounding mode to use
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to tgamma<R>()
+		template<std::float_round_style R> unsigned int tgamma_impl(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+			return flush_result(float2half<R>(std::tgamma(half2float<internal_t>(arg))));
+		#else
+			unsigned int abs = arg & 0x7FFF;
+			if(!abs)
+				return pole(arg);
+			if(abs >= 0x7C00)
+				return (arg==0x7C00) ? arg : signal(arg);
+			if(arg >= 0xE400 || (arg >= 0xBC00 && !(abs&((1<<(25-(abs>>10)))-1))))
+				return invalid();
+			if(arg >= 0xCA80)
+				return flush_result(underflow<R>((1-((abs>>(25-(abs>>10)))&1))<<15));
+			if(arg < 0x100 || (arg >= 0x4900 && arg < 0x8000))
+				return flush_result(overflow<R>());
+			if(arg == 0x3C00)
+				return arg;
+			return flush_result(gamma<R,false>(arg));
+		#endif
+		}
+
+		/// \}
+		/// \name Basic arithmetic
+		/// \{
+
+		/// Half-precision addition using integer arithmetic.
+		/// \tparam R rounding mode to use
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return sum as half-precision bits
+		/// \exception FE_INVALID if \a x and \a y are infinities with different signs or signaling NaNs
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int add_soft(unsigned int x, unsigned int y)
+		{
+			int absx = x & 0x7FFF, absy = y & 0x7FFF;
+			bool sub = ((x^y)&0x8000) != 0;
+			if(absx >= 0x7C00 || absy >= 0x7C00)
+				return (absx>0x7C00 || absy>0x7C00) ? signal(x, y) : (absy!=0x7C00) ? x : (sub && absx==0x7C00) ? invalid() : y;
+			if(!absx)
+				return absy ? y : (R==std::round_toward_neg_infinity) ? (x|y) : (x&y);
+			if(!absy)
+				return x;
+			unsigned int sign = ((sub && absy>absx) ? y : x) & 0x8000;
+			if(absy > absx)
+				std::swap(absx, absy);
+			int exp = (absx>>10) + (absx<=0x3FF), d = exp - (absy>>10) - (absy<=0x3FF), mx = ((absx&0x3FF)|((absx>0x3FF)<<10)) << 3, my;
+			if(d < 13)
+			{
+				my = ((absy&0x3FF)|((absy>0x3FF)<<10)) << 3;
+				my = (my>>d) | ((my&((1<<d)-1))!=0);
+			}
+			else
+				my = 1;
+			if(sub)
+			{
+				if(!(mx-=my))
+					return static_cast<unsigned>(R==std::round_toward_neg_infinity) << 15;
+				exp -= normalize<13>(mx, exp-1);
+			}
+			else
+			{
+				mx += my;
+				int i = mx >> 14;
+				if((exp+=i) > 30)
+					return overflow<R>(sign);
+				mx = (mx>>i) | (mx&i);
+			}
+			return rounded<R,false>(sign+((exp-1)<<10)+(mx>>3), (mx>>2)&1, (mx&0x3)!=0);
+		}
+
+		/// Half-precision multiplication using integer arithmetic.
+		/// \tparam R rounding mode to use
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return product as half-precision bits
+		/// \exception FE_INVALID if multiplying 0 with infinity or if \a x or \a y is signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int mul_soft(unsigned int x, unsigned int y)
+		{
+			int absx = x & 0x7FFF, absy = y & 0x7FFF, exp = -16;
+			unsigned int sign = (x^y) & 0x8000;
+			if(absx >= 0x7C00 || absy >= 0x7C00)
+				return (absx>0x7C00 || absy>0x7C00) ? signal(x, y) : ((absx==0x7C00 && !absy)||(absy==0x7C00 && !absx)) ? invalid() : (sign|0x7C00);
+			if(!absx || !absy)
+				return sign;
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(absx);
+			exp -= normalize<10>(absy);
+		#endif
+			uint32 m = static_cast<uint32>((absx&0x3FF)|0x400) * static_cast<uint32>((absy&0x3FF)|0x400);
+			int i = m >> 21, s = m & i;
+			exp += (absx>>10) + (absy>>10) + i;
+			if(exp > 29)
+				return overflow<R>(sign);
+			else if(exp < -11)
+				return underflow<R>(sign);
+			return fixed2half<R,20,false,false,false>(m>>i, exp, sign, s);
+		}
+
+		/// Half-precision division using integer arithmetic.
+		/// \tparam R rounding mode to use
+		/// \param x dividend as half-precision bits
+		/// \param y divisor as half-precision bits
+		/// \return quotient as half-precision bits
+		/// \exception FE_INVALID if dividing 0s or infinities with each other or if \a x or \a y is signaling NaN
+		/// \exception FE_DIVBYZERO if dividing finite value by 0
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int div_soft(unsigned int x, unsigned int y)
+		{
+			int absx = x & 0x7FFF, absy = y & 0x7FFF, exp = 14;
+			unsigned int sign = (x^y) & 0x8000;
+			if(absx >= 0x7C00 || absy >= 0x7C00)
+				return (absx>0x7C00 || absy>0x7C00) ? signal(x, y) : (absx==absy) ? invalid() : (sign|((absx==0x7C00) ? 0x7C00 : 0));
+			if(!absx)
+				return absy ? sign : invalid();
+			if(!absy)
+				return pole(sign);
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(absx);
+			exp += normalize<10>(absy);
+		#endif
+			uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
+			int i = mx < my;
+			exp += (absx>>10) - (absy>>10) - i;
+			if(exp > 29)
+				return overflow<R>(sign);
+			else if(exp < -11)
+				return underflow<R>(sign);
+			mx <<= 12 + i;
+			my <<= 1;
+			return fixed2half<R,11,false,false,false>(mx/my, exp, sign, mx%my!=0);
+		}
+
+		/// Half-precision square root using integer arithmetic.
+		/// \tparam R rounding mode to use
+		/// \param arg operand as half-precision bits
+		/// \return square root as half-precision bits
+		/// \exception FE_INVALID for signaling NaN and negative arguments
+		/// \exception FE_INEXACT according to rounding
+		template<std::float_round_style R> unsigned int sqrt_soft(unsigned int arg)
+		{
+			int abs = arg & 0x7FFF, exp = 15;
+			if(!abs || arg >= 0x7C00)
+				return (abs>0x7C00) ? signal(arg) : (arg>0x8000) ? invalid() : arg;
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(abs);
+		#endif
+			uint32 r = static_cast<uint32>((abs&0x3FF)|0x400) << 10, m = sqrt<20>(r, exp+=abs>>10);
+			return rounded<R,false>((exp<<10)+(m&0x3FF), r>m, r!=0);
+		}
+
+		/// Half-precision fused multiply add using integer arithmetic.
+		/// \tparam R rounding mode to use
+		/// \param x first factor as half-precision bits
+		/// \param y second factor as half-precision bits
+		/// \param z summand as half-precision bits
+		/// \return ( \a x * \a y ) + \a z rounded as one operation, as half-precision bits
+		/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+		template<std::float_round_style R> unsigned int fma_soft(unsigned int x, unsigned int y, unsigned int z)
+		{
+			int absx = x & 0x7FFF, absy = y & 0x7FFF, absz = z & 0x7FFF, exp = -15;
+			unsigned int sign = (x^y) & 0x8000;
+			bool sub = ((sign^z)&0x8000) != 0;
+			if(absx >= 0x7C00 || absy >= 0x7C00 || absz >= 0x7C00)
+				return	(absx>0x7C00 || absy>0x7C00 || absz>0x7C00) ? signal(x, y, z) :
+						(absx==0x7C00) ? ((!absy || (sub && absz==0x7C00)) ? invalid() : (sign|0x7C00)) :
+						(absy==0x7C00) ? ((!absx || (sub && absz==0x7C00)) ? invalid() : (sign|0x7C00)) : z;
+			if(!absx || !absy)
+				return absz ? z : (R==std::round_toward_neg_infinity) ? (z|sign) : (z&sign);
+		#if !HALF_FLUSH_DENORMALS
+			exp -= normalize<10>(absx);
+			exp -= normalize<10>(absy);
+		#endif
+			uint32 m = static_cast<uint32>((absx&0x3FF)|0x400) * static_cast<uint32>((absy&0x3FF)|0x400);
+			int i = m >> 21;
+			exp += (absx>>10) + (absy>>10) + i;
+			m <<= 3 - i;
+			if(absz)
+			{
+				int expz = 0;
+			#if !HALF_FLUSH_DENORMALS
+				expz -= normalize<10>(absz);
+			#endif
+				expz += absz >> 10;
+				uint32 mz = static_cast<uint32>((absz&0x3FF)|0x400) << 13;
+				if(expz > exp || (expz == exp && mz > m))
+				{
+					std::swap(m, mz);
+					std::swap(exp, expz);
+					if(sub)
+						sign = z & 0x8000;
+				}
+				int d = exp - expz;
+				mz = (d<23) ? ((mz>>d)|((mz&((static_cast<uint32>(1)<<d)-1))!=0)) : 1;
+				if(sub)
+				{
+					m = m - mz;
+					if(!m)
+						return static_cast<unsigned>(R==std::round_toward_neg_infinity) << 15;
+					exp -= normalize<23>(m);
+				}
+				else
+				{
+					m += mz;
+					i = m >> 24;
+					m = (m>>i) | (m&i);
+					exp += i;
+				}
+			}
+			if(exp > 30)
+				return overflow<R>(sign);
+			else if(exp < -10)
+				return underflow<R>(sign);
+			return fixed2half<R,23,false,false,false>(m, exp-1, sign);
+		}
+
+		/// Round single-precision result to odd.
+		/// An inexact result with an even last bit is replaced by its neighbour in the direction of the exact result. Since all 
+		/// half-precision values and midpoints between them have even single-precision representations, rounding this to 
+		/// half-precision gives the same result and exceptions as rounding the exact result directly, for any rounding mode.
+		/// \param value single-precision result rounded to either neighbour of the exact result
+		/// \param inexact `true` if \a value differs from the exact result, `false` if exact
+		/// \param up `true` if the exact result is greater than \a value, `false` if it is smaller
+		/// \return \a value rounded to odd
+		inline float round_to_odd(float value, bool inexact, bool up)
+		{
+			bits<float>::type fbits, odd;
+			std::memcpy(&fbits, &value, sizeof(float));
+			odd = static_cast<bits<float>::type>(inexact) & ~fbits & 1;
+			fbits = (up==(value>0.0f)) ? (fbits+odd) : (fbits-odd);
+			std::memcpy(&value, &fbits, sizeof(float));
+			return value;
+		}
+
+		/// Round double-precision value to odd single-precision.
+		/// The value is converted to single-precision in the current rounding mode and the rounding error of that is always exact 
+		/// in double-precision, so this doesn't depend on the rounding mode of the built-in arithmetic.
+		/// \param value double-precision value in the normal single-precision range
+		/// \return \a value rounded to odd single-precision
+		inline float round_to_odd(double value)
+		{
+			float f = static_cast<float>(value);
+			double err = value - static_cast<double>(f);
+			return round_to_odd(f, err!=0.0, err>0.0);
+		}
+
+		/// Round to nearest in single-precision kernels.
+		/// The [batch arithmetic](\ref batch_arithmetic), packed arithmetic and approximated batch functions compute blocks of 
+		/// values in single-precision, relying on the built-in arithmetic rounding to nearest for the error-free transformations 
+		/// of sums and for the argument reductions. This switches the built-in rounding mode to round to nearest for the lifetime 
+		/// of the object if necessary and restores it afterwards. With SSE2 this only changes the rounding control of the MXCSR 
+		/// register, keeping any exception flags raised meanwhile, otherwise it uses the 
+		/// [C++11 floating-point environment](\ref HALF_ENABLE_CPP11_CFENV) if available.
+		class nearest_rounding
+		{
+		public:
+		#if HALF_SIMD_SSE2
+			/// Switch to round to nearest.
+			HALF_TARGET_SSE2 nearest_rounding() : mode_(_mm_getcsr()&0x6000) { if(mode_) _mm_setcsr(_mm_getcsr()&~0x6000u); }
+
+			/// Restore rounding mode.
+			HALF_TARGET_SSE2 ~nearest_rounding() { if(mode_) _mm_setcsr(_mm_getcsr()|mode_); }
+
+		private:
+			/// Rounding control bits to restore.
+			unsigned int mode_;
+		#elif HALF_ENABLE_CPP11_CFENV && defined(FE_TONEAREST)
+			/// Switch to round to nearest.
+			nearest_rounding() : mode_(std::fegetround()) { if(mode_ != FE_TONEAREST) std::fesetround(FE_TONEAREST); }
+
+			/// Restore rounding mode.
+			~nearest_rounding() { if(mode_ != FE_TONEAREST) std::fesetround(mode_); }
+
+		private:
+			/// Rounding mode to restore.
+			int mode_;
+		#else
+			/// Keep rounding mode.
+			nearest_rounding() {}
+		#endif
+		};
+
+		/// Half-precision addition using single-precision arithmetic.
+		/// The sum of two half-precision values is always exact in double-precision and rounded to odd single-precision. This 
+		/// gives the correctly rounded result for any rounding mode, independent of the rounding mode of the built-in arithmetic. 
+		/// Special values are handled by add_soft().
+		/// \tparam R rounding mode to use
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return sum as half-precision bits
+		/// \exception FE_INVALID if \a x and \a y are infinities with different signs or signaling NaNs
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int add_float(unsigned int x, unsigned int y)
+		{
+			if(!std::numeric_limits<float>::is_iec559 || (x&0x7FFF) >= 0x7C00 || (y&0x7FFF) >= 0x7C00)
+				return add_soft<R>(x, y);
+			double s = static_cast<double>(half2float<float>(x)) + static_cast<double>(half2float<float>(y));
+			if(s == 0.0)
+				return (R==std::round_toward_neg_infinity) ? ((x|y)&0x8000) : (x&y&0x8000);
+			return float2half<R>(round_to_odd(s));
+		}
+
+		/// Half-precision multiplication using single-precision arithmetic.
+		/// The single-precision product is always exact. Special values are handled by mul_soft().
+		/// \tparam R rounding mode to use
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return product as half-precision bits
+		/// \exception FE_INVALID if multiplying 0 with infinity or if \a x or \a y is signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int mul_float(unsigned int x, unsigned int y)
+		{
+			if(!std::numeric_limits<float>::is_iec559 || (x&0x7FFF) >= 0x7C00 || (y&0x7FFF) >= 0x7C00)
+				return mul_soft<R>(x, y);
+			return float2half<R>(half2float<float>(x)*half2float<float>(y));
+		}
+
+		/// Half-precision division using single-precision arithmetic.
+		/// The single-precision quotient is rounded to odd, with the remainder computed exactly in double-precision. This gives the 
+		/// correctly rounded result for any rounding mode, independent of the rounding mode of the built-in arithmetic. Special 
+		/// values and divisions by zero are handled by div_soft().
+		/// \tparam R rounding mode to use
+		/// \param x dividend as half-precision bits
+		/// \param y divisor as half-precision bits
+		/// \return quotient as half-precision bits
+		/// \exception FE_INVALID if dividing 0s or infinities with each other or if \a x or \a y is signaling NaN
+		/// \exception FE_DIVBYZERO if dividing finite value by 0
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int div_float(unsigned int x, unsigned int y)
+		{
+			if(!std::numeric_limits<float>::is_iec559 || (x&0x7FFF) >= 0x7C00 || !(y&0x7FFF) || (y&0x7FFF) >= 0x7C00)
+				return div_soft<R>(x, y);
+			float a = half2float<float>(x), b = half2float<float>(y), q = a / b;
+			double r = static_cast<double>(a) - static_cast<double>(q)*static_cast<double>(b);
+			return float2half<R>(round_to_odd(q, r!=0.0, (r>0.0)==(b>0.0f)));
+		}
+
+		/// Half-precision square root using single-precision arithmetic.
+		/// The single-precision square root is rounded to odd, with the remainder computed exactly in double-precision. This gives 
+		/// the correctly rounded result for any rounding mode, independent of the rounding mode of the built-in arithmetic. Special 
+		/// values, zeros and negative arguments are handled by sqrt_soft().
+		/// \tparam R rounding mode to use
+		/// \param arg operand as half-precision bits
+		/// \return square root as half-precision bits
+		/// \exception FE_INVALID for signaling NaN and negative arguments
+		/// \exception FE_INEXACT according to rounding
+		template<std::float_round_style R> unsigned int sqrt_float(unsigned int arg)
+		{
+			if(!std::numeric_limits<float>::is_iec559 || !arg || arg >= 0x7C00)
+				return sqrt_soft<R>(arg);
+			float a = half2float<float>(arg), q = std::sqrt(a);
+			double r = static_cast<double>(a) - static_cast<double>(q)*static_cast<double>(q);
+			return float2half<R>(round_to_odd(q, r!=0.0, r>0.0));
+		}
+
+		/// Half-precision fused multiply add using single-precision arithmetic.
+		/// The single-precision product is always exact. Since the exact sum may lie arbitrarily close to a half-precision 
+		/// midpoint, it is always rounded to odd. The sum is computed in double-precision, which is exact unless the summands are 
+		/// so far apart that the smaller one only decides the direction of rounding the larger one. Both cases are distinguished 
+		/// exactly, so this doesn't depend on the rounding mode of the built-in arithmetic. Special values are handled by fma_soft().
+		/// \tparam R rounding mode to use
+		/// \param x first factor as half-precision bits
+		/// \param y second factor as half-precision bits
+		/// \param z summand as half-precision bits
+		/// \return ( \a x * \a y ) + \a z rounded as one operation, as half-precision bits
+		/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+		template<std::float_round_style R> unsigned int fma_float(unsigned int x, unsigned int y, unsigned int z)
+		{
+			if(!std::numeric_limits<float>::is_iec559 || (x&0x7FFF) >= 0x7C00 || (y&0x7FFF) >= 0x7C00 || (z&0x7FFF) >= 0x7C00)
+				return fma_soft<R>(x, y, z);
+			float p = half2float<float>(x) * half2float<float>(y), c = half2float<float>(z);
+			double s = static_cast<double>(p) + static_cast<double>(c);
+			if(s == 0.0)
+				return (R==std::round_toward_neg_infinity) ? (((x^y)|z)&0x8000) : ((x^y)&z&0x8000);
+			bool big = std::abs(p) >= std::abs(c);
+			float a = big ? p : c, b = big ? c : p;
+			if(s-static_cast<double>(a) != static_cast<double>(b))
+				return float2half<R>(round_to_odd(a, true, b>0.0f));
+			return float2half<R>(round_to_odd(s));
+		}
+
+		/// Half-precision addition.
+		/// This computes in [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE) if defined, uses add_float() if 
+		/// [enabled](\ref HALF_ENABLE_FLOAT_ARITHMETIC) and add_soft() otherwise.
+		/// \tparam R rounding mode to use
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return sum as half-precision bits
+		/// \exception FE_INVALID if \a x and \a y are infinities with different signs or signaling NaNs
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int add(unsigned int x, unsigned int y)
+		{
+			x = flush_arg(x), y = flush_arg(y);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(half2float<internal_t>(x)+half2float<internal_t>(y)));
+		#elif HALF_ENABLE_FLOAT_ARITHMETIC
+			return flush_result(add_float<R>(x, y));
+		#else
+			return flush_result(add_soft<R>(x, y));
+		#endif
+		}
+
+		/// Half-precision subtraction.
+		/// This computes in [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE) if defined and adds the negated subtrahend otherwise.
+		/// \tparam R rounding mode to use
+		/// \param x minuend as half-precision bits
+		/// \param y subtrahend as half-precision bits
+		/// \return difference as half-precision bits
+		/// \exception FE_INVALID if \a x and \a y are infinities with equal signs or signaling NaNs
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int sub(unsigned int x, unsigned int y)
+		{
+		#ifdef HALF_ARITHMETIC_TYPE
+			x = flush_arg(x), y = flush_arg(y);
+			return flush_result(float2half<R>(half2float<internal_t>(x)-half2float<internal_t>(y)));
+		#else
+			return add<R>(x, y^0x8000);
+		#endif
+		}
+
+		/// Half-precision multiplication.
+		/// This computes in [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE) if defined, uses mul_float() if 
+		/// [enabled](\ref HALF_ENABLE_FLOAT_ARITHMETIC) and F16C is available for the conversions and mul_soft() otherwise.
+		/// \tparam R rounding mode to use
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return product as half-precision bits
+		/// \exception FE_INVALID if multiplying 0 with infinity or if \a x or \a y is signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int mul(unsigned int x, unsigned int y)
+		{
+			x = flush_arg(x), y = flush_arg(y);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(half2float<internal_t>(x)*half2float<internal_t>(y)));
+		#elif HALF_ENABLE_FLOAT_ARITHMETIC && HALF_ENABLE_F16C_INTRINSICS && !HALF_ERRHANDLING
+			return flush_result(mul_float<R>(x, y));
+		#else
+			return flush_result(mul_soft<R>(x, y));
+		#endif
+		}
+
+		/// Half-precision division.
+		/// This computes in [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE) if defined, uses div_float() if 
+		/// [enabled](\ref HALF_ENABLE_FLOAT_ARITHMETIC) and F16C is available for the conversions and div_soft() otherwise.
+		/// \tparam R rounding mode to use
+		/// \param x dividend as half-precision bits
+		/// \param y divisor as half-precision bits
+		/// \return quotient as half-precision bits
+		/// \exception FE_INVALID if dividing 0s or infinities with each other or if \a x or \a y is signaling NaN
+		/// \exception FE_DIVBYZERO if dividing finite value by 0
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> unsigned int div(unsigned int x, unsigned int y)
+		{
+			x = flush_arg(x), y = flush_arg(y);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(half2float<internal_t>(x)/half2float<internal_t>(y)));
+		#elif HALF_ENABLE_FLOAT_ARITHMETIC && HALF_ENABLE_F16C_INTRINSICS && !HALF_ERRHANDLING
+			return flush_result(div_float<R>(x, y));
+		#else
+			return flush_result(div_soft<R>(x, y));
+		#endif
+		}
+
+		/// Half-precision square root.
+		/// This computes in [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE) if defined, uses sqrt_float() if 
+		/// [enabled](\ref HALF_ENABLE_FLOAT_ARITHMETIC) and sqrt_soft() otherwise.
+		/// \tparam R rounding mode to use
+		/// \param arg operand as half-precision bits
+		/// \return square root as half-precision bits
+		/// \exception FE_INVALID for signaling NaN and negative arguments
+		/// \exception FE_INEXACT according to rounding
+		template<std::float_round_style R> unsigned int sqrt(unsigned int arg)
+		{
+			arg = flush_arg(arg);
+		#ifdef HALF_ARITHMETIC_TYPE
+			return flush_result(float2half<R>(std::sqrt(half2float<internal_t>(arg))));
+		#elif HALF_ENABLE_FLOAT_ARITHMETIC
+			return flush_result(sqrt_float<R>(arg));
+		#else
+			return flush_result(sqrt_soft<R>(arg));
+		#endif
+		}
+
+		/// Half-precision fused multiply add.
+		/// This computes in [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE) if defined, uses fma_float() if 
+		/// [enabled](\ref HALF_ENABLE_FLOAT_ARITHMETIC) and fma_soft() otherwise.
+		/// \tparam R rounding mode to use
+		/// \param x first factor as half-precision bits
+		/// \param y second factor as half-precision bits
+		/// \param z summand as half-precision bits
+		/// \return ( \a x * \a y ) + \a z rounded as one operation, as half-precision bits
+		/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+		template<std::float_round_style R> unsigned int fma(unsigned int x, unsigned int y, unsigned int z)
+		{
+			x = flush_arg(x), y = flush_arg(y), z = flush_arg(z);
+		#ifdef HALF_ARITHMETIC_TYPE
+			internal_t fx = half2float<internal_t>(x), fy = half2float<internal_t>(y), fz = half2float<internal_t>(z);
+			#if HALF_ENABLE_CPP11_CMATH && FP_FAST_FMA
+				return flush_result(float2half<R>(std::fma(fx, fy, fz)));
+			#else
+				return flush_result(float2half<R>(fx*fy+fz));
+			#endif
+		#elif HALF_ENABLE_FLOAT_ARITHMETIC
+			return flush_result(fma_float<R>(x, y, z));
+		#else
+			return flush_result(fma_soft<R>(x, y, z));
+		#endif
+		}
+
+		/// Maximum of half-precision values.
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return maximum of operands as half-precision bits, ignoring quiet NaNs
+		/// \exception FE_INVALID if \a x or \a y is signaling NaN
+		inline HALF_CONSTEXPR_NOERR unsigned int fmax(unsigned int x, unsigned int y)
+		{
+			return ((y&0x7FFF) <= 0x7C00 && ((x&0x7FFF) > 0x7C00 || (x^(0x8000|(0x8000-(x>>15)))) < 
+				(y^(0x8000|(0x8000-(y>>15)))))) ? select(y, x) : select(x, y);
+		}
+
+		/// Minimum of half-precision values.
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return minimum of operands as half-precision bits, ignoring quiet NaNs
+		/// \exception FE_INVALID if \a x or \a y is signaling NaN
+		inline HALF_CONSTEXPR_NOERR unsigned int fmin(unsigned int x, unsigned int y)
+		{
+			return ((y&0x7FFF) <= 0x7C00 && ((x&0x7FFF) > 0x7C00 || (x^(0x8000|(0x8000-(x>>15)))) > 
+				(y^(0x8000|(0x8000-(y>>15)))))) ? select(y, x) : select(x, y);
+		}
+
+		/// Half-precision arithmetic.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*` or `/`)
+		/// \param x first operand as half-precision bits
+		/// \param y second operand as half-precision bits
+		/// \return result as half-precision bits
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<std::float_round_style R,char O> unsigned int arithmetic(unsigned int x, unsigned int y)
+		{
+			return (O=='+') ? add<R>(x, y) : (O=='-') ? sub<R>(x, y) : (O=='*') ? mul<R>(x, y) : div<R>(x, y);
+		}
+
+		/// \}
+		/// \name Batch arithmetic
+		/// \{
+
+		/// Compute arrays of half-precision values one by one.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*` or `/`)
+		/// \tparam B broadcast operands (1 for using first value of \a x throughout, 2 for \a y)
+		/// \param x first operands
+		/// \param y second operands
+		/// \param dst array to store results at
+		/// \param n number of values to compute
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<std::float_round_style R,char O,unsigned int B> void arithmetic_scalar(const uint16 *x, const uint16 *y, uint16 *dst, std::size_t n)
+		{
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = static_cast<uint16>(arithmetic<R,O>(x[(B&1) ? 0 : i], y[(B&2) ? 0 : i]));
+		}
+
+	#if HALF_SIMD_SSE2
+		/// Treat subnormal arguments as zero using SSE2.
+		/// This is the SSE2 version of flush_arg() with identical results.
+		/// \param h eight half-precision values
+		/// \return \a h with subnormal values replaced by zeros of the same sign if [flushing](\ref HALF_FLUSH_DENORMALS) is enabled
+		HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i flush_arg_sse2(__m128i h)
+		{
+		#if HALF_FLUSH_DENORMALS
+			return _mm_andnot_si128(_mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(h, _mm_set1_epi16(0x7C00)), 
+				_mm_setzero_si128()), _mm_set1_epi16(0x7FFF)), h);
+		#else
+			return h;
+		#endif
+		}
+
+		/// Flush subnormal results to zero using SSE2.
+		/// This is the SSE2 version of flush_result() with identical results.
+		/// \param h eight half-precision results
+		/// \return \a h with subnormal values replaced by zeros of the same sign if [flushing](\ref HALF_FLUSH_DENORMALS) is enabled
+		/// \exception FE_UNDERFLOW and FE_INEXACT if any value is flushed
+		HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i flush_result_sse2(__m128i h)
+		{
+		#if HALF_FLUSH_DENORMALS
+			const __m128i zero = _mm_setzero_si128();
+			__m128i sub = _mm_andnot_si128(_mm_cmpeq_epi16(_mm_and_si128(h, _mm_set1_epi16(0x3FF)), zero), 
+				_mm_cmpeq_epi16(_mm_and_si128(h, _mm_set1_epi16(0x7C00)), zero));
+			#if HALF_ERRHANDLING
+				raise(FE_UNDERFLOW|FE_INEXACT, _mm_movemask_epi8(sub)!=0);
+			#endif
+			return _mm_andnot_si128(_mm_and_si128(sub, _mm_set1_epi16(0x7FFF)), h);
+		#else
+			return h;
+		#endif
+		}
+
+		/// Round four single-precision results to odd using SSE2.
+		/// This is the SSE2 version of round_to_odd() with identical results.
+		/// \param value single-precision results rounded to nearest
+		/// \param inexact mask of lanes differing from the exact results
+		/// \param up mask of lanes whose exact results are greater than \a value
+		/// \return \a value rounded to odd
+		HALF_TARGET_SSE2 HALF_FORCEINLINE __m128 round_to_odd_sse2(__m128 value, __m128 inexact, __m128 up)
+		{
+			__m128i bits = _mm_castps_si128(value), odd = _mm_andnot_si128(bits, _mm_and_si128(_mm_castps_si128(inexact), _mm_set1_epi32(1)));
+			__m128i down = _mm_xor_si128(_mm_castps_si128(up), _mm_cmpeq_epi32(_mm_srai_epi32(bits, 31), _mm_setzero_si128()));
+			return _mm_castsi128_ps(_mm_add_epi32(bits, _mm_sub_epi32(_mm_xor_si128(odd, down), down)));
+		}
+
+		/// Compute four single-precision results using SSE2.
+		/// This is the SSE2 version of add_float(), mul_float() and div_float() for finite operands and non-zero divisors, 
+		/// computing the results in single-precision and rounding them to odd where necessary.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*` or `/`)
+		/// \param a first operands as exactly converted from half-precision
+		/// \param b second operands as exactly converted from half-precision
+		/// \return single-precision results, giving the correctly rounded results when converted to half-precision
+		template<std::float_round_style R,char O> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128 arithmetic_sse2(__m128 a, __m128 b)
+		{
+		#if HALF_ERRHANDLING
+			const bool odd = true;
+		#else
+			const bool odd = R != std::round_to_nearest;
+		#endif
+			const __m128 zero = _mm_setzero_ps();
+			if(O == '*')
+				return _mm_mul_ps(a, b);
+			if(O == '/')
+			{
+				__m128 q = _mm_div_ps(a, b);
+				if(odd)
+				{
+					__m128d r0 = _mm_sub_pd(_mm_cvtps_pd(a), _mm_mul_pd(_mm_cvtps_pd(q), _mm_cvtps_pd(b)));
+					__m128d r1 = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(a, a)), 
+						_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(q, q)), _mm_cvtps_pd(_mm_movehl_ps(b, b))));
+					__m128 r = _mm_movelh_ps(_mm_cvtpd_ps(r0), _mm_cvtpd_ps(r1));
+					q = round_to_odd_sse2(q, _mm_cmpneq_ps(r, zero), _mm_xor_ps(_mm_cmpgt_ps(r, zero), _mm_cmplt_ps(b, zero)));
+				}
+				return q;
+			}
+			if(O == '-')
+				b = _mm_xor_ps(b, _mm_set1_ps(-0.0f));
+			__m128 sum = _mm_add_ps(a, b);
+			if(odd)
+			{
+				__m128 bb = _mm_sub_ps(sum, a), err = _mm_add_ps(_mm_sub_ps(a, _mm_sub_ps(sum, bb)), _mm_sub_ps(b, bb));
+				sum = round_to_odd_sse2(sum, _mm_cmpneq_ps(err, zero), _mm_cmpgt_ps(err, zero));
+			}
+			if(R == std::round_toward_neg_infinity)
+				sum = _mm_or_ps(sum, _mm_and_ps(_mm_cmpeq_ps(sum, zero), _mm_and_ps(_mm_or_ps(a, b), _mm_set1_ps(-0.0f))));
+			return sum;
+		}
+
+		/// Compute arrays of half-precision values using SSE2.
+		/// Blocks of finite operands (and non-zero divisors) are computed in single-precision and converted back with integer 
+		/// operations, accumulating any exceptions and raising them once at the end. Blocks containing any other operands are 
+		/// computed one by one. The results and exceptions are identical to those of arithmetic_scalar().
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*` or `/`)
+		/// \tparam B broadcast operands (1 for using first value of \a x throughout, 2 for \a y)
+		/// \param x first operands
+		/// \param y second operands
+		/// \param dst array to store results at
+		/// \param n number of values to compute
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<std::float_round_style R,char O,unsigned int B> HALF_TARGET_SSE2 void arithmetic_sse2(const uint16 *x, const uint16 *y, uint16 *dst, std::size_t n)
+		{
+			const __m128i zero = _mm_setzero_si128(), abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFF);
+			__m128i flags = zero, hx = _mm_set1_epi16(static_cast<short>(*x)), hy = _mm_set1_epi16(static_cast<short>(*y));
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+			{
+				if(!(B&1))
+					hx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i));
+				if(!(B&2))
+					hy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i));
+				hx = flush_arg_sse2(hx);
+				hy = flush_arg_sse2(hy);
+				__m128i special = _mm_or_si128(_mm_cmpgt_epi16(_mm_and_si128(hx, abs), max), _mm_cmpgt_epi16(_mm_and_si128(hy, abs), max));
+				if(O == '/')
+					special = _mm_or_si128(special, _mm_cmpeq_epi16(_mm_and_si128(hy, abs), zero));
+				if(_mm_movemask_epi8(special))
+				{
+					arithmetic_scalar<R,O,B>(x+((B&1) ? 0 : i), y+((B&2) ? 0 : i), dst+i, 8);
+					continue;
+				}
+				__m128i lo = float2half_sse2<R>(_mm_castps_si128(arithmetic_sse2<R,O>(half2float_sse2(_mm_unpacklo_epi16(hx, zero)), 
+					half2float_sse2(_mm_unpacklo_epi16(hy, zero)))), flags);
+				__m128i hi = float2half_sse2<R>(_mm_castps_si128(arithmetic_sse2<R,O>(half2float_sse2(_mm_unpackhi_epi16(hx, zero)), 
+					half2float_sse2(_mm_unpackhi_epi16(hy, zero)))), flags);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), flush_result_sse2(_mm_packs_epi32(
+					_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16))));
+			}
+		#if HALF_ERRHANDLING
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0x4E));
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0xB1));
+			raise(_mm_cvtsi128_si32(flags), _mm_cvtsi128_si32(flags)!=0);
+		#endif
+			arithmetic_scalar<R,O,B>(x+((B&1) ? 0 : i), y+((B&2) ? 0 : i), dst+i, n-i);
+		}
+	#endif
+
+	#if HALF_SIMD_AVX2
+		/// Round eight single-precision results to odd using AVX2.
+		/// This is the AVX2 version of round_to_odd() with identical results.
+		/// \param value single-precision results rounded to nearest
+		/// \param inexact mask of lanes differing from the exact results
+		/// \param up mask of lanes whose exact results are greater than \a value
+		/// \return \a value rounded to odd
+		HALF_TARGET_AVX2 HALF_FORCEINLINE __m256 round_to_odd_avx2(__m256 value, __m256 inexact, __m256 up)
+		{
+			__m256i bits = _mm256_castps_si256(value), odd = _mm256_andnot_si256(bits, 
+				_mm256_and_si256(_mm256_castps_si256(inexact), _mm256_set1_epi32(1)));
+			__m256i down = _mm256_xor_si256(_mm256_castps_si256(up), _mm256_cmpeq_epi32(_mm256_srai_epi32(bits, 31), _mm256_setzero_si256()));
+			return _mm256_castsi256_ps(_mm256_add_epi32(bits, _mm256_sub_epi32(_mm256_xor_si256(odd, down), down)));
+		}
+
+		/// Compute eight single-precision results using AVX2.
+		/// This is the AVX2 version of arithmetic_sse2() with identical results.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*` or `/`)
+		/// \param a first operands as exactly converted from half-precision
+		/// \param b second operands as exactly converted from half-precision
+		/// \return single-precision results, giving the correctly rounded results when converted to half-precision
+		template<std::float_round_style R,char O> HALF_TARGET_AVX2 HALF_FORCEINLINE __m256 arithmetic_avx2(__m256 a, __m256 b)
+		{
+		#if HALF_ERRHANDLING
+			const bool odd = true;
+		#else
+			const bool odd = R != std::round_to_nearest;
+		#endif
+			const __m256 zero = _mm256_setzero_ps();
+			if(O == '*')
+				return _mm256_mul_ps(a, b);
+			if(O == '/')
+			{
+				__m256 q = _mm256_div_ps(a, b);
+				if(odd)
+				{
+					__m256d r0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(a)), 
+						_mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(q)), _mm256_cvtps_pd(_mm256_castps256_ps128(b))));
+					__m256d r1 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(a, 1)), 
+						_mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(q, 1)), _mm256_cvtps_pd(_mm256_extractf128_ps(b, 1))));
+					__m256 r = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(r0)), _mm256_cvtpd_ps(r1), 1);
+					q = round_to_odd_avx2(q, _mm256_cmp_ps(r, zero, _CMP_NEQ_UQ), 
+						_mm256_xor_ps(_mm256_cmp_ps(r, zero, _CMP_GT_OQ), _mm256_cmp_ps(b, zero, _CMP_LT_OQ)));
+				}
+				return q;
+			}
+			if(O == '-')
+				b = _mm256_xor_ps(b, _mm256_set1_ps(-0.0f));
+			__m256 sum = _mm256_add_ps(a, b);
+			if(odd)
+			{
+				__m256 bb = _mm256_sub_ps(sum, a), err = _mm256_add_ps(_mm256_sub_ps(a, _mm256_sub_ps(sum, bb)), _mm256_sub_ps(b, bb));
+				sum = round_to_odd_avx2(sum, _mm256_cmp_ps(err, zero, _CMP_NEQ_UQ), _mm256_cmp_ps(err, zero, _CMP_GT_OQ));
+			}
+			if(R == std::round_toward_neg_infinity)
+				sum = _mm256_or_ps(sum, _mm256_and_ps(_mm256_cmp_ps(sum, zero, _CMP_EQ_OQ), 
+					_mm256_and_ps(_mm256_or_ps(a, b), _mm256_set1_ps(-0.0f))));
+			return sum;
+		}
+
+		/// Compute arrays of half-precision values using AVX2.
+		/// This works like arithmetic_sse2() but converts between half- and single-precision with F16C, unless the conversion 
+		/// to half-precision has to raise exceptions.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*` or `/`)
+		/// \tparam B broadcast operands (1 for using first value of \a x throughout, 2 for \a y)
+		/// \param x first operands
+		/// \param y second operands
+		/// \param dst array to store results at
+		/// \param n number of values to compute
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<std::float_round_style R,char O,unsigned int B> HALF_TARGET_AVX2 void arithmetic_avx2(const uint16 *x, const uint16 *y, uint16 *dst, std::size_t n)
+		{
+			const __m128i zero = _mm_setzero_si128(), abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFF);
+			__m128i hx = _mm_set1_epi16(static_cast<short>(*x)), hy = _mm_set1_epi16(static_cast<short>(*y));
+		#if HALF_ERRHANDLING
+			__m256i flags = _mm256_setzero_si256();
+		#endif
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+			{
+				if(!(B&1))
+					hx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i));
+				if(!(B&2))
+					hy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i));
+				hx = flush_arg_sse2(hx);
+				hy = flush_arg_sse2(hy);
+				__m128i special = _mm_or_si128(_mm_cmpgt_epi16(_mm_and_si128(hx, abs), max), _mm_cmpgt_epi16(_mm_and_si128(hy, abs), max));
+				if(O == '/')
+					special = _mm_or_si128(special, _mm_cmpeq_epi16(_mm_and_si128(hy, abs), zero));
+				if(_mm_movemask_epi8(special))
+				{
+					arithmetic_scalar<R,O,B>(x+((B&1) ? 0 : i), y+((B&2) ? 0 : i), dst+i, 8);
+					continue;
+				}
+				__m256 f = arithmetic_avx2<R,O>(_mm256_cvtph_ps(hx), _mm256_cvtph_ps(hy));
+			#if HALF_ERRHANDLING
+				__m256i h = float2half_avx2<R>(_mm256_castps_si256(f), flags);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), flush_result_sse2(_mm_packus_epi32(_mm256_castsi256_si128(h), _mm256_extracti128_si256(h, 1))));
+			#else
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), flush_result_sse2(_mm256_cvtps_ph(f, f16c_rounding<R>::value)));
+			#endif
+			}
+		#if HALF_ERRHANDLING
+			__m128i flags4 = _mm_or_si128(_mm256_castsi256_si128(flags), _mm256_extracti128_si256(flags, 1));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0x4E));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0xB1));
+			raise(_mm_cvtsi128_si32(flags4), _mm_cvtsi128_si32(flags4)!=0);
+		#endif
+			arithmetic_scalar<R,O,B>(x+((B&1) ? 0 : i), y+((B&2) ? 0 : i), dst+i, n-i);
+		}
+	#endif
+
+		/// Compute arrays of half-precision values.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level). The SIMD kernels rely on IEEE-conformant 
+		/// single-precision arithmetic and are thus only used if [enabled](\ref HALF_ENABLE_FLOAT_ARITHMETIC) and not 
+		/// [overridden](\ref HALF_ARITHMETIC_TYPE), in which case they [round to nearest](\ref nearest_rounding) meanwhile.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*` or `/`)
+		/// \tparam B broadcast operands (1 for using first value of \a x throughout, 2 for \a y)
+		/// \param x first operands
+		/// \param y second operands
+		/// \param dst array to store results at
+		/// \param n number of values to compute
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<std::float_round_style R,char O,unsigned int B> void arithmetic_n(const uint16 *x, const uint16 *y, uint16 *dst, std::size_t n)
+		{
+			typedef void (*kernel)(const uint16*, const uint16*, uint16*, std::size_t);
+			static const kernel kernels[4] = { &arithmetic_scalar<R,O,B>,
+			#if HALF_SIMD_SSE2 && HALF_ENABLE_FLOAT_ARITHMETIC && !defined(HALF_ARITHMETIC_TYPE)
+				&arithmetic_sse2<R,O,B>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2 && HALF_ENABLE_FLOAT_ARITHMETIC && !defined(HALF_ARITHMETIC_TYPE)
+				&arithmetic_avx2<R,O,B>,
+			#else
+				0,
+			#endif
+				0 };
+			if(!n)
+				return;
+		#if HALF_ENABLE_FLOAT_ARITHMETIC && !defined(HALF_ARITHMETIC_TYPE)
+			nearest_rounding rounding;
+		#endif
+			simd_kernel(kernels)(x, y, dst, n);
+		}
+
+		/// Compute fused multiply adds of arrays one by one.
+		/// \tparam R rounding mode to use
+		/// \tparam B broadcast operands (combination of 1 for using first value of \a x throughout, 2 for \a y and 4 for \a z)
+		/// \param x first factors
+		/// \param y second factors
+		/// \param z summands
+		/// \param dst array to store results at
+		/// \param n number of values to compute
+		/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+		template<std::float_round_style R,unsigned int B> void fma_scalar(const uint16 *x, const uint16 *y, const uint16 *z, uint16 *dst, std::size_t n)
+		{
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = static_cast<uint16>(fma<R>(x[(B&1) ? 0 : i], y[(B&2) ? 0 : i], z[(B&4) ? 0 : i]));
+		}
+
+	#if HALF_SIMD_SSE2
+		/// Compute four fused multiply adds using SSE2.
+		/// This is the SSE2 version of fma_float() for finite operands, rounding the sum of the exact products to odd.
+		/// \tparam R rounding mode to use
+		/// \param a first factors as exactly converted from half-precision
+		/// \param b second factors as exactly converted from half-precision
+		/// \param c summands as exactly converted from half-precision
+		/// \return single-precision results, giving the correctly rounded results when converted to half-precision
+		template<std::float_round_style R> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128 fma_sse2(__m128 a, __m128 b, __m128 c)
+		{
+			const __m128 zero = _mm_setzero_ps();
+			__m128 p = _mm_mul_ps(a, b), sum = _mm_add_ps(p, c), bb = _mm_sub_ps(sum, p);
+			__m128 err = _mm_add_ps(_mm_sub_ps(p, _mm_sub_ps(sum, bb)), _mm_sub_ps(c, bb));
+			sum = round_to_odd_sse2(sum, _mm_cmpneq_ps(err, zero), _mm_cmpgt_ps(err, zero));
+			if(R == std::round_toward_neg_infinity)
+				sum = _mm_or_ps(sum, _mm_and_ps(_mm_cmpeq_ps(sum, zero), _mm_and_ps(_mm_or_ps(p, c), _mm_set1_ps(-0.0f))));
+			return sum;
+		}
+
+		/// Compute fused multiply adds of arrays using SSE2.
+		/// This works like arithmetic_sse2() for blocks of finite operands. The results and exceptions are identical to those of 
+		/// fma_scalar().
+		/// \tparam R rounding mode to use
+		/// \tparam B broadcast operands (combination of 1 for using first value of \a x throughout, 2 for \a y and 4 for \a z)
+		/// \param x first factors
+		/// \param y second factors
+		/// \param z summands
+		/// \param dst array to store results at
+		/// \param n number of values to compute
+		/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+		template<std::float_round_style R,unsigned int B> HALF_TARGET_SSE2 void fma_sse2(const uint16 *x, const uint16 *y, const uint16 *z, uint16 *dst, std::size_t n)
+		{
+			const __m128i zero = _mm_setzero_si128(), abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFF);
+			__m128i flags = zero, hx = _mm_set1_epi16(static_cast<short>(*x)), hy = _mm_set1_epi16(static_cast<short>(*y));
+			__m128i hz = _mm_set1_epi16(static_cast<short>(*z));
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+			{
+				if(!(B&1))
+					hx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i));
+				if(!(B&2))
+					hy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i));
+				if(!(B&4))
+					hz = _mm_loadu_si128(reinterpret_cast<const __m128i*>(z+i));
+				hx = flush_arg_sse2(hx);
+				hy = flush_arg_sse2(hy);
+				hz = flush_arg_sse2(hz);
+				if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpgt_epi16(_mm_and_si128(hx, abs), max), 
+					_mm_cmpgt_epi16(_mm_and_si128(hy, abs), max)), _mm_cmpgt_epi16(_mm_and_si128(hz, abs), max))))
+				{
+					fma_scalar<R,B>(x+((B&1) ? 0 : i), y+((B&2) ? 0 : i), z+((B&4) ? 0 : i), dst+i, 8);
+					continue;
+				}
+				__m128i lo = float2half_sse2<R>(_mm_castps_si128(fma_sse2<R>(half2float_sse2(_mm_unpacklo_epi16(hx, zero)), 
+					half2float_sse2(_mm_unpacklo_epi16(hy, zero)), half2float_sse2(_mm_unpacklo_epi16(hz, zero)))), flags);
+				__m128i hi = float2half_sse2<R>(_mm_castps_si128(fma_sse2<R>(half2float_sse2(_mm_unpackhi_epi16(hx, zero)), 
+					half2float_sse2(_mm_unpackhi_epi16(hy, zero)), half2float_sse2(_mm_unpackhi_epi16(hz, zero)))), flags);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), flush_result_sse2(_mm_packs_epi32(
+					_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16))));
+			}
+		#if HALF_ERRHANDLING
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0x4E));
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0xB1));
+			raise(_mm_cvtsi128_si32(flags), _mm_cvtsi128_si32(flags)!=0);
+		#endif
+			fma_scalar<R,B>(x+((B&1) ? 0 : i), y+((B&2) ? 0 : i), z+((B&4) ? 0 : i), dst+i, n-i);
+		}
+	#endif
+
+	#if HALF_SIMD_AVX2
+		/// Compute eight fused multiply adds using AVX2.
+		/// This is the AVX2 version of fma_sse2() with identical results.
+		/// \tparam R rounding mode to use
+		/// \param a first factors as exactly converted from half-precision
+		/// \param b second factors as exactly converted from half-precision
+		/// \param c summands as exactly converted from half-precision
+		/// \return single-precision results, giving the correctly rounded results when converted to half-precision
+		template<std::float_round_style R> HALF_TARGET_AVX2 HALF_FORCEINLINE __m256 fma_avx2(__m256 a, __m256 b, __m256 c)
+		{
+			const __m256 zero = _mm256_setzero_ps();
+			__m256 p = _mm256_mul_ps(a, b), sum = _mm256_add_ps(p, c), bb = _mm256_sub_ps(sum, p);
+			__m256 err = _mm256_add_ps(_mm256_sub_ps(p, _mm256_sub_ps(sum, bb)), _mm256_sub_ps(c, bb));
+			sum = round_to_odd_avx2(sum, _mm256_cmp_ps(err, zero, _CMP_NEQ_UQ), _mm256_cmp_ps(err, zero, _CMP_GT_OQ));
+			if(R == std::round_toward_neg_infinity)
+				sum = _mm256_or_ps(sum, _mm256_and_ps(_mm256_cmp_ps(sum, zero, _CMP_EQ_OQ), 
+					_mm256_and_ps(_mm256_or_ps(p, c), _mm256_set1_ps(-0.0f))));
+			return sum;
+		}
+
+		/// Compute fused multiply adds of arrays using AVX2.
+		/// This works like fma_sse2() but converts between half- and single-precision with F16C, unless the conversion to 
+		/// half-precision has to raise exceptions.
+		/// \tparam R rounding mode to use
+		/// \tparam B broadcast operands (combination of 1 for using first value of \a x throughout, 2 for \a y and 4 for \a z)
+		/// \param x first factors
+		/// \param y second factors
+		/// \param z summands
+		/// \param dst array to store results at
+		/// \param n number of values to compute
+		/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+		template<std::float_round_style R,unsigned int B> HALF_TARGET_AVX2 void fma_avx2(const uint16 *x, const uint16 *y, const uint16 *z, uint16 *dst, std::size_t n)
+		{
+			const __m128i abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFF);
+			__m128i hx = _mm_set1_epi16(static_cast<short>(*x)), hy = _mm_set1_epi16(static_cast<short>(*y));
+			__m128i hz = _mm_set1_epi16(static_cast<short>(*z));
+		#if HALF_ERRHANDLING
+			__m256i flags = _mm256_setzero_si256();
+		#endif
+			std::size_t i = 0;
+			for(; i+8<=n; i+=8)
+			{
+				if(!(B&1))
+					hx = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i));
+				if(!(B&2))
+					hy = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i));
+				if(!(B&4))
+					hz = _mm_loadu_si128(reinterpret_cast<const __m128i*>(z+i));
+				hx = flush_arg_sse2(hx);
+				hy = flush_arg_sse2(hy);
+				hz = flush_arg_sse2(hz);
+				if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpgt_epi16(_mm_and_si128(hx, abs), max), 
+					_mm_cmpgt_epi16(_mm_and_si128(hy, abs), max)), _mm_cmpgt_epi16(_mm_and_si128(hz, abs), max))))
+				{
+					fma_scalar<R,B>(x+((B&1) ? 0 : i), y+((B&2) ? 0 : i), z+((B&4) ? 0 : i), dst+i, 8);
+					continue;
+				}
+				__m256 f = fma_avx2<R>(_mm256_cvtph_ps(hx), _mm256_cvtph_ps(hy), _mm256_cvtph_ps(hz));
+			#if HALF_ERRHANDLING
+				__m256i h = float2half_avx2<R>(_mm256_castps_si256(f), flags);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), flush_result_sse2(_mm_packus_epi32(_mm256_castsi256_si128(h), _mm256_extracti128_si256(h, 1))));
+			#else
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+i), flush_result_sse2(_mm256_cvtps_ph(f, f16c_rounding<R>::value)));
+			#endif
+			}
+		#if HALF_ERRHANDLING
+			__m128i flags4 = _mm_or_si128(_mm256_castsi256_si128(flags), _mm256_extracti128_si256(flags, 1));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0x4E));
+			flags4 = _mm_or_si128(flags4, _mm_shuffle_epi32(flags4, 0xB1));
+			raise(_mm_cvtsi128_si32(flags4), _mm_cvtsi128_si32(flags4)!=0);
+		#endif
+			fma_scalar<R,B>(x+((B&1) ? 0 : i), y+((B&2) ? 0 : i), z+((B&4) ? 0 : i), dst+i, n-i);
+		}
+	#endif
+
+		/// Compute fused multiply adds of arrays.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level) under the same conditions as arithmetic_n().
+		/// \tparam R rounding mode to use
+		/// \tparam B broadcast operands (combination of 1 for using first value of \a x throughout, 2 for \a y and 4 for \a z)
+		/// \param x first factors
+		/// \param y second factors
+		/// \param z summands
+		/// \param dst array to store results at
+		/// \param n number of values to compute
+		/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+		template<std::float_round_style R,unsigned int B> void fma_n(const uint16 *x, const uint16 *y, const uint16 *z, uint16 *dst, std::size_t n)
+		{
+			typedef void (*kernel)(const uint16*, const uint16*, const uint16*, uint16*, std::size_t);
+			static const kernel kernels[4] = { &fma_scalar<R,B>,
+			#if HALF_SIMD_SSE2 && HALF_ENABLE_FLOAT_ARITHMETIC && !defined(HALF_ARITHMETIC_TYPE)
+				&fma_sse2<R,B>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2 && HALF_ENABLE_FLOAT_ARITHMETIC && !defined(HALF_ARITHMETIC_TYPE)
+				&fma_avx2<R,B>,
+			#else
+				0,
+			#endif
+				0 };
+			if(!n)
+				return;
+		#if HALF_ENABLE_FLOAT_ARITHMETIC && !defined(HALF_ARITHMETIC_TYPE)
+			nearest_rounding rounding;
+		#endif
+			simd_kernel(kernels)(x, y, z, dst, n);
+		}
+
+		/// \}
+		/// \name Batch comparison
+		/// \{
+
+		/// Signed ordering key of half-precision value.
+		/// This maps all values except NaNs to signed integers with the same ordering, with both zeros mapping to 0.
+		/// \param x half-precision bits
+		/// \return negated absolute value for negative values, absolute value otherwise
+		inline HALF_CONSTEXPR int compare_key(unsigned int x)
+		{
+			return (x&0x8000) ? -static_cast<int>(x&0x7FFF) : static_cast<int>(x&0x7FFF);
+		}
+
+		/// Compare half-precision value.
+		/// The results and exceptions are identical to those of the comparison operators and isnan().
+		/// \tparam O comparison to perform (`<`, `>`, `l` for less equal, `g` for greater equal, `=` for equality, `b` for 
+		/// \a a <= \a x <= \a b or `n` for NaN check)
+		/// \param x value to compare as half-precision bits
+		/// \param a value to compare to (or lower bound) as half-precision bits
+		/// \param b upper bound as half-precision bits
+		/// \return result of comparison
+		/// \exception FE_INVALID if \a x or \a a is NaN or for `b` if \a b is NaN and \a a <= \a x
+		template<char O> bool compare(unsigned int x, unsigned int a, unsigned int b)
+		{
+			if(O == 'n')
+				return (x&0x7FFF) > 0x7C00;
+			if(O == 'b')
+				return compare<'g'>(x, a, a) && compare<'l'>(x, b, b);
+			if(compsignal(x, a))
+				return false;
+			int kx = compare_key(x), ka = compare_key(a);
+			return (O=='<') ? (kx<ka) : (O=='>') ? (kx>ka) : (O=='l') ? (kx<=ka) : (O=='g') ? (kx>=ka) : (kx==ka);
+		}
+
+		/// Compare array of half-precision values one by one.
+		/// \tparam O comparison to perform (see compare())
+		/// \param x values to compare
+		/// \param a value to compare to (or lower bound) as half-precision bits
+		/// \param b upper bound as half-precision bits
+		/// \param mask array to store bitmask at, with bit *i* % 8 of byte *i* / 8 set if comparison is true for *i*-th value
+		/// \param n number of values to compare
+		/// \exception FE_INVALID according to compare()
+		template<char O> void compare_scalar(const uint16 *x, unsigned int a, unsigned int b, unsigned char *mask, std::size_t n)
+		{
+			for(std::size_t i=0; i<n; i+=8)
+			{
+				unsigned int bits = 0;
+				for(std::size_t j=0; j<8 && i+j<n; ++j)
+					bits |= static_cast<unsigned int>(compare<O>(x[i+j], a, b)) << j;
+				mask[i/8] = static_cast<unsigned char>(bits);
+			}
+		}
+
+	#if HALF_SIMD_SSE2
+		/// Compare eight half-precision values using SSE2.
+		/// \tparam O comparison to perform (see compare())
+		/// \param x values to compare
+		/// \param ka ordering key of value to compare to (or lower bound)
+		/// \param kb ordering key of upper bound
+		/// \param nans NaN values of \a x to accumulate
+		/// \return comparison results (all bits set for true)
+		template<char O> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128i compare_sse2(__m128i x, __m128i ka, __m128i kb, __m128i &nans)
+		{
+			const __m128i abs = _mm_set1_epi16(0x7FFF), ones = _mm_set1_epi16(-1);
+			__m128i ax = _mm_and_si128(x, abs), s = _mm_srai_epi16(x, 15);
+			__m128i kx = _mm_sub_epi16(_mm_xor_si128(ax, s), s), nan = _mm_cmpgt_epi16(ax, _mm_set1_epi16(0x7C00));
+			nans = _mm_or_si128(nans, nan);
+			switch(O)
+			{
+				case '<': return _mm_andnot_si128(nan, _mm_cmplt_epi16(kx, ka));
+				case '>': return _mm_andnot_si128(nan, _mm_cmpgt_epi16(kx, ka));
+				case 'l': return _mm_andnot_si128(_mm_or_si128(nan, _mm_cmpgt_epi16(kx, ka)), ones);
+				case 'g': return _mm_andnot_si128(_mm_or_si128(nan, _mm_cmplt_epi16(kx, ka)), ones);
+				case '=': return _mm_andnot_si128(nan, _mm_cmpeq_epi16(kx, ka));
+				case 'b': return _mm_andnot_si128(_mm_or_si128(nan, _mm_or_si128(_mm_cmplt_epi16(kx, ka), _mm_cmpgt_epi16(kx, kb))), ones);
+				default: return nan;
+			}
+		}
+
+		/// Compare array of half-precision values using SSE2.
+		/// This is the SSE2 version of compare_scalar() with identical results, comparing sixteen values at once. NaN 
+		/// comparands are left to compare_scalar().
+		/// \tparam O comparison to perform (see compare())
+		/// \param x values to compare
+		/// \param a value to compare to (or lower bound) as half-precision bits
+		/// \param b upper bound as half-precision bits
+		/// \param mask array to store bitmask at
+		/// \param n number of values to compare
+		/// \exception FE_INVALID according to compare()
+		template<char O> HALF_TARGET_SSE2 void compare_sse2(const uint16 *x, unsigned int a, unsigned int b, unsigned char *mask, std::size_t n)
+		{
+			if(O != 'n' && ((a&0x7FFF) > 0x7C00 || (O == 'b' && (b&0x7FFF) > 0x7C00)))
+				return compare_scalar<O>(x, a, b, mask, n);
+			const __m128i ka = _mm_set1_epi16(static_cast<short>(compare_key(a))), kb = _mm_set1_epi16(static_cast<short>(compare_key(b)));
+			__m128i nans = _mm_setzero_si128();
+			std::size_t i = 0;
+			for(; i+16<=n; i+=16)
+			{
+				__m128i r0 = compare_sse2<O>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)), ka, kb, nans);
+				__m128i r1 = compare_sse2<O>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i+8)), ka, kb, nans);
+				unsigned int bits = static_cast<unsigned int>(_mm_movemask_epi8(_mm_packs_epi16(r0, r1)));
+				mask[i/8] = static_cast<unsigned char>(bits);
+				mask[i/8+1] = static_cast<unsigned char>(bits>>8);
+			}
+		#if HALF_ERRHANDLING
+			raise(FE_INVALID, O != 'n' && _mm_movemask_epi8(nans) != 0);
+		#endif
+			compare_scalar<O>(x+i, a, b, mask+i/8, n-i);
+		}
+	#endif
+
+	#if HALF_SIMD_AVX2
+		/// Compare array of half-precision values using AVX2.
+		/// This is the AVX2 version of compare_scalar() with identical results, comparing 32 values at once. NaN comparands are 
+		/// left to compare_scalar().
+		/// \tparam O comparison to perform (see compare())
+		/// \param x values to compare
+		/// \param a value to compare to (or lower bound) as half-precision bits
+		/// \param b upper bound as half-precision bits
+		/// \param mask array to store bitmask at
+		/// \param n number of values to compare
+		/// \exception FE_INVALID according to compare()
+		template<char O> HALF_TARGET_AVX2 void compare_avx2(const uint16 *x, unsigned int a, unsigned int b, unsigned char *mask, std::size_t n)
+		{
+			if(O != 'n' && ((a&0x7FFF) > 0x7C00 || (O == 'b' && (b&0x7FFF) > 0x7C00)))
+				return compare_scalar<O>(x, a, b, mask, n);
+			const __m256i abs = _mm256_set1_epi16(0x7FFF), inf = _mm256_set1_epi16(0x7C00), ones = _mm256_set1_epi16(-1);
+			const __m256i ka = _mm256_set1_epi16(static_cast<short>(compare_key(a))), kb = _mm256_set1_epi16(static_cast<short>(compare_key(b)));
+			__m256i nans = _mm256_setzero_si256(), r[2];
+			std::size_t i = 0;
+			for(; i+32<=n; i+=32)
+			{
+				for(unsigned int j=0; j<2; ++j)
+				{
+					__m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x+i+16*j));
+					__m256i ax = _mm256_and_si256(h, abs), s = _mm256_srai_epi16(h, 15);
+					__m256i kx = _mm256_sub_epi16(_mm256_xor_si256(ax, s), s), nan = _mm256_cmpgt_epi16(ax, inf);
+					nans = _mm256_or_si256(nans, nan);
+					switch(O)
+					{
+						case '<': r[j] = _mm256_andnot_si256(nan, _mm256_cmpgt_epi16(ka, kx)); break;
+						case '>': r[j] = _mm256_andnot_si256(nan, _mm256_cmpgt_epi16(kx, ka)); break;
+						case 'l': r[j] = _mm256_andnot_si256(_mm256_or_si256(nan, _mm256_cmpgt_epi16(kx, ka)), ones); break;
+						case 'g': r[j] = _mm256_andnot_si256(_mm256_or_si256(nan, _mm256_cmpgt_epi16(ka, kx)), ones); break;
+						case '=': r[j] = _mm256_andnot_si256(nan, _mm256_cmpeq_epi16(kx, ka)); break;
+						case 'b': r[j] = _mm256_andnot_si256(_mm256_or_si256(nan, _mm256_or_si256(_mm256_cmpgt_epi16(ka, kx), 
+							_mm256_cmpgt_epi16(kx, kb))), ones); break;
+						default: r[j] = nan;
+					}
+				}
+				unsigned int bits = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(_mm256_packs_epi16(r[0], r[1]), 0xD8)));
+				for(unsigned int j=0; j<4; ++j)
+					mask[i/8+j] = static_cast<unsigned char>(bits>>(8*j));
+			}
+		#if HALF_ERRHANDLING
+			raise(FE_INVALID, O != 'n' && !_mm256_testz_si256(nans, nans));
+		#endif
+			compare_scalar<O>(x+i, a, b, mask+i/8, n-i);
+		}
+	#endif
+
+	#if HALF_SIMD_AVX512
+		/// Compare array of half-precision values using AVX-512.
+		/// This is the AVX-512 version of compare_scalar() with identical results, comparing 64 values at once using mask 
+		/// registers. NaN comparands are left to compare_scalar().
+		/// \tparam O comparison to perform (see compare())
+		/// \param x values to compare
+		/// \param a value to compare to (or lower bound) as half-precision bits
+		/// \param b upper bound as half-precision bits
+		/// \param mask array to store bitmask at
+		/// \param n number of values to compare
+		/// \exception FE_INVALID according to compare()
+		template<char O> HALF_TARGET_AVX512 void compare_avx512(const uint16 *x, unsigned int a, unsigned int b, unsigned char *mask, std::size_t n)
+		{
+			if(O != 'n' && ((a&0x7FFF) > 0x7C00 || (O == 'b' && (b&0x7FFF) > 0x7C00)))
+				return compare_scalar<O>(x, a, b, mask, n);
+			const __m512i abs = _mm512_set1_epi16(0x7FFF), inf = _mm512_set1_epi16(0x7C00);
+			const __m512i ka = _mm512_set1_epi16(static_cast<short>(compare_key(a))), kb = _mm512_set1_epi16(static_cast<short>(compare_key(b)));
+			__mmask32 nans = 0;
+			std::size_t i = 0;
+			for(; i+64<=n; i+=64)
+			{
+				for(unsigned int j=0; j<2; ++j)
+				{
+					__m512i h = _mm512_loadu_si512(x+i+32*j);
+					__m512i ax = _mm512_and_si512(h, abs), s = _mm512_srai_epi16(h, 15);
+					__m512i kx = _mm512_sub_epi16(_mm512_xor_si512(ax, s), s);
+					__mmask32 nan = _mm512_cmpgt_epi16_mask(ax, inf), r;
+					nans |= nan;
+					switch(O)
+					{
+						case '<': r = _mm512_mask_cmplt_epi16_mask(~nan, kx, ka); break;
+						case '>': r = _mm512_mask_cmpgt_epi16_mask(~nan, kx, ka); break;
+						case 'l': r = _mm512_mask_cmple_epi16_mask(~nan, kx, ka); break;
+						case 'g': r = _mm512_mask_cmpge_epi16_mask(~nan, kx, ka); break;
+						case '=': r = _mm512_mask_cmpeq_epi16_mask(~nan, kx, ka); break;
+						case 'b': r = _mm512_mask_cmple_epi16_mask(_mm512_mask_cmpge_epi16_mask(~nan, kx, ka), kx, kb); break;
+						default: r = nan;
+					}
+					for(unsigned int k=0; k<4; ++k)
+						mask[i/8+4*j+k] = static_cast<unsigned char>(r>>(8*k));
+				}
+			}
+		#if HALF_ERRHANDLING
+			raise(FE_INVALID, O != 'n' && nans != 0);
+		#endif
+			compare_scalar<O>(x+i, a, b, mask+i/8, n-i);
+		}
+	#endif
+
+		/// Compare array of half-precision values.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level), comparing 16-bit ordering keys with integer 
+		/// instructions.
+		/// \tparam O comparison to perform (see compare())
+		/// \param x values to compare
+		/// \param a value to compare to (or lower bound) as half-precision bits
+		/// \param b upper bound as half-precision bits
+		/// \param mask array to store bitmask at, with bit *i* % 8 of byte *i* / 8 set if comparison is true for *i*-th value 
+		/// and unused bits of the last byte cleared
+		/// \param n number of values to compare
+		/// \exception FE_INVALID according to compare()
+		template<char O> void compare_n(const uint16 *x, unsigned int a, unsigned int b, unsigned char *mask, std::size_t n)
+		{
+			typedef void (*kernel)(const uint16*, unsigned int, unsigned int, unsigned char*, std::size_t);
+			static const kernel kernels[4] = { &compare_scalar<O>,
+			#if HALF_SIMD_SSE2
+				&compare_sse2<O>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2
+				&compare_avx2<O>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX512
+				&compare_avx512<O> };
+			#else
+				0 };
+			#endif
+			if(n)
+				simd_kernel(kernels)(x, a, b, mask, n);
+		}
+
+		/// Count set bits of bitmask.
+		/// \param mask bitmask as array of bytes
+		/// \param n number of bits to count
+		/// \return number of set bits among the first \a n bits
+		inline std::size_t count_bits(const unsigned char *mask, std::size_t n)
+		{
+			std::size_t count = 0, i = 0;
+			for(; i+32<=n; i+=32, mask+=4)
+				count += popcount(static_cast<uint32>(mask[0]) | (static_cast<uint32>(mask[1])<<8) | 
+					(static_cast<uint32>(mask[2])<<16) | (static_cast<uint32>(mask[3])<<24));
+			for(; i<n; i+=8, ++mask)
+				count += popcount(static_cast<uint32>(*mask) & ((n-i<8) ? ((1U<<(n-i))-1) : 0xFF));
+			return count;
+		}
+
+		/// Copy values selected by bitmask.
+		/// \param src values to select from
+		/// \param mask bitmask as array of bytes
+		/// \param dst array to store selected values at consecutively
+		/// \param n number of values to select from
+		/// \return number of selected values
+		inline std::size_t select_bits(const uint16 *src, const unsigned char *mask, uint16 *dst, std::size_t n)
+		{
+			std::size_t count = 0;
+			for(std::size_t i=0; i<n; i+=32, mask+=4)
+			{
+				uint32 bits = static_cast<uint32>(mask[0]);
+				if(n-i > 8)
+					bits |= static_cast<uint32>(mask[1]) << 8;
+				if(n-i > 16)
+					bits |= static_cast<uint32>(mask[2]) << 16;
+				if(n-i > 24)
+					bits |= static_cast<uint32>(mask[3]) << 24;
+				if(n-i < 32)
+					bits &= (static_cast<uint32>(1)<<(n-i)) - 1;
+				for(; bits; bits&=bits-1)
+					dst[count++] = src[i+ctz(bits)];
+			}
+			return count;
+		}
+
+		/// \}
+		/// \name Function tables
+		/// \{
+
+		/// Table of all values of a unary function.
+		/// This holds the results of a function for all 65536 half-precision arguments, padded by one entry so that gathering 
+		/// 32-bit words at 16-bit offsets stays inside the table.
+		/// \tparam R rounding mode of function
+		/// \tparam F function computing half-precision bits from half-precision bits
+		template<std::float_round_style R,unsigned int(*F)(unsigned int)> class function_table
+		{
+		public:
+			/// Get function table.
+			/// The table is built on first use by evaluating the function for every argument. This is thread-safe when the 
+			/// compiler guards the initialization of local statics, as required by C++11.
+			/// \return array of 65537 function values
+			static const uint16* get() { static const function_table table; return table.values_; }
+
+		private:
+			/// Build table.
+			function_table()
+			{
+				for(unsigned int i=0; i<0x10000; ++i)
+					values_[i] = static_cast<uint16>(F(i));
+				values_[0x10000] = 0;
+			}
+
+			/// Function values.
+			uint16 values_[0x10001];
+		};
+
+		/// Evaluate unary function.
+		/// This looks the result up in the [function table](\ref HALF_ENABLE_UNARY_TABLES) if enabled and calls the function 
+		/// otherwise. Tables are not used with [exception handling](\ref errors) enabled, since they can't reproduce exceptions.
+		/// \tparam R rounding mode of function
+		/// \tparam F function computing half-precision bits from half-precision bits
+		/// \param arg half-precision function argument
+		/// \return half-precision function value
+		/// \exception according to \a F
+		template<std::float_round_style R,unsigned int(*F)(unsigned int)> unsigned int tabulated(unsigned int arg)
+		{
+		#if HALF_ENABLE_UNARY_TABLES && !HALF_ERRHANDLING
+			return function_table<R,F>::get()[arg];
+		#else
+			return F(arg);
+		#endif
+		}
+
+		/// Look up array of values in table one by one.
+		/// \param table table of 65537 values indexed by half-precision bits
+		/// \param src values to look up
+		/// \param dst array to store results at
+		/// \param n number of values to look up
+		inline void lookup_scalar(const uint16 *table, const uint16 *src, uint16 *dst, std::size_t n)
+		{
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = table[src[i]];
+		}
+
+	#if HALF_SIMD_AVX2
+		/// Look up array of values in table using AVX2.
+		/// This gathers 32-bit words at 16-bit offsets and keeps their low halves, looking up 16 values at once.
+		/// \param table table of 65537 values indexed by half-precision bits
+		/// \param src values to look up
+		/// \param dst array to store results at
+		/// \param n number of values to look up
+		HALF_TARGET_AVX2 inline void lookup_avx2(const uint16 *table, const uint16 *src, uint16 *dst, std::size_t n)
+		{
+			const int *base = reinterpret_cast<const int*>(table);
+			const __m256i zero = _mm256_setzero_si256(), low = _mm256_set1_epi32(0xFFFF);
+			std::size_t i = 0;
+			for(; i+16<=n; i+=16)
+			{
+				__m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src+i));
+				__m256i lo = _mm256_and_si256(_mm256_i32gather_epi32(base, _mm256_unpacklo_epi16(h, zero), 2), low);
+				__m256i hi = _mm256_and_si256(_mm256_i32gather_epi32(base, _mm256_unpackhi_epi16(h, zero), 2), low);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+i), _mm256_packus_epi32(lo, hi));
+			}
+			lookup_scalar(table, src+i, dst+i, n-i);
+		}
+	#endif
+
+	#if HALF_SIMD_AVX512
+		/// Look up array of values in table using AVX-512.
+		/// This gathers 32-bit words at 16-bit offsets and truncates them to their low halves, looking up 32 values at once.
+		/// \param table table of 65537 values indexed by half-precision bits
+		/// \param src values to look up
+		/// \param dst array to store results at
+		/// \param n number of values to look up
+		HALF_TARGET_AVX512 inline void lookup_avx512(const uint16 *table, const uint16 *src, uint16 *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+			for(; i+32<=n; i+=32)
+				for(unsigned int j=0; j<32; j+=16)
+				{
+					__m512i idx = _mm512_maskz_cvtepu16_epi32(0xFFFF, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src+i+j)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+i+j), _mm512_maskz_cvtepi32_epi16(0xFFFF, 
+						_mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, idx, table, 2)));
+				}
+			lookup_scalar(table, src+i, dst+i, n-i);
+		}
+	#endif
+
+		/// Look up array of values in table.
+		/// This uses the kernel for the [selected SIMD level](\ref simd_level), with SSE2 falling back to scalar lookups for lack 
+		/// of gather instructions.
+		/// \param table table of 65537 values indexed by half-precision bits
+		/// \param src values to look up
+		/// \param dst array to store results at
+		/// \param n number of values to look up
+		inline void lookup_n(const uint16 *table, const uint16 *src, uint16 *dst, std::size_t n)
+		{
+			typedef void (*kernel)(const uint16*, const uint16*, uint16*, std::size_t);
+			static const kernel kernels[4] = { &lookup_scalar, 0,
+			#if HALF_SIMD_AVX2
+				&lookup_avx2,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX512
+				&lookup_avx512 };
+			#else
+				0 };
+			#endif
+			if(n)
+				simd_kernel(kernels)(table, src, dst, n);
+		}
+
+		/// Evaluate unary function for array of values.
+		/// This looks the results up in the [function table](\ref HALF_ENABLE_UNARY_TABLES) if enabled and calls the function for 
+		/// each value otherwise.
+		/// \tparam R rounding mode of function
+		/// \tparam F function computing half-precision bits from half-precision bits
+		/// \param src function arguments
+		/// \param dst array to store function values at
+		/// \param n number of values to compute
+		/// \exception according to \a F
+		template<std::float_round_style R,unsigned int(*F)(unsigned int)> void tabulated_n(const uint16 *src, uint16 *dst, std::size_t n)
+		{
+		#if HALF_ENABLE_UNARY_TABLES && !HALF_ERRHANDLING
+			lookup_n(function_table<R,F>::get(), src, dst, n);
+		#else
+			for(std::size_t i=0; i<n; ++i)
+				dst[i] = static_cast<uint16>(F(src[i]));
+		#endif
+		}
+
+		/// \}
+		/// \name Function approximations
+		/// \{
+
+		/// Reinterpret single-precision value as bits.
+		/// \param value single-precision value
+		/// \return IEEE bits of \a value
+		HALF_FORCEINLINE bits<float>::type float_bits(float value)
+		{
+			bits<float>::type fbits;
+			std::memcpy(&fbits, &value, sizeof(float));
+			return fbits;
+		}
+
+		/// Reinterpret bits as single-precision value.
+		/// \param fbits IEEE bits
+		/// \return single-precision value
+		HALF_FORCEINLINE float bits_float(bits<float>::type fbits)
+		{
+			float value;
+			std::memcpy(&value, &fbits, sizeof(float));
+			return value;
+		}
+
+		/// Select single-precision value.
+		/// This blends the values with a bit mask instead of branching, so that loops using it can be vectorized.
+		/// \param cond condition to select by
+		/// \param a value to select if \a cond is `true`
+		/// \param b value to select if \a cond is `false`
+		/// \return \a a if \a cond, \a b otherwise
+		HALF_FORCEINLINE float select_float(bool cond, float a, float b)
+		{
+			bits<float>::type mask = 0U - static_cast<bits<float>::type>(cond);
+			return bits_float((float_bits(a)&mask)|(float_bits(b)&~mask));
+		}
+
+		/// Transfer sign of single-precision value.
+		/// \param value value to take magnitude from
+		/// \param sign value to take sign from
+		/// \return \a value with sign of \a sign
+		HALF_FORCEINLINE float copysign_float(float value, float sign)
+		{
+			return bits_float((float_bits(value)&0x7FFFFFFF)|(float_bits(sign)&0x80000000));
+		}
+
+		/// Single-precision exponential minus one of small argument.
+		/// This is the Taylor series up to \f$r^7\f$, whose truncation error including that of the single-precision 
+		/// coefficients stays below \f$2^{-27.5}\f$ over the argument range. Evaluating it with rounded operations adds an 
+		/// absolute error of less than \f$2^{-24.6}\f$.
+		/// \param r argument with absolute value of at most \f$\frac{\ln 2}{2}\f$
+		/// \return approximation of \f$e^r-1\f$
+		HALF_FORCEINLINE float expm1_poly(float r)
+		{
+			return r + r*r*(0.5f+r*(1.0f/6.0f+r*(1.0f/24.0f+r*(1.0f/120.0f+r*(1.0f/720.0f+r*(1.0f/5040.0f))))));
+		}
+
+		/// Single-precision exponential.
+		/// The argument is reduced by a multiple of \f$\ln 2\f$ split into two parts. For the clamped arguments the first 
+		/// product and difference are exact, so the reduced argument only suffers from rounding the second part and the final 
+		/// difference and from the representation error of \f$\ln 2\f$, together less than \f$2^{-24}|r|+2^{-37.8}\f$. 
+		/// The returned value \f$q\f$ thus gives \f$2^n(1+q)\f$ with a relative error below \f$2^{-23.8}\f$ before rounding.
+		/// \param x argument (clamped to [-20,12])
+		/// \param scale power of two to store
+		/// \return \f$e^{x-n\ln 2}-1\f$ with \f$2^n\f$ stored in \a scale
+		HALF_FORCEINLINE float exp_reduced(float x, float &scale)
+		{
+			x = select_float(x<-20.0f, -20.0f, x);
+			x = select_float(x>12.0f, 12.0f, x);
+			float k = (x*1.44269504f+12582912.0f) - 12582912.0f;
+			scale = bits_float(static_cast<bits<float>::type>(static_cast<int>(k)+127)<<23);
+			return expm1_poly((x-k*0.693145751953125f)-k*1.428606765330187e-6f);
+		}
+
+		/// Single-precision natural logarithm.
+		/// The mantissa is brought into \f$[\sqrt{0.5},\sqrt{2})\f$ and its logarithm computed from the series of 
+		/// \f$\ln\frac{1+s}{1-s}\f$ up to \f$s^{11}\f$ with \f$|s|\leq\frac{\sqrt{2}-1}{\sqrt{2}+1}\f$. Its truncation 
+		/// error stays below \f$2^{-31.9}\f$ relative to the result, while the rounded evaluation, including the division 
+		/// for \f$s\f$, adds a relative error of less than \f$2^{-22.3}\f$.
+		/// \param x positive finite argument
+		/// \param e variable to store exponent at
+		/// \return logarithm of mantissa with exponent stored in \a e
+		HALF_FORCEINLINE float log_reduced(float x, float &e)
+		{
+			bits<float>::type fbits = float_bits(x);
+			float m = bits_float((fbits&0x7FFFFF)|0x3F800000);
+			bool big = m > 1.41421356f;
+			m = select_float(big, m*0.5f, m);
+			e = static_cast<float>(static_cast<int>(fbits>>23)-127+big);
+			float f = m - 1.0f, s = f / (2.0f+f), s2 = s * s;
+			return 2.0f*s + 2.0f*s*s2*(1.0f/3.0f+s2*(1.0f/5.0f+s2*(1.0f/7.0f+s2*(1.0f/9.0f+s2*(1.0f/11.0f)))));
+		}
+
+		/// Single-precision sine and cosine.
+		/// The argument is reduced by a multiple of \f$\frac{\pi}{2}\f$ in double-precision, which is exact enough for the 
+		/// range of half-precision, leaving only the rounding to single-precision. The Taylor series up to \f$r^9\f$ and 
+		/// \f$r^{10}\f$ for \f$|r|\leq\frac{\pi}{4}\f$ have truncation errors below \f$2^{-29}\f$ and \f$2^{-30.9}\f$ 
+		/// relative to the sine and cosine, and their rounded evaluation adds relative errors of less than \f$2^{-23.4}\f$ and 
+		/// \f$2^{-22.7}\f$.
+		/// \param x finite argument
+		/// \param s variable to store sine of reduced argument at
+		/// \param c variable to store cosine of reduced argument at
+		/// \return quadrant of argument
+		HALF_FORCEINLINE int sincos_reduced(float x, float &s, float &c)
+		{
+			double d = x, k = (d*0.63661977236758134+6755399441055744.0) - 6755399441055744.0;
+			float r = static_cast<float>((d-k*1.5707963267341256)-k*6.0771005065061922e-11), r2 = r * r;
+			s = r + r*r2*(-1.0f/6.0f+r2*(1.0f/120.0f+r2*(-1.0f/5040.0f+r2*(1.0f/362880.0f))));
+			c = 1.0f + r2*(-0.5f+r2*(1.0f/24.0f+r2*(-1.0f/720.0f+r2*(1.0f/40320.0f+r2*(-1.0f/3628800.0f)))));
+			return static_cast<int>(k);
+		}
+
+		/// Single-precision approximation of function.
+		/// The approximations have a relative error of a few single-precision ulps, which is small enough to round most 
+		/// results correctly to half-precision. Over all finite non-zero half-precision arguments with results of magnitude 
+		/// between \f$2^{-26}\f$ and the overflow threshold, their relative errors are bounded by \f$2^{-22.7}\f$ for exp 
+		/// and exp2, \f$2^{-22.3}\f$ for log, cbrt, sin and cos, \f$2^{-22.2}\f$ for atan, \f$2^{-22.1}\f$ for cosh, 
+		/// \f$2^{-21.9}\f$ for log10, log2 and sinh, \f$2^{-21.8}\f$ for log1p, \f$2^{-21.7}\f$ for expm1, \f$2^{-21.5}\f$ 
+		/// for tanh and \f$2^{-21.1}\f$ for tan. These bounds were derived for each argument by adding the truncation errors of 
+		/// the polynomials and Newton iterations, computed exactly, to a running bound of \f$2^{-24}\f$ times the magnitude of 
+		/// every inexact operation, propagated to first order. They thus hold regardless of vectorization and of contracting 
+		/// operations into fused multiply-adds. Larger results only occur for arguments clamped to values whose results overflow 
+		/// as well, and smaller ones for exp and exp2 of large negative arguments, which are clamped to positive values below 
+		/// \f$2^{-26}\f$. They don't care for special values and their results are only valid for finite non-zero arguments.
+		/// \tparam C function to compute (`'e'` exp, `'2'` exp2, `'m'` expm1, `'l'` log, `'d'` log10, `'b'` log2, `'p'` log1p, 
+		/// `'3'` cbrt, `'s'` sin, `'c'` cos, `'t'` tan, `'a'` atan, `'S'` sinh, `'C'` cosh, `'T'` tanh)
+		/// \param x function argument
+		/// \return approximate function value
+		template<char C> HALF_FORCEINLINE float approximate(float x)
+		{
+			float a = bits_float(float_bits(x)&0x7FFFFFFF), y, z;
+			if(C == 'e' || C == 'm' || C == 'S' || C == 'C' || C == 'T')
+			{
+				float s, q = exp_reduced((C=='T') ? (-2.0f*a) : (C=='S' || C=='C') ? a : x, s);
+				y = s + s*q;
+				if(C == 'm')
+					return s*q + (s-1.0f);
+				if(C == 'C')
+					return 0.5f*y + 0.5f/y;
+				if(C == 'T')
+				{
+					z = s*q + (s-1.0f);
+					return copysign_float(-z/(z+2.0f), x);
+				}
+				if(C == 'S')
+				{
+					z = a*a;
+					z = a + a*z*(1.0f/6.0f+z*(1.0f/120.0f+z*(1.0f/5040.0f+z*(1.0f/362880.0f+z*(1.0f/39916800.0f)))));
+					return copysign_float(select_float(a<1.0f, z, 0.5f*y-0.5f/y), x);
+				}
+				return y;
+			}
+			if(C == '2')
+			{
+				x = select_float(x<-30.0f, -30.0f, x);
+				x = select_float(x>17.0f, 17.0f, x);
+				float k = (x+12582912.0f) - 12582912.0f, s = bits_float(static_cast<bits<float>::type>(static_cast<int>(k)+127)<<23);
+				return s + s*expm1_poly((x-k)*0.693147181f);
+			}
+			if(C == 'l' || C == 'd' || C == 'b' || C == 'p')
+			{
+				float u = (C=='p') ? (1.0f+x) : x, e, l = log_reduced(u, e);
+				if(C == 'b')
+					y = e + l*1.44269504f;
+				else if(C == 'd')
+					y = e*0.30102999566f + l*0.434294482f;
+				else
+					y = e*0.693145751953125f + (e*1.428606765330187e-6f+l);
+				if(C == 'p')
+				{
+					z = u - 1.0f;
+					y = select_float(z==0.0f, x, y*(x/z));
+				}
+				return select_float(u>0.0f, y, bits_float(0x7FC00000));
+			}
+			if(C == 's' || C == 'c' || C == 't')
+			{
+				int q = sincos_reduced(x, y, z);
+				if(C == 't')
+					return select_float((q&1)!=0, -z/y, y/z);
+				if(C == 'c')
+					++q;
+				return bits_float(float_bits(select_float((q&1)!=0, z, y))^(static_cast<bits<float>::type>(q&2)<<30));
+			}
+			if(C == 'a')
+			{
+				bool inv = a > 1.0f, mid;
+				a = select_float(inv, 1.0f/a, a);
+				mid = a > 0.41421356f;
+				a = select_float(mid, (a-1.0f)/(a+1.0f), a);
+				z = a * a;
+				y = a + a*z*(-1.0f/3.0f+z*(1.0f/5.0f+z*(-1.0f/7.0f+z*(1.0f/9.0f+z*(-1.0f/11.0f+z*(1.0f/13.0f+z*(-1.0f/15.0f+
+					z*(1.0f/17.0f))))))));
+				y = select_float(mid, 0.785398163f+y, y);
+				return copysign_float(select_float(inv, 1.570796327f-y, y), x);
+			}
+			if(C == '3')
+			{
+				y = bits_float(float_bits(a)/3+709958130);
+				for(unsigned int i=0; i<3; ++i)
+					y = (2.0f*y+a/(y*y)) * (1.0f/3.0f);
+				return copysign_float(y, x);
+			}
+			return x;
+		}
+
+		/// Block of function arguments and approximate results.
+		struct approx_block
+		{
+			float x[256];		///< function arguments
+			float lo[256];		///< lower bounds of function values
+			float hi[256];		///< upper bounds of function values
+		};
+
+		/// Approximate function for block of values.
+		/// This computes bounds for the exact function values, widening the approximations by \f$2^{-19}\f$ relative to their 
+		/// magnitude. Rounding the bounds themselves may take back up to \f$2^{-24}\f$ of that, which still leaves more than 
+		/// 4 times the largest error bound of approximate(), yet is small enough for most bounds to round to the same value. 
+		/// The absolute \f$10^{-30}\f$ separates the bounds of zero results. When both bounds round to the same 
+		/// half-precision value, this is the correctly rounded result.
+		/// \tparam C function to compute
+		/// \param block block of arguments to compute bounds for
+		template<char C> HALF_FORCEINLINE void approximate_block(approx_block &block)
+		{
+			for(unsigned int i=0; i<256; ++i)
+			{
+				float y = approximate<C>(block.x[i]), e = bits_float(float_bits(y)&0x7FFFFFFF)*(1.0f/524288.0f) + 1e-30f;
+				block.lo[i] = y - e;
+				block.hi[i] = y + e;
+			}
+		}
+
+		/// Approximate function for block of values without SIMD.
+		/// \tparam C function to compute
+		/// \param block block of arguments to compute bounds for
+		template<char C> void approximate_scalar(approx_block &block) { approximate_block<C>(block); }
+
+	#if HALF_SIMD_SSE2
+		/// Approximate function for block of values using SSE2.
+		/// This is the same code as approximate_scalar(), only compiled for SSE2 so the compiler can vectorize it.
+		/// \tparam C function to compute
+		/// \param block block of arguments to compute bounds for
+		template<char C> HALF_TARGET_SSE2 void approximate_sse2(approx_block &block) { approximate_block<C>(block); }
+	#endif
+
+	#if HALF_SIMD_AVX2
+		/// Approximate function for block of values using AVX2.
+		/// This is the same code as approximate_scalar(), only compiled for AVX2 so the compiler can vectorize it.
+		/// \tparam C function to compute
+		/// \param block block of arguments to compute bounds for
+		template<char C> HALF_TARGET_AVX2 void approximate_avx2(approx_block &block) { approximate_block<C>(block); }
+	#endif
+
+	#if HALF_SIMD_AVX512
+		/// Approximate function for block of values using AVX-512.
+		/// This is the same code as approximate_scalar(), only compiled for AVX-512 so the compiler can vectorize it.
+		/// \tparam C function to compute
+		/// \param block block of arguments to compute bounds for
+		template<char C> HALF_TARGET_AVX512 void approximate_avx512(approx_block &block) { approximate_block<C>(block); }
+	#endif
+
+		/// Evaluate unary function for array of values using approximations.
+		/// The values are converted to single-precision in blocks, approximated with the kernel for the 
+		/// [selected SIMD level](\ref simd_level) and both bounds of each result rounded to half-precision. Where they differ, 
+		/// as well as for zero, infinite or NaN arguments or results, the function is evaluated exactly instead. So are small 
+		/// arguments of expm1 and log1p, whose exact implementations aren't always correctly rounded there. The results are thus 
+		/// always identical to those of the exact function. This isn't used with [function tables](\ref HALF_ENABLE_UNARY_TABLES), 
+		/// [exception handling](\ref errors), [flushed subnormals](\ref HALF_FLUSH_DENORMALS), a custom 
+		/// [arithmetic type](\ref HALF_ARITHMETIC_TYPE) or [disabled](\ref HALF_ENABLE_FLOAT_ARITHMETIC) single-precision 
+		/// arithmetic, which all evaluate the values like tabulated_n(). The latter includes fast-math optimizations, which may 
+		/// fold the rounding tricks of the approximations away.
+		/// \tparam R rounding mode of function
+		/// \tparam C function to approximate as for approximate()
+		/// \tparam F function computing half-precision bits from half-precision bits
+		/// \param src function arguments
+		/// \param dst array to store function values at
+		/// \param n number of values to compute
+		/// \exception according to \a F
+		template<std::float_round_style R,char C,unsigned int(*F)(unsigned int)> void approximated_n(const uint16 *src, uint16 *dst, std::size_t n)
+		{
+		#if HALF_ENABLE_UNARY_TABLES || HALF_ERRHANDLING || HALF_FLUSH_DENORMALS || defined(HALF_ARITHMETIC_TYPE) || \
+			!HALF_ENABLE_FLOAT_ARITHMETIC
+			tabulated_n<R,F>(src, dst, n);
+		#else
+			if(!std::numeric_limits<float>::is_iec559)
+				return tabulated_n<R,F>(src, dst, n);
+			typedef void (*kernel)(approx_block&);
+			static const kernel kernels[4] = { &approximate_scalar<C>,
+			#if HALF_SIMD_SSE2
+				&approximate_sse2<C>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX2
+				&approximate_avx2<C>,
+			#else
+				0,
+			#endif
+			#if HALF_SIMD_AVX512
+				&approximate_avx512<C> };
+			#else
+				0 };
+			#endif
+			kernel approx = simd_kernel(kernels);
+			nearest_rounding rounding;
+			approx_block block;
+			uint16 lo[256], hi[256];
+			for(std::size_t i=0; i<n; i+=256)
+			{
+				std::size_t m = (std::min)(n-i, static_cast<std::size_t>(256));
+				half2float_n(src+i, block.x, m);
+				std::fill(block.x+m, block.x+256, 1.0f);
+				approx(block);
+				float2half_n<R,policy_none>(block.lo, lo, m);
+				float2half_n<R,policy_none>(block.hi, hi, m);
+				for(std::size_t j=0; j<m; ++j)
+				{
+					unsigned int arg = src[i+j], abs = arg & 0x7FFF;
+					dst[i+j] = (lo[j] != hi[j] || (lo[j]&0x7FFF) > 0x7C00 || !abs || abs >= 0x7C00 || 
+						((C=='m' || C=='p') && abs < 0x2400)) ? static_cast<uint16>(F(arg)) : lo[j];
+				}
+			}
+		#endif
+		}
+
+		/// \}
+		/// \name Packed arithmetic
+		/// \{
+
+		/// Storage for packed half-precision values.
+		/// With SSE2 enabled at compile-time this holds blocks of eight values in SSE registers, otherwise plain arrays.
+		/// \tparam N number of values (multiple of 8)
+		template<std::size_t N> struct packed_storage
+		{
+		#if HALF_PACKED_SSE2
+			__m128i v[N/8];		///< blocks of eight values
+		#else
+			uint16 v[N];		///< values
+		#endif
+		};
+
+		/// Type of packed values.
+		/// This is only defined for the supported numbers of values, so that functions on packed values don't interfere with 
+		/// the overloads for single values taking a rounding mode as template argument.
+		/// \tparam N number of values
+		template<std::size_t N> struct packed_type {};
+		template<> struct packed_type<8> { typedef packed_half<8> type; };
+		template<> struct packed_type<16> { typedef packed_half<16> type; };
+		template<> struct packed_type<32> { typedef packed_half<32> type; };
+
+	#if HALF_PACKED_SSE2
+		/// Compute four square roots using SSE2.
+		/// This is the SSE2 version of sqrt_float() for positive finite operands, rounding the results to odd where necessary.
+		/// \tparam R rounding mode to use
+		/// \param a operands as exactly converted from half-precision
+		/// \return single-precision results, giving the correctly rounded results when converted to half-precision
+		template<std::float_round_style R> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128 sqrt_sse2(__m128 a)
+		{
+			__m128 q = _mm_sqrt_ps(a);
+		#if !HALF_ERRHANDLING
+			if(R != std::round_to_nearest)
+		#endif
+			{
+				__m128d r0 = _mm_sub_pd(_mm_cvtps_pd(a), _mm_mul_pd(_mm_cvtps_pd(q), _mm_cvtps_pd(q)));
+				__m128d r1 = _mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(a, a)), 
+					_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(q, q)), _mm_cvtps_pd(_mm_movehl_ps(q, q))));
+				__m128 r = _mm_movelh_ps(_mm_cvtpd_ps(r0), _mm_cvtpd_ps(r1)), zero = _mm_setzero_ps();
+				q = round_to_odd_sse2(q, _mm_cmpneq_ps(r, zero), _mm_cmpgt_ps(r, zero));
+			}
+			return q;
+		}
+
+		/// Compute four single-precision results using SSE2.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*`, `/`, `f` for fused multiply add or `s` for square root)
+		/// \param a first operands as exactly converted from half-precision
+		/// \param b second operands as exactly converted from half-precision
+		/// \param c third operands as exactly converted from half-precision
+		/// \return single-precision results, giving the correctly rounded results when converted to half-precision
+		template<std::float_round_style R,char O> HALF_TARGET_SSE2 HALF_FORCEINLINE __m128 packed_sse2(__m128 a, __m128 b, __m128 c)
+		{
+			return (O=='s') ? sqrt_sse2<R>(a) : (O=='f') ? fma_sse2<R>(a, b, c) : arithmetic_sse2<R,O>(a, b);
+		}
+
+	#if HALF_PACKED_AVX2
+		/// Compute eight square roots using AVX2.
+		/// This is the AVX2 version of sqrt_sse2() with identical results.
+		/// \tparam R rounding mode to use
+		/// \param a operands as exactly converted from half-precision
+		/// \return single-precision results, giving the correctly rounded results when converted to half-precision
+		template<std::float_round_style R> HALF_FORCEINLINE __m256 sqrt_avx2(__m256 a)
+		{
+			__m256 q = _mm256_sqrt_ps(a);
+		#if !HALF_ERRHANDLING
+			if(R != std::round_to_nearest)
+		#endif
+			{
+				__m128 qlo = _mm256_castps256_ps128(q), qhi = _mm256_extractf128_ps(q, 1);
+				__m256d r0 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(a)), _mm256_mul_pd(_mm256_cvtps_pd(qlo), _mm256_cvtps_pd(qlo)));
+				__m256d r1 = _mm256_sub_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(a, 1)), _mm256_mul_pd(_mm256_cvtps_pd(qhi), _mm256_cvtps_pd(qhi)));
+				__m256 r = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(r0)), _mm256_cvtpd_ps(r1), 1), zero = _mm256_setzero_ps();
+				q = round_to_odd_avx2(q, _mm256_cmp_ps(r, zero, _CMP_NEQ_UQ), _mm256_cmp_ps(r, zero, _CMP_GT_OQ));
+			}
+			return q;
+		}
+
+		/// Compute eight single-precision results using AVX2.
+		/// This is the AVX2 version of packed_sse2() with identical results.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*`, `/`, `f` for fused multiply add or `s` for square root)
+		/// \param a first operands as exactly converted from half-precision
+		/// \param b second operands as exactly converted from half-precision
+		/// \param c third operands as exactly converted from half-precision
+		/// \return single-precision results, giving the correctly rounded results when converted to half-precision
+		template<std::float_round_style R,char O> HALF_FORCEINLINE __m256 packed_avx2(__m256 a, __m256 b, __m256 c)
+		{
+			return (O=='s') ? sqrt_avx2<R>(a) : (O=='f') ? fma_avx2<R>(a, b, c) : arithmetic_avx2<R,O>(a, b);
+		}
+	#endif
+
+		/// Convert eight half-precision values to single-precision.
+		/// \param h half-precision values
+		/// \param lo array to store lower four single-precision values at
+		/// \param hi array to store upper four single-precision values at
+		HALF_FORCEINLINE void packed_widen(__m128i h, float *lo, float *hi)
+		{
+		#if HALF_PACKED_AVX2
+			__m256 f = _mm256_cvtph_ps(h);
+			_mm_storeu_ps(lo, _mm256_castps256_ps128(f));
+			_mm_storeu_ps(hi, _mm256_extractf128_ps(f, 1));
+		#else
+			_mm_storeu_ps(lo, half2float_sse2(_mm_unpacklo_epi16(h, _mm_setzero_si128())));
+			_mm_storeu_ps(hi, half2float_sse2(_mm_unpackhi_epi16(h, _mm_setzero_si128())));
+		#endif
+		}
+
+		/// Convert eight single-precision values to half-precision.
+		/// \tparam R rounding mode to use
+		/// \param lo lower four single-precision values
+		/// \param hi upper four single-precision values
+		/// \return half-precision values
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<std::float_round_style R> HALF_FORCEINLINE __m128i packed_narrow(__m128 lo, __m128 hi)
+		{
+		#if HALF_PACKED_AVX2 && !HALF_ERRHANDLING
+			return _mm256_cvtps_ph(_mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1), f16c_rounding<R>::value);
+		#else
+			__m128i flags = _mm_setzero_si128(), l = float2half_sse2<R>(_mm_castps_si128(lo), flags), h = float2half_sse2<R>(_mm_castps_si128(hi), flags);
+		#if HALF_ERRHANDLING
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0x4E));
+			flags = _mm_or_si128(flags, _mm_shuffle_epi32(flags, 0xB1));
+			raise(_mm_cvtsi128_si32(flags), _mm_cvtsi128_si32(flags)!=0);
+		#endif
+			return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(l, 16), 16), _mm_srai_epi32(_mm_slli_epi32(h, 16), 16));
+		#endif
+		}
+
+		/// Compute eight half-precision results.
+		/// Blocks of finite operands (and non-zero divisors or positive square root arguments) are computed in single-precision 
+		/// like the [batch arithmetic](\ref batch_arithmetic) if [enabled](\ref HALF_ENABLE_FLOAT_ARITHMETIC), all others one by 
+		/// one. The results and exceptions are identical to those of computing the values one by one.
+		/// \tparam R rounding mode to use
+		/// \tparam O operation to perform (`+`, `-`, `*`, `/`, `f` for fused multiply add or `s` for square root)
+		/// \param x first operands
+		/// \param y second operands
+		/// \param z third operands
+		/// \return results
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<std::float_round_style R,char O> HALF_FORCEINLINE __m128i packed_arithmetic(__m128i x, __m128i y, __m128i z)
+		{
+		#if HALF_ENABLE_FLOAT_ARITHMETIC && !defined(HALF_ARITHMETIC_TYPE)
+			const __m128i abs = _mm_set1_epi16(0x7FFF), max = _mm_set1_epi16(0x7BFF);
+			x = flush_arg_sse2(x);
+			y = flush_arg_sse2(y);
+			z = flush_arg_sse2(z);
+			__m128i special = (O=='s') ? _mm_or_si128(_mm_cmpgt_epi16(x, max), _mm_cmplt_epi16(x, _mm_set1_epi16(1))) : 
+				_mm_or_si128(_mm_cmpgt_epi16(_mm_and_si128(x, abs), max), _mm_cmpgt_epi16(_mm_and_si128(y, abs), max));
+			if(O == '/')
+				special = _mm_or_si128(special, _mm_cmpeq_epi16(_mm_and_si128(y, abs), _mm_setzero_si128()));
+			if(O == 'f')
+				special = _mm_or_si128(special, _mm_cmpgt_epi16(_mm_and_si128(z, abs), max));
+			if(!_mm_movemask_epi8(special))
+			{
+				nearest_rounding rounding;
+			#if HALF_PACKED_AVX2
+				__m256 f = packed_avx2<R,O>(_mm256_cvtph_ps(x), _mm256_cvtph_ps(y), _mm256_cvtph_ps(z));
+				return flush_result_sse2(packed_narrow<R>(_mm256_castps256_ps128(f), _mm256_extractf128_ps(f, 1)));
+			#else
+				const __m128i zero = _mm_setzero_si128();
+				return flush_result_sse2(packed_narrow<R>(packed_sse2<R,O>(half2float_sse2(_mm_unpacklo_epi16(x, zero)), 
+					half2float_sse2(_mm_unpacklo_epi16(y, zero)), half2float_sse2(_mm_unpacklo_epi16(z, zero))), 
+					packed_sse2<R,O>(half2float_sse2(_mm_unpackhi_epi16(x, zero)), half2float_sse2(_mm_unpackhi_epi16(y, zero)), 
+					half2float_sse2(_mm_unpackhi_epi16(z, zero)))));
+			#endif
+			}
+		#endif
+			uint16 a[8], b[8], c[8];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(a), x);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(b), y);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(c), z);
+			for(unsigned int i=0; i<8; ++i)
+				a[i] = static_cast<uint16>((O=='s') ? sqrt<R>(a[i]) : (O=='f') ? fma<R>(a[i], b[i], c[i]) : arithmetic<R,O>(a[i], b[i]));
+			return _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+		}
+
+		/// Compute minimum or maximum of eight half-precision values.
+		/// The results and exceptions are identical to those of fmin() and fmax().
+		/// \tparam O `<` for minimum, `>` for maximum
+		/// \param x first operands
+		/// \param y second operands
+		/// \return minima or maxima
+		/// \exception FE_INVALID if a value is signaling NaN
+		template<char O> HALF_FORCEINLINE __m128i packed_minmax(__m128i x, __m128i y)
+		{
+			const __m128i abs = _mm_set1_epi16(0x7FFF), inf = _mm_set1_epi16(0x7C00);
+			if(_mm_movemask_epi8(_mm_or_si128(_mm_cmpgt_epi16(_mm_and_si128(x, abs), inf), _mm_cmpgt_epi16(_mm_and_si128(y, abs), inf))))
+			{
+				uint16 a[8], b[8];
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(a), x);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(b), y);
+				for(unsigned int i=0; i<8; ++i)
+					a[i] = static_cast<uint16>((O=='<') ? fmin(a[i], b[i]) : fmax(a[i], b[i]));
+				return _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+			}
+			__m128i kx = _mm_xor_si128(x, _mm_and_si128(_mm_srai_epi16(x, 15), abs)), ky = _mm_xor_si128(y, _mm_and_si128(_mm_srai_epi16(y, 15), abs));
+			__m128i m = (O=='<') ? _mm_cmpgt_epi16(kx, ky) : _mm_cmplt_epi16(kx, ky);
+			return _mm_or_si128(_mm_and_si128(m, y), _mm_andnot_si128(m, x));
+		}
+
+		/// Compare eight half-precision values.
+		/// The results and exceptions are identical to those of the comparison operators.
+		/// \tparam O comparison to perform (`=`, `!`, `<`, `>`, `l` for less equal or `g` for greater equal)
+		/// \param x first operands
+		/// \param y second operands
+		/// \return bit mask with bit *i* set if comparison is true for *i*-th values
+		/// \exception FE_INVALID if a value is NaN
+		template<char O> HALF_FORCEINLINE unsigned int packed_compare(__m128i x, __m128i y)
+		{
+			const __m128i abs = _mm_set1_epi16(0x7FFF), inf = _mm_set1_epi16(0x7C00);
+			__m128i ax = _mm_and_si128(x, abs), ay = _mm_and_si128(y, abs), sx = _mm_srai_epi16(x, 15), sy = _mm_srai_epi16(y, 15);
+			__m128i nan = _mm_or_si128(_mm_cmpgt_epi16(ax, inf), _mm_cmpgt_epi16(ay, inf));
+			__m128i kx = _mm_sub_epi16(_mm_xor_si128(ax, sx), sx), ky = _mm_sub_epi16(_mm_xor_si128(ay, sy), sy);
+			__m128i m = (O=='=' || O=='!') ? _mm_cmpeq_epi16(kx, ky) : (O=='<' || O=='g') ? _mm_cmplt_epi16(kx, ky) : _mm_cmpgt_epi16(kx, ky);
+			m = (O=='!') ? _mm_or_si128(_mm_andnot_si128(m, _mm_cmpeq_epi16(m, m)), nan) : (O=='l' || O=='g') ? 
+				_mm_andnot_si128(_mm_or_si128(m, nan), _mm_cmpeq_epi16(m, m)) : _mm_andnot_si128(nan, m);
+		#if HALF_ERRHANDLING
+			raise(FE_INVALID, _mm_movemask_epi8(nan)!=0);
+		#endif
+			return static_cast<unsigned int>(_mm_movemask_epi8(_mm_packs_epi16(m, _mm_setzero_si128())));
+		}
+
+		/// Reduce eight half-precision values.
+		/// This combines the values at distance 4, 2 and 1 in turn, the unused values being zero.
+		/// \tparam R rounding mode to use
+		/// \tparam O `+` for sum, `<` for minimum, `>` for maximum
+		/// \param x values to reduce
+		/// \return reduced value as half-precision bits
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<std::float_round_style R,char O> HALF_FORCEINLINE unsigned int packed_reduce(__m128i x)
+		{
+			const __m128i m2 = _mm_set_epi32(0, 0, 0, -1), m1 = _mm_set_epi32(0, 0, 0, 0xFFFF);
+			__m128i a = _mm_move_epi64(x), b = _mm_srli_si128(x, 8);
+			x = (O=='+') ? packed_arithmetic<R,'+'>(a, b, b) : packed_minmax<O>(a, b);
+			a = _mm_and_si128(x, m2);
+			b = _mm_and_si128(_mm_srli_si128(x, 4), m2);
+			x = (O=='+') ? packed_arithmetic<R,'+'>(a, b, b) : packed_minmax<O>(a, b);
+			a = _mm_and_si128(x, m1);
+			b = _mm_and_si128(_mm_srli_si128(x, 2), m1);
+			x = (O=='+') ? packed_arithmetic<R,'+'>(a, b, b) : packed_minmax<O>(a, b);
+			return static_cast<unsigned int>(_mm_cvtsi128_si32(x)) & 0xFFFF;
+		}
+	#endif
+		/// \}
+		/// \name Interval arithmetic
+		/// \{
+
+		/// Check whether interval contains zero.
+		/// \param lo lower bound as half-precision bits
+		/// \param hi upper bound as half-precision bits
+		/// \return true if \a lo <= 0 <= \a hi, false if not or if a bound is NaN
+		inline HALF_CONSTEXPR bool interval_zero(unsigned int lo, unsigned int hi)
+		{
+			return (lo == 0 || (lo >= 0x8000 && lo <= 0xFC00)) && (hi == 0x8000 || hi <= 0x7C00);
+		}
+
+		/// Split intervals into separate arrays of bounds.
+		/// \param src intervals as consecutive pairs of lower and upper bounds
+		/// \param lo array to store lower bounds at
+		/// \param hi array to store upper bounds at
+		/// \param n number of intervals
+		inline void interval_split(const uint16 *src, uint16 *lo, uint16 *hi, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_PACKED_SSE2
+			for(; i+8<=n; i+=8)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src+2*i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src+2*i+8));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(lo+i), _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16), 
+					_mm_srai_epi32(_mm_slli_epi32(b, 16), 16)));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(hi+i), _mm_packs_epi32(_mm_srai_epi32(a, 16), _mm_srai_epi32(b, 16)));
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				lo[i] = src[2*i];
+				hi[i] = src[2*i+1];
+			}
+		}
+
+		/// Merge separate arrays of bounds into intervals.
+		/// \param lo lower bounds
+		/// \param hi upper bounds
+		/// \param dst array to store intervals at as consecutive pairs of lower and upper bounds
+		/// \param n number of intervals
+		inline void interval_merge(const uint16 *lo, const uint16 *hi, uint16 *dst, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_PACKED_SSE2
+			for(; i+8<=n; i+=8)
+			{
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lo+i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hi+i));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+2*i), _mm_unpacklo_epi16(a, b));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+2*i+8), _mm_unpackhi_epi16(a, b));
+			}
+		#endif
+			for(; i<n; ++i)
+			{
+				dst[2*i] = lo[i];
+				dst[2*i+1] = hi[i];
+			}
+		}
+
+		/// Update bounds with minima or maxima.
+		/// \tparam O `<` for minimum, `>` for maximum
+		/// \param x bounds to update
+		/// \param y bounds to combine with
+		/// \param n number of bounds
+		/// \exception FE_INVALID if a value is signaling NaN
+		template<char O> void interval_minmax(uint16 *x, const uint16 *y, std::size_t n)
+		{
+			std::size_t i = 0;
+		#if HALF_PACKED_SSE2
+			for(; i+8<=n; i+=8)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(x+i), packed_minmax<O>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x+i)), 
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(y+i))));
+		#endif
+			for(; i<n; ++i)
+				x[i] = static_cast<uint16>((O=='<') ? fmin(x[i], y[i]) : fmax(x[i], y[i]));
+		}
+
+		/// Compute arrays of half-precision intervals.
+		/// The intervals are stored as consecutive pairs of lower and upper bounds. Blocks of these are split into separate arrays 
+		/// of bounds, which are computed with arithmetic_n(), rounding lower bounds toward negative infinity and upper bounds toward 
+		/// positive infinity. Products and quotients are the minima and maxima of all four combinations of bounds, ignoring NaNs. 
+		/// Division by an interval containing zero results in the entire range, but divides by one instead to not raise exceptions.
+		/// \tparam O operation to perform (`+`, `-`, `*` or `/`)
+		/// \param x first operands
+		/// \param y second operands
+		/// \param dst array to store results at
+		/// \param n number of intervals to compute
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<char O> void interval_n(const uint16 *x, const uint16 *y, uint16 *dst, std::size_t n)
+		{
+			uint16 xl[256], xh[256], yl[256], yh[256], lo[256], hi[256], tmp[256];
+			bool zero[256];
+			for(std::size_t i=0; i<n; i+=256)
+			{
+				std::size_t m = (std::min)(n-i, static_cast<std::size_t>(256));
+				interval_split(x+2*i, xl, xh, m);
+				interval_split(y+2*i, yl, yh, m);
+				if(O == '+' || O == '-')
+				{
+					arithmetic_n<std::round_toward_neg_infinity,O,0>(xl, (O=='+') ? yl : yh, lo, m);
+					arithmetic_n<std::round_toward_infinity,O,0>(xh, (O=='+') ? yh : yl, hi, m);
+				}
+				else
+				{
+					if(O == '/')
+						for(std::size_t j=0; j<m; ++j)
+							if((zero[j]=interval_zero(yl[j], yh[j])) != false)
+								yl[j] = yh[j] = 0x3C00;
+					const uint16 *a[4] = { xl, xl, xh, xh }, *b[4] = { yl, yh, yl, yh };
+					arithmetic_n<std::round_toward_neg_infinity,O,0>(xl, yl, lo, m);
+					arithmetic_n<std::round_toward_infinity,O,0>(xl, yl, hi, m);
+					for(unsigned int k=1; k<4; ++k)
+					{
+						arithmetic_n<std::round_toward_neg_infinity,O,0>(a[k], b[k], tmp, m);
+						interval_minmax<'<'>(lo, tmp, m);
+						arithmetic_n<std::round_toward_infinity,O,0>(a[k], b[k], tmp, m);
+						interval_minmax<'>'>(hi, tmp, m);
+					}
+					if(O == '/')
+						for(std::size_t j=0; j<m; ++j)
+							if(zero[j] && (lo[j]&0x7FFF) <= 0x7C00)
+								lo[j] = 0xFC00, hi[j] = 0x7C00;
+				}
+				interval_merge(lo, hi, dst+2*i, m);
+			}
+		}
+
+		/// Convert arrays to half-precision intervals.
+		/// This converts blocks of values with float2half_n() rounding toward negative and positive infinity for lower and upper 
+		/// bounds respectively and stores them as consecutive pairs.
+		/// \tparam T type to convert from (`float` or `double`)
+		/// \param src values to convert
+		/// \param dst array to store intervals at
+		/// \param n number of values to convert
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		template<typename T> void interval_convert_n(const T *src, uint16 *dst, std::size_t n)
+		{
+			uint16 lo[256], hi[256];
+			for(std::size_t i=0; i<n; i+=256)
+			{
+				std::size_t m = (std::min)(n-i, static_cast<std::size_t>(256));
+				float2half_n<std::round_toward_neg_infinity,policy_none>(src+i, lo, m);
+				float2half_n<std::round_toward_infinity,policy_none>(src+i, hi, m);
+				interval_merge(lo, hi, dst+2*i, m);
+			}
+		}
+
+		/// \}
+
+		template<typename,typename,std::float_round_style> struct half_caster;
+	}
+
+	/// Half-precision floating-point type.
+	/// This class implements an IEEE-conformant half-precision floating-point type with the usual arithmetic 
+	/// operators and conversions. It is implicitly convertible to single-precision floating-point, which makes artihmetic 
+	/// expressions and functions with mixed-type operands to be of the most precise operand type.
+	///
+	/// According to the C++98/03 definition, the half type is not a POD type. But according to C++11's less strict and 
+	/// extended definitions it is both a standard layout type and a trivially copyable type (even if not a POD type), which 
+	/// means it can be standard-conformantly copied using raw binary copies. But in this context some more words about the 
+	/// actual size of the type. Although the half is representing an IEEE 16-bit type, it does not neccessarily have to be of 
+	/// exactly 16-bits size. But on any reasonable implementation the actual binary representation of this type will most 
+	/// probably not ivolve any additional "magic" or padding beyond the simple binary representation of the underlying 16-bit 
+	/// IEEE number, even if not strictly guaranteed by the standard. But even then it only has an actual size of 16 bits if 
+	/// your C++ implementation supports an unsigned integer type of exactly 16 bits width. But this should be the case on 
+	/// nearly any reasonable platform.
+	///
+	/// So if your C++ implementation is not totally exotic or imposes special alignment requirements, it is a reasonable 
+	/// assumption that the data of a half is just comprised of the 2 bytes of the underlying IEEE representation.
+	class half
+	{
+	public:
+		/// \name Construction and assignment
+		/// \{
+
+		/// Default constructor.
+		/// This initializes the half to 0. Although this does not match the builtin types' default-initialization semantics 
+		/// and may be less efficient than no initialization, it is needed to provide proper value-initialization semantics.
+		HALF_CONSTEXPR half() HALF_NOEXCEPT : data_() {}
+
+		/// Conversion constructor.
+		/// \param rhs float to convert
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		explicit half(float rhs) : data_(static_cast<detail::uint16>(detail::float2half<round_style>(rhs))) {}
+	
+		/// Conversion to single-precision.
+		/// \return single precision value representing expression value
+		operator float() const { return detail::half2float<float>(data_); }
+
+		/// Assignment operator.
+		/// \param rhs single-precision value to copy from
+		/// \return reference to this half
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		half& operator=(float rhs) { data_ = static_cast<detail::uint16>(detail::float2half<round_style>(rhs)); return *this; }
+
+		/// \}
+		/// \name Arithmetic updates
+		/// \{
+
+		/// Arithmetic assignment.
+		/// \tparam T type of concrete half expression
+		/// \param rhs half expression to add
+		/// \return reference to this half
+		/// \exception FE_... according to operator+(half,half)
+		half& operator+=(half rhs) { return *this = *this + rhs; }
+
+		/// Arithmetic assignment.
+		/// \tparam T type of concrete half expression
+		/// \param rhs half expression to subtract
+		/// \return reference to this half
+		/// \exception FE_... according to operator-(half,half)
+		half& operator-=(half rhs) { return *this = *this - rhs; }
+
+		/// Arithmetic assignment.
+		/// \tparam T type of concrete half expression
+		/// \param rhs half expression to multiply with
+		/// \return reference to this half
+		/// \exception FE_... according to operator*(half,half)
+		half& operator*=(half rhs) { return *this = *this * rhs; }
+
+		/// Arithmetic assignment.
+		/// \tparam T type of concrete half expression
+		/// \param rhs half expression to divide by
+		/// \return reference to this half
+		/// \exception FE_... according to operator/(half,half)
+		half& operator/=(half rhs) { return *this = *this / rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs single-precision value to add
+		/// \return reference to this half
+		/// \exception FE_... according to operator=()
+		half& operator+=(float rhs) { return *this = *this + rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs single-precision value to subtract
+		/// \return reference to this half
+		/// \exception FE_... according to operator=()
+		half& operator-=(float rhs) { return *this = *this - rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs single-precision value to multiply with
+		/// \return reference to this half
+		/// \exception FE_... according to operator=()
+		half& operator*=(float rhs) { return *this = *this * rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs single-precision value to divide by
+		/// \return reference to this half
+		/// \exception FE_... according to operator=()
+		half& operator/=(float rhs) { return *this = *this / rhs; }
+
+		/// \}
+		/// \name Increment and decrement
+		/// \{
+
+		/// Prefix increment.
+		/// \return incremented half value
+		/// \exception FE_... according to operator+(half,half)
+		half& operator++() { return *this = *this + half(detail::binary, 0x3C00); }
+
+		/// Prefix decrement.
+		/// \return decremented half value
+		/// \exception FE_... according to operator-(half,half)
+		half& operator--() { return *this = *this + half(detail::binary, 0xBC00); }
+
+		/// Postfix increment.
+		/// \return non-incremented half value
+		/// \exception FE_... according to operator+(half,half)
+		half operator++(int) { half out(*this); ++*this; return out; }
+
+		/// Postfix decrement.
+		/// \return non-decremented half value
+		/// \exception FE_... according to operator-(half,half)
+		half operator--(int) { half out(*this); --*this; return out; }
+		/// \}
+	
+	private:
+		/// Rounding mode to use
+		static const std::float_round_style round_style = (std::float_round_style)(HALF_ROUND_STYLE);
+
+		/// Constructor.
+		/// \param bits binary representation to set half to
+		HALF_CONSTEXPR half(detail::binary_t, unsigned int bits) HALF_NOEXCEPT : data_(static_cast<detail::uint16>(bits)) {}
+
+		/// Internal binary representation
+		detail::uint16 data_;
+
+	#ifndef HALF_DOXYGEN_ONLY
+		friend HALF_CONSTEXPR_NOERR bool operator==(half, half);
+		friend HALF_CONSTEXPR_NOERR bool operator!=(half, half);
+		friend HALF_CONSTEXPR_NOERR bool operator<(half, half);
+		friend HALF_CONSTEXPR_NOERR bool operator>(half, half);
+		friend HALF_CONSTEXPR_NOERR bool operator<=(half, half);
+		friend HALF_CONSTEXPR_NOERR bool operator>=(half, half);
+		friend HALF_CONSTEXPR half operator-(half);
+		friend half operator+(half, half);
+		template<std::float_round_style> friend half add(half, half);
+		friend half operator-(half, half);
+		template<std::float_round_style> friend half sub(half, half);
+		friend half operator*(half, half);
+		template<std::float_round_style> friend half mul(half, half);
+		friend half operator/(half, half);
+		template<std::float_round_style> friend half div(half, half);
+		template<typename charT,typename traits> friend std::basic_ostream<charT,traits>& operator<<(std::basic_ostream<charT,traits>&, half);
+		template<typename charT,typename traits> friend std::basic_istream<charT,traits>& operator>>(std::basic_istream<charT,traits>&, half&);
+		friend HALF_CONSTEXPR half fabs(half);
+		friend half fmod(half, half);
+		friend half remainder(half, half);
+		friend half remquo(half, half, int*);
+		friend half fma(half, half, half);
+		template<std::float_round_style> friend half fma(half, half, half);
+		friend HALF_CONSTEXPR_NOERR half fmax(half, half);
+		friend HALF_CONSTEXPR_NOERR half fmin(half, half);
+		friend half fdim(half, half);
+		template<std::float_round_style> friend half fdim(half, half);
+		friend half nanh(const char*);
+		friend half exp(half);
+		template<std::float_round_style> friend half exp(half);
+		friend half exp2(half);
+		template<std::float_round_style> friend half exp2(half);
+		friend half expm1(half);
+		template<std::float_round_style> friend half expm1(half);
+		friend half log(half);
+		template<std::float_round_style> friend half log(half);
+		friend half log10(half);
+		template<std::float_round_style> friend half log10(half);
+		friend half log2(half);
+		template<std::float_round_style> friend half log2(half);
+		friend half log1p(half);
+		template<std::float_round_style> friend half log1p(half);
+		friend half sqrt(half);
+		template<std::float_round_style> friend half sqrt(half);
+		friend half rsqrt(half);
+		template<std::float_round_style> friend half rsqrt(half);
+		friend half cbrt(half);
+		template<std::float_round_style> friend half cbrt(half);
+		friend half hypot(half, half);
+		template<std::float_round_style> friend half hypot(half, half);
+		friend half hypot(half, half, half);
+		template<std::float_round_style> friend half hypot(half, half, half);
+		friend half pow(half, half);
+		template<std::float_round_style> friend half pow(half, half);
+		friend void sincos(half, half*, half*);
+		template<std::float_round_style> friend void sincos(half, half*, half*);
+		friend half sin(half);
+		template<std::float_round_style> friend half sin(half);
+		friend half cos(half);
+		template<std::float_round_style> friend half cos(half);
+		friend half tan(half);
+		template<std::float_round_style> friend half tan(half);
+		friend half asin(half);
+		template<std::float_round_style> friend half asin(half);
+		friend half acos(half);
+		template<std::float_round_style> friend half acos(half);
+		friend half atan(half);
+		template<std::float_round_style> friend half atan(half);
+		friend half atan2(half, half);
+		template<std::float_round_style> friend half atan2(half, half);
+		friend half sinh(half);
+		template<std::float_round_style> friend half sinh(half);
+		friend half cosh(half);
+		template<std::float_round_style> friend half cosh(half);
+		friend half tanh(half);
+		template<std::float_round_style> friend half tanh(half);
+		friend half asinh(half);
+		template<std::float_round_style> friend half asinh(half);
+		friend half acosh(half);
+		template<std::float_round_style> friend half acosh(half);
+		friend half atanh(half);
+		template<std::float_round_style> friend half atanh(half);
+		friend half erf(half);
+		template<std::float_round_style> friend half erf(half);
+		friend half erfc(half);
+		template<std::float_round_style> friend half erfc(half);
+		friend half lgamma(half);
+		template<std::float_round_style> friend half lgamma(half);
+		friend half tgamma(half);
+		template<std::float_round_style> friend half tgamma(half);
+		friend half ceil(half);
+		friend half floor(half);
+		friend half trunc(half);
+		friend half round(half);
+		friend long lround(half);
+		friend half rint(half);
+		template<std::float_round_style> friend half rint(half);
+		friend long lrint(half);
+		template<std::float_round_style> friend long lrint(half);
+		friend half nearbyint(half);
+		template<std::float_round_style> friend half nearbyint(half);
+	#ifdef HALF_ENABLE_CPP11_LONG_LONG
+		friend long long llround(half);
+		friend long long llrint(half);
+		template<std::float_round_style> friend long long llrint(half);
+	#endif
+		friend half frexp(half, int*);
+		friend half scalbln(half, long);
+		template<std::float_round_style> friend half scalbln(half, long);
+		friend half modf(half, half*);
+		friend int ilogb(half);
+		friend half logb(half);
+		friend half nextafter(half, half);
+		friend half nexttoward(half, long double);
+		friend HALF_CONSTEXPR half copysign(half, half);
+		friend HALF_CONSTEXPR int fpclassify(half);
+		friend HALF_CONSTEXPR bool isfinite(half);
+		friend HALF_CONSTEXPR bool isinf(half);
+		friend HALF_CONSTEXPR bool isnan(half);
+		friend HALF_CONSTEXPR bool isnormal(half);
+		friend HALF_CONSTEXPR bool signbit(half);
+		friend HALF_CONSTEXPR bool isgreater(half, half);
+		friend HALF_CONSTEXPR bool isgreaterequal(half, half);
+		friend HALF_CONSTEXPR bool isless(half, half);
+		friend HALF_CONSTEXPR bool islessequal(half, half);
+		friend HALF_CONSTEXPR bool islessgreater(half, half);
+		template<typename,typename,std::float_round_style> friend struct detail::half_caster;
+		template<std::size_t> friend class packed_half;
+		friend class unary_table;
+		friend class std::numeric_limits<half>;
+	#if HALF_ENABLE_CPP11_HASH
+		friend struct std::hash<half>;
+	#endif
+	#if HALF_ENABLE_CPP11_USER_LITERALS
+		friend half literal::operator "" _h(long double);
+	#endif
+	#endif
+	};
+
+#if HALF_ENABLE_CPP11_USER_LITERALS
+	namespace literal
+	{
+		/// Half literal.
+		/// While this returns a properly rounded half-precision value, half literals can unfortunately not be constant 
+		/// expressions due to rather involved conversions. So don't expect this to be a literal literal without involving 
+		/// conversion operations at runtime. It is a convenience feature, not a performance optimization.
+		/// \param value literal value
+		/// \return half with of given value (possibly rounded)
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		inline half operator "" _h(long double value) { return half(detail::binary, detail::float2half<half::round_style>(value)); }
+	}
+#endif
+
+	namespace detail
+	{
+		/// Helper class for half casts.
+		/// This class template has to be specialized for all valid cast arguments to define an appropriate static 
+		/// `cast` member function and a corresponding `type` member denoting its return type.
+		/// \tparam T destination type
+		/// \tparam U source type
+		/// \tparam R rounding mode to use
+		template<typename T,typename U,std::float_round_style R=(std::float_round_style)(HALF_ROUND_STYLE)> struct half_caster {};
+		template<typename U,std::float_round_style R> struct half_caster<half,U,R>
+		{
+		#if HALF_ENABLE_CPP11_STATIC_ASSERT && HALF_ENABLE_CPP11_TYPE_TRAITS
+			static_assert(std::is_arithmetic<U>::value, "half_cast from non-arithmetic type unsupported");
+		#endif
+
+			static half cast(U arg) { return cast_impl(arg, is_float<U>()); };
+			template<unsigned int P> static half cast(U arg) { return half(binary, apply_policy<P>(cast_impl(arg, is_float<U>()).data_)); }
+			template<unsigned int P,typename G> static half cast(U arg, G &gen)
+			{
+				return half(binary, apply_policy<P>(float2half_stochastic(arg, static_cast<uint32>(gen()))));
+			}
+
+		private:
+			static half cast_impl(U arg, true_type) { return half(binary, float2half<R>(arg)); }
+			static half cast_impl(U arg, false_type) { return half(binary, int2half<R>(arg)); }
+		};
+		template<typename T,std::float_round_style R> struct half_caster<T,half,R>
+		{
+		#if HALF_ENABLE_CPP11_STATIC_ASSERT && HALF_ENABLE_CPP11_TYPE_TRAITS
+			static_assert(std::is_arithmetic<T>::value, "half_cast to non-arithmetic type unsupported");
+		#endif
+
+			static T cast(half arg) { return cast_impl(arg, is_float<T>()); }
+
+		private:
+			static T cast_impl(half arg, true_type) { return half2float<T>(arg.data_); }
+			static T cast_impl(half arg, false_type) { return half2int<R,true,true,T>(arg.data_); }
+		};
+		template<std::float_round_style R> struct half_caster<half,half,R>
+		{
+			static half cast(half arg) { return arg; }
+			template<unsigned int P> static half cast(half arg) { return half(binary, apply_policy<P>(arg.data_)); }
+		};
+	}
+}
+
+/// Extensions to the C++ standard library.
+namespace std
+{
+	/// Numeric limits for half-precision floats.
+	/// **See also:** Documentation for [std::numeric_limits](https://en.cppreference.com/w/cpp/types/numeric_limits)
+	template<> class numeric_limits<half_float::half>
+	{
+	public:
+		/// Is template specialization.
+		static HALF_CONSTEXPR_CONST bool is_specialized = true;
+
+		/// Supports signed values.
+		static HALF_CONSTEXPR_CONST bool is_signed = true;
+
+		/// Is not an integer type.
+		static HALF_CONSTEXPR_CONST bool is_integer = false;
+
+		/// Is not exact.
+		static HALF_CONSTEXPR_CONST bool is_exact = false;
+
+		/// Doesn't provide modulo arithmetic.
+		static HALF_CONSTEXPR_CONST bool is_modulo = false;
+
+		/// Has a finite set of values.
+		static HALF_CONSTEXPR_CONST bool is_bounded = true;
+
+		/// IEEE conformant.
+		static HALF_CONSTEXPR_CONST bool is_iec559 = true;
+
+		/// Supports infinity.
+		static HALF_CONSTEXPR_CONST bool has_infinity = true;
+
+		/// Supports quiet NaNs.
+		static HALF_CONSTEXPR_CONST bool has_quiet_NaN = true;
+
+		/// Supports signaling NaNs.
+		static HALF_CONSTEXPR_CONST bool has_signaling_NaN = true;
+
+		/// Supports subnormal values.
+		static HALF_CONSTEXPR_CONST float_denorm_style has_denorm = denorm_present;
+
+		/// Supports no denormalization detection.
+		static HALF_CONSTEXPR_CONST bool has_denorm_loss = false;
+
+	#if HALF_ERRHANDLING_THROWS
+		static HALF_CONSTEXPR_CONST bool traps = true;
+	#else
+		/// Traps only if [HALF_ERRHANDLING_THROW_...](\ref HALF_ERRHANDLING_THROW_INVALID) is acitvated.
+		static HALF_CONSTEXPR_CONST bool traps = false;
+	#endif
+
+		/// Does not support no pre-rounding underflow detection.
+		static HALF_CONSTEXPR_CONST bool tinyness_before = false;
+
+		/// Rounding mode.
+		static HALF_CONSTEXPR_CONST float_round_style round_style = half_float::half::round_style;
+
+		/// Significant digits.
+		static HALF_CONSTEXPR_CONST int digits = 11;
+
+		/// Significant decimal digits.
+		static HALF_CONSTEXPR_CONST int digits10 = 3;
+
+		/// Required decimal digits to represent all possible values.
+		static HALF_CONSTEXPR_CONST int max_digits10 = 5;
+
+		/// Number base.
+		static HALF_CONSTEXPR_CONST int radix = 2;
+
+		/// One more than smallest exponent.
+		static HALF_CONSTEXPR_CONST int min_exponent = -13;
+
+		/// Smallest normalized representable power of 10.
+		static HALF_CONSTEXPR_CONST int min_exponent10 = -4;
+
+		/// One more than largest exponent
+		static HALF_CONSTEXPR_CONST int max_exponent = 16;
+
+		/// Largest finitely representable power of 10.
+		static HALF_CONSTEXPR_CONST int max_exponent10 = 4;
+
+		/// Smallest positive normal value.
+		static HALF_CONSTEXPR half_float::half min() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x0400); }
+
+		/// Smallest finite value.
+		static HALF_CONSTEXPR half_float::half lowest() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0xFBFF); }
+
+		/// Largest finite value.
+		static HALF_CONSTEXPR half_float::half max() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x7BFF); }
+
+		/// Difference between 1 and next representable value.
+		static HALF_CONSTEXPR half_float::half epsilon() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x1400); }
+
+		/// Maximum rounding error in ULP (units in the last place).
+		static HALF_CONSTEXPR half_float::half round_error() HALF_NOTHROW
+			{ return half_float::half(half_float::detail::binary, (round_style==std::round_to_nearest) ? 0x3800 : 0x3C00); }
+
+		/// Positive infinity.
+		static HALF_CONSTEXPR half_float::half infinity() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x7C00); }
+
+		/// Quiet NaN.
+		static HALF_CONSTEXPR half_float::half quiet_NaN() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x7FFF); }
+
+		/// Signaling NaN.
+		static HALF_CONSTEXPR half_float::half signaling_NaN() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x7DFF); }
+
+		/// Smallest positive subnormal value.
+		static HALF_CONSTEXPR half_float::half denorm_min() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x0001); }
+	};
+
+#if HALF_ENABLE_CPP11_HASH
+	/// Hash function for half-precision floats.
+	/// This is only defined if C++11 `std::hash` is supported and enabled.
+	///
+	/// **See also:** Documentation for [std::hash](https://en.cppreference.com/w/cpp/utility/hash)
+	template<> struct hash<half_float::half>
+	{
+		/// Type of function argument.
+		typedef half_float::half argument_type;
+
+		/// Function return type.
+		typedef size_t result_type;
+
+		/// Compute hash function.
+		/// \param arg half to hash
+		/// \return hash value
+		result_type operator()(argument_type arg) const { return hash<half_float::detail::uint16>()(arg.data_&-static_cast<unsigned>(arg.data_!=0x8000)); }
+	};
+#endif
+}
+
+namespace half_float
+{
+	/// \anchor compop
+	/// \name Comparison operators
+	/// \{
+
+	/// Comparison for equality.
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if operands equal
+	/// \retval false else
+	/// \exception FE_INVALID if \a x or \a y is NaN
+	inline HALF_CONSTEXPR_NOERR bool operator==(half x, half y)
+	{
+		return !detail::compsignal(x.data_, y.data_) && (x.data_==y.data_ || !((x.data_|y.data_)&0x7FFF));
+	}
+
+	/// Comparison for inequality.
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if operands not equal
+	/// \retval false else
+	/// \exception FE_INVALID if \a x or \a y is NaN
+	inline HALF_CONSTEXPR_NOERR bool operator!=(half x, half y)
+	{
+		return detail::compsignal(x.data_, y.data_) || (x.data_!=y.data_ && ((x.data_|y.data_)&0x7FFF));
+	}
+
+	/// Comparison for less than.
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if \a x less than \a y
+	/// \retval false else
+	/// \exception FE_INVALID if \a x or \a y is NaN
+	inline HALF_CONSTEXPR_NOERR bool operator<(half x, half y)
+	{
+		return !detail::compsignal(x.data_, y.data_) &&
+			((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) < ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15));
+	}
+
+	/// Comparison for greater than.
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if \a x greater than \a y
+	/// \retval false else
+	/// \exception FE_INVALID if \a x or \a y is NaN
+	inline HALF_CONSTEXPR_NOERR bool operator>(half x, half y)
+	{
+		return !detail::compsignal(x.data_, y.data_) &&
+			((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) > ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15));
+	}
+
+	/// Comparison for less equal.
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if \a x less equal \a y
+	/// \retval false else
+	/// \exception FE_INVALID if \a x or \a y is NaN
+	inline HALF_CONSTEXPR_NOERR bool operator<=(half x, half y)
+	{
+		return !detail::compsignal(x.data_, y.data_) &&
+			((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) <= ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15));
+	}
+
+	/// Comparison for greater equal.
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if \a x greater equal \a y
+	/// \retval false else
+	/// \exception FE_INVALID if \a x or \a y is NaN
+	inline HALF_CONSTEXPR_NOERR bool operator>=(half x, half y)
+	{
+		return !detail::compsignal(x.data_, y.data_) &&
+			((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) >= ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15));
+	}
+
+	/// \}
+	/// \anchor arithmetics
+	/// \name Arithmetic operators
+	/// \{
+
+	/// Identity.
+	/// \param arg operand
+	/// \return unchanged operand
+	inline HALF_CONSTEXPR half operator+(half arg) { return arg; }
+
+	/// Negation.
+	/// \param arg operand
+	/// \return negated operand
+	inline HALF_CONSTEXPR half operator-(half arg) { return half(detail::binary, arg.data_^0x8000); }
+
+	/// Addition with given rounding mode.
+	/// This operation is exact to rounding for all rounding modes.
+	/// \tparam R rounding mode to use
+	/// \param x left operand
+	/// \param y right operand
+	/// \return sum of \a x and \a y
+	/// \exception FE_INVALID if \a x and \a y are infinities with different signs or signaling NaNs
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half add(half x, half y) { return half(detail::binary, detail::add<R>(x.data_, y.data_)); }
+
+	/// Addition.
+	/// This operation is exact to rounding for all rounding modes.
+	/// \param x left operand
+	/// \param y right operand
+	/// \return sum of half expressions
+	/// \exception FE_INVALID if \a x and \a y are infinities with different signs or signaling NaNs
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half operator+(half x, half y) { return add<half::round_style>(x, y); }
+
+	/// Subtraction with given rounding mode.
+	/// This operation is exact to rounding for all rounding modes.
+	/// \tparam R rounding mode to use
+	/// \param x left operand
+	/// \param y right operand
+	/// \return difference of \a x and \a y
+	/// \exception FE_INVALID if \a x and \a y are infinities with equal signs or signaling NaNs
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half sub(half x, half y) { return half(detail::binary, detail::sub<R>(x.data_, y.data_)); }
+
+	/// Subtraction.
+	/// This operation is exact to rounding for all rounding modes.
+	/// \param x left operand
+	/// \param y right operand
+	/// \return difference of half expressions
+	/// \exception FE_INVALID if \a x and \a y are infinities with equal signs or signaling NaNs
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half operator-(half x, half y) { return sub<half::round_style>(x, y); }
+
+	/// Multiplication with given rounding mode.
+	/// This operation is exact to rounding for all rounding modes.
+	/// \tparam R rounding mode to use
+	/// \param x left operand
+	/// \param y right operand
+	/// \return product of \a x and \a y
+	/// \exception FE_INVALID if multiplying 0 with infinity or if \a x or \a y is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half mul(half x, half y) { return half(detail::binary, detail::mul<R>(x.data_, y.data_)); }
+
+	/// Multiplication.
+	/// This operation is exact to rounding for all rounding modes.
+	/// \param x left operand
+	/// \param y right operand
+	/// \return product of half expressions
+	/// \exception FE_INVALID if multiplying 0 with infinity or if \a x or \a y is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half operator*(half x, half y) { return mul<half::round_style>(x, y); }
+
+	/// Division with given rounding mode.
+	/// This operation is exact to rounding for all rounding modes.
+	/// \tparam R rounding mode to use
+	/// \param x left operand
+	/// \param y right operand
+	/// \return quotient of \a x and \a y
+	/// \exception FE_INVALID if dividing 0s or infinities with each other or if \a x or \a y is signaling NaN
+	/// \exception FE_DIVBYZERO if dividing finite value by 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half div(half x, half y) { return half(detail::binary, detail::div<R>(x.data_, y.data_)); }
+
+	/// Division.
+	/// This operation is exact to rounding for all rounding modes.
+	/// \param x left operand
+	/// \param y right operand
+	/// \return quotient of half expressions
+	/// \exception FE_INVALID if dividing 0s or infinities with each other or if \a x or \a y is signaling NaN
+	/// \exception FE_DIVBYZERO if dividing finite value by 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half operator/(half x, half y) { return div<half::round_style>(x, y); }
+
+	/// \}
+	/// \anchor streaming
+	/// \name Input and output
+	/// \{
+
+	/// Output operator.
+	///	This uses the built-in functionality for streaming out floating-point numbers.
+	/// \param out output stream to write into
+	/// \param arg half expression to write
+	/// \return reference to output stream
+	template<typename charT,typename traits> std::basic_ostream<charT,traits>& operator<<(std::basic_ostream<charT,traits> &out, half arg)
+	{
+	#ifdef HALF_ARITHMETIC_TYPE
+		return out << detail::half2float<detail::internal_t>(arg.data_);
+	#else
+		return out << detail::half2float<float>(arg.data_);
+	#endif
+	}
+
+	/// Input operator.
+	///	This uses the built-in functionality for streaming in floating-point numbers, specifically double precision floating 
+	/// point numbers (unless overridden with [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE)). So the input string is first 
+	/// rounded to double precision using the underlying platform's current floating-point rounding mode before being rounded 
+	/// to half-precision using the library's half-precision rounding mode.
+	/// \param in input stream to read from
+	/// \param arg half to read into
+	/// \return reference to input stream
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<typename charT,typename traits> std::basic_istream<charT,traits>& operator>>(std::basic_istream<charT,traits> &in, half &arg)
+	{
+	#ifdef HALF_ARITHMETIC_TYPE
+		detail::internal_t f;
+	#else
+		double f;
+	#endif
+		if(in >> f)
+			arg.data_ = detail::float2half<half::round_style>(f);
+		return in;
+	}
+
+	/// \}
+	/// \anchor basic
+	/// \name Basic mathematical operations
+	/// \{
+
+	/// Absolute value.
+	/// **See also:** Documentation for [std::fabs](https://en.cppreference.com/w/cpp/numeric/math/fabs).
+	/// \param arg operand
+	/// \return absolute value of \a arg
+	inline HALF_CONSTEXPR half fabs(half arg) { return half(detail::binary, arg.data_&0x7FFF); }
+
+	/// Absolute value.
+	/// **See also:** Documentation for [std::abs](https://en.cppreference.com/w/cpp/numeric/math/fabs).
+	/// \param arg operand
+	/// \return absolute value of \a arg
+	inline HALF_CONSTEXPR half abs(half arg) { return fabs(arg); }
+
+	/// Remainder of division.
+	/// **See also:** Documentation for [std::fmod](https://en.cppreference.com/w/cpp/numeric/math/fmod).
+	/// \param x first operand
+	/// \param y second operand
+	/// \return remainder of floating-point division.
+	/// \exception FE_INVALID if \a x is infinite or \a y is 0 or if \a x or \a y is signaling NaN
+	inline half fmod(half x, half y)
+	{
+		x.data_ = detail::flush_arg(x.data_), y.data_ = detail::flush_arg(y.data_);
+		unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, sign = x.data_ & 0x8000;
+		if(absx >= 0x7C00 || absy >= 0x7C00)
+			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
+										(absx==0x7C00) ? detail::invalid() : x.data_);
+		if(!absy)
+			return half(detail::binary, detail::invalid());
+		if(!absx)
+			return x;
+		if(absx == absy)
+			return half(detail::binary, detail::flush_result(sign));
+		return half(detail::binary, detail::flush_result(sign|detail::mod<false,false>(absx, absy)));
+	}
+
+	/// Remainder of division.
+	/// **See also:** Documentation for [std::remainder](https://en.cppreference.com/w/cpp/numeric/math/remainder).
+	/// \param x first operand
+	/// \param y second operand
+	/// \return remainder of floating-point division.
+	/// \exception FE_INVALID if \a x is infinite or \a y is 0 or if \a x or \a y is signaling NaN
+	inline half remainder(half x, half y)
+	{
+		x.data_ = detail::flush_arg(x.data_), y.data_ = detail::flush_arg(y.data_);
+		unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, sign = x.data_ & 0x8000;
+		if(absx >= 0x7C00 || absy >= 0x7C00)
+			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
+										(absx==0x7C00) ? detail::invalid() : x.data_);
+		if(!absy)
+			return half(detail::binary, detail::invalid());
+		if(absx == absy)
+			return half(detail::binary, detail::flush_result(sign));
+		return half(detail::binary, detail::flush_result(sign^detail::mod<false,true>(absx, absy)));
+	}
+
+	/// Remainder of division.
+	/// **See also:** Documentation for [std::remquo](https://en.cppreference.com/w/cpp/numeric/math/remquo).
+	/// \param x first operand
+	/// \param y second operand
+	/// \param quo address to store some bits of quotient at
+	/// \return remainder of floating-point division.
+	/// \exception FE_INVALID if \a x is infinite or \a y is 0 or if \a x or \a y is signaling NaN
+	inline half remquo(half x, half y, int *quo)
+	{
+		x.data_ = detail::flush_arg(x.data_), y.data_ = detail::flush_arg(y.data_);
+		unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, value = x.data_ & 0x8000;
+		if(absx >= 0x7C00 || absy >= 0x7C00)
+			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
+										(absx==0x7C00) ? detail::invalid() : (*quo = 0, x.data_));
+		if(!absy)
+			return half(detail::binary, detail::invalid());
+		bool qsign = ((value^y.data_)&0x8000) != 0;
+		int q = 1;
+		if(absx != absy)
+			value ^= detail::mod<true, true>(absx, absy, &q);
+		return *quo = qsign ? -q : q, half(detail::binary, detail::flush_result(value));
+	}
+
+	/// Fused multiply add.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::fma](https://en.cppreference.com/w/cpp/numeric/math/fma).
+	/// \tparam R rounding mode to use
+	/// \param x first operand
+	/// \param y second operand
+	/// \param z third operand
+	/// \return ( \a x * \a y ) + \a z rounded as one operation.
+	/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+	template<std::float_round_style R> half fma(half x, half y, half z)
+	{
+		return half(detail::binary, detail::fma<R>(x.data_, y.data_, z.data_));
+	}
+
+	/// Fused multiply add.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like fma<R>().
+	/// \param x first operand
+	/// \param y second operand
+	/// \param z third operand
+	/// \return ( \a x * \a y ) + \a z rounded as one operation.
+	inline half fma(half x, half y, half z) { return fma<half::round_style>(x, y, z); }
+
+	/// Maximum of half expressions.
+	/// **See also:** Documentation for [std::fmax](https://en.cppreference.com/w/cpp/numeric/math/fmax).
+	/// \param x first operand
+	/// \param y second operand
+	/// \return maximum of operands, ignoring quiet NaNs
+	/// \exception FE_INVALID if \a x or \a y is signaling NaN
+	inline HALF_CONSTEXPR_NOERR half fmax(half x, half y) { return half(detail::binary, detail::fmax(x.data_, y.data_)); }
+
+	/// Minimum of half expressions.
+	/// **See also:** Documentation for [std::fmin](https://en.cppreference.com/w/cpp/numeric/math/fmin).
+	/// \param x first operand
+	/// \param y second operand
+	/// \return minimum of operands, ignoring quiet NaNs
+	/// \exception FE_INVALID if \a x or \a y is signaling NaN
+	inline HALF_CONSTEXPR_NOERR half fmin(half x, half y) { return half(detail::binary, detail::fmin(x.data_, y.data_)); }
+
+	/// Positive difference.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::fdim](https://en.cppreference.com/w/cpp/numeric/math/fdim).
+	/// \tparam R rounding mode to use
+	/// \param x first operand
+	/// \param y second operand
+	/// \return \a x - \a y or 0 if difference negative
+	/// \exception FE_... according to operator-(half,half)
+	template<std::float_round_style R> half fdim(half x, half y)
+	{
+		x.data_ = detail::flush_arg(x.data_), y.data_ = detail::flush_arg(y.data_);
+		if(isnan(x) || isnan(y))
+			return half(detail::binary, detail::signal(x.data_, y.data_));
+		return (x.data_^(0x8000|(0x8000-(x.data_>>15)))) <= (y.data_^(0x8000|(0x8000-(y.data_>>15)))) ? half(detail::binary, 0) : sub<R>(x, y);
+	}
+
+	/// Positive difference.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like fdim<R>().
+	/// \param x first operand
+	/// \param y second operand
+	/// \return \a x - \a y or 0 if difference negative
+	inline half fdim(half x, half y) { return fdim<half::round_style>(x, y); }
+
+	/// Get NaN value.
+	/// **See also:** Documentation for [std::nan](https://en.cppreference.com/w/cpp/numeric/math/nan).
+	/// \param arg string code
+	/// \return quiet NaN
+	inline half nanh(const char *arg)
+	{
+		unsigned int value = 0x7FFF;
+		while(*arg)
+			value ^= static_cast<unsigned>(*arg++) & 0xFF;
+		return half(detail::binary, value);
+	}
+
+	/// \}
+	/// \anchor exponential
+	/// \name Exponential functions
+	/// \{
+
+	/// Exponential function.
+	/// This function is exact to rounding for all rounding modes. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled 
+	/// the results are looked up instead.
+	///
+	/// **See also:** Documentation for [std::exp](https://en.cppreference.com/w/cpp/numeric/math/exp).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return e raised to \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half exp(half arg)
+	{
+		return half(detail::binary, detail::tabulated<R,&detail::exp_impl<R> >(arg.data_));
+	}
+
+	/// Exponential function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like exp<R>().
+	/// \param arg function argument
+	/// \return e raised to \a arg
+	inline half exp(half arg) { return exp<half::round_style>(arg); }
+
+	/// Binary exponential.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::exp2](https://en.cppreference.com/w/cpp/numeric/math/exp2).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return 2 raised to \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half exp2(half arg)
+	{
+		return half(detail::binary, detail::exp2_impl<R>(arg.data_));
+	}
+
+	/// Binary exponential.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like exp2<R>().
+	/// \param arg function argument
+	/// \return 2 raised to \a arg
+	inline half exp2(half arg) { return exp2<half::round_style>(arg); }
+
+	/// Exponential minus one.
+	/// This function may be 1 ULP off the correctly rounded exact result in <0.05% of inputs for `std::round_to_nearest` 
+	/// and in <1% of inputs for any other rounding mode.
+	///
+	/// **See also:** Documentation for [std::expm1](https://en.cppreference.com/w/cpp/numeric/math/expm1).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return e raised to \a arg and subtracted by 1
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half expm1(half arg)
+	{
+		return half(detail::binary, detail::expm1_impl<R>(arg.data_));
+	}
+
+	/// Exponential minus one.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like expm1<R>().
+	/// \param arg function argument
+	/// \return e raised to \a arg and subtracted by 1
+	inline half expm1(half arg) { return expm1<half::round_style>(arg); }
+
+	/// Natural logarithm.
+	/// This function is exact to rounding for all rounding modes. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled 
+	/// the results are looked up instead.
+	///
+	/// **See also:** Documentation for [std::log](https://en.cppreference.com/w/cpp/numeric/math/log).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base e
+	/// \exception FE_INVALID for signaling NaN or negative argument
+	/// \exception FE_DIVBYZERO for 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half log(half arg)
+	{
+		return half(detail::binary, detail::tabulated<R,&detail::log_impl<R> >(arg.data_));
+	}
+
+	/// Natural logarithm.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like log<R>().
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base e
+	inline half log(half arg) { return log<half::round_style>(arg); }
+
+	/// Common logarithm.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::log10](https://en.cppreference.com/w/cpp/numeric/math/log10).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base 10
+	/// \exception FE_INVALID for signaling NaN or negative argument
+	/// \exception FE_DIVBYZERO for 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half log10(half arg)
+	{
+		return half(detail::binary, detail::log10_impl<R>(arg.data_));
+	}
+
+	/// Common logarithm.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like log10<R>().
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base 10
+	inline half log10(half arg) { return log10<half::round_style>(arg); }
+
+	/// Binary logarithm.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::log2](https://en.cppreference.com/w/cpp/numeric/math/log2).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base 2
+	/// \exception FE_INVALID for signaling NaN or negative argument
+	/// \exception FE_DIVBYZERO for 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half log2(half arg)
+	{
+		return half(detail::binary, detail::log2_impl<R>(arg.data_));
+	}
+
+	/// Binary logarithm.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like log2<R>().
+	/// \param arg function argument
+	/// \return logarithm of \a arg to base 2
+	inline half log2(half arg) { return log2<half::round_style>(arg); }
+
+	/// Natural logarithm plus one.
+	/// This function may be 1 ULP off the correctly rounded exact result in <0.05% of inputs for `std::round_to_nearest` 
+	/// and in ~1% of inputs for any other rounding mode.
+	///
+	/// **See also:** Documentation for [std::log1p](https://en.cppreference.com/w/cpp/numeric/math/log1p).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return logarithm of \a arg plus 1 to base e
+	/// \exception FE_INVALID for signaling NaN or argument <-1
+	/// \exception FE_DIVBYZERO for -1
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half log1p(half arg)
+	{
+		return half(detail::binary, detail::log1p_impl<R>(arg.data_));
+	}
+
+	/// Natural logarithm plus one.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like log1p<R>().
+	/// \param arg function argument
+	/// \return logarithm of \a arg plus 1 to base e
+	inline half log1p(half arg) { return log1p<half::round_style>(arg); }
+
+	/// \}
+	/// \anchor power
+	/// \name Power functions
+	/// \{
+
+	/// Square root.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::sqrt](https://en.cppreference.com/w/cpp/numeric/math/sqrt).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return square root of \a arg
+	/// \exception FE_INVALID for signaling NaN and negative arguments
+	/// \exception FE_INEXACT according to rounding
+	template<std::float_round_style R> half sqrt(half arg) { return half(detail::binary, detail::sqrt<R>(arg.data_)); }
+
+	/// Square root.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like sqrt<R>().
+	/// \param arg function argument
+	/// \return square root of \a arg
+	inline half sqrt(half arg) { return sqrt<half::round_style>(arg); }
+
+	/// Inverse square root.
+	/// This function is exact to rounding for all rounding modes and thus generally more accurate than directly computing 
+	/// 1 / sqrt(\a arg) in half-precision, in addition to also being faster.
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return reciprocal of square root of \a arg
+	/// \exception FE_INVALID for signaling NaN and negative arguments
+	/// \exception FE_INEXACT according to rounding
+	template<std::float_round_style R> half rsqrt(half arg)
+	{
+		arg.data_ = detail::flush_arg(arg.data_);
+	#ifdef HALF_ARITHMETIC_TYPE
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(detail::internal_t(1)/std::sqrt(detail::half2float<detail::internal_t>(arg.data_)))));
+	#else
+		unsigned int abs = arg.data_ & 0x7FFF, bias = 0x4000;
+		if(!abs || arg.data_ >= 0x7C00)
+			return half(detail::binary,	(abs>0x7C00) ? detail::signal(arg.data_) : (arg.data_>0x8000) ?
+										detail::invalid() : !abs ? detail::pole(arg.data_&0x8000) : 0);
+	#if !HALF_FLUSH_DENORMALS
+		bias -= detail::normalize<10>(abs) << 10;
+	#endif
+		unsigned int frac = (abs+=bias) & 0x7FF;
+		if(frac == 0x400)
+			return half(detail::binary, detail::flush_result(0x7A00-(abs>>1)));
+		if((R == std::round_to_nearest && (frac == 0x3FE || frac == 0x76C)) ||
+		   (R != std::round_to_nearest && (frac == 0x15A || frac == 0x3FC || frac == 0x401 || frac == 0x402 || frac == 0x67B)))
+			return pow<R>(arg, half(detail::binary, 0xB800));
+		detail::uint32 f = 0x17376 - abs, mx = (abs&0x3FF) | 0x400, my = ((f>>1)&0x3FF) | 0x400, mz = my * my;
+		int expy = (f>>11) - 31, expx = 32 - (abs>>10), i = mz >> 21;
+		mz = 0x60000000 - (((mz>>i)*mx)>>(expx-2*expy-i));
+		expy -= detail::normalize<30>(mz);
+		i = (my*=mz>>10) >> 31;
+		expy += i;
+		my = (my>>(20+i)) + 1;
+		i = (mz=my*my) >> 21;
+		mz = 0x60000000 - (((mz>>i)*mx)>>(expx-2*expy-i));
+		expy -= detail::normalize<30>(mz);
+		i = (my*=(mz>>10)+1) >> 31;
+		return half(detail::binary, detail::flush_result(detail::fixed2half<R,30,false,false,true>(my>>i, expy+i+14)));
+	#endif
+	}
+
+	/// Inverse square root.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like rsqrt<R>().
+	/// \param arg function argument
+	/// \return reciprocal of square root of \a arg
+	inline half rsqrt(half arg) { return rsqrt<half::round_style>(arg); }
+
+	/// Cubic root.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::cbrt](https://en.cppreference.com/w/cpp/numeric/math/cbrt).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return cubic root of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_INEXACT according to rounding
+	template<std::float_round_style R> half cbrt(half arg)
+	{
+		return half(detail::binary, detail::cbrt_impl<R>(arg.data_));
+	}
+
+	/// Cubic root.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like cbrt<R>().
+	/// \param arg function argument
+	/// \return cubic root of \a arg
+	inline half cbrt(half arg) { return cbrt<half::round_style>(arg); }
+
+	/// Hypotenuse function.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::hypot](https://en.cppreference.com/w/cpp/numeric/math/hypot).
+	/// \tparam R rounding mode to use
+	/// \param x first argument
+	/// \param y second argument
+	/// \return square root of sum of squares without internal over- or underflows
+	/// \exception FE_INVALID if \a x or \a y is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of the final square root
+	template<std::float_round_style R> half hypot(half x, half y)
+	{
+		x.data_ = detail::flush_arg(x.data_), y.data_ = detail::flush_arg(y.data_);
+	#ifdef HALF_ARITHMETIC_TYPE
+		detail::internal_t fx = detail::half2float<detail::internal_t>(x.data_), fy = detail::half2float<detail::internal_t>(y.data_);
+		#if HALF_ENABLE_CPP11_CMATH
+			return half(detail::binary, detail::flush_result(detail::float2half<R>(std::hypot(fx, fy))));
+		#else
+			return half(detail::binary, detail::flush_result(detail::float2half<R>(std::sqrt(fx*fx+fy*fy))));
+		#endif
+	#else
+		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, expx = 0, expy = 0;
+		if(absx >= 0x7C00 || absy >= 0x7C00)
+			return half(detail::binary,	(absx==0x7C00) ? detail::select(0x7C00, y.data_) :
+				(absy==0x7C00) ? detail::select(0x7C00, x.data_) : detail::signal(x.data_, y.data_));
+		if(!absx)
+			return half(detail::binary, detail::flush_result(absy ? detail::check_underflow(absy) : 0));
+		if(!absy)
+			return half(detail::binary, detail::flush_result(detail::check_underflow(absx)));
+		if(absy > absx)
+			std::swap(absx, absy);
+	#if !HALF_FLUSH_DENORMALS
+		expx -= detail::normalize<10>(absx);
+		expy -= detail::normalize<10>(absy);
+	#endif
+		detail::uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
+		mx *= mx;
+		my *= my;
+		int ix = mx >> 21, iy = my >> 21;
+		expx = 2*(expx+(absx>>10)) - 15 + ix;
+		expy = 2*(expy+(absy>>10)) - 15 + iy;
+		mx <<= 10 - ix;
+		my <<= 10 - iy;
+		int d = expx - expy;
+		my = (d<30) ? ((my>>d)|((my&((static_cast<detail::uint32>(1)<<d)-1))!=0)) : 1;
+		return half(detail::binary, detail::flush_result(detail::hypot_post<R>(mx+my, expx)));
+	#endif
+	}
+
+	/// Hypotenuse function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like hypot<R>().
+	/// \param x first argument
+	/// \param y second argument
+	/// \return square root of sum of squares without internal over- or underflows
+	inline half hypot(half x, half y) { return hypot<half::round_style>(x, y); }
+
+	/// Hypotenuse function.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::hypot](https://en.cppreference.com/w/cpp/numeric/math/hypot).
+	/// \tparam R rounding mode to use
+	/// \param x first argument
+	/// \param y second argument
+	/// \param z third argument
+	/// \return square root of sum of squares without internal over- or underflows
+	/// \exception FE_INVALID if \a x, \a y or \a z is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of the final square root
+	template<std::float_round_style R> half hypot(half x, half y, half z)
+	{
+		x.data_ = detail::flush_arg(x.data_), y.data_ = detail::flush_arg(y.data_), z.data_ = detail::flush_arg(z.data_);
+	#ifdef HALF_ARITHMETIC_TYPE
+		detail::internal_t fx = detail::half2float<detail::internal_t>(x.data_), fy = detail::half2float<detail::internal_t>(y.data_), fz = detail::half2float<detail::internal_t>(z.data_);
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(std::sqrt(fx*fx+fy*fy+fz*fz))));
+	#else
+		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, absz = z.data_ & 0x7FFF, expx = 0, expy = 0, expz = 0;
+		if(!absx)
+			return hypot<R>(y, z);
+		if(!absy)
+			return hypot<R>(x, z);
+		if(!absz)
+			return hypot<R>(x, y);
+		if(absx >= 0x7C00 || absy >= 0x7C00 || absz >= 0x7C00)
+			return half(detail::binary,	(absx==0x7C00) ? detail::select(0x7C00, detail::select(y.data_, z.data_)) :
+										(absy==0x7C00) ? detail::select(0x7C00, detail::select(x.data_, z.data_)) :
+										(absz==0x7C00) ? detail::select(0x7C00, detail::select(x.data_, y.data_)) :
+										detail::signal(x.data_, y.data_, z.data_));
+		if(absz > absy)
+			std::swap(absy, absz);
+		if(absy > absx)
+			std::swap(absx, absy);
+		if(absz > absy)
+			std::swap(absy, absz);
+	#if !HALF_FLUSH_DENORMALS
+		expx -= detail::normalize<10>(absx);
+		expy -= detail::normalize<10>(absy);
+		expz -= detail::normalize<10>(absz);
+	#endif
+		detail::uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400, mz = (absz&0x3FF) | 0x400;
+		mx *= mx;
+		my *= my;
+		mz *= mz;
+		int ix = mx >> 21, iy = my >> 21, iz = mz >> 21;
+		expx = 2*(expx+(absx>>10)) - 15 + ix;
+		expy = 2*(expy+(absy>>10)) - 15 + iy;
+		expz = 2*(expz+(absz>>10)) - 15 + iz;
+		mx <<= 10 - ix;
+		my <<= 10 - iy;
+		mz <<= 10 - iz;
+		int d = expy - expz;
+		mz = (d<30) ? ((mz>>d)|((mz&((static_cast<detail::uint32>(1)<<d)-1))!=0)) : 1;
+		my += mz;
+		if(my & 0x80000000)
+		{
+			my = (my>>1) | (my&1);
+			if(++expy > expx)
+			{
+				std::swap(mx, my);
+				std::swap(expx, expy);
+			}
+		}
+		d = expx - expy;
+		my = (d<30) ? ((my>>d)|((my&((static_cast<detail::uint32>(1)<<d)-1))!=0)) : 1;
+		return half(detail::binary, detail::flush_result(detail::hypot_post<R>(mx+my, expx)));
+	#endif
+	}
+
+	/// Hypotenuse function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like hypot<R>().
+	/// \param x first argument
+	/// \param y second argument
+	/// \param z third argument
+	/// \return square root of sum of squares without internal over- or underflows
+	inline half hypot(half x, half y, half z) { return hypot<half::round_style>(x, y, z); }
+
+	/// Power function.
+	/// This function may be 1 ULP off the correctly rounded exact result for any rounding mode in ~0.00025% of inputs.
+	///
+	/// **See also:** Documentation for [std::pow](https://en.cppreference.com/w/cpp/numeric/math/pow).
+	/// \tparam R rounding mode to use
+	/// \param x base
+	/// \param y exponent
+	/// \return \a x raised to \a y
+	/// \exception FE_INVALID if \a x or \a y is signaling NaN or if \a x is finite an negative and \a y is finite and not integral
+	/// \exception FE_DIVBYZERO if \a x is 0 and \a y is negative
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half pow(half x, half y)
+	{
+		x.data_ = detail::flush_arg(x.data_), y.data_ = detail::flush_arg(y.data_);
+	#ifdef HALF_ARITHMETIC_TYPE
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(std::pow(detail::half2float<detail::internal_t>(x.data_), detail::half2float<detail::internal_t>(y.data_)))));
+	#else
+		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, exp = -15;
+		if(!absy || x.data_ == 0x3C00)
+			return half(detail::binary, detail::flush_result(detail::select(0x3C00, (x.data_==0x3C00) ? y.data_ : x.data_)));
+		bool is_int = absy >= 0x6400 || (absy>=0x3C00 && !(absy&((1<<(25-(absy>>10)))-1)));
+		unsigned int sign = x.data_ & (static_cast<unsigned>((absy<0x6800)&&is_int&&((absy>>(25-(absy>>10)))&1))<<15);
+		if(absx >= 0x7C00 || absy >= 0x7C00)
+			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
+										(absy==0x7C00) ? ((absx==0x3C00) ? 0x3C00 : (!absx && y.data_==0xFC00) ? detail::pole() :
+										(0x7C00&-((y.data_>>15)^(absx>0x3C00)))) : (sign|(0x7C00&((y.data_>>15)-1U))));
+		if(!absx)
+			return half(detail::binary, detail::flush_result((y.data_&0x8000) ? detail::pole(sign) : sign));
+		if((x.data_&0x8000) && !is_int)
+			return half(detail::binary, detail::invalid());
+		if(x.data_ == 0xBC00)
+			return half(detail::binary, detail::flush_result(sign|0x3C00));
+		switch(y.data_)
+		{
+			case 0x3800: return sqrt<R>(x);
+			case 0x3C00: return half(detail::binary, detail::flush_result(detail::check_underflow(x.data_)));
+			case 0x4000: return mul<R>(x, x);
+			case 0xBC00: return div<R>(half(detail::binary, 0x3C00), x);
+		}
+	#if !HALF_FLUSH_DENORMALS
+		exp -= detail::normalize<10>(absx);
+	#endif
+		detail::uint32 ilog = exp + (absx>>10), msign = detail::sign_mask(ilog), f, m = 
+			(((ilog<<27)+((detail::log2(static_cast<detail::uint32>((absx&0x3FF)|0x400)<<20)+8)>>4))^msign) - msign;
+		exp = -11 - detail::normalize<31>(m);
+	#if !HALF_FLUSH_DENORMALS
+		exp -= detail::normalize<10>(absy);
+	#endif
+		m = detail::multiply64(m, static_cast<detail::uint32>((absy&0x3FF)|0x400)<<21);
+		int i = m >> 31;
+		exp += (absy>>10) + i;
+		m <<= 1 - i;
+		if(exp < 0)
+		{
+			f = m >> -exp;
+			exp = 0;
+		}
+		else
+		{
+			f = (m<<exp) & 0x7FFFFFFF;
+			exp = m >> (31-exp);
+		}
+		return half(detail::binary, detail::flush_result(detail::exp2_post<R>(f, exp, ((msign&1)^(y.data_>>15))!=0, sign)));
+	#endif
+	}
+
+	/// Power function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like pow<R>().
+	/// \param x base
+	/// \param y exponent
+	/// \return \a x raised to \a y
+	inline half pow(half x, half y) { return pow<half::round_style>(x, y); }
+
+	/// \}
+	/// \anchor trigonometric
+	/// \name Trigonometric functions
+	/// \{
+
+	/// Compute sine and cosine simultaneously.
+	///	This returns the same results as sin() and cos() but is faster than calling each function individually.
+	///
+	/// This function is exact to rounding for all rounding modes.
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \param sin variable to take sine of \a arg
+	/// \param cos variable to take cosine of \a arg
+	/// \exception FE_INVALID for signaling NaN or infinity
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> void sincos(half arg, half *sin, half *cos)
+	{
+		arg.data_ = detail::flush_arg(arg.data_);
+	#ifdef HALF_ARITHMETIC_TYPE
+		detail::internal_t f = detail::half2float<detail::internal_t>(arg.data_);
+		*sin = half(detail::binary, detail::flush_result(detail::float2half<R>(std::sin(f))));
+		*cos = half(detail::binary, detail::flush_result(detail::float2half<R>(std::cos(f))));
+	#else
+		int abs = arg.data_ & 0x7FFF, sign = arg.data_ >> 15, k;
+		if(abs >= 0x7C00)
+			*sin = *cos = half(detail::binary, detail::flush_result((abs==0x7C00) ? detail::invalid() : detail::signal(arg.data_)));
+		else if(!abs)
+		{
+			*sin = arg;
+			*cos = half(detail::binary, 0x3C00);
+		}
+		else if(abs < 0x2500)
+		{
+			*sin = half(detail::binary, detail::flush_result(detail::rounded<R,true>(arg.data_-1, 1, 1)));
+			*cos = half(detail::binary, detail::flush_result(detail::rounded<R,true>(0x3BFF, 1, 1)));
+		}
+		else
+		{
+			if(R != std::round_to_nearest)
+			{
+				switch(abs)
+				{
+				case 0x48B7:
+					*sin = half(detail::binary, detail::flush_result(detail::rounded<R,true>((~arg.data_&0x8000)|0x1D07, 1, 1)));
+					*cos = half(detail::binary, detail::flush_result(detail::rounded<R,true>(0xBBFF, 1, 1)));
+					return;
+				case 0x598C:
+					*sin = half(detail::binary, detail::flush_result(detail::rounded<R,true>((arg.data_&0x8000)|0x3BFF, 1, 1)));
+					*cos = half(detail::binary, detail::flush_result(detail::rounded<R,true>(0x80FC, 1, 1)));
+					return;
+				case 0x5D8C:
+					*sin = half(detail::binary, detail::flush_result(detail::rounded<R,true>((~arg.data_&0x8000)|0x01F9, 1, 1)));
+					*cos = half(detail::binary, detail::flush_result(detail::rounded<R,true>(0xBBFF, 1, 1)));
+					return;
+				case 0x6A64:
+					*sin = half(detail::binary, detail::flush_result(detail::rounded<R,true>((~arg.data_&0x8000)|0x3BFE, 1, 1)));
+					*cos = half(detail::binary, detail::flush_result(detail::rounded<R,true>(0x27FF, 1, 1)));
+					return;
+				case 0x6D8C:
+					*sin = half(detail::binary, detail::flush_result(detail::rounded<R,true>((arg.data_&0x8000)|0x0FE6, 1, 1)));
+					*cos = half(detail::binary, detail::flush_result(detail::rounded<R,true>(0x3BFF, 1, 1)));
+					return;
+				}
+			}
+			std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k));
+			switch(k & 3)
+			{
+				case 1: sc = std::make_pair(sc.second, -sc.first); break;
+				case 2: sc = std::make_pair(-sc.first, -sc.second); break;
+				case 3: sc = std::make_pair(-sc.second, sc.first); break;
+			}
+			*sin = half(detail::binary, detail::flush_result(detail::fixed2half<R,30,true,true,true>((sc.first^-static_cast<detail::uint32>(sign))+sign)));
+			*cos = half(detail::binary, detail::flush_result(detail::fixed2half<R,30,true,true,true>(sc.second)));
+		}
+	#endif
+	}
+
+	/// Compute sine and cosine simultaneously.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like sincos<R>().
+	/// \param arg function argument
+	/// \param sin variable to take sine of \a arg
+	/// \param cos variable to take cosine of \a arg
+	inline void sincos(half arg, half *sin, half *cos) { sincos<half::round_style>(arg, sin, cos); }
 
-	#ifndef HALF_DOXYGEN_ONLY
-		friend HALF_CONSTEXPR_NOERR bool operator==(half, half);
-		friend HALF_CONSTEXPR_NOERR bool operator!=(half, half);
-		friend HALF_CONSTEXPR_NOERR bool operator<(half, half);
-		friend HALF_CONSTEXPR_NOERR bool operator>(half, half);
-		friend HALF_CONSTEXPR_NOERR bool operator<=(half, half);
-		friend HALF_CONSTEXPR_NOERR bool operator>=(half, half);
-		friend HALF_CONSTEXPR half operator-(half);
-		friend half operator+(half, half);
-		friend half operator-(half, half);
-		friend half operator*(half, half);
-		friend half operator/(half, half);
-		template<typename charT,typename traits> friend std::basic_ostream<charT,traits>& operator<<(std::basic_ostream<charT,traits>&, half);
-		template<typename charT,typename traits> friend std::basic_istream<charT,traits>& operator>>(std::basic_istream<charT,traits>&, half&);
-		friend HALF_CONSTEXPR half fabs(half);
-		friend half fmod(half, half);
-		friend half remainder(half, half);
-		friend half remquo(half, half, int*);
-		friend half fma(half, half, half);
-		friend HALF_CONSTEXPR_NOERR half fmax(half, half);
-		friend HALF_CONSTEXPR_NOERR half fmin(half, half);
-		friend half fdim(half, half);
-		friend half nanh(const char*);
-		friend half exp(half);
-		friend half exp2(half);
-		friend half expm1(half);
-		friend half log(half);
-		friend half log10(half);
-		friend half log2(half);
-		friend half log1p(half);
-		friend half sqrt(half);
-		friend half rsqrt(half);
-		friend half cbrt(half);
-		friend half hypot(half, half);
-		friend half hypot(half, half, half);
-		friend half pow(half, half);
-		friend void sincos(half, half*, half*);
-		friend half sin(half);
-		friend half cos(half);
-		friend half tan(half);
-		friend half asin(half);
-		friend half acos(half);
-		friend half atan(half);
-		friend half atan2(half, half);
-		friend half sinh(half);
-		friend half cosh(half);
-		friend half tanh(half);
-		friend half asinh(half);
-		friend half acosh(half);
-		friend half atanh(half);
-		friend half erf(half);
-		friend half erfc(half);
-		friend half lgamma(half);
-		friend half tgamma(half);
-		friend half ceil(half);
-		friend half floor(half);
-		friend half trunc(half);
-		friend half round(half);
-		friend long lround(half);
-		friend half rint(half);
-		friend long lrint(half);
-		friend half nearbyint(half);
-	#ifdef HALF_ENABLE_CPP11_LONG_LONG
-		friend long long llround(half);
-		friend long long llrint(half);
+	/// Sine function.
+	/// This function is exact to rounding for all rounding modes. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled 
+	/// the results are looked up instead.
+	///
+	/// **See also:** Documentation for [std::sin](https://en.cppreference.com/w/cpp/numeric/math/sin).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return sine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or infinity
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half sin(half arg)
+	{
+		return half(detail::binary, detail::tabulated<R,&detail::sin_impl<R> >(arg.data_));
+	}
+
+	/// Sine function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like sin<R>().
+	/// \param arg function argument
+	/// \return sine value of \a arg
+	inline half sin(half arg) { return sin<half::round_style>(arg); }
+
+	/// Cosine function.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::cos](https://en.cppreference.com/w/cpp/numeric/math/cos).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return cosine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or infinity
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half cos(half arg)
+	{
+		return half(detail::binary, detail::cos_impl<R>(arg.data_));
+	}
+
+	/// Cosine function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like cos<R>().
+	/// \param arg function argument
+	/// \return cosine value of \a arg
+	inline half cos(half arg) { return cos<half::round_style>(arg); }
+
+	/// Tangent function.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::tan](https://en.cppreference.com/w/cpp/numeric/math/tan).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return tangent value of \a arg
+	/// \exception FE_INVALID for signaling NaN or infinity
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half tan(half arg)
+	{
+		return half(detail::binary, detail::tan_impl<R>(arg.data_));
+	}
+
+	/// Tangent function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like tan<R>().
+	/// \param arg function argument
+	/// \return tangent value of \a arg
+	inline half tan(half arg) { return tan<half::round_style>(arg); }
+
+	/// Arc sine.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::asin](https://en.cppreference.com/w/cpp/numeric/math/asin).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return arc sine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half asin(half arg)
+	{
+		arg.data_ = detail::flush_arg(arg.data_);
+	#ifdef HALF_ARITHMETIC_TYPE
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(std::asin(detail::half2float<detail::internal_t>(arg.data_)))));
+	#else
+		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
+		if(!abs)
+			return arg;
+		if(abs >= 0x3C00)
+			return half(detail::binary, detail::flush_result((abs>0x7C00) ? detail::signal(arg.data_) : (abs>0x3C00) ? detail::invalid() :
+										detail::rounded<R,true>(sign|0x3E48, 0, 1)));
+		if(abs < 0x2900)
+			return half(detail::binary, detail::flush_result(detail::rounded<R,true>(arg.data_, 0, 1)));
+		if(R != std::round_to_nearest && (abs == 0x2B44 || abs == 0x2DC3))
+			return half(detail::binary, detail::flush_result(detail::rounded<R,true>(arg.data_+1, 1, 1)));
+		std::pair<detail::uint32,detail::uint32> sc = detail::atan2_args(abs);
+		detail::uint32 lo, m = detail::atan2(sc.first, sc.second, lo);
+		return half(detail::binary, detail::flush_result(detail::fixed2half<R,30,false,true,true>(m, 14, sign, lo!=0)));
 	#endif
-		friend half frexp(half, int*);
-		friend half scalbln(half, long);
-		friend half modf(half, half*);
-		friend int ilogb(half);
-		friend half logb(half);
-		friend half nextafter(half, half);
-		friend half nexttoward(half, long double);
-		friend HALF_CONSTEXPR half copysign(half, half);
-		friend HALF_CONSTEXPR int fpclassify(half);
-		friend HALF_CONSTEXPR bool isfinite(half);
-		friend HALF_CONSTEXPR bool isinf(half);
-		friend HALF_CONSTEXPR bool isnan(half);
-		friend HALF_CONSTEXPR bool isnormal(half);
-		friend HALF_CONSTEXPR bool signbit(half);
-		friend HALF_CONSTEXPR bool isgreater(half, half);
-		friend HALF_CONSTEXPR bool isgreaterequal(half, half);
-		friend HALF_CONSTEXPR bool isless(half, half);
-		friend HALF_CONSTEXPR bool islessequal(half, half);
-		friend HALF_CONSTEXPR bool islessgreater(half, half);
-		template<typename,typename,std::float_round_style> friend struct detail::half_caster;
-		friend class std::numeric_limits<half>;
-	#if HALF_ENABLE_CPP11_HASH
-		friend struct std::hash<half>;
+	}
+
+	/// Arc sine.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like asin<R>().
+	/// \param arg function argument
+	/// \return arc sine value of \a arg
+	inline half asin(half arg) { return asin<half::round_style>(arg); }
+
+	/// Arc cosine function.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::acos](https://en.cppreference.com/w/cpp/numeric/math/acos).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return arc cosine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half acos(half arg)
+	{
+		arg.data_ = detail::flush_arg(arg.data_);
+	#ifdef HALF_ARITHMETIC_TYPE
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(std::acos(detail::half2float<detail::internal_t>(arg.data_)))));
+	#else
+		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ >> 15;
+		if(!abs)
+			return half(detail::binary, detail::flush_result(detail::rounded<R,true>(0x3E48, 0, 1)));
+		if(abs >= 0x3C00)
+			return half(detail::binary,	(abs>0x7C00) ? detail::signal(arg.data_) : (abs>0x3C00) ? detail::invalid() :
+										sign ? detail::rounded<R,true>(0x4248, 0, 1) : 0);
+		std::pair<detail::uint32,detail::uint32> cs = detail::atan2_args(abs);
+		detail::uint32 lo, m = detail::atan2(cs.second, cs.first, lo);
+		if(sign)
+		{
+			detail::uint32 h = 0xC90FDAA2, l = 0x2168C234;
+			detail::sub64(h, l, m, lo);
+			m = h;
+			lo = l;
+		}
+		return half(detail::binary, detail::flush_result(detail::fixed2half<R,31,false,true,true>(m, 15, 0, lo!=0)));
+	#endif
+	}
+
+	/// Arc cosine function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like acos<R>().
+	/// \param arg function argument
+	/// \return arc cosine value of \a arg
+	inline half acos(half arg) { return acos<half::round_style>(arg); }
+
+	/// Arc tangent function.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::atan](https://en.cppreference.com/w/cpp/numeric/math/atan).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return arc tangent value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half atan(half arg)
+	{
+		return half(detail::binary, detail::atan_impl<R>(arg.data_));
+	}
+
+	/// Arc tangent function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like atan<R>().
+	/// \param arg function argument
+	/// \return arc tangent value of \a arg
+	inline half atan(half arg) { return atan<half::round_style>(arg); }
+
+	/// Arc tangent function.
+	/// This function may be 1 ULP off the correctly rounded exact result in ~0.005% of inputs for `std::round_to_nearest`, 
+	/// in ~0.1% of inputs for `std::round_toward_zero` and in ~0.02% of inputs for any other rounding mode.
+	///
+	/// **See also:** Documentation for [std::atan2](https://en.cppreference.com/w/cpp/numeric/math/atan2).
+	/// \tparam R rounding mode to use
+	/// \param y numerator
+	/// \param x denominator
+	/// \return arc tangent value
+	/// \exception FE_INVALID if \a x or \a y is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half atan2(half y, half x)
+	{
+		y.data_ = detail::flush_arg(y.data_), x.data_ = detail::flush_arg(x.data_);
+	#ifdef HALF_ARITHMETIC_TYPE
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(std::atan2(detail::half2float<detail::internal_t>(y.data_), detail::half2float<detail::internal_t>(x.data_)))));
+	#else
+		unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, signx = x.data_ >> 15, signy = y.data_ & 0x8000;
+		if(absx >= 0x7C00 || absy >= 0x7C00)
+		{
+			if(absx > 0x7C00 || absy > 0x7C00)
+				return half(detail::binary, detail::signal(x.data_, y.data_));
+			if(absy == 0x7C00)
+				return half(detail::binary, detail::flush_result((absx<0x7C00) ?	detail::rounded<R,true>(signy|0x3E48, 0, 1) :
+													signx ?	detail::rounded<R,true>(signy|0x40B6, 0, 1) :
+															detail::rounded<R,true>(signy|0x3A48, 0, 1)));
+			return (x.data_==0x7C00) ? half(detail::binary, detail::flush_result(signy)) : half(detail::binary, detail::flush_result(detail::rounded<R,true>(signy|0x4248, 0, 1)));
+		}
+		if(!absy)
+			return signx ? half(detail::binary, detail::flush_result(detail::rounded<R,true>(signy|0x4248, 0, 1))) : y;
+		if(!absx)
+			return half(detail::binary, detail::flush_result(detail::rounded<R,true>(signy|0x3E48, 0, 1)));
+		int d = (absy>>10) + (absy<=0x3FF) - (absx>>10) - (absx<=0x3FF);
+		if(d > (signx ? 18 : 12))
+			return half(detail::binary, detail::flush_result(detail::rounded<R,true>(signy|0x3E48, 0, 1)));
+		if(signx && d < -11)
+			return half(detail::binary, detail::flush_result(detail::rounded<R,true>(signy|0x4248, 0, 1)));
+		if(!signx && d < ((R==std::round_toward_zero) ? -15 : -9))
+		{
+		#if !HALF_FLUSH_DENORMALS
+			d -= detail::normalize<10>(absy);
+		#endif
+			detail::uint32 mx = ((absx<<1)&0x7FF) | 0x800, my = ((absy<<1)&0x7FF) | 0x800;
+			int i = my < mx;
+			d -= i;
+			if(d < -25)
+				return half(detail::binary, detail::flush_result(detail::underflow<R>(signy)));
+			my <<= 11 + i;
+			return half(detail::binary, detail::flush_result(detail::fixed2half<R,11,false,false,true>(my/mx, d+14, signy, my%mx!=0)));
+		}
+		detail::uint32 lo, m = detail::atan2(	((absy&0x3FF)|((absy>0x3FF)<<10))<<(19+((d<0) ? d : (d>0) ? 0 : -1)),
+													((absx&0x3FF)|((absx>0x3FF)<<10))<<(19-((d>0) ? d : (d<0) ? 0 : 1)), lo);
+		if(signx)
+		{
+			detail::uint32 h = 0xC90FDAA2, l = 0x2168C234;
+			detail::sub64(h, l, m, lo);
+			m = h;
+			lo = l;
+		}
+		return half(detail::binary, detail::flush_result(detail::fixed2half<R,31,false,true,true>(m, 15, signy, lo!=0)));
+	#endif
+	}
+
+	/// Arc tangent function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like atan2<R>().
+	/// \param y numerator
+	/// \param x denominator
+	/// \return arc tangent value
+	inline half atan2(half y, half x) { return atan2<half::round_style>(y, x); }
+
+	/// \}
+	/// \anchor hyperbolic
+	/// \name Hyperbolic functions
+	/// \{
+
+	/// Hyperbolic sine.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::sinh](https://en.cppreference.com/w/cpp/numeric/math/sinh).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return hyperbolic sine value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half sinh(half arg)
+	{
+		return half(detail::binary, detail::sinh_impl<R>(arg.data_));
+	}
+
+	/// Hyperbolic sine.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like sinh<R>().
+	/// \param arg function argument
+	/// \return hyperbolic sine value of \a arg
+	inline half sinh(half arg) { return sinh<half::round_style>(arg); }
+
+	/// Hyperbolic cosine.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::cosh](https://en.cppreference.com/w/cpp/numeric/math/cosh).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return hyperbolic cosine value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half cosh(half arg)
+	{
+		return half(detail::binary, detail::cosh_impl<R>(arg.data_));
+	}
+
+	/// Hyperbolic cosine.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like cosh<R>().
+	/// \param arg function argument
+	/// \return hyperbolic cosine value of \a arg
+	inline half cosh(half arg) { return cosh<half::round_style>(arg); }
+
+	/// Hyperbolic tangent.
+	/// This function is exact to rounding for all rounding modes. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled 
+	/// the results are looked up instead.
+	///
+	/// **See also:** Documentation for [std::tanh](https://en.cppreference.com/w/cpp/numeric/math/tanh).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return hyperbolic tangent value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half tanh(half arg)
+	{
+		return half(detail::binary, detail::tabulated<R,&detail::tanh_impl<R> >(arg.data_));
+	}
+
+	/// Hyperbolic tangent.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like tanh<R>().
+	/// \param arg function argument
+	/// \return hyperbolic tangent value of \a arg
+	inline half tanh(half arg) { return tanh<half::round_style>(arg); }
+
+	/// Hyperbolic area sine.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::asinh](https://en.cppreference.com/w/cpp/numeric/math/asinh).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return area sine value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half asinh(half arg)
+	{
+		arg.data_ = detail::flush_arg(arg.data_);
+	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(std::asinh(detail::half2float<detail::internal_t>(arg.data_)))));
+	#else
+		int abs = arg.data_ & 0x7FFF;
+		if(!abs || abs >= 0x7C00)
+			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
+		if(abs <= 0x2900)
+			return half(detail::binary, detail::flush_result(detail::rounded<R,true>(arg.data_-1, 1, 1)));
+		if(R != std::round_to_nearest)
+			switch(abs)
+			{
+				case 0x32D4: return half(detail::binary, detail::flush_result(detail::rounded<R,true>(arg.data_-13, 1, 1)));
+				case 0x3B5B: return half(detail::binary, detail::flush_result(detail::rounded<R,true>(arg.data_-197, 1, 1)));
+			}
+		return half(detail::binary, detail::flush_result(detail::area<R,true>(arg.data_)));
 	#endif
-	#if HALF_ENABLE_CPP11_USER_LITERALS
-		friend half literal::operator "" _h(long double);
+	}
+
+	/// Hyperbolic area sine.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like asinh<R>().
+	/// \param arg function argument
+	/// \return area sine value of \a arg
+	inline half asinh(half arg) { return asinh<half::round_style>(arg); }
+
+	/// Hyperbolic area cosine.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::acosh](https://en.cppreference.com/w/cpp/numeric/math/acosh).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return area cosine value of \a arg
+	/// \exception FE_INVALID for signaling NaN or arguments <1
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half acosh(half arg)
+	{
+		arg.data_ = detail::flush_arg(arg.data_);
+	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(std::acosh(detail::half2float<detail::internal_t>(arg.data_)))));
+	#else
+		int abs = arg.data_ & 0x7FFF;
+		if((arg.data_&0x8000) || abs < 0x3C00)
+			return half(detail::binary, detail::flush_result((abs<=0x7C00) ? detail::invalid() : detail::signal(arg.data_)));
+		if(abs == 0x3C00)
+			return half(detail::binary, 0);
+		if(arg.data_ >= 0x7C00)
+			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
+		return half(detail::binary, detail::flush_result(detail::area<R,false>(arg.data_)));
 	#endif
+	}
+
+	/// Hyperbolic area cosine.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like acosh<R>().
+	/// \param arg function argument
+	/// \return area cosine value of \a arg
+	inline half acosh(half arg) { return acosh<half::round_style>(arg); }
+
+	/// Hyperbolic area tangent.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::atanh](https://en.cppreference.com/w/cpp/numeric/math/atanh).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return area tangent value of \a arg
+	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
+	/// \exception FE_DIVBYZERO for +/-1
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half atanh(half arg)
+	{
+		arg.data_ = detail::flush_arg(arg.data_);
+	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
+		return half(detail::binary, detail::flush_result(detail::float2half<R>(std::atanh(detail::half2float<detail::internal_t>(arg.data_)))));
+	#else
+		int abs = arg.data_ & 0x7FFF, exp = 0;
+		if(!abs)
+			return arg;
+		if(abs >= 0x3C00)
+			return half(detail::binary, detail::flush_result((abs==0x3C00) ? detail::pole(arg.data_&0x8000) : (abs<=0x7C00) ? detail::invalid() : detail::signal(arg.data_)));
+		if(abs < 0x2700)
+			return half(detail::binary, detail::flush_result(detail::rounded<R,true>(arg.data_, 0, 1)));
+		detail::uint32 m = static_cast<detail::uint32>((abs&0x3FF)|((abs>0x3FF)<<10)) << ((abs>>10)+(abs<=0x3FF)+6), my = 0x80000000 + m, mx = 0x80000000 - m;
+		exp += detail::normalize<31>(mx);
+		int i = my >= mx, s;
+		return half(detail::binary, detail::flush_result(detail::log2_post<R,0xB8AA3B2A>(detail::log2(
+			(detail::divide64(my>>i, mx, s)+1)>>1, 27)+0x10, exp+i-1, 16, arg.data_&0x8000)));
 	#endif
-	};
+	}
+
+	/// Hyperbolic area tangent.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like atanh<R>().
+	/// \param arg function argument
+	/// \return area tangent value of \a arg
+	inline half atanh(half arg) { return atanh<half::round_style>(arg); }
+
+	/// \}
+	/// \anchor special
+	/// \name Error and gamma functions
+	/// \{
+
+	/// Error function.
+	/// This function is exact to rounding for all rounding modes. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled 
+	/// the results are looked up instead.
+	///
+	/// **See also:** Documentation for [std::erf](https://en.cppreference.com/w/cpp/numeric/math/erf).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return error function value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half erf(half arg)
+	{
+		return half(detail::binary, detail::tabulated<R,&detail::erf_impl<R> >(arg.data_));
+	}
+
+	/// Error function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like erf<R>().
+	/// \param arg function argument
+	/// \return error function value of \a arg
+	inline half erf(half arg) { return erf<half::round_style>(arg); }
+
+	/// Complementary error function.
+	/// This function is exact to rounding for all rounding modes. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled 
+	/// the results are looked up instead.
+	///
+	/// **See also:** Documentation for [std::erfc](https://en.cppreference.com/w/cpp/numeric/math/erfc).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return 1 minus error function value of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half erfc(half arg)
+	{
+		return half(detail::binary, detail::tabulated<R,&detail::erfc_impl<R> >(arg.data_));
+	}
+
+	/// Complementary error function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like erfc<R>().
+	/// \param arg function argument
+	/// \return 1 minus error function value of \a arg
+	inline half erfc(half arg) { return erfc<half::round_style>(arg); }
+
+	/// Natural logarithm of gamma function.
+	/// This function is exact to rounding for all rounding modes. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled 
+	/// the results are looked up instead.
+	///
+	/// **See also:** Documentation for [std::lgamma](https://en.cppreference.com/w/cpp/numeric/math/lgamma).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return natural logarith of gamma function for \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_DIVBYZERO for 0 or negative integer arguments
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half lgamma(half arg)
+	{
+		return half(detail::binary, detail::tabulated<R,&detail::lgamma_impl<R> >(arg.data_));
+	}
+
+	/// Natural logarithm of gamma function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like lgamma<R>().
+	/// \param arg function argument
+	/// \return natural logarith of gamma function for \a arg
+	inline half lgamma(half arg) { return lgamma<half::round_style>(arg); }
+
+	/// Gamma function.
+	/// This function is exact to rounding for all rounding modes. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled 
+	/// the results are looked up instead.
+	///
+	/// **See also:** Documentation for [std::tgamma](https://en.cppreference.com/w/cpp/numeric/math/tgamma).
+	/// \tparam R rounding mode to use
+	/// \param arg function argument
+	/// \return gamma function value of \a arg
+	/// \exception FE_INVALID for signaling NaN, negative infinity or negative integer arguments
+	/// \exception FE_DIVBYZERO for 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half tgamma(half arg)
+	{
+		return half(detail::binary, detail::tabulated<R,&detail::tgamma_impl<R> >(arg.data_));
+	}
+
+	/// Gamma function.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like tgamma<R>().
+	/// \param arg function argument
+	/// \return gamma function value of \a arg
+	inline half tgamma(half arg) { return tgamma<half::round_style>(arg); }
+
+	/// \}
+	/// \anchor rounding
+	/// \name Rounding
+	/// \{
+
+	/// Nearest integer not less than half value.
+	/// **See also:** Documentation for [std::ceil](https://en.cppreference.com/w/cpp/numeric/math/ceil).
+	/// \param arg half to round
+	/// \return nearest integer not less than \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_INEXACT if value had to be rounded
+	inline half ceil(half arg) { return half(detail::binary, detail::integral<std::round_toward_infinity,true,true>(arg.data_)); }
+
+	/// Nearest integer not greater than half value.
+	/// **See also:** Documentation for [std::floor](https://en.cppreference.com/w/cpp/numeric/math/floor).
+	/// \param arg half to round
+	/// \return nearest integer not greater than \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_INEXACT if value had to be rounded
+	inline half floor(half arg) { return half(detail::binary, detail::integral<std::round_toward_neg_infinity,true,true>(arg.data_)); }
+
+	/// Nearest integer not greater in magnitude than half value.
+	/// **See also:** Documentation for [std::trunc](https://en.cppreference.com/w/cpp/numeric/math/trunc).
+	/// \param arg half to round
+	/// \return nearest integer not greater in magnitude than \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_INEXACT if value had to be rounded
+	inline half trunc(half arg) { return half(detail::binary, detail::integral<std::round_toward_zero,true,true>(arg.data_)); }
+
+	/// Nearest integer.
+	/// **See also:** Documentation for [std::round](https://en.cppreference.com/w/cpp/numeric/math/round).
+	/// \param arg half to round
+	/// \return nearest integer, rounded away from zero in half-way cases
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_INEXACT if value had to be rounded
+	inline half round(half arg) { return half(detail::binary, detail::integral<std::round_to_nearest,false,true>(arg.data_)); }
+
+	/// Nearest integer.
+	/// **See also:** Documentation for [std::lround](https://en.cppreference.com/w/cpp/numeric/math/round).
+	/// \param arg half to round
+	/// \return nearest integer, rounded away from zero in half-way cases
+	/// \exception FE_INVALID if value is not representable as `long`
+	inline long lround(half arg) { return detail::half2int<std::round_to_nearest,false,false,long>(arg.data_); }
+
+	/// Nearest integer using given rounding mode.
+	/// **See also:** Documentation for [std::rint](https://en.cppreference.com/w/cpp/numeric/math/rint).
+	/// \tparam R rounding mode to use
+	/// \param arg half expression to round
+	/// \return nearest integer using rounding mode \a R
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_INEXACT if value had to be rounded
+	template<std::float_round_style R> half rint(half arg) { return half(detail::binary, detail::integral<R,true,true>(arg.data_)); }
+
+	/// Nearest integer using half's internal rounding mode.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like rint<R>().
+	/// \param arg half expression to round
+	/// \return nearest integer using default rounding mode
+	inline half rint(half arg) { return rint<half::round_style>(arg); }
+
+	/// Nearest integer using given rounding mode.
+	/// **See also:** Documentation for [std::lrint](https://en.cppreference.com/w/cpp/numeric/math/rint).
+	/// \tparam R rounding mode to use
+	/// \param arg half expression to round
+	/// \return nearest integer using rounding mode \a R
+	/// \exception FE_INVALID if value is not representable as `long`
+	/// \exception FE_INEXACT if value had to be rounded
+	template<std::float_round_style R> long lrint(half arg) { return detail::half2int<R,true,true,long>(arg.data_); }
+
+	/// Nearest integer using half's internal rounding mode.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like lrint<R>().
+	/// \param arg half expression to round
+	/// \return nearest integer using default rounding mode
+	inline long lrint(half arg) { return lrint<half::round_style>(arg); }
+
+	/// Nearest integer using given rounding mode.
+	/// **See also:** Documentation for [std::nearbyint](https://en.cppreference.com/w/cpp/numeric/math/nearbyint).
+	/// \tparam R rounding mode to use
+	/// \param arg half expression to round
+	/// \return nearest integer using rounding mode \a R
+	/// \exception FE_INVALID for signaling NaN
+	template<std::float_round_style R> half nearbyint(half arg) { return half(detail::binary, detail::integral<R,true,false>(arg.data_)); }
+
+	/// Nearest integer using half's internal rounding mode.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like nearbyint<R>().
+	/// \param arg half expression to round
+	/// \return nearest integer using default rounding mode
+	inline half nearbyint(half arg) { return nearbyint<half::round_style>(arg); }
+#if HALF_ENABLE_CPP11_LONG_LONG
+	/// Nearest integer.
+	/// **See also:** Documentation for [std::llround](https://en.cppreference.com/w/cpp/numeric/math/round).
+	/// \param arg half to round
+	/// \return nearest integer, rounded away from zero in half-way cases
+	/// \exception FE_INVALID if value is not representable as `long long`
+	inline long long llround(half arg) { return detail::half2int<std::round_to_nearest,false,false,long long>(arg.data_); }
+
+	/// Nearest integer using given rounding mode.
+	/// **See also:** Documentation for [std::llrint](https://en.cppreference.com/w/cpp/numeric/math/rint).
+	/// \tparam R rounding mode to use
+	/// \param arg half expression to round
+	/// \return nearest integer using rounding mode \a R
+	/// \exception FE_INVALID if value is not representable as `long long`
+	/// \exception FE_INEXACT if value had to be rounded
+	template<std::float_round_style R> long long llrint(half arg) { return detail::half2int<R,true,true,long long>(arg.data_); }
+
+	/// Nearest integer using half's internal rounding mode.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like llrint<R>().
+	/// \param arg half expression to round
+	/// \return nearest integer using default rounding mode
+	inline long long llrint(half arg) { return llrint<half::round_style>(arg); }
+#endif
 
-#if HALF_ENABLE_CPP11_USER_LITERALS
-	namespace literal
+	/// \}
+	/// \anchor float
+	/// \name Floating point manipulation
+	/// \{
+
+	/// Decompress floating-point number.
+	/// **See also:** Documentation for [std::frexp](https://en.cppreference.com/w/cpp/numeric/math/frexp).
+	/// \param arg number to decompress
+	/// \param exp address to store exponent at
+	/// \return significant in range [0.5, 1)
+	/// \exception FE_INVALID for signaling NaN
+	inline half frexp(half arg, int *exp)
 	{
-		/// Half literal.
-		/// While this returns a properly rounded half-precision value, half literals can unfortunately not be constant 
-		/// expressions due to rather involved conversions. So don't expect this to be a literal literal without involving 
-		/// conversion operations at runtime. It is a convenience feature, not a performance optimization.
-		/// \param value literal value
-		/// \return half with of given value (possibly rounded)
-		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-		inline half operator "" _h(long double value) { return half(detail::binary, detail::float2half<half::round_style>(value)); }
+		*exp = 0;
+		unsigned int abs = arg.data_ & 0x7FFF;
+		if(abs >= 0x7C00 || !abs)
+			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
+		*exp -= detail::normalize<10>(abs);
+		*exp += (abs>>10) - 14;
+		return half(detail::binary, (arg.data_&0x8000)|0x3800|(abs&0x3FF));
 	}
-#endif
 
-	namespace detail
+	/// Multiply by power of two.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::scalbln](https://en.cppreference.com/w/cpp/numeric/math/scalbn).
+	/// \tparam R rounding mode to use
+	/// \param arg number to modify
+	/// \param exp power of two to multiply with
+	/// \return \a arg multplied by 2 raised to \a exp
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half scalbln(half arg, long exp)
 	{
-		/// Helper class for half casts.
-		/// This class template has to be specialized for all valid cast arguments to define an appropriate static 
-		/// `cast` member function and a corresponding `type` member denoting its return type.
-		/// \tparam T destination type
-		/// \tparam U source type
-		/// \tparam R rounding mode to use
-		template<typename T,typename U,std::float_round_style R=(std::float_round_style)(HALF_ROUND_STYLE)> struct half_caster {};
-		template<typename U,std::float_round_style R> struct half_caster<half,U,R>
-		{
-		#if HALF_ENABLE_CPP11_STATIC_ASSERT && HALF_ENABLE_CPP11_TYPE_TRAITS
-			static_assert(std::is_arithmetic<U>::value, "half_cast from non-arithmetic type unsupported");
-		#endif
+		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
+		if(abs >= 0x7C00 || !abs)
+			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
+		exp -= detail::normalize<10>(abs);
+		exp += abs >> 10;
+		if(exp > 30)
+			return half(detail::binary, detail::overflow<R>(sign));
+		else if(exp < -10)
+			return half(detail::binary, detail::underflow<R>(sign));
+		else if(exp > 0)
+			return half(detail::binary, sign|(exp<<10)|(abs&0x3FF));
+		unsigned int m = (abs&0x3FF) | 0x400;
+		return half(detail::binary, detail::rounded<R,false>(sign|(m>>(1-exp)), (m>>-exp)&1, (m&((1<<-exp)-1))!=0));
+	}
 
-			static half cast(U arg) { return cast_impl(arg, is_float<U>()); };
+	/// Multiply by power of two.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like scalbln<R>().
+	/// \param arg number to modify
+	/// \param exp power of two to multiply with
+	/// \return \a arg multplied by 2 raised to \a exp
+	inline half scalbln(half arg, long exp) { return scalbln<half::round_style>(arg, exp); }
 
-		private:
-			static half cast_impl(U arg, true_type) { return half(binary, float2half<R>(arg)); }
-			static half cast_impl(U arg, false_type) { return half(binary, int2half<R>(arg)); }
-		};
-		template<typename T,std::float_round_style R> struct half_caster<T,half,R>
-		{
-		#if HALF_ENABLE_CPP11_STATIC_ASSERT && HALF_ENABLE_CPP11_TYPE_TRAITS
-			static_assert(std::is_arithmetic<T>::value, "half_cast to non-arithmetic type unsupported");
-		#endif
+	/// Multiply by power of two.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::scalbn](https://en.cppreference.com/w/cpp/numeric/math/scalbn).
+	/// \tparam R rounding mode to use
+	/// \param arg number to modify
+	/// \param exp power of two to multiply with
+	/// \return \a arg multplied by 2 raised to \a exp
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half scalbn(half arg, int exp) { return scalbln<R>(arg, exp); }
 
-			static T cast(half arg) { return cast_impl(arg, is_float<T>()); }
+	/// Multiply by power of two.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like scalbn<R>().
+	/// \param arg number to modify
+	/// \param exp power of two to multiply with
+	/// \return \a arg multplied by 2 raised to \a exp
+	inline half scalbn(half arg, int exp) { return scalbln(arg, exp); }
 
-		private:
-			static T cast_impl(half arg, true_type) { return half2float<T>(arg.data_); }
-			static T cast_impl(half arg, false_type) { return half2int<R,true,true,T>(arg.data_); }
-		};
-		template<std::float_round_style R> struct half_caster<half,half,R>
+	/// Multiply by power of two.
+	/// This function is exact to rounding for all rounding modes.
+	///
+	/// **See also:** Documentation for [std::ldexp](https://en.cppreference.com/w/cpp/numeric/math/ldexp).
+	/// \tparam R rounding mode to use
+	/// \param arg number to modify
+	/// \param exp power of two to multiply with
+	/// \return \a arg multplied by 2 raised to \a exp
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> half ldexp(half arg, int exp) { return scalbln<R>(arg, exp); }
+
+	/// Multiply by power of two.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like ldexp<R>().
+	/// \param arg number to modify
+	/// \param exp power of two to multiply with
+	/// \return \a arg multplied by 2 raised to \a exp
+	inline half ldexp(half arg, int exp) { return scalbln(arg, exp); }
+
+	/// Extract integer and fractional parts.
+	/// **See also:** Documentation for [std::modf](https://en.cppreference.com/w/cpp/numeric/math/modf).
+	/// \param arg number to decompress
+	/// \param iptr address to store integer part at
+	/// \return fractional part
+	/// \exception FE_INVALID for signaling NaN
+	inline half modf(half arg, half *iptr)
+	{
+		unsigned int abs = arg.data_ & 0x7FFF;
+		if(abs > 0x7C00)
 		{
-			static half cast(half arg) { return arg; }
-		};
+			arg = half(detail::binary, detail::signal(arg.data_));
+			return *iptr = arg, arg;
+		}
+		if(abs >= 0x6400)
+			return *iptr = arg, half(detail::binary, arg.data_&0x8000);
+		if(abs < 0x3C00)
+			return iptr->data_ = arg.data_ & 0x8000, arg;
+		unsigned int exp = abs >> 10, mask = (1<<(25-exp)) - 1, m = arg.data_ & mask;
+		iptr->data_ = arg.data_ & ~mask;
+		if(!m)
+			return half(detail::binary, arg.data_&0x8000);
+		exp -= detail::normalize<10>(m);
+		return half(detail::binary, (arg.data_&0x8000)|(exp<<10)|(m&0x3FF));
 	}
-}
 
-/// Extensions to the C++ standard library.
-namespace std
-{
-	/// Numeric limits for half-precision floats.
-	/// **See also:** Documentation for [std::numeric_limits](https://en.cppreference.com/w/cpp/types/numeric_limits)
-	template<> class numeric_limits<half_float::half>
+	/// Extract exponent.
+	/// **See also:** Documentation for [std::ilogb](https://en.cppreference.com/w/cpp/numeric/math/ilogb).
+	/// \param arg number to query
+	/// \return floating-point exponent
+	/// \retval FP_ILOGB0 for zero
+	/// \retval FP_ILOGBNAN for NaN
+	/// \retval INT_MAX for infinity
+	/// \exception FE_INVALID for 0 or infinite values
+	inline int ilogb(half arg)
 	{
-	public:
-		/// Is template specialization.
-		static HALF_CONSTEXPR_CONST bool is_specialized = true;
-
-		/// Supports signed values.
-		static HALF_CONSTEXPR_CONST bool is_signed = true;
-
-		/// Is not an integer type.
-		static HALF_CONSTEXPR_CONST bool is_integer = false;
-
-		/// Is not exact.
-		static HALF_CONSTEXPR_CONST bool is_exact = false;
-
-		/// Doesn't provide modulo arithmetic.
-		static HALF_CONSTEXPR_CONST bool is_modulo = false;
-
-		/// Has a finite set of values.
-		static HALF_CONSTEXPR_CONST bool is_bounded = true;
+		int abs = arg.data_ & 0x7FFF, exp;
+		if(!abs || abs >= 0x7C00)
+		{
+			detail::raise(FE_INVALID);
+			return !abs ? FP_ILOGB0 : (abs==0x7C00) ? INT_MAX : FP_ILOGBNAN;
+		}
+		exp = (abs>>10) - 15;
+		exp -= detail::normalize<9>(abs);
+		return exp;
+	}
 
-		/// IEEE conformant.
-		static HALF_CONSTEXPR_CONST bool is_iec559 = true;
+	/// Extract exponent.
+	/// **See also:** Documentation for [std::logb](https://en.cppreference.com/w/cpp/numeric/math/logb).
+	/// \param arg number to query
+	/// \return floating-point exponent
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_DIVBYZERO for 0
+	inline half logb(half arg)
+	{
+		int abs = arg.data_ & 0x7FFF, exp;
+		if(!abs)
+			return half(detail::binary, detail::pole(0x8000));
+		if(abs >= 0x7C00)
+			return half(detail::binary, (abs==0x7C00) ? 0x7C00 : detail::signal(arg.data_));
+		exp = (abs>>10) - 15;
+		exp -= detail::normalize<9>(abs);
+		unsigned int value = static_cast<unsigned>(exp<0) << 15;
+		if(exp)
+		{
+			unsigned int m = std::abs(exp) << 6;
+			exp = 18 - detail::normalize<10>(m);
+			value |= (exp<<10) + m;
+		}
+		return half(detail::binary, value);
+	}
 
-		/// Supports infinity.
-		static HALF_CONSTEXPR_CONST bool has_infinity = true;
+	/// Next representable value.
+	/// **See also:** Documentation for [std::nextafter](https://en.cppreference.com/w/cpp/numeric/math/nextafter).
+	/// \param from value to compute next representable value for
+	/// \param to direction towards which to compute next value
+	/// \return next representable value after \a from in direction towards \a to
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW for infinite result from finite argument
+	/// \exception FE_UNDERFLOW for subnormal result
+	inline half nextafter(half from, half to)
+	{
+		int fabs = from.data_ & 0x7FFF, tabs = to.data_ & 0x7FFF;
+		if(fabs > 0x7C00 || tabs > 0x7C00)
+			return half(detail::binary, detail::signal(from.data_, to.data_));
+		if(from.data_ == to.data_ || !(fabs|tabs))
+			return to;
+		if(!fabs)
+		{
+			detail::raise(FE_UNDERFLOW, !HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT);
+			return half(detail::binary, (to.data_&0x8000)+1);
+		}
+		unsigned int out = from.data_ + (((from.data_>>15)^static_cast<unsigned>(
+			(from.data_^(0x8000|(0x8000-(from.data_>>15))))<(to.data_^(0x8000|(0x8000-(to.data_>>15))))))<<1) - 1;
+		detail::raise(FE_OVERFLOW, fabs<0x7C00 && (out&0x7C00)==0x7C00);
+		detail::raise(FE_UNDERFLOW, !HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT && (out&0x7C00)<0x400);
+		return half(detail::binary, out);
+	}
 
-		/// Supports quiet NaNs.
-		static HALF_CONSTEXPR_CONST bool has_quiet_NaN = true;
+	/// Next representable value.
+	/// **See also:** Documentation for [std::nexttoward](https://en.cppreference.com/w/cpp/numeric/math/nexttoward).
+	/// \param from value to compute next representable value for
+	/// \param to direction towards which to compute next value
+	/// \return next representable value after \a from in direction towards \a to
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW for infinite result from finite argument
+	/// \exception FE_UNDERFLOW for subnormal result
+	inline half nexttoward(half from, long double to)
+	{
+		int fabs = from.data_ & 0x7FFF;
+		if(fabs > 0x7C00)
+			return half(detail::binary, detail::signal(from.data_));
+		long double lfrom = static_cast<long double>(from);
+		if(detail::builtin_isnan(to) || lfrom == to)
+			return half(static_cast<float>(to));
+		if(!fabs)
+		{
+			detail::raise(FE_UNDERFLOW, !HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT);
+			return half(detail::binary, (static_cast<unsigned>(detail::builtin_signbit(to))<<15)+1);
+		}
+		unsigned int out = from.data_ + (((from.data_>>15)^static_cast<unsigned>(lfrom<to))<<1) - 1;
+		detail::raise(FE_OVERFLOW, (out&0x7FFF)==0x7C00);
+		detail::raise(FE_UNDERFLOW, !HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT && (out&0x7FFF)<0x400);
+		return half(detail::binary, out);
+	}
 
-		/// Supports signaling NaNs.
-		static HALF_CONSTEXPR_CONST bool has_signaling_NaN = true;
+	/// Take sign.
+	/// **See also:** Documentation for [std::copysign](https://en.cppreference.com/w/cpp/numeric/math/copysign).
+	/// \param x value to change sign for
+	/// \param y value to take sign from
+	/// \return value equal to \a x in magnitude and to \a y in sign
+	inline HALF_CONSTEXPR half copysign(half x, half y) { return half(detail::binary, x.data_^((x.data_^y.data_)&0x8000)); }
 
-		/// Supports subnormal values.
-		static HALF_CONSTEXPR_CONST float_denorm_style has_denorm = denorm_present;
+	/// \}
+	/// \anchor classification
+	/// \name Floating point classification
+	/// \{
 
-		/// Supports no denormalization detection.
-		static HALF_CONSTEXPR_CONST bool has_denorm_loss = false;
+	/// Classify floating-point value.
+	/// **See also:** Documentation for [std::fpclassify](https://en.cppreference.com/w/cpp/numeric/math/fpclassify).
+	/// \param arg number to classify
+	/// \retval FP_ZERO for positive and negative zero
+	/// \retval FP_SUBNORMAL for subnormal numbers
+	/// \retval FP_INFINITY for positive and negative infinity
+	/// \retval FP_NAN for NaNs
+	/// \retval FP_NORMAL for all other (normal) values
+	inline HALF_CONSTEXPR int fpclassify(half arg)
+	{
+		return	!(arg.data_&0x7FFF) ? FP_ZERO :
+				((arg.data_&0x7FFF)<0x400) ? FP_SUBNORMAL :
+				((arg.data_&0x7FFF)<0x7C00) ? FP_NORMAL :
+				((arg.data_&0x7FFF)==0x7C00) ? FP_INFINITE :
+				FP_NAN;
+	}
 
-	#if HALF_ERRHANDLING_THROWS
-		static HALF_CONSTEXPR_CONST bool traps = true;
-	#else
-		/// Traps only if [HALF_ERRHANDLING_THROW_...](\ref HALF_ERRHANDLING_THROW_INVALID) is acitvated.
-		static HALF_CONSTEXPR_CONST bool traps = false;
-	#endif
+	/// Check if finite number.
+	/// **See also:** Documentation for [std::isfinite](https://en.cppreference.com/w/cpp/numeric/math/isfinite).
+	/// \param arg number to check
+	/// \retval true if neither infinity nor NaN
+	/// \retval false else
+	inline HALF_CONSTEXPR bool isfinite(half arg) { return (arg.data_&0x7C00) != 0x7C00; }
 
-		/// Does not support no pre-rounding underflow detection.
-		static HALF_CONSTEXPR_CONST bool tinyness_before = false;
+	/// Check for infinity.
+	/// **See also:** Documentation for [std::isinf](https://en.cppreference.com/w/cpp/numeric/math/isinf).
+	/// \param arg number to check
+	/// \retval true for positive or negative infinity
+	/// \retval false else
+	inline HALF_CONSTEXPR bool isinf(half arg) { return (arg.data_&0x7FFF) == 0x7C00; }
 
-		/// Rounding mode.
-		static HALF_CONSTEXPR_CONST float_round_style round_style = half_float::half::round_style;
+	/// Check for NaN.
+	/// **See also:** Documentation for [std::isnan](https://en.cppreference.com/w/cpp/numeric/math/isnan).
+	/// \param arg number to check
+	/// \retval true for NaNs
+	/// \retval false else
+	inline HALF_CONSTEXPR bool isnan(half arg) { return (arg.data_&0x7FFF) > 0x7C00; }
 
-		/// Significant digits.
-		static HALF_CONSTEXPR_CONST int digits = 11;
+	/// Check if normal number.
+	/// **See also:** Documentation for [std::isnormal](https://en.cppreference.com/w/cpp/numeric/math/isnormal).
+	/// \param arg number to check
+	/// \retval true if normal number
+	/// \retval false if either subnormal, zero, infinity or NaN
+	inline HALF_CONSTEXPR bool isnormal(half arg) { return ((arg.data_&0x7C00)!=0) & ((arg.data_&0x7C00)!=0x7C00); }
 
-		/// Significant decimal digits.
-		static HALF_CONSTEXPR_CONST int digits10 = 3;
+	/// Check sign.
+	/// **See also:** Documentation for [std::signbit](https://en.cppreference.com/w/cpp/numeric/math/signbit).
+	/// \param arg number to check
+	/// \retval true for negative number
+	/// \retval false for positive number
+	inline HALF_CONSTEXPR bool signbit(half arg) { return (arg.data_&0x8000) != 0; }
 
-		/// Required decimal digits to represent all possible values.
-		static HALF_CONSTEXPR_CONST int max_digits10 = 5;
+	/// \}
+	/// \anchor compfunc
+	/// \name Comparison
+	/// \{
 
-		/// Number base.
-		static HALF_CONSTEXPR_CONST int radix = 2;
+	/// Quiet comparison for greater than.
+	/// **See also:** Documentation for [std::isgreater](https://en.cppreference.com/w/cpp/numeric/math/isgreater).
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if \a x greater than \a y
+	/// \retval false else
+	inline HALF_CONSTEXPR bool isgreater(half x, half y)
+	{
+		return ((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) > ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15)) && !isnan(x) && !isnan(y);
+	}
 
-		/// One more than smallest exponent.
-		static HALF_CONSTEXPR_CONST int min_exponent = -13;
+	/// Quiet comparison for greater equal.
+	/// **See also:** Documentation for [std::isgreaterequal](https://en.cppreference.com/w/cpp/numeric/math/isgreaterequal).
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if \a x greater equal \a y
+	/// \retval false else
+	inline HALF_CONSTEXPR bool isgreaterequal(half x, half y)
+	{
+		return ((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) >= ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15)) && !isnan(x) && !isnan(y);
+	}
 
-		/// Smallest normalized representable power of 10.
-		static HALF_CONSTEXPR_CONST int min_exponent10 = -4;
+	/// Quiet comparison for less than.
+	/// **See also:** Documentation for [std::isless](https://en.cppreference.com/w/cpp/numeric/math/isless).
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if \a x less than \a y
+	/// \retval false else
+	inline HALF_CONSTEXPR bool isless(half x, half y)
+	{
+		return ((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) < ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15)) && !isnan(x) && !isnan(y);
+	}
 
-		/// One more than largest exponent
-		static HALF_CONSTEXPR_CONST int max_exponent = 16;
+	/// Quiet comparison for less equal.
+	/// **See also:** Documentation for [std::islessequal](https://en.cppreference.com/w/cpp/numeric/math/islessequal).
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if \a x less equal \a y
+	/// \retval false else
+	inline HALF_CONSTEXPR bool islessequal(half x, half y)
+	{
+		return ((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) <= ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15)) && !isnan(x) && !isnan(y);
+	}
 
-		/// Largest finitely representable power of 10.
-		static HALF_CONSTEXPR_CONST int max_exponent10 = 4;
+	/// Quiet comarison for less or greater.
+	/// **See also:** Documentation for [std::islessgreater](https://en.cppreference.com/w/cpp/numeric/math/islessgreater).
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if either less or greater
+	/// \retval false else
+	inline HALF_CONSTEXPR bool islessgreater(half x, half y)
+	{
+		return x.data_!=y.data_ && ((x.data_|y.data_)&0x7FFF) && !isnan(x) && !isnan(y);
+	}
 
-		/// Smallest positive normal value.
-		static HALF_CONSTEXPR half_float::half min() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x0400); }
+	/// Quiet check if unordered.
+	/// **See also:** Documentation for [std::isunordered](https://en.cppreference.com/w/cpp/numeric/math/isunordered).
+	/// \param x first operand
+	/// \param y second operand
+	/// \retval true if unordered (one or two NaN operands)
+	/// \retval false else
+	inline HALF_CONSTEXPR bool isunordered(half x, half y) { return isnan(x) || isnan(y); }
 
-		/// Smallest finite value.
-		static HALF_CONSTEXPR half_float::half lowest() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0xFBFF); }
+	/// \}
+	/// \anchor casting
+	/// \name Casting
+	/// \{
 
-		/// Largest finite value.
-		static HALF_CONSTEXPR half_float::half max() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x7BFF); }
+	/// Cast to or from half-precision floating-point number.
+	/// This casts between [half](\ref half_float::half) and any built-in arithmetic type. The values are converted 
+	/// directly using the default rounding mode, without any roundtrip over `float` that a `static_cast` would otherwise do.
+	///
+	/// Using this cast with neither of the two types being a [half](\ref half_float::half) or with any of the two types 
+	/// not being a built-in arithmetic type (apart from [half](\ref half_float::half), of course) results in a compiler 
+	/// error and casting between [half](\ref half_float::half)s returns the argument unmodified.
+	/// \tparam T destination type (half or built-in arithmetic type)
+	/// \tparam U source type (half or built-in arithmetic type)
+	/// \param arg value to cast
+	/// \return \a arg converted to destination type
+	/// \exception FE_INVALID if \a T is integer type and result is not representable as \a T
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<typename T,typename U> T half_cast(U arg) { return detail::half_caster<T,U>::cast(arg); }
 
-		/// Difference between 1 and next representable value.
-		static HALF_CONSTEXPR half_float::half epsilon() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x1400); }
+	/// Cast to or from half-precision floating-point number.
+	/// This casts between [half](\ref half_float::half) and any built-in arithmetic type. The values are converted 
+	/// directly using the specified rounding mode, without any roundtrip over `float` that a `static_cast` would otherwise do.
+	///
+	/// Using this cast with neither of the two types being a [half](\ref half_float::half) or with any of the two types 
+	/// not being a built-in arithmetic type (apart from [half](\ref half_float::half), of course) results in a compiler 
+	/// error and casting between [half](\ref half_float::half)s returns the argument unmodified.
+	/// \tparam T destination type (half or built-in arithmetic type)
+	/// \tparam R rounding mode to use.
+	/// \tparam U source type (half or built-in arithmetic type)
+	/// \param arg value to cast
+	/// \return \a arg converted to destination type
+	/// \exception FE_INVALID if \a T is integer type and result is not representable as \a T
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<typename T,std::float_round_style R,typename U> T half_cast(U arg) { return detail::half_caster<T,U,R>::cast(arg); }
 
-		/// Maximum rounding error in ULP (units in the last place).
-		static HALF_CONSTEXPR half_float::half round_error() HALF_NOTHROW
-			{ return half_float::half(half_float::detail::binary, (round_style==std::round_to_nearest) ? 0x3800 : 0x3C00); }
+	/// Cast to half-precision floating-point number with conversion policies.
+	/// This works like half_cast<T,R>() and additionally applies the given [conversion policies](\ref conversion_policy) to the 
+	/// rounded result, e.g. to clamp out-of-range values to the largest finite value:
+	/// ~~~~{.cpp}
+	/// half h = half_cast<half,std::round_to_nearest,policy_saturate|policy_scrub_nan>(1e10f);
+	/// ~~~~
+	/// \tparam T destination type (has to be half)
+	/// \tparam R rounding mode to use.
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \tparam U source type (half or built-in arithmetic type)
+	/// \param arg value to cast
+	/// \return \a arg converted to half-precision
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<typename T,std::float_round_style R,unsigned int P,typename U> T half_cast(U arg)
+	{
+		return detail::half_caster<T,U,R>::template cast<P>(arg);
+	}
 
-		/// Positive infinity.
-		static HALF_CONSTEXPR half_float::half infinity() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x7C00); }
+	/// Random number generator for stochastic rounding.
+	/// This is a fast generator of 32 random bits, consisting of eight interleaved [xoshiro128++](https://prng.di.unimi.it/) 
+	/// generators that are used in turn. It satisfies the requirements of a *UniformRandomBitGenerator* and can be used 
+	/// with half_cast(float,G&). For [batch conversions](\ref convert(const float*,half*,std::size_t,stochastic_generator&)) 
+	/// the generators are advanced in SIMD registers, but the results are still identical to those of converting the values one 
+	/// by one. Generators are not thread-safe, so each thread should use its own, seeded differently.
+	class stochastic_generator
+	{
+	public:
+		/// Type of generated random numbers.
+		typedef detail::bits<float>::type result_type;
 
-		/// Quiet NaN.
-		static HALF_CONSTEXPR half_float::half quiet_NaN() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x7FFF); }
+		/// Smallest possible random number.
+		/// \return 0
+		static HALF_CONSTEXPR result_type (min)() { return 0; }
 
-		/// Signaling NaN.
-		static HALF_CONSTEXPR half_float::half signaling_NaN() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x7DFF); }
+		/// Largest possible random number.
+		/// \return 2^32-1
+		static HALF_CONSTEXPR result_type (max)() { return 0xFFFFFFFF; }
 
-		/// Smallest positive subnormal value.
-		static HALF_CONSTEXPR half_float::half denorm_min() HALF_NOTHROW { return half_float::half(half_float::detail::binary, 0x0001); }
-	};
+		/// Constructor.
+		/// Generators created with the same seed produce the same random numbers.
+		/// \param value seed value
+		explicit stochastic_generator(unsigned long value = 0) { seed(value); }
 
-#if HALF_ENABLE_CPP11_HASH
-	/// Hash function for half-precision floats.
-	/// This is only defined if C++11 `std::hash` is supported and enabled.
-	///
-	/// **See also:** Documentation for [std::hash](https://en.cppreference.com/w/cpp/utility/hash)
-	template<> struct hash<half_float::half>
-	{
-		/// Type of function argument.
-		typedef half_float::half argument_type;
+		/// Reinitialize generator.
+		/// \param value seed value
+		void seed(unsigned long value = 0) { detail::random_seed(state_, value); }
 
-		/// Function return type.
-		typedef size_t result_type;
+		/// Generate random number.
+		/// \return 32 uniformly distributed random bits
+		result_type operator()() { return static_cast<result_type>(detail::random_next(state_)); }
 
-		/// Compute hash function.
-		/// \param arg half to hash
-		/// \return hash value
-		result_type operator()(argument_type arg) const { return hash<half_float::detail::uint16>()(arg.data_&-static_cast<unsigned>(arg.data_!=0x8000)); }
-	};
-#endif
-}
+	private:
+		/// Generator state.
+		detail::random_state state_;
 
-namespace half_float
-{
-	/// \anchor compop
-	/// \name Comparison operators
-	/// \{
+		template<unsigned int P> friend void convert(const float*, half*, std::size_t, stochastic_generator&);
+	};
 
-	/// Comparison for equality.
-	/// \param x first operand
-	/// \param y second operand
-	/// \retval true if operands equal
-	/// \retval false else
-	/// \exception FE_INVALID if \a x or \a y is NaN
-	inline HALF_CONSTEXPR_NOERR bool operator==(half x, half y)
+	/// Cast to half-precision floating-point number with stochastic rounding.
+	/// Inexact values are rounded away from zero with a probability proportional to their distance to the value truncated 
+	/// toward zero, and toward zero otherwise. This way the rounding errors cancel out on average, which is required for 
+	/// accumulating many small updates, e.g. when training neural networks. Values too large for half-precision are rounded to 
+	/// infinity like with `std::round_to_nearest`.
+	/// \tparam T destination type (has to be half)
+	/// \tparam G type of random number generator
+	/// \param arg single-precision value to cast
+	/// \param gen generator producing 32 uniformly distributed random bits per call (e.g. stochastic_generator or `std::mt19937`)
+	/// \return \a arg rounded stochastically to half-precision
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<typename T,typename G> T half_cast(float arg, G &gen)
 	{
-		return !detail::compsignal(x.data_, y.data_) && (x.data_==y.data_ || !((x.data_|y.data_)&0x7FFF));
+		return detail::half_caster<T,float>::template cast<policy_none>(arg, gen);
 	}
 
-	/// Comparison for inequality.
-	/// \param x first operand
-	/// \param y second operand
-	/// \retval true if operands not equal
-	/// \retval false else
-	/// \exception FE_INVALID if \a x or \a y is NaN
-	inline HALF_CONSTEXPR_NOERR bool operator!=(half x, half y)
+	/// Cast to half-precision floating-point number with stochastic rounding and conversion policies.
+	/// This works like half_cast<T>(float,G&) and additionally applies the given [conversion policies](\ref conversion_policy) 
+	/// to the rounded result.
+	/// \tparam T destination type (has to be half)
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \tparam G type of random number generator
+	/// \param arg single-precision value to cast
+	/// \param gen generator producing 32 uniformly distributed random bits per call
+	/// \return \a arg rounded stochastically to half-precision
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<typename T,unsigned int P,typename G> T half_cast(float arg, G &gen)
 	{
-		return detail::compsignal(x.data_, y.data_) || (x.data_!=y.data_ && ((x.data_|y.data_)&0x7FFF));
+		return detail::half_caster<T,float>::template cast<P>(arg, gen);
 	}
 
-	/// Comparison for less than.
-	/// \param x first operand
-	/// \param y second operand
-	/// \retval true if \a x less than \a y
-	/// \retval false else
-	/// \exception FE_INVALID if \a x or \a y is NaN
-	inline HALF_CONSTEXPR_NOERR bool operator<(half x, half y)
+	/// \}
+	/// \anchor batch
+	/// \name Batch conversion
+	/// \{
+
+	/// SIMD instruction set levels.
+	/// These denote the instruction set extensions used for the batch operations. With 
+	/// [runtime dispatch](\ref HALF_ENABLE_SIMD_DISPATCH) the best level supported by the processor is selected automatically, 
+	/// otherwise the best level enabled at compile-time is used.
+	enum simd_level
 	{
-		return !detail::compsignal(x.data_, y.data_) &&
-			((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) < ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15));
-	}
+		simd_scalar = 0,	///< no SIMD instructions
+		simd_sse2 = 1,		///< SSE2 instructions
+		simd_avx2 = 2,		///< AVX2 and F16C instructions
+		simd_avx512 = 3		///< AVX-512F and AVX-512BW instructions
+	};
 
-	/// Comparison for greater than.
-	/// \param x first operand
-	/// \param y second operand
-	/// \retval true if \a x greater than \a y
-	/// \retval false else
-	/// \exception FE_INVALID if \a x or \a y is NaN
-	inline HALF_CONSTEXPR_NOERR bool operator>(half x, half y)
+	/// Get supported SIMD level.
+	/// \return best SIMD level supported by both the platform and the processor
+	inline simd_level supported_simd_level() { static const int level = detail::simd_detect(); return static_cast<simd_level>(level); }
+
+	/// Get selected SIMD level.
+	/// \return SIMD level currently used for batch operations
+	inline simd_level get_simd_level() { return static_cast<simd_level>(static_cast<int>(detail::simd_level())); }
+
+	/// Select SIMD level.
+	/// This pins the instruction sets to use for batch operations, which can be useful for benchmarking or testing. The same can be 
+	/// achieved without recompiling by setting the `HALF_SIMD_LEVEL` environment variable to `scalar`, `sse2`, `avx2` or `avx512` 
+	/// (or the corresponding numbers). With [C++11 atomics](\ref HALF_ENABLE_CPP11_ATOMIC) this can be called while other threads 
+	/// run batch operations, which may still use the previous level but produce the same results, otherwise it must not be called 
+	/// concurrently with any batch operations.
+	/// \param level SIMD level to use (lowered to the supported level if necessary)
+	/// \return SIMD level actually used from now on
+	inline simd_level set_simd_level(simd_level level)
 	{
-		return !detail::compsignal(x.data_, y.data_) &&
-			((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) > ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15));
+		return static_cast<simd_level>(detail::simd_level() = (std::min)(static_cast<int>(level), static_cast<int>(supported_simd_level())));
 	}
 
-	/// Comparison for less equal.
-	/// \param x first operand
-	/// \param y second operand
-	/// \retval true if \a x less equal \a y
-	/// \retval false else
-	/// \exception FE_INVALID if \a x or \a y is NaN
-	inline HALF_CONSTEXPR_NOERR bool operator<=(half x, half y)
+	/// Get streaming threshold.
+	/// \return minimum number of bytes read and written by a batch conversion to use non-temporal stores
+	inline std::size_t get_streaming_threshold() { return detail::load_setting(detail::stream_threshold()); }
+
+	/// Set streaming threshold.
+	/// Batch conversions reading and writing at least this many bytes in total convert the values blockwise and write them to memory 
+	/// with non-temporal stores, bypassing the caches. This is initialized from [HALF_STREAMING_THRESHOLD](\ref HALF_STREAMING_THRESHOLD). 
+	/// With [C++11 atomics](\ref HALF_ENABLE_CPP11_ATOMIC) this can be called while other threads run batch conversions, which 
+	/// may still use the previous threshold but produce the same results, otherwise it must not be called concurrently with any 
+	/// batch operations.
+	/// \param bytes new minimum size in bytes (0 to always stream, `std::numeric_limits<std::size_t>::max()` to never stream)
+	/// \return previous threshold
+	inline std::size_t set_streaming_threshold(std::size_t bytes)
 	{
-		return !detail::compsignal(x.data_, y.data_) &&
-			((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) <= ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15));
+		return detail::store_setting(detail::stream_threshold(), bytes);
 	}
 
-	/// Comparison for greater equal.
-	/// \param x first operand
-	/// \param y second operand
-	/// \retval true if \a x greater equal \a y
-	/// \retval false else
-	/// \exception FE_INVALID if \a x or \a y is NaN
-	inline HALF_CONSTEXPR_NOERR bool operator>=(half x, half y)
+	/// Get default number of threads.
+	/// \return number of threads used by [parallel](\ref parallel_policy) batch conversions by default
+	inline unsigned int get_parallel_threads() { return detail::load_setting(detail::parallel_threads()); }
+
+	/// Set default number of threads.
+	/// This is initialized to the number of hardware threads (1 without the [thread pool](\ref HALF_ENABLE_PARALLEL)). With [C++11 atomics](\ref HALF_ENABLE_CPP11_ATOMIC) this can be 
+	/// called while other threads run parallel batch conversions, which may still use the previous number of threads but produce 
+	/// the same results, otherwise it must not be called concurrently with any parallel batch operations. Threads that were 
+	/// already started keep waiting for further tasks, but only as many as requested are used.
+	/// \param threads new number of threads used by [parallel](\ref parallel_policy) batch conversions by default 
+	/// (0 for the number of hardware threads)
+	/// \return previous number of threads
+	inline unsigned int set_parallel_threads(unsigned int threads)
 	{
-		return !detail::compsignal(x.data_, y.data_) &&
-			((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) >= ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15));
+		return detail::store_setting(detail::parallel_threads(), threads ? threads : detail::parallel_default());
 	}
 
-	/// \}
-	/// \anchor arithmetics
-	/// \name Arithmetic operators
-	/// \{
+	/// Parallel execution policy.
+	/// Passing this to the [batch conversion](\ref batch) functions splits large arrays into equal parts that are converted 
+	/// concurrently, with each thread using the [selected instruction sets](\ref simd_level). The threads are taken from a 
+	/// pool that is only started by the first parallel conversion, which needs at least 65536 values per thread to be used 
+	/// at all. The results and exception flags are identical to the sequential conversions.
+	///
+	/// This requires the [thread pool](\ref HALF_ENABLE_PARALLEL) to be enabled, otherwise the conversions are run on the 
+	/// calling thread. The same holds if exceptions are propagated to `errno`, the built-in floating-point environment or as 
+	/// C++ exceptions, which would get lost in other threads.
+	class parallel_policy
+	{
+	public:
+		/// Constructor.
+		/// \param threads maximum number of threads to use, 0 for the [default](\ref set_parallel_threads)
+		explicit HALF_CONSTEXPR parallel_policy(unsigned int threads = 0) : threads_(threads) {}
 
-	/// Identity.
-	/// \param arg operand
-	/// \return unchanged operand
-	inline HALF_CONSTEXPR half operator+(half arg) { return arg; }
+		/// Get number of threads.
+		/// \return maximum number of threads to use
+		unsigned int threads() const { return threads_ ? threads_ : detail::load_setting(detail::parallel_threads()); }
 
-	/// Negation.
-	/// \param arg operand
-	/// \return negated operand
-	inline HALF_CONSTEXPR half operator-(half arg) { return half(detail::binary, arg.data_^0x8000); }
+	private:
+		/// Number of threads to use.
+		unsigned int threads_;
+	};
 
-	/// Addition.
-	/// This operation is exact to rounding for all rounding modes.
-	/// \param x left operand
-	/// \param y right operand
-	/// \return sum of half expressions
-	/// \exception FE_INVALID if \a x and \a y are infinities with different signs or signaling NaNs
+	/// Parallel execution using the default number of threads.
+	HALF_CONSTEXPR_CONST parallel_policy parallel = parallel_policy();
+
+	/// Convert array of single-precision values to half-precision.
+	/// This converts \a n consecutive values using the default rounding mode, with the results being identical to converting each 
+	/// value separately. But whole blocks of values are converted at once using the [selected instruction sets](\ref simd_level), 
+	/// making this much faster for large arrays.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half operator+(half x, half y)
+	inline void convert(const float *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(detail::half2float<detail::internal_t>(x.data_)+detail::half2float<detail::internal_t>(y.data_)));
-	#else
-		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF;
-		bool sub = ((x.data_^y.data_)&0x8000) != 0;
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) : (absy!=0x7C00) ? x.data_ :
-										(sub && absx==0x7C00) ? detail::invalid() : y.data_);
-		if(!absx)
-			return absy ? y : half(detail::binary, (half::round_style==std::round_toward_neg_infinity) ? (x.data_|y.data_) : (x.data_&y.data_));
-		if(!absy)
-			return x;
-		unsigned int sign = ((sub && absy>absx) ? y.data_ : x.data_) & 0x8000;
-		if(absy > absx)
-			std::swap(absx, absy);
-		int exp = (absx>>10) + (absx<=0x3FF), d = exp - (absy>>10) - (absy<=0x3FF), mx = ((absx&0x3FF)|((absx>0x3FF)<<10)) << 3, my;
-		if(d < 13)
-		{
-			my = ((absy&0x3FF)|((absy>0x3FF)<<10)) << 3;
-			my = (my>>d) | ((my&((1<<d)-1))!=0);
-		}
-		else
-			my = 1;
-		if(sub)
-		{
-			if(!(mx-=my))
-				return half(detail::binary, static_cast<unsigned>(half::round_style==std::round_toward_neg_infinity)<<15);
-			for(; mx<0x2000 && exp>1; mx<<=1,--exp) ;
-		}
-		else
-		{
-			mx += my;
-			int i = mx >> 14;
-			if((exp+=i) > 30)
-				return half(detail::binary, detail::overflow<half::round_style>(sign));
-			mx = (mx>>i) | (mx&i);
-		}
-		return half(detail::binary, detail::rounded<half::round_style,false>(sign+((exp-1)<<10)+(mx>>3), (mx>>2)&1, (mx&0x3)!=0));
-	#endif
+		detail::float2half_n<(std::float_round_style)(HALF_ROUND_STYLE),policy_none>(src, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Subtraction.
-	/// This operation is exact to rounding for all rounding modes.
-	/// \param x left operand
-	/// \param y right operand
-	/// \return difference of half expressions
-	/// \exception FE_INVALID if \a x and \a y are infinities with equal signs or signaling NaNs
+	/// Convert array of single-precision values to half-precision.
+	/// This converts \a n consecutive values using the specified rounding mode, with the results being identical to 
+	/// half_cast<half,R>() of each value. But whole blocks of values are converted at once using the 
+	/// [selected instruction sets](\ref simd_level). For `std::round_indeterminate` these may use the current rounding direction 
+	/// of the built-in floating-point implementation.
+	/// \tparam R rounding mode to use.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half operator-(half x, half y)
+	template<std::float_round_style R> void convert(const float *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(detail::half2float<detail::internal_t>(x.data_)-detail::half2float<detail::internal_t>(y.data_)));
-	#else
-		return x + -y;
-	#endif
+		detail::float2half_n<R,policy_none>(src, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Multiplication.
-	/// This operation is exact to rounding for all rounding modes.
-	/// \param x left operand
-	/// \param y right operand
-	/// \return product of half expressions
-	/// \exception FE_INVALID if multiplying 0 with infinity or if \a x or \a y is signaling NaN
+	/// Convert array of single-precision values to half-precision with conversion policies.
+	/// This converts \a n consecutive values using the specified rounding mode and [conversion policies](\ref conversion_policy), 
+	/// with the results being identical to half_cast<half,R,P>() of each value. The policies are applied to whole blocks of 
+	/// values right after converting them, so this doesn't take another pass over the data.
+	/// \tparam R rounding mode to use.
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half operator*(half x, half y)
+	template<std::float_round_style R,unsigned int P> void convert(const float *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(detail::half2float<detail::internal_t>(x.data_)*detail::half2float<detail::internal_t>(y.data_)));
-	#else
-		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, exp = -16;
-		unsigned int sign = (x.data_^y.data_) & 0x8000;
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
-										((absx==0x7C00 && !absy)||(absy==0x7C00 && !absx)) ? detail::invalid() : (sign|0x7C00));
-		if(!absx || !absy)
-			return half(detail::binary, sign);
-		for(; absx<0x400; absx<<=1,--exp) ;
-		for(; absy<0x400; absy<<=1,--exp) ;
-		detail::uint32 m = static_cast<detail::uint32>((absx&0x3FF)|0x400) * static_cast<detail::uint32>((absy&0x3FF)|0x400);
-		int i = m >> 21, s = m & i;
-		exp += (absx>>10) + (absy>>10) + i;
-		if(exp > 29)
-			return half(detail::binary, detail::overflow<half::round_style>(sign));
-		else if(exp < -11)
-			return half(detail::binary, detail::underflow<half::round_style>(sign));
-		return half(detail::binary, detail::fixed2half<half::round_style,20,false,false,false>(m>>i, exp, sign, s));
-	#endif
+		detail::float2half_n<R,P>(src, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Division.
-	/// This operation is exact to rounding for all rounding modes.
-	/// \param x left operand
-	/// \param y right operand
-	/// \return quotient of half expressions
-	/// \exception FE_INVALID if dividing 0s or infinities with each other or if \a x or \a y is signaling NaN
-	/// \exception FE_DIVBYZERO if dividing finite value by 0
+	/// Convert array of double-precision values to half-precision.
+	/// This converts \a n consecutive values using the default rounding mode, with the results being identical to converting each 
+	/// value separately. In particular the values are rounded directly to half-precision and not via single-precision. But whole 
+	/// blocks of values are converted at once using the [selected instruction sets](\ref simd_level), making this much faster for 
+	/// large arrays.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half operator/(half x, half y)
+	inline void convert(const double *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(detail::half2float<detail::internal_t>(x.data_)/detail::half2float<detail::internal_t>(y.data_)));
-	#else
-		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, exp = 14;
-		unsigned int sign = (x.data_^y.data_) & 0x8000;
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
-										(absx==absy) ? detail::invalid() : (sign|((absx==0x7C00) ? 0x7C00 : 0)));
-		if(!absx)
-			return half(detail::binary, absy ? sign : detail::invalid());
-		if(!absy)
-			return half(detail::binary, detail::pole(sign));
-		for(; absx<0x400; absx<<=1,--exp) ;
-		for(; absy<0x400; absy<<=1,++exp) ;
-		detail::uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
-		int i = mx < my;
-		exp += (absx>>10) - (absy>>10) - i;
-		if(exp > 29)
-			return half(detail::binary, detail::overflow<half::round_style>(sign));
-		else if(exp < -11)
-			return half(detail::binary, detail::underflow<half::round_style>(sign));
-		mx <<= 12 + i;
-		my <<= 1;
-		return half(detail::binary, detail::fixed2half<half::round_style,11,false,false,false>(mx/my, exp, sign, mx%my!=0));
-	#endif
+		detail::float2half_n<(std::float_round_style)(HALF_ROUND_STYLE),policy_none>(src, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// \}
-	/// \anchor streaming
-	/// \name Input and output
-	/// \{
-
-	/// Output operator.
-	///	This uses the built-in functionality for streaming out floating-point numbers.
-	/// \param out output stream to write into
-	/// \param arg half expression to write
-	/// \return reference to output stream
-	template<typename charT,typename traits> std::basic_ostream<charT,traits>& operator<<(std::basic_ostream<charT,traits> &out, half arg)
+	/// Convert array of double-precision values to half-precision.
+	/// This converts \a n consecutive values using the specified rounding mode, with the results being identical to 
+	/// half_cast<half,R>() of each value. But whole blocks of values are converted at once using the 
+	/// [selected instruction sets](\ref simd_level). For `std::round_indeterminate` these may use the current rounding direction 
+	/// of the built-in floating-point implementation.
+	/// \tparam R rounding mode to use.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R> void convert(const double *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return out << detail::half2float<detail::internal_t>(arg.data_);
-	#else
-		return out << detail::half2float<float>(arg.data_);
-	#endif
+		detail::float2half_n<R,policy_none>(src, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Input operator.
-	///	This uses the built-in functionality for streaming in floating-point numbers, specifically double precision floating 
-	/// point numbers (unless overridden with [HALF_ARITHMETIC_TYPE](\ref HALF_ARITHMETIC_TYPE)). So the input string is first 
-	/// rounded to double precision using the underlying platform's current floating-point rounding mode before being rounded 
-	/// to half-precision using the library's half-precision rounding mode.
-	/// \param in input stream to read from
-	/// \param arg half to read into
-	/// \return reference to input stream
+	/// Convert array of double-precision values to half-precision with conversion policies.
+	/// This converts \a n consecutive values using the specified rounding mode and [conversion policies](\ref conversion_policy), 
+	/// with the results being identical to half_cast<half,R,P>() of each value. The policies are applied to whole blocks of 
+	/// values right after converting them, so this doesn't take another pass over the data.
+	/// \tparam R rounding mode to use.
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	template<typename charT,typename traits> std::basic_istream<charT,traits>& operator>>(std::basic_istream<charT,traits> &in, half &arg)
+	template<std::float_round_style R,unsigned int P> void convert(const double *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		detail::internal_t f;
-	#else
-		double f;
-	#endif
-		if(in >> f)
-			arg.data_ = detail::float2half<half::round_style>(f);
-		return in;
+		detail::float2half_n<R,P>(src, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// \}
-	/// \anchor basic
-	/// \name Basic mathematical operations
-	/// \{
-
-	/// Absolute value.
-	/// **See also:** Documentation for [std::fabs](https://en.cppreference.com/w/cpp/numeric/math/fabs).
-	/// \param arg operand
-	/// \return absolute value of \a arg
-	inline HALF_CONSTEXPR half fabs(half arg) { return half(detail::binary, arg.data_&0x7FFF); }
-
-	/// Absolute value.
-	/// **See also:** Documentation for [std::abs](https://en.cppreference.com/w/cpp/numeric/math/fabs).
-	/// \param arg operand
-	/// \return absolute value of \a arg
-	inline HALF_CONSTEXPR half abs(half arg) { return fabs(arg); }
+	/// Convert array of single-precision values to half-precision with stochastic rounding.
+	/// This converts \a n consecutive values, with the results being identical to half_cast<half>(float,G&) of each value in 
+	/// turn using the same generator. But whole blocks of values are converted at once using the 
+	/// [selected instruction sets](\ref simd_level), with the random numbers generated in SIMD registers as well, making this 
+	/// hardly slower than rounding to nearest.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \param gen random number generator to use (advanced by \a n numbers)
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void convert(const float *src, half *dst, std::size_t n, stochastic_generator &gen)
+	{
+		convert<policy_none>(src, dst, n, gen);
+	}
 
-	/// Remainder of division.
-	/// **See also:** Documentation for [std::fmod](https://en.cppreference.com/w/cpp/numeric/math/fmod).
-	/// \param x first operand
-	/// \param y second operand
-	/// \return remainder of floating-point division.
-	/// \exception FE_INVALID if \a x is infinite or \a y is 0 or if \a x or \a y is signaling NaN
-	inline half fmod(half x, half y)
+	/// Convert array of single-precision values to half-precision with stochastic rounding and conversion policies.
+	/// This works like convert(const float*,half*,std::size_t,stochastic_generator&) and additionally applies the given 
+	/// [conversion policies](\ref conversion_policy), with the results being identical to half_cast<half,P>(float,G&).
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \param gen random number generator to use (advanced by \a n numbers)
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<unsigned int P> void convert(const float *src, half *dst, std::size_t n, stochastic_generator &gen)
 	{
-		unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, sign = x.data_ & 0x8000;
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
-										(absx==0x7C00) ? detail::invalid() : x.data_);
-		if(!absy)
-			return half(detail::binary, detail::invalid());
-		if(!absx)
-			return x;
-		if(absx == absy)
-			return half(detail::binary, sign);
-		return half(detail::binary, sign|detail::mod<false,false>(absx, absy));
+		detail::float2half_stochastic_n<P>(src, reinterpret_cast<detail::uint16*>(dst), n, gen.state_);
 	}
 
-	/// Remainder of division.
-	/// **See also:** Documentation for [std::remainder](https://en.cppreference.com/w/cpp/numeric/math/remainder).
-	/// \param x first operand
-	/// \param y second operand
-	/// \return remainder of floating-point division.
-	/// \exception FE_INVALID if \a x is infinite or \a y is 0 or if \a x or \a y is signaling NaN
-	inline half remainder(half x, half y)
+	/// Convert array of single-precision values to half-precision with stochastic rounding.
+	/// This converts \a n consecutive values one by one using half_cast<half>(float,G&) with a custom random number generator.
+	/// \tparam G type of random number generator
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \param gen generator producing 32 uniformly distributed random bits per call
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<typename G> void convert(const float *src, half *dst, std::size_t n, G &gen)
 	{
-		unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, sign = x.data_ & 0x8000;
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
-										(absx==0x7C00) ? detail::invalid() : x.data_);
-		if(!absy)
-			return half(detail::binary, detail::invalid());
-		if(absx == absy)
-			return half(detail::binary, sign);
-		return half(detail::binary, sign^detail::mod<false,true>(absx, absy));
+		for(std::size_t i=0; i<n; ++i)
+			dst[i] = half_cast<half>(src[i], gen);
 	}
 
-	/// Remainder of division.
-	/// **See also:** Documentation for [std::remquo](https://en.cppreference.com/w/cpp/numeric/math/remquo).
-	/// \param x first operand
-	/// \param y second operand
-	/// \param quo address to store some bits of quotient at
-	/// \return remainder of floating-point division.
-	/// \exception FE_INVALID if \a x is infinite or \a y is 0 or if \a x or \a y is signaling NaN
-	inline half remquo(half x, half y, int *quo)
+	/// Convert array of single-precision values to half-precision with stochastic rounding and conversion policies.
+	/// This converts \a n consecutive values one by one using half_cast<half,P>(float,G&) with a custom random number generator.
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \tparam G type of random number generator
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \param gen generator producing 32 uniformly distributed random bits per call
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<unsigned int P,typename G> void convert(const float *src, half *dst, std::size_t n, G &gen)
 	{
-		unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, value = x.data_ & 0x8000;
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
-										(absx==0x7C00) ? detail::invalid() : (*quo = 0, x.data_));
-		if(!absy)
-			return half(detail::binary, detail::invalid());
-		bool qsign = ((value^y.data_)&0x8000) != 0;
-		int q = 1;
-		if(absx != absy)
-			value ^= detail::mod<true, true>(absx, absy, &q);
-		return *quo = qsign ? -q : q, half(detail::binary, value);
+		for(std::size_t i=0; i<n; ++i)
+			dst[i] = half_cast<half,P>(src[i], gen);
 	}
 
-	/// Fused multiply add.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::fma](https://en.cppreference.com/w/cpp/numeric/math/fma).
-	/// \param x first operand
-	/// \param y second operand
-	/// \param z third operand
-	/// \return ( \a x * \a y ) + \a z rounded as one operation.
-	/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
-	inline half fma(half x, half y, half z)
+	/// Convert array of integers to half-precision.
+	/// This converts \a n consecutive values using the default rounding mode, with the results being identical to converting each 
+	/// value separately. But whole blocks of values are converted at once using the [selected instruction sets](\ref simd_level), 
+	/// making this much faster for large arrays.
+	/// \tparam T type to convert from (builtin integer type)
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	template<typename T> void convert(const T *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		detail::internal_t fx = detail::half2float<detail::internal_t>(x.data_), fy = detail::half2float<detail::internal_t>(y.data_), fz = detail::half2float<detail::internal_t>(z.data_);
-		#if HALF_ENABLE_CPP11_CMATH && FP_FAST_FMA
-			return half(detail::binary, detail::float2half<half::round_style>(std::fma(fx, fy, fz)));
-		#else
-			return half(detail::binary, detail::float2half<half::round_style>(fx*fy+fz));
-		#endif
-	#else
-		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, absz = z.data_ & 0x7FFF, exp = -15;
-		unsigned int sign = (x.data_^y.data_) & 0x8000;
-		bool sub = ((sign^z.data_)&0x8000) != 0;
-		if(absx >= 0x7C00 || absy >= 0x7C00 || absz >= 0x7C00)
-			return	(absx>0x7C00 || absy>0x7C00 || absz>0x7C00) ? half(detail::binary, detail::signal(x.data_, y.data_, z.data_)) :
-					(absx==0x7C00) ? half(detail::binary, (!absy || (sub && absz==0x7C00)) ? detail::invalid() : (sign|0x7C00)) :
-					(absy==0x7C00) ? half(detail::binary, (!absx || (sub && absz==0x7C00)) ? detail::invalid() : (sign|0x7C00)) : z;
-		if(!absx || !absy)
-			return absz ? z : half(detail::binary, (half::round_style==std::round_toward_neg_infinity) ? (z.data_|sign) : (z.data_&sign));
-		for(; absx<0x400; absx<<=1,--exp) ;
-		for(; absy<0x400; absy<<=1,--exp) ;
-		detail::uint32 m = static_cast<detail::uint32>((absx&0x3FF)|0x400) * static_cast<detail::uint32>((absy&0x3FF)|0x400);
-		int i = m >> 21;
-		exp += (absx>>10) + (absy>>10) + i;
-		m <<= 3 - i;
-		if(absz)
-		{
-			int expz = 0;
-			for(; absz<0x400; absz<<=1,--expz) ;
-			expz += absz >> 10;
-			detail::uint32 mz = static_cast<detail::uint32>((absz&0x3FF)|0x400) << 13;
-			if(expz > exp || (expz == exp && mz > m))
-			{
-				std::swap(m, mz);
-				std::swap(exp, expz);
-				if(sub)
-					sign = z.data_ & 0x8000;
-			}
-			int d = exp - expz;
-			mz = (d<23) ? ((mz>>d)|((mz&((static_cast<detail::uint32>(1)<<d)-1))!=0)) : 1;
-			if(sub)
-			{
-				m = m - mz;
-				if(!m)
-					return half(detail::binary, static_cast<unsigned>(half::round_style==std::round_toward_neg_infinity)<<15);
-				for(; m<0x800000; m<<=1,--exp) ;
-			}
-			else
-			{
-				m += mz;
-				i = m >> 24;
-				m = (m>>i) | (m&i);
-				exp += i;
-			}
-		}
-		if(exp > 30)
-			return half(detail::binary, detail::overflow<half::round_style>(sign));
-		else if(exp < -10)
-			return half(detail::binary, detail::underflow<half::round_style>(sign));
-		return half(detail::binary, detail::fixed2half<half::round_style,23,false,false,false>(m, exp-1, sign));
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(std::numeric_limits<T>::is_integer, "batch conversion from non-integer type unsupported");
+	#endif
+		detail::int2half_n<(std::float_round_style)(HALF_ROUND_STYLE),policy_none>(src, reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Convert array of integers to half-precision.
+	/// This converts \a n consecutive values using the specified rounding mode, with the results being identical to 
+	/// half_cast<half,R>() of each value. But whole blocks of values are converted at once using the 
+	/// [selected instruction sets](\ref simd_level).
+	/// \tparam R rounding mode to use.
+	/// \tparam T type to convert from (builtin integer type)
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R,typename T> void convert(const T *src, half *dst, std::size_t n)
+	{
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(std::numeric_limits<T>::is_integer, "batch conversion from non-integer type unsupported");
 	#endif
+		detail::int2half_n<R,policy_none>(src, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Maximum of half expressions.
-	/// **See also:** Documentation for [std::fmax](https://en.cppreference.com/w/cpp/numeric/math/fmax).
-	/// \param x first operand
-	/// \param y second operand
-	/// \return maximum of operands, ignoring quiet NaNs
-	/// \exception FE_INVALID if \a x or \a y is signaling NaN
-	inline HALF_CONSTEXPR_NOERR half fmax(half x, half y)
+	/// Convert array of integers to half-precision with conversion policies.
+	/// This converts \a n consecutive values using the specified rounding mode and [conversion policies](\ref conversion_policy), 
+	/// with the results being identical to half_cast<half,R,P>() of each value.
+	/// \tparam R rounding mode to use.
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \tparam T type to convert from (builtin integer type)
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R,unsigned int P,typename T> void convert(const T *src, half *dst, std::size_t n)
 	{
-		return half(detail::binary, (!isnan(y) && (isnan(x) || (x.data_^(0x8000|(0x8000-(x.data_>>15)))) < 
-			(y.data_^(0x8000|(0x8000-(y.data_>>15)))))) ? detail::select(y.data_, x.data_) : detail::select(x.data_, y.data_));
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(std::numeric_limits<T>::is_integer, "batch conversion from non-integer type unsupported");
+	#endif
+		detail::int2half_n<R,P>(src, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Minimum of half expressions.
-	/// **See also:** Documentation for [std::fmin](https://en.cppreference.com/w/cpp/numeric/math/fmin).
-	/// \param x first operand
-	/// \param y second operand
-	/// \return minimum of operands, ignoring quiet NaNs
-	/// \exception FE_INVALID if \a x or \a y is signaling NaN
-	inline HALF_CONSTEXPR_NOERR half fmin(half x, half y)
+	/// Convert array of half-precision values to single-precision.
+	/// This converts \a n consecutive values, with the results being identical to converting each value separately. But whole 
+	/// blocks of values are converted at once using the [selected instruction sets](\ref simd_level), making this much faster 
+	/// for large arrays. Like with the F16C instructions used for single values, signaling NaNs might be converted to quiet NaNs.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	inline void convert(const half *src, float *dst, std::size_t n)
 	{
-		return half(detail::binary, (!isnan(y) && (isnan(x) || (x.data_^(0x8000|(0x8000-(x.data_>>15)))) >
-			(y.data_^(0x8000|(0x8000-(y.data_>>15)))))) ? detail::select(y.data_, x.data_) : detail::select(x.data_, y.data_));
+		detail::half2float_n(reinterpret_cast<const detail::uint16*>(src), dst, n);
 	}
 
-	/// Positive difference.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::fdim](https://en.cppreference.com/w/cpp/numeric/math/fdim).
-	/// \param x first operand
-	/// \param y second operand
-	/// \return \a x - \a y or 0 if difference negative
-	/// \exception FE_... according to operator-(half,half)
-	inline half fdim(half x, half y)
+	/// Convert array of half-precision values to double-precision.
+	/// This converts \a n consecutive values, with the results being identical to converting each value separately. But whole 
+	/// blocks of values are converted at once using the [selected instruction sets](\ref simd_level), making this much faster 
+	/// for large arrays. Signaling NaNs might be converted to quiet NaNs.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	inline void convert(const half *src, double *dst, std::size_t n)
 	{
-		if(isnan(x) || isnan(y))
-			return half(detail::binary, detail::signal(x.data_, y.data_));
-		return (x.data_^(0x8000|(0x8000-(x.data_>>15)))) <= (y.data_^(0x8000|(0x8000-(y.data_>>15)))) ? half(detail::binary, 0) : (x-y);
+		detail::half2float_n(reinterpret_cast<const detail::uint16*>(src), dst, n);
 	}
 
-	/// Get NaN value.
-	/// **See also:** Documentation for [std::nan](https://en.cppreference.com/w/cpp/numeric/math/nan).
-	/// \param arg string code
-	/// \return quiet NaN
-	inline half nanh(const char *arg)
+	/// Convert array of half-precision values to extended precision.
+	/// This converts \a n consecutive values, with the results being identical to converting each value separately. But whole 
+	/// blocks of values are converted at once using the [selected instruction sets](\ref simd_level), making this much faster 
+	/// for large arrays. Signaling NaNs might be converted to quiet NaNs.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	inline void convert(const half *src, long double *dst, std::size_t n)
 	{
-		unsigned int value = 0x7FFF;
-		while(*arg)
-			value ^= static_cast<unsigned>(*arg++) & 0xFF;
-		return half(detail::binary, value);
+		detail::half2float_n(reinterpret_cast<const detail::uint16*>(src), dst, n);
 	}
 
-	/// \}
-	/// \anchor exponential
-	/// \name Exponential functions
-	/// \{
+	/// Convert array of half-precision values to integers.
+	/// This converts \a n consecutive values using the default rounding mode, with the results being identical to 
+	/// half_cast<T>() of each value, including the results and exceptions for values not representable in \a T. But whole 
+	/// blocks of values are converted at once using the [selected instruction sets](\ref simd_level), making this much faster 
+	/// for large arrays.
+	/// \tparam T type to convert to (builtin integer type)
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_INVALID if a value is not representable in type \a T
+	/// \exception FE_INEXACT if values had to be rounded
+	template<typename T> void convert(const half *src, T *dst, std::size_t n)
+	{
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(std::numeric_limits<T>::is_integer, "batch conversion to non-integer type unsupported");
+	#endif
+		detail::half2int_n<(std::float_round_style)(HALF_ROUND_STYLE)>(reinterpret_cast<const detail::uint16*>(src), dst, n);
+	}
 
-	/// Exponential function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::exp](https://en.cppreference.com/w/cpp/numeric/math/exp).
-	/// \param arg function argument
-	/// \return e raised to \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half exp(half arg)
+	/// Convert array of half-precision values to integers.
+	/// This converts \a n consecutive values using the specified rounding mode, with the results being identical to 
+	/// half_cast<T,R>() of each value, including the results and exceptions for values not representable in \a T. But whole 
+	/// blocks of values are converted at once using the [selected instruction sets](\ref simd_level).
+	/// \tparam R rounding mode to use.
+	/// \tparam T type to convert to (builtin integer type)
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_INVALID if a value is not representable in type \a T
+	/// \exception FE_INEXACT if values had to be rounded
+	template<std::float_round_style R,typename T> void convert(const half *src, T *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::exp(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, e = (abs>>10) + (abs<=0x3FF), exp;
-		if(!abs)
-			return half(detail::binary, 0x3C00);
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? (0x7C00&((arg.data_>>15)-1U)) : detail::signal(arg.data_));
-		if(abs >= 0x4C80)
-			return half(detail::binary, (arg.data_&0x8000) ? detail::underflow<half::round_style>() : detail::overflow<half::round_style>());
-		detail::uint32 m = detail::multiply64(static_cast<detail::uint32>((abs&0x3FF)+((abs>0x3FF)<<10))<<21, 0xB8AA3B29);
-		if(e < 14)
-		{
-			exp = 0;
-			m >>= 14 - e;
-		}
-		else
-		{
-			exp = m >> (45-e);
-			m = (m<<(e-14)) & 0x7FFFFFFF;
-		}
-		return half(detail::binary, detail::exp2_post<half::round_style>(m, exp, (arg.data_&0x8000)!=0, 0, 26));
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(std::numeric_limits<T>::is_integer, "batch conversion to non-integer type unsupported");
 	#endif
+		detail::half2int_n<R>(reinterpret_cast<const detail::uint16*>(src), dst, n);
 	}
 
-	/// Binary exponential.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::exp2](https://en.cppreference.com/w/cpp/numeric/math/exp2).
-	/// \param arg function argument
-	/// \return 2 raised to \a arg
-	/// \exception FE_INVALID for signaling NaN
+	/// Convert array of single-precision values to half-precision in parallel.
+	/// This works like convert(const float*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half exp2(half arg)
+	inline void convert(const parallel_policy &policy, const float *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::exp2(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, e = (abs>>10) + (abs<=0x3FF), exp = (abs&0x3FF) + ((abs>0x3FF)<<10);
-		if(!abs)
-			return half(detail::binary, 0x3C00);
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? (0x7C00&((arg.data_>>15)-1U)) : detail::signal(arg.data_));
-		if(abs >= 0x4E40)
-			return half(detail::binary, (arg.data_&0x8000) ? detail::underflow<half::round_style>() : detail::overflow<half::round_style>());
-		return half(detail::binary, detail::exp2_post<half::round_style>(
-			(static_cast<detail::uint32>(exp)<<(6+e))&0x7FFFFFFF, exp>>(25-e), (arg.data_&0x8000)!=0, 0, 28));
-	#endif
+		detail::float2half_n<(std::float_round_style)(HALF_ROUND_STYLE),policy_none>(src, 
+			reinterpret_cast<detail::uint16*>(dst), n, policy.threads());
 	}
 
-	/// Exponential minus one.
-	/// This function may be 1 ULP off the correctly rounded exact result in <0.05% of inputs for `std::round_to_nearest` 
-	/// and in <1% of inputs for any other rounding mode.
-	///
-	/// **See also:** Documentation for [std::expm1](https://en.cppreference.com/w/cpp/numeric/math/expm1).
-	/// \param arg function argument
-	/// \return e raised to \a arg and subtracted by 1
-	/// \exception FE_INVALID for signaling NaN
+	/// Convert array of single-precision values to half-precision in parallel.
+	/// This works like convert<R,P>(const float*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam R rounding mode to use.
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half expm1(half arg)
+	template<std::float_round_style R,unsigned int P> void convert(const parallel_policy &policy, const float *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::expm1(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000, e = (abs>>10) + (abs<=0x3FF), exp;
-		if(!abs)
-			return arg;
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? (0x7C00+(sign>>1)) : detail::signal(arg.data_));
-		if(abs >= 0x4A00)
-			return half(detail::binary, (arg.data_&0x8000) ? detail::rounded<half::round_style,true>(0xBBFF, 1, 1) : detail::overflow<half::round_style>());
-		detail::uint32 m = detail::multiply64(static_cast<detail::uint32>((abs&0x3FF)+((abs>0x3FF)<<10))<<21, 0xB8AA3B29);
-		if(e < 14)
-		{
-			exp = 0;
-			m >>= 14 - e;
-		}
-		else
-		{
-			exp = m >> (45-e);
-			m = (m<<(e-14)) & 0x7FFFFFFF;
-		}
-		m = detail::exp2(m);
-		if(sign)
-		{
-			int s = 0;
-			if(m > 0x80000000)
-			{
-				++exp;
-				m = detail::divide64(0x80000000, m, s);
-			}
-			m = 0x80000000 - ((m>>exp)|((m&((static_cast<detail::uint32>(1)<<exp)-1))!=0)|s);
-			exp = 0;
-		}
-		else
-			m -= (exp<31) ? (0x80000000>>exp) : 1;
-		for(exp+=14; m<0x80000000 && exp; m<<=1,--exp) ;
-		if(exp > 29)
-			return half(detail::binary, detail::overflow<half::round_style>());
-		return half(detail::binary, detail::rounded<half::round_style,true>(sign+(exp<<10)+(m>>21), (m>>20)&1, (m&0xFFFFF)!=0));
-	#endif
+		detail::float2half_n<R,P>(src, reinterpret_cast<detail::uint16*>(dst), n, policy.threads());
 	}
 
-	/// Natural logarithm.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::log](https://en.cppreference.com/w/cpp/numeric/math/log).
-	/// \param arg function argument
-	/// \return logarithm of \a arg to base e
-	/// \exception FE_INVALID for signaling NaN or negative argument
-	/// \exception FE_DIVBYZERO for 0
+	/// Convert array of single-precision values to half-precision in parallel.
+	/// This works like convert<R>(const float*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam R rounding mode to use.
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half log(half arg)
+	template<std::float_round_style R> void convert(const parallel_policy &policy, const float *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::log(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp = -15;
-		if(!abs)
-			return half(detail::binary, detail::pole(0x8000));
-		if(arg.data_ & 0x8000)
-			return half(detail::binary, (arg.data_<=0xFC00) ? detail::invalid() : detail::signal(arg.data_));
-		if(abs >= 0x7C00)
-			return (abs==0x7C00) ? arg : half(detail::binary, detail::signal(arg.data_));
-		for(; abs<0x400; abs<<=1,--exp) ;
-		exp += abs >> 10;
-		return half(detail::binary, detail::log2_post<half::round_style,0xB8AA3B2A>(
-			detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, 27)+8, exp, 17));
-	#endif
+		convert<R,policy_none>(policy, src, dst, n);
 	}
 
-	/// Common logarithm.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::log10](https://en.cppreference.com/w/cpp/numeric/math/log10).
-	/// \param arg function argument
-	/// \return logarithm of \a arg to base 10
-	/// \exception FE_INVALID for signaling NaN or negative argument
-	/// \exception FE_DIVBYZERO for 0
+	/// Convert array of double-precision values to half-precision in parallel.
+	/// This works like convert(const double*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half log10(half arg)
+	inline void convert(const parallel_policy &policy, const double *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::log10(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp = -15;
-		if(!abs)
-			return half(detail::binary, detail::pole(0x8000));
-		if(arg.data_ & 0x8000)
-			return half(detail::binary, (arg.data_<=0xFC00) ? detail::invalid() : detail::signal(arg.data_));
-		if(abs >= 0x7C00)
-			return (abs==0x7C00) ? arg : half(detail::binary, detail::signal(arg.data_));
-		switch(abs)
-		{
-			case 0x4900: return half(detail::binary, 0x3C00);
-			case 0x5640: return half(detail::binary, 0x4000);
-			case 0x63D0: return half(detail::binary, 0x4200);
-			case 0x70E2: return half(detail::binary, 0x4400);
-		}
-		for(; abs<0x400; abs<<=1,--exp) ;
-		exp += abs >> 10;
-		return half(detail::binary, detail::log2_post<half::round_style,0xD49A784C>(
-			detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, 27)+8, exp, 16));
-	#endif
+		detail::float2half_n<(std::float_round_style)(HALF_ROUND_STYLE),policy_none>(src, 
+			reinterpret_cast<detail::uint16*>(dst), n, policy.threads());
 	}
 
-	/// Binary logarithm.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::log2](https://en.cppreference.com/w/cpp/numeric/math/log2).
-	/// \param arg function argument
-	/// \return logarithm of \a arg to base 2
-	/// \exception FE_INVALID for signaling NaN or negative argument
-	/// \exception FE_DIVBYZERO for 0
+	/// Convert array of double-precision values to half-precision in parallel.
+	/// This works like convert<R,P>(const double*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam R rounding mode to use.
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half log2(half arg)
+	template<std::float_round_style R,unsigned int P> void convert(const parallel_policy &policy, const double *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::log2(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp = -15, s = 0;
-		if(!abs)
-			return half(detail::binary, detail::pole(0x8000));
-		if(arg.data_ & 0x8000)
-			return half(detail::binary, (arg.data_<=0xFC00) ? detail::invalid() : detail::signal(arg.data_));
-		if(abs >= 0x7C00)
-			return (abs==0x7C00) ? arg : half(detail::binary, detail::signal(arg.data_));
-		if(abs == 0x3C00)
-			return half(detail::binary, 0);
-		for(; abs<0x400; abs<<=1,--exp) ;
-		exp += (abs>>10);
-		if(!(abs&0x3FF))
-		{
-			unsigned int value = static_cast<unsigned>(exp<0) << 15, m = std::abs(exp) << 6;
-			for(exp=18; m<0x400; m<<=1,--exp) ;
-			return half(detail::binary, value+(exp<<10)+m);
-		}
-		detail::uint32 ilog = exp, sign = detail::sign_mask(ilog), m = 
-			(((ilog<<27)+(detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, 28)>>4))^sign) - sign;
-		if(!m)
-			return half(detail::binary, 0);
-		for(exp=14; m<0x8000000 && exp; m<<=1,--exp) ;
-		for(; m>0xFFFFFFF; m>>=1,++exp)
-			s |= m & 1;
-		return half(detail::binary, detail::fixed2half<half::round_style,27,false,false,true>(m, exp, sign&0x8000, s));
-	#endif
+		detail::float2half_n<R,P>(src, reinterpret_cast<detail::uint16*>(dst), n, policy.threads());
 	}
 
-	/// Natural logarithm plus one.
-	/// This function may be 1 ULP off the correctly rounded exact result in <0.05% of inputs for `std::round_to_nearest` 
-	/// and in ~1% of inputs for any other rounding mode.
-	///
-	/// **See also:** Documentation for [std::log1p](https://en.cppreference.com/w/cpp/numeric/math/log1p).
-	/// \param arg function argument
-	/// \return logarithm of \a arg plus 1 to base e
-	/// \exception FE_INVALID for signaling NaN or argument <-1
-	/// \exception FE_DIVBYZERO for -1
+	/// Convert array of double-precision values to half-precision in parallel.
+	/// This works like convert<R>(const double*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam R rounding mode to use.
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half log1p(half arg)
+	template<std::float_round_style R> void convert(const parallel_policy &policy, const double *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::log1p(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		if(arg.data_ >= 0xBC00)
-			return half(detail::binary, (arg.data_==0xBC00) ? detail::pole(0x8000) : (arg.data_<=0xFC00) ? detail::invalid() : detail::signal(arg.data_));
-		int abs = arg.data_ & 0x7FFF, exp = -15;
-		if(!abs || abs >= 0x7C00)
-			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		for(; abs<0x400; abs<<=1,--exp) ;
-		exp += abs >> 10;
-		detail::uint32 m = static_cast<detail::uint32>((abs&0x3FF)|0x400) << 20;
-		if(arg.data_ & 0x8000)
-		{
-			m = 0x40000000 - (m>>-exp);
-			for(exp=0; m<0x40000000; m<<=1,--exp) ;
-		}
-		else
-		{
-			if(exp < 0)
-			{
-				m = 0x40000000 + (m>>-exp);
-				exp = 0;
-			}
-			else
-			{
-				m += 0x40000000 >> exp;
-				int i = m >> 31;
-				m >>= i;
-				exp += i;
-			}
-		}
-		return half(detail::binary, detail::log2_post<half::round_style,0xB8AA3B2A>(detail::log2(m), exp, 17));
+		convert<R,policy_none>(policy, src, dst, n);
+	}
+
+	/// Convert array of integers to half-precision in parallel.
+	/// This works like convert<R,P>(const T*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam R rounding mode to use.
+	/// \tparam P conversion policies to apply (combination of conversion_policy values)
+	/// \tparam T type to convert from (builtin integer type)
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R,unsigned int P,typename T> void convert(const parallel_policy &policy, const T *src, half *dst, std::size_t n)
+	{
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(std::numeric_limits<T>::is_integer, "batch conversion from non-integer type unsupported");
+	#endif
+		detail::int2half_n<R,P>(src, reinterpret_cast<detail::uint16*>(dst), n, policy.threads());
+	}
+
+	/// Convert array of integers to half-precision in parallel.
+	/// This works like convert<R>(const T*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam R rounding mode to use.
+	/// \tparam T type to convert from (builtin integer type)
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	template<std::float_round_style R,typename T> void convert(const parallel_policy &policy, const T *src, half *dst, std::size_t n)
+	{
+		convert<R,policy_none>(policy, src, dst, n);
+	}
+
+	/// Convert array of integers to half-precision in parallel.
+	/// This works like convert(const T*,half*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam T type to convert from (builtin integer type)
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+	template<typename T> void convert(const parallel_policy &policy, const T *src, half *dst, std::size_t n)
+	{
+		convert<(std::float_round_style)(HALF_ROUND_STYLE),policy_none>(policy, src, dst, n);
+	}
+
+	/// Convert array of half-precision values to single-precision in parallel.
+	/// This works like convert(const half*,float*,std::size_t) but uses multiple threads for large arrays.
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	inline void convert(const parallel_policy &policy, const half *src, float *dst, std::size_t n)
+	{
+		detail::half2float_n(reinterpret_cast<const detail::uint16*>(src), dst, n, policy.threads());
+	}
+
+	/// Convert array of half-precision values to double-precision in parallel.
+	/// This works like convert(const half*,double*,std::size_t) but uses multiple threads for large arrays.
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	inline void convert(const parallel_policy &policy, const half *src, double *dst, std::size_t n)
+	{
+		detail::half2float_n(reinterpret_cast<const detail::uint16*>(src), dst, n, policy.threads());
+	}
+
+	/// Convert array of half-precision values to extended precision.
+	/// This works like convert(const half*,long double*,std::size_t), which is always run on the calling thread.
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	inline void convert(const parallel_policy&, const half *src, long double *dst, std::size_t n)
+	{
+		detail::half2float_n(reinterpret_cast<const detail::uint16*>(src), dst, n);
+	}
+
+	/// Convert array of half-precision values to integers in parallel.
+	/// This works like convert<R>(const half*,T*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam R rounding mode to use.
+	/// \tparam T type to convert to (builtin integer type)
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_INVALID if a value is not representable in type \a T
+	/// \exception FE_INEXACT if values had to be rounded
+	template<std::float_round_style R,typename T> void convert(const parallel_policy &policy, const half *src, T *dst, std::size_t n)
+	{
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(std::numeric_limits<T>::is_integer, "batch conversion to non-integer type unsupported");
 	#endif
+		detail::half2int_n<R>(reinterpret_cast<const detail::uint16*>(src), dst, n, policy.threads());
+	}
+
+	/// Convert array of half-precision values to integers in parallel.
+	/// This works like convert(const half*,T*,std::size_t) but uses multiple threads for large arrays.
+	/// \tparam T type to convert to (builtin integer type)
+	/// \param policy parallel execution policy
+	/// \param src array of values to convert
+	/// \param dst array to store converted values at (should not overlap \a src)
+	/// \param n number of values to convert
+	/// \exception FE_INVALID if a value is not representable in type \a T
+	/// \exception FE_INEXACT if values had to be rounded
+	template<typename T> void convert(const parallel_policy &policy, const half *src, T *dst, std::size_t n)
+	{
+		convert<(std::float_round_style)(HALF_ROUND_STYLE)>(policy, src, dst, n);
 	}
 
 	/// \}
-	/// \anchor power
-	/// \name Power functions
+	/// \anchor batch_arithmetic
+	/// \name Batch arithmetic
 	/// \{
 
-	/// Square root.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::sqrt](https://en.cppreference.com/w/cpp/numeric/math/sqrt).
-	/// \param arg function argument
-	/// \return square root of \a arg
-	/// \exception FE_INVALID for signaling NaN and negative arguments
-	/// \exception FE_INEXACT according to rounding
-	inline half sqrt(half arg)
+	/// Add arrays of half-precision values.
+	/// This computes `dst[i] = x[i] + y[i]` for \a n consecutive values, with the results and exceptions being identical to those 
+	/// of the addition operator. But whole blocks of values are computed at once in single-precision using the 
+	/// [selected instruction sets](\ref simd_level), making this much faster for large arrays.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a x or \a y, but should not overlap them otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if adding infinities with different signs or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void add(const half *x, const half *y, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::sqrt(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp = 15;
-		if(!abs || arg.data_ >= 0x7C00)
-			return half(detail::binary, (abs>0x7C00) ? detail::signal(arg.data_) : (arg.data_>0x8000) ? detail::invalid() : arg.data_);
-		for(; abs<0x400; abs<<=1,--exp) ;
-		detail::uint32 r = static_cast<detail::uint32>((abs&0x3FF)|0x400) << 10, m = detail::sqrt<20>(r, exp+=abs>>10);
-		return half(detail::binary, detail::rounded<half::round_style,false>((exp<<10)+(m&0x3FF), r>m, r!=0));
-	#endif
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'+',0>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Inverse square root.
-	/// This function is exact to rounding for all rounding modes and thus generally more accurate than directly computing 
-	/// 1 / sqrt(\a arg) in half-precision, in addition to also being faster.
-	/// \param arg function argument
-	/// \return reciprocal of square root of \a arg
-	/// \exception FE_INVALID for signaling NaN and negative arguments
-	/// \exception FE_INEXACT according to rounding
-	inline half rsqrt(half arg)
+	/// Add array of half-precision values and single value.
+	/// This works like add(const half*,const half*,half*,std::size_t) but uses the same second operand for all values.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param dst array to store results at (may be identical to \a x, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if adding infinities with different signs or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void add(const half *x, half y, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(detail::internal_t(1)/std::sqrt(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		unsigned int abs = arg.data_ & 0x7FFF, bias = 0x4000;
-		if(!abs || arg.data_ >= 0x7C00)
-			return half(detail::binary,	(abs>0x7C00) ? detail::signal(arg.data_) : (arg.data_>0x8000) ?
-										detail::invalid() : !abs ? detail::pole(arg.data_&0x8000) : 0);
-		for(; abs<0x400; abs<<=1,bias-=0x400) ;
-		unsigned int frac = (abs+=bias) & 0x7FF;
-		if(frac == 0x400)
-			return half(detail::binary, 0x7A00-(abs>>1));
-		if((half::round_style == std::round_to_nearest && (frac == 0x3FE || frac == 0x76C)) ||
-		   (half::round_style != std::round_to_nearest && (frac == 0x15A || frac == 0x3FC || frac == 0x401 || frac == 0x402 || frac == 0x67B)))
-			return pow(arg, half(detail::binary, 0xB800));
-		detail::uint32 f = 0x17376 - abs, mx = (abs&0x3FF) | 0x400, my = ((f>>1)&0x3FF) | 0x400, mz = my * my;
-		int expy = (f>>11) - 31, expx = 32 - (abs>>10), i = mz >> 21;
-		for(mz=0x60000000-(((mz>>i)*mx)>>(expx-2*expy-i)); mz<0x40000000; mz<<=1,--expy) ;
-		i = (my*=mz>>10) >> 31;
-		expy += i;
-		my = (my>>(20+i)) + 1;
-		i = (mz=my*my) >> 21;
-		for(mz=0x60000000-(((mz>>i)*mx)>>(expx-2*expy-i)); mz<0x40000000; mz<<=1,--expy) ;
-		i = (my*=(mz>>10)+1) >> 31;
-		return half(detail::binary, detail::fixed2half<half::round_style,30,false,false,true>(my>>i, expy+i+14));
-	#endif
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'+',2>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(&y), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Add single value and array of half-precision values.
+	/// This works like add(const half*,const half*,half*,std::size_t) but uses the same first operand for all values.
+	/// \param x first operand
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a y, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if adding infinities with different signs or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void add(half x, const half *y, half *dst, std::size_t n)
+	{
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'+',1>(reinterpret_cast<const detail::uint16*>(&x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Cubic root.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::cbrt](https://en.cppreference.com/w/cpp/numeric/math/cbrt).
-	/// \param arg function argument
-	/// \return cubic root of \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_INEXACT according to rounding
-	inline half cbrt(half arg)
+	/// Subtract arrays of half-precision values.
+	/// This computes `dst[i] = x[i] - y[i]` for \a n consecutive values, with the results and exceptions being identical to those 
+	/// of the subtraction operator. But whole blocks of values are computed at once in single-precision using the 
+	/// [selected instruction sets](\ref simd_level), making this much faster for large arrays.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a x or \a y, but should not overlap them otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if subtracting infinities with equal signs or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void sub(const half *x, const half *y, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::cbrt(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp = -15;
-		if(!abs || abs == 0x3C00 || abs >= 0x7C00)
-			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		for(; abs<0x400; abs<<=1, --exp);
-		detail::uint32 ilog = exp + (abs>>10), sign = detail::sign_mask(ilog), f, m = 
-			(((ilog<<27)+(detail::log2(static_cast<detail::uint32>((abs&0x3FF)|0x400)<<20, 24)>>4))^sign) - sign;
-		for(exp=2; m<0x80000000; m<<=1,--exp) ;
-		m = detail::multiply64(m, 0xAAAAAAAB);
-		int i = m >> 31, s;
-		exp += i;
-		m <<= 1 - i;
-		if(exp < 0)
-		{
-			f = m >> -exp;
-			exp = 0;
-		}
-		else
-		{
-			f = (m<<exp) & 0x7FFFFFFF;
-			exp = m >> (31-exp);
-		}
-		m = detail::exp2(f, (half::round_style==std::round_to_nearest) ? 29 : 26);
-		if(sign)
-		{
-			if(m > 0x80000000)
-			{
-				m = detail::divide64(0x80000000, m, s);
-				++exp;
-			}
-			exp = -exp;
-		}
-		return half(detail::binary, (half::round_style==std::round_to_nearest) ?
-			detail::fixed2half<half::round_style,31,false,false,false>(m, exp+14, arg.data_&0x8000) :
-			detail::fixed2half<half::round_style,23,false,false,false>((m+0x80)>>8, exp+14, arg.data_&0x8000));
-	#endif
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'-',0>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Hypotenuse function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::hypot](https://en.cppreference.com/w/cpp/numeric/math/hypot).
-	/// \param x first argument
-	/// \param y second argument
-	/// \return square root of sum of squares without internal over- or underflows
-	/// \exception FE_INVALID if \a x or \a y is signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of the final square root
-	inline half hypot(half x, half y)
+	/// Subtract array of half-precision values and single value.
+	/// This works like sub(const half*,const half*,half*,std::size_t) but uses the same second operand for all values.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param dst array to store results at (may be identical to \a x, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if subtracting infinities with equal signs or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void sub(const half *x, half y, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		detail::internal_t fx = detail::half2float<detail::internal_t>(x.data_), fy = detail::half2float<detail::internal_t>(y.data_);
-		#if HALF_ENABLE_CPP11_CMATH
-			return half(detail::binary, detail::float2half<half::round_style>(std::hypot(fx, fy)));
-		#else
-			return half(detail::binary, detail::float2half<half::round_style>(std::sqrt(fx*fx+fy*fy)));
-		#endif
-	#else
-		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, expx = 0, expy = 0;
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-			return half(detail::binary,	(absx==0x7C00) ? detail::select(0x7C00, y.data_) :
-				(absy==0x7C00) ? detail::select(0x7C00, x.data_) : detail::signal(x.data_, y.data_));
-		if(!absx)
-			return half(detail::binary, absy ? detail::check_underflow(absy) : 0);
-		if(!absy)
-			return half(detail::binary, detail::check_underflow(absx));
-		if(absy > absx)
-			std::swap(absx, absy);
-		for(; absx<0x400; absx<<=1,--expx) ;
-		for(; absy<0x400; absy<<=1,--expy) ;
-		detail::uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400;
-		mx *= mx;
-		my *= my;
-		int ix = mx >> 21, iy = my >> 21;
-		expx = 2*(expx+(absx>>10)) - 15 + ix;
-		expy = 2*(expy+(absy>>10)) - 15 + iy;
-		mx <<= 10 - ix;
-		my <<= 10 - iy;
-		int d = expx - expy;
-		my = (d<30) ? ((my>>d)|((my&((static_cast<detail::uint32>(1)<<d)-1))!=0)) : 1;
-		return half(detail::binary, detail::hypot_post<half::round_style>(mx+my, expx));
-	#endif
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'-',2>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(&y), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Hypotenuse function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::hypot](https://en.cppreference.com/w/cpp/numeric/math/hypot).
-	/// \param x first argument
-	/// \param y second argument
-	/// \param z third argument
-	/// \return square root of sum of squares without internal over- or underflows
-	/// \exception FE_INVALID if \a x, \a y or \a z is signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding of the final square root
-	inline half hypot(half x, half y, half z)
+	/// Subtract single value and array of half-precision values.
+	/// This works like sub(const half*,const half*,half*,std::size_t) but uses the same first operand for all values.
+	/// \param x first operand
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a y, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if subtracting infinities with equal signs or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void sub(half x, const half *y, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		detail::internal_t fx = detail::half2float<detail::internal_t>(x.data_), fy = detail::half2float<detail::internal_t>(y.data_), fz = detail::half2float<detail::internal_t>(z.data_);
-		return half(detail::binary, detail::float2half<half::round_style>(std::sqrt(fx*fx+fy*fy+fz*fz)));
-	#else
-		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, absz = z.data_ & 0x7FFF, expx = 0, expy = 0, expz = 0;
-		if(!absx)
-			return hypot(y, z);
-		if(!absy)
-			return hypot(x, z);
-		if(!absz)
-			return hypot(x, y);
-		if(absx >= 0x7C00 || absy >= 0x7C00 || absz >= 0x7C00)
-			return half(detail::binary,	(absx==0x7C00) ? detail::select(0x7C00, detail::select(y.data_, z.data_)) :
-										(absy==0x7C00) ? detail::select(0x7C00, detail::select(x.data_, z.data_)) :
-										(absz==0x7C00) ? detail::select(0x7C00, detail::select(x.data_, y.data_)) :
-										detail::signal(x.data_, y.data_, z.data_));
-		if(absz > absy)
-			std::swap(absy, absz);
-		if(absy > absx)
-			std::swap(absx, absy);
-		if(absz > absy)
-			std::swap(absy, absz);
-		for(; absx<0x400; absx<<=1,--expx) ;
-		for(; absy<0x400; absy<<=1,--expy) ;
-		for(; absz<0x400; absz<<=1,--expz) ;
-		detail::uint32 mx = (absx&0x3FF) | 0x400, my = (absy&0x3FF) | 0x400, mz = (absz&0x3FF) | 0x400;
-		mx *= mx;
-		my *= my;
-		mz *= mz;
-		int ix = mx >> 21, iy = my >> 21, iz = mz >> 21;
-		expx = 2*(expx+(absx>>10)) - 15 + ix;
-		expy = 2*(expy+(absy>>10)) - 15 + iy;
-		expz = 2*(expz+(absz>>10)) - 15 + iz;
-		mx <<= 10 - ix;
-		my <<= 10 - iy;
-		mz <<= 10 - iz;
-		int d = expy - expz;
-		mz = (d<30) ? ((mz>>d)|((mz&((static_cast<detail::uint32>(1)<<d)-1))!=0)) : 1;
-		my += mz;
-		if(my & 0x80000000)
-		{
-			my = (my>>1) | (my&1);
-			if(++expy > expx)
-			{
-				std::swap(mx, my);
-				std::swap(expx, expy);
-			}
-		}
-		d = expx - expy;
-		my = (d<30) ? ((my>>d)|((my&((static_cast<detail::uint32>(1)<<d)-1))!=0)) : 1;
-		return half(detail::binary, detail::hypot_post<half::round_style>(mx+my, expx));
-	#endif
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'-',1>(reinterpret_cast<const detail::uint16*>(&x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Power function.
-	/// This function may be 1 ULP off the correctly rounded exact result for any rounding mode in ~0.00025% of inputs.
-	///
-	/// **See also:** Documentation for [std::pow](https://en.cppreference.com/w/cpp/numeric/math/pow).
-	/// \param x base
-	/// \param y exponent
-	/// \return \a x raised to \a y
-	/// \exception FE_INVALID if \a x or \a y is signaling NaN or if \a x is finite an negative and \a y is finite and not integral
-	/// \exception FE_DIVBYZERO if \a x is 0 and \a y is negative
+	/// Multiply arrays of half-precision values.
+	/// This computes `dst[i] = x[i] * y[i]` for \a n consecutive values, with the results and exceptions being identical to those 
+	/// of the multiplication operator. But whole blocks of values are computed at once in single-precision using the 
+	/// [selected instruction sets](\ref simd_level), making this much faster for large arrays.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a x or \a y, but should not overlap them otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if multiplying 0 with infinity or if a value is signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half pow(half x, half y)
+	inline void mul(const half *x, const half *y, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::pow(detail::half2float<detail::internal_t>(x.data_), detail::half2float<detail::internal_t>(y.data_))));
-	#else
-		int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, exp = -15;
-		if(!absy || x.data_ == 0x3C00)
-			return half(detail::binary, detail::select(0x3C00, (x.data_==0x3C00) ? y.data_ : x.data_));
-		bool is_int = absy >= 0x6400 || (absy>=0x3C00 && !(absy&((1<<(25-(absy>>10)))-1)));
-		unsigned int sign = x.data_ & (static_cast<unsigned>((absy<0x6800)&&is_int&&((absy>>(25-(absy>>10)))&1))<<15);
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-			return half(detail::binary,	(absx>0x7C00 || absy>0x7C00) ? detail::signal(x.data_, y.data_) :
-										(absy==0x7C00) ? ((absx==0x3C00) ? 0x3C00 : (!absx && y.data_==0xFC00) ? detail::pole() :
-										(0x7C00&-((y.data_>>15)^(absx>0x3C00)))) : (sign|(0x7C00&((y.data_>>15)-1U))));
-		if(!absx)
-			return half(detail::binary, (y.data_&0x8000) ? detail::pole(sign) : sign);
-		if((x.data_&0x8000) && !is_int)
-			return half(detail::binary, detail::invalid());
-		if(x.data_ == 0xBC00)
-			return half(detail::binary, sign|0x3C00);
-		switch(y.data_)
-		{
-			case 0x3800: return sqrt(x);
-			case 0x3C00: return half(detail::binary, detail::check_underflow(x.data_));
-			case 0x4000: return x * x;
-			case 0xBC00: return half(detail::binary, 0x3C00) / x;
-		}
-		for(; absx<0x400; absx<<=1,--exp) ;
-		detail::uint32 ilog = exp + (absx>>10), msign = detail::sign_mask(ilog), f, m = 
-			(((ilog<<27)+((detail::log2(static_cast<detail::uint32>((absx&0x3FF)|0x400)<<20)+8)>>4))^msign) - msign;
-		for(exp=-11; m<0x80000000; m<<=1,--exp) ;
-		for(; absy<0x400; absy<<=1,--exp) ;
-		m = detail::multiply64(m, static_cast<detail::uint32>((absy&0x3FF)|0x400)<<21);
-		int i = m >> 31;
-		exp += (absy>>10) + i;
-		m <<= 1 - i;
-		if(exp < 0)
-		{
-			f = m >> -exp;
-			exp = 0;
-		}
-		else
-		{
-			f = (m<<exp) & 0x7FFFFFFF;
-			exp = m >> (31-exp);
-		}
-		return half(detail::binary, detail::exp2_post<half::round_style>(f, exp, ((msign&1)^(y.data_>>15))!=0, sign));
-	#endif
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'*',0>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// \}
-	/// \anchor trigonometric
-	/// \name Trigonometric functions
-	/// \{
+	/// Multiply array of half-precision values and single value.
+	/// This works like mul(const half*,const half*,half*,std::size_t) but uses the same second operand for all values.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param dst array to store results at (may be identical to \a x, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if multiplying 0 with infinity or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void mul(const half *x, half y, half *dst, std::size_t n)
+	{
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'*',2>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(&y), reinterpret_cast<detail::uint16*>(dst), n);
+	}
 
-	/// Compute sine and cosine simultaneously.
-	///	This returns the same results as sin() and cos() but is faster than calling each function individually.
-	///
-	/// This function is exact to rounding for all rounding modes.
-	/// \param arg function argument
-	/// \param sin variable to take sine of \a arg
-	/// \param cos variable to take cosine of \a arg
-	/// \exception FE_INVALID for signaling NaN or infinity
+	/// Multiply single value and array of half-precision values.
+	/// This works like mul(const half*,const half*,half*,std::size_t) but uses the same first operand for all values.
+	/// \param x first operand
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a y, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if multiplying 0 with infinity or if a value is signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline void sincos(half arg, half *sin, half *cos)
+	inline void mul(half x, const half *y, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		detail::internal_t f = detail::half2float<detail::internal_t>(arg.data_);
-		*sin = half(detail::binary, detail::float2half<half::round_style>(std::sin(f)));
-		*cos = half(detail::binary, detail::float2half<half::round_style>(std::cos(f)));
-	#else
-		int abs = arg.data_ & 0x7FFF, sign = arg.data_ >> 15, k;
-		if(abs >= 0x7C00)
-			*sin = *cos = half(detail::binary, (abs==0x7C00) ? detail::invalid() : detail::signal(arg.data_));
-		else if(!abs)
-		{
-			*sin = arg;
-			*cos = half(detail::binary, 0x3C00);
-		}
-		else if(abs < 0x2500)
-		{
-			*sin = half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
-			*cos = half(detail::binary, detail::rounded<half::round_style,true>(0x3BFF, 1, 1));
-		}
-		else
-		{
-			if(half::round_style != std::round_to_nearest)
-			{
-				switch(abs)
-				{
-				case 0x48B7:
-					*sin = half(detail::binary, detail::rounded<half::round_style,true>((~arg.data_&0x8000)|0x1D07, 1, 1));
-					*cos = half(detail::binary, detail::rounded<half::round_style,true>(0xBBFF, 1, 1));
-					return;
-				case 0x598C:
-					*sin = half(detail::binary, detail::rounded<half::round_style,true>((arg.data_&0x8000)|0x3BFF, 1, 1));
-					*cos = half(detail::binary, detail::rounded<half::round_style,true>(0x80FC, 1, 1));
-					return;
-				case 0x6A64:
-					*sin = half(detail::binary, detail::rounded<half::round_style,true>((~arg.data_&0x8000)|0x3BFE, 1, 1));
-					*cos = half(detail::binary, detail::rounded<half::round_style,true>(0x27FF, 1, 1));
-					return;
-				case 0x6D8C:
-					*sin = half(detail::binary, detail::rounded<half::round_style,true>((arg.data_&0x8000)|0x0FE6, 1, 1));
-					*cos = half(detail::binary, detail::rounded<half::round_style,true>(0x3BFF, 1, 1));
-					return;
-				}
-			}
-			std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), 28);
-			switch(k & 3)
-			{
-				case 1: sc = std::make_pair(sc.second, -sc.first); break;
-				case 2: sc = std::make_pair(-sc.first, -sc.second); break;
-				case 3: sc = std::make_pair(-sc.second, sc.first); break;
-			}
-			*sin = half(detail::binary, detail::fixed2half<half::round_style,30,true,true,true>((sc.first^-static_cast<detail::uint32>(sign))+sign));
-			*cos = half(detail::binary, detail::fixed2half<half::round_style,30,true,true,true>(sc.second));
-		}
-	#endif
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'*',1>(reinterpret_cast<const detail::uint16*>(&x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Sine function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::sin](https://en.cppreference.com/w/cpp/numeric/math/sin).
-	/// \param arg function argument
-	/// \return sine value of \a arg
-	/// \exception FE_INVALID for signaling NaN or infinity
+	/// Divide arrays of half-precision values.
+	/// This computes `dst[i] = x[i] / y[i]` for \a n consecutive values, with the results and exceptions being identical to those 
+	/// of the division operator. But whole blocks of values are computed at once in single-precision using the 
+	/// [selected instruction sets](\ref simd_level), making this much faster for large arrays.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a x or \a y, but should not overlap them otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if dividing 0s or infinities with each other or if a value is signaling NaN
+	/// \exception FE_DIVBYZERO if dividing finite value by 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void div(const half *x, const half *y, half *dst, std::size_t n)
+	{
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'/',0>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Divide array of half-precision values and single value.
+	/// This works like div(const half*,const half*,half*,std::size_t) but uses the same second operand for all values.
+	/// \param x array of first operands
+	/// \param y second operand
+	/// \param dst array to store results at (may be identical to \a x, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if dividing 0s or infinities with each other or if a value is signaling NaN
+	/// \exception FE_DIVBYZERO if dividing finite value by 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline void div(const half *x, half y, half *dst, std::size_t n)
+	{
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'/',2>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(&y), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Divide single value and array of half-precision values.
+	/// This works like div(const half*,const half*,half*,std::size_t) but uses the same first operand for all values.
+	/// \param x first operand
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a y, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID if dividing 0s or infinities with each other or if a value is signaling NaN
+	/// \exception FE_DIVBYZERO if dividing finite value by 0
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half sin(half arg)
+	inline void div(half x, const half *y, half *dst, std::size_t n)
+	{
+		detail::arithmetic_n<(std::float_round_style)(HALF_ROUND_STYLE),'/',1>(reinterpret_cast<const detail::uint16*>(&x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Fused multiply add of arrays of half-precision values.
+	/// This computes `dst[i] = fma(x[i], y[i], z[i])` for \a n consecutive values, with the results and exceptions being 
+	/// identical to those of fma(). But whole blocks of values are computed at once in single-precision using the 
+	/// [selected instruction sets](\ref simd_level), making this much faster for large arrays.
+	/// \param x array of first factors
+	/// \param y array of second factors
+	/// \param z array of summands
+	/// \param dst array to store results at (may be identical to \a x, \a y or \a z, but should not overlap them otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+	inline void fma_n(const half *x, const half *y, const half *z, half *dst, std::size_t n)
+	{
+		detail::fma_n<(std::float_round_style)(HALF_ROUND_STYLE),0>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<const detail::uint16*>(z), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Scaled addition of arrays of half-precision values.
+	/// This computes `y[i] = fma(a, x[i], y[i])` for \a n consecutive values. It works like 
+	/// fma_n(const half*,const half*,const half*,half*,std::size_t) but uses the same first factor for all values and 
+	/// accumulates into the summands.
+	/// \param a scaling factor
+	/// \param x array of values to scale
+	/// \param y array of values to add to and to store results at (should not overlap \a x unless identical)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+	inline void axpy(half a, const half *x, half *y, std::size_t n)
+	{
+		detail::fma_n<(std::float_round_style)(HALF_ROUND_STYLE),1>(reinterpret_cast<const detail::uint16*>(&a), 
+			reinterpret_cast<const detail::uint16*>(x), reinterpret_cast<const detail::uint16*>(y), reinterpret_cast<detail::uint16*>(y), n);
+	}
+
+	/// Scale and offset array of half-precision values.
+	/// This computes `dst[i] = fma(x[i], a, b)` for \a n consecutive values. It works like 
+	/// fma_n(const half*,const half*,const half*,half*,std::size_t) but uses the same second factor and summand for all values.
+	/// \param x array of values to scale
+	/// \param a scaling factor
+	/// \param b offset to add
+	/// \param dst array to store results at (may be identical to \a x, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+	inline void scale_add(const half *x, half a, half b, half *dst, std::size_t n)
+	{
+		detail::fma_n<(std::float_round_style)(HALF_ROUND_STYLE),6>(reinterpret_cast<const detail::uint16*>(x), 
+			reinterpret_cast<const detail::uint16*>(&a), reinterpret_cast<const detail::uint16*>(&b), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// \}
+	/// \anchor batch_comparison
+	/// \name Batch comparison
+	/// \{
+
+	/// Compare array of half-precision values for less than.
+	/// This sets bit *i* % 8 of `mask[i/8]` if `x[i] < y` for \a n consecutive values, with the results and exceptions being 
+	/// identical to those of the comparison operator. But whole blocks of values are compared at once as 16-bit integers using 
+	/// the [selected instruction sets](\ref simd_level), with 8, 16 or 32 values per instruction, making this much faster for 
+	/// large arrays. Unused bits of the last byte are cleared.
+	/// \param x array of values to compare
+	/// \param y value to compare to
+	/// \param mask array of (\a n + 7) / 8 bytes to store bitmask at
+	/// \param n number of values to compare
+	/// \exception FE_INVALID if \a y or a value is NaN
+	inline void compare_lt(const half *x, half y, unsigned char *mask, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::sin(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, k;
-		if(!abs)
-			return arg;
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? detail::invalid() : detail::signal(arg.data_));
-		if(abs < 0x2900)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
-		if(half::round_style != std::round_to_nearest)
-			switch(abs)
-			{
-				case 0x48B7: return half(detail::binary, detail::rounded<half::round_style,true>((~arg.data_&0x8000)|0x1D07, 1, 1));
-				case 0x6A64: return half(detail::binary, detail::rounded<half::round_style,true>((~arg.data_&0x8000)|0x3BFE, 1, 1));
-				case 0x6D8C: return half(detail::binary, detail::rounded<half::round_style,true>((arg.data_&0x8000)|0x0FE6, 1, 1));
-			}
-		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), 28);
-		detail::uint32 sign = -static_cast<detail::uint32>(((k>>1)&1)^(arg.data_>>15));
-		return half(detail::binary, detail::fixed2half<half::round_style,30,true,true,true>((((k&1) ? sc.second : sc.first)^sign) - sign));
-	#endif
+		detail::compare_n<'<'>(reinterpret_cast<const detail::uint16*>(x), *reinterpret_cast<const detail::uint16*>(&y), 
+			*reinterpret_cast<const detail::uint16*>(&y), mask, n);
 	}
 
-	/// Cosine function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::cos](https://en.cppreference.com/w/cpp/numeric/math/cos).
-	/// \param arg function argument
-	/// \return cosine value of \a arg
-	/// \exception FE_INVALID for signaling NaN or infinity
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half cos(half arg)
+	/// Compare array of half-precision values for less equal.
+	/// This works like compare_lt() but sets bit *i* if `x[i] <= y`.
+	/// \param x array of values to compare
+	/// \param y value to compare to
+	/// \param mask array of (\a n + 7) / 8 bytes to store bitmask at
+	/// \param n number of values to compare
+	/// \exception FE_INVALID if \a y or a value is NaN
+	inline void compare_le(const half *x, half y, unsigned char *mask, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::cos(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, k;
-		if(!abs)
-			return half(detail::binary, 0x3C00);
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? detail::invalid() : detail::signal(arg.data_));
-		if(abs < 0x2500)
-			return half(detail::binary, detail::rounded<half::round_style,true>(0x3BFF, 1, 1));
-		if(half::round_style != std::round_to_nearest && abs == 0x598C)
-			return half(detail::binary, detail::rounded<half::round_style,true>(0x80FC, 1, 1));
-		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), 28);
-		detail::uint32 sign = -static_cast<detail::uint32>(((k>>1)^k)&1);
-		return half(detail::binary, detail::fixed2half<half::round_style,30,true,true,true>((((k&1) ? sc.first : sc.second)^sign) - sign));
-	#endif
+		detail::compare_n<'l'>(reinterpret_cast<const detail::uint16*>(x), *reinterpret_cast<const detail::uint16*>(&y), 
+			*reinterpret_cast<const detail::uint16*>(&y), mask, n);
 	}
 
-	/// Tangent function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::tan](https://en.cppreference.com/w/cpp/numeric/math/tan).
-	/// \param arg function argument
-	/// \return tangent value of \a arg
-	/// \exception FE_INVALID for signaling NaN or infinity
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half tan(half arg)
+	/// Compare array of half-precision values for greater than.
+	/// This works like compare_lt() but sets bit *i* if `x[i] > y`.
+	/// \param x array of values to compare
+	/// \param y value to compare to
+	/// \param mask array of (\a n + 7) / 8 bytes to store bitmask at
+	/// \param n number of values to compare
+	/// \exception FE_INVALID if \a y or a value is NaN
+	inline void compare_gt(const half *x, half y, unsigned char *mask, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::tan(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp = 13, k;
-		if(!abs)
-			return arg;
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? detail::invalid() : detail::signal(arg.data_));
-		if(abs < 0x2700)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_, 0, 1));
-		if(half::round_style != std::round_to_nearest)
-			switch(abs)
-			{
-				case 0x658C: return half(detail::binary, detail::rounded<half::round_style,true>((arg.data_&0x8000)|0x07E6, 1, 1));
-				case 0x7330: return half(detail::binary, detail::rounded<half::round_style,true>((~arg.data_&0x8000)|0x4B62, 1, 1));
-			}
-		std::pair<detail::uint32,detail::uint32> sc = detail::sincos(detail::angle_arg(abs, k), 30);
-		if(k & 1)
-			sc = std::make_pair(-sc.second, sc.first);
-		detail::uint32 signy = detail::sign_mask(sc.first), signx = detail::sign_mask(sc.second);
-		detail::uint32 my = (sc.first^signy) - signy, mx = (sc.second^signx) - signx;
-		for(; my<0x80000000; my<<=1,--exp) ;
-		for(; mx<0x80000000; mx<<=1,++exp) ;
-		return half(detail::binary, detail::tangent_post<half::round_style>(my, mx, exp, (signy^signx^arg.data_)&0x8000));
-	#endif
+		detail::compare_n<'>'>(reinterpret_cast<const detail::uint16*>(x), *reinterpret_cast<const detail::uint16*>(&y), 
+			*reinterpret_cast<const detail::uint16*>(&y), mask, n);
 	}
 
-	/// Arc sine.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::asin](https://en.cppreference.com/w/cpp/numeric/math/asin).
-	/// \param arg function argument
-	/// \return arc sine value of \a arg
-	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half asin(half arg)
+	/// Compare array of half-precision values for greater equal.
+	/// This works like compare_lt() but sets bit *i* if `x[i] >= y`.
+	/// \param x array of values to compare
+	/// \param y value to compare to
+	/// \param mask array of (\a n + 7) / 8 bytes to store bitmask at
+	/// \param n number of values to compare
+	/// \exception FE_INVALID if \a y or a value is NaN
+	inline void compare_ge(const half *x, half y, unsigned char *mask, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::asin(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
-		if(!abs)
-			return arg;
-		if(abs >= 0x3C00)
-			return half(detail::binary, (abs>0x7C00) ? detail::signal(arg.data_) : (abs>0x3C00) ? detail::invalid() :
-										detail::rounded<half::round_style,true>(sign|0x3E48, 0, 1));
-		if(abs < 0x2900)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_, 0, 1));
-		if(half::round_style != std::round_to_nearest && (abs == 0x2B44 || abs == 0x2DC3))
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_+1, 1, 1));
-		std::pair<detail::uint32,detail::uint32> sc = detail::atan2_args(abs);
-		detail::uint32 m = detail::atan2(sc.first, sc.second, (half::round_style==std::round_to_nearest) ? 27 : 26);
-		return half(detail::binary, detail::fixed2half<half::round_style,30,false,true,true>(m, 14, sign));
-	#endif
+		detail::compare_n<'g'>(reinterpret_cast<const detail::uint16*>(x), *reinterpret_cast<const detail::uint16*>(&y), 
+			*reinterpret_cast<const detail::uint16*>(&y), mask, n);
 	}
 
-	/// Arc cosine function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::acos](https://en.cppreference.com/w/cpp/numeric/math/acos).
-	/// \param arg function argument
-	/// \return arc cosine value of \a arg
-	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half acos(half arg)
+	/// Compare array of half-precision values for equality.
+	/// This works like compare_lt() but sets bit *i* if `x[i] == y`, so positive and negative zero compare equal.
+	/// \param x array of values to compare
+	/// \param y value to compare to
+	/// \param mask array of (\a n + 7) / 8 bytes to store bitmask at
+	/// \param n number of values to compare
+	/// \exception FE_INVALID if \a y or a value is NaN
+	inline void compare_eq(const half *x, half y, unsigned char *mask, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::acos(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ >> 15;
-		if(!abs)
-			return half(detail::binary, detail::rounded<half::round_style,true>(0x3E48, 0, 1));
-		if(abs >= 0x3C00)
-			return half(detail::binary,	(abs>0x7C00) ? detail::signal(arg.data_) : (abs>0x3C00) ? detail::invalid() :
-										sign ? detail::rounded<half::round_style,true>(0x4248, 0, 1) : 0);
-		std::pair<detail::uint32,detail::uint32> cs = detail::atan2_args(abs);
-		detail::uint32 m = detail::atan2(cs.second, cs.first, 28);
-		return half(detail::binary, detail::fixed2half<half::round_style,31,false,true,true>(sign ? (0xC90FDAA2-m) : m, 15, 0, sign));
-	#endif
+		detail::compare_n<'='>(reinterpret_cast<const detail::uint16*>(x), *reinterpret_cast<const detail::uint16*>(&y), 
+			*reinterpret_cast<const detail::uint16*>(&y), mask, n);
 	}
 
-	/// Arc tangent function.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::atan](https://en.cppreference.com/w/cpp/numeric/math/atan).
-	/// \param arg function argument
-	/// \return arc tangent value of \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half atan(half arg)
+	/// Check array of half-precision values for range.
+	/// This works like compare_lt() but sets bit *i* if `lo <= x[i] && x[i] <= hi`.
+	/// \param x array of values to check
+	/// \param lo lower bound
+	/// \param hi upper bound
+	/// \param mask array of (\a n + 7) / 8 bytes to store bitmask at
+	/// \param n number of values to check
+	/// \exception FE_INVALID if \a lo or a value is NaN or if \a hi is NaN and `lo <= x[i]` for any value
+	inline void compare_between(const half *x, half lo, half hi, unsigned char *mask, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::atan(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
-		if(!abs)
-			return arg;
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? detail::rounded<half::round_style,true>(sign|0x3E48, 0, 1) : detail::signal(arg.data_));
-		if(abs <= 0x2700)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
-		int exp = (abs>>10) + (abs<=0x3FF);
-		detail::uint32 my = (abs&0x3FF) | ((abs>0x3FF)<<10);
-		detail::uint32 m = (exp>15) ?	detail::atan2(my<<19, 0x20000000>>(exp-15), (half::round_style==std::round_to_nearest) ? 26 : 24) :
-										detail::atan2(my<<(exp+4), 0x20000000, (half::round_style==std::round_to_nearest) ? 30 : 28);
-		return half(detail::binary, detail::fixed2half<half::round_style,30,false,true,true>(m, 14, sign));
-	#endif
+		detail::compare_n<'b'>(reinterpret_cast<const detail::uint16*>(x), *reinterpret_cast<const detail::uint16*>(&lo), 
+			*reinterpret_cast<const detail::uint16*>(&hi), mask, n);
 	}
 
-	/// Arc tangent function.
-	/// This function may be 1 ULP off the correctly rounded exact result in ~0.005% of inputs for `std::round_to_nearest`, 
-	/// in ~0.1% of inputs for `std::round_toward_zero` and in ~0.02% of inputs for any other rounding mode.
-	///
-	/// **See also:** Documentation for [std::atan2](https://en.cppreference.com/w/cpp/numeric/math/atan2).
-	/// \param y numerator
-	/// \param x denominator
-	/// \return arc tangent value
-	/// \exception FE_INVALID if \a x or \a y is signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half atan2(half y, half x)
+	/// Check array of half-precision values for NaN.
+	/// This works like compare_lt() but sets bit *i* if `isnan(x[i])`.
+	/// \param x array of values to check
+	/// \param mask array of (\a n + 7) / 8 bytes to store bitmask at
+	/// \param n number of values to check
+	inline void isnan(const half *x, unsigned char *mask, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::atan2(detail::half2float<detail::internal_t>(y.data_), detail::half2float<detail::internal_t>(x.data_))));
-	#else
-		unsigned int absx = x.data_ & 0x7FFF, absy = y.data_ & 0x7FFF, signx = x.data_ >> 15, signy = y.data_ & 0x8000;
-		if(absx >= 0x7C00 || absy >= 0x7C00)
-		{
-			if(absx > 0x7C00 || absy > 0x7C00)
-				return half(detail::binary, detail::signal(x.data_, y.data_));
-			if(absy == 0x7C00)
-				return half(detail::binary, (absx<0x7C00) ?	detail::rounded<half::round_style,true>(signy|0x3E48, 0, 1) :
-													signx ?	detail::rounded<half::round_style,true>(signy|0x40B6, 0, 1) :
-															detail::rounded<half::round_style,true>(signy|0x3A48, 0, 1));
-			return (x.data_==0x7C00) ? half(detail::binary, signy) : half(detail::binary, detail::rounded<half::round_style,true>(signy|0x4248, 0, 1));
-		}
-		if(!absy)
-			return signx ? half(detail::binary, detail::rounded<half::round_style,true>(signy|0x4248, 0, 1)) : y;
-		if(!absx)
-			return half(detail::binary, detail::rounded<half::round_style,true>(signy|0x3E48, 0, 1));
-		int d = (absy>>10) + (absy<=0x3FF) - (absx>>10) - (absx<=0x3FF);
-		if(d > (signx ? 18 : 12))
-			return half(detail::binary, detail::rounded<half::round_style,true>(signy|0x3E48, 0, 1));
-		if(signx && d < -11)
-			return half(detail::binary, detail::rounded<half::round_style,true>(signy|0x4248, 0, 1));
-		if(!signx && d < ((half::round_style==std::round_toward_zero) ? -15 : -9))
-		{
-			for(; absy<0x400; absy<<=1,--d) ;
-			detail::uint32 mx = ((absx<<1)&0x7FF) | 0x800, my = ((absy<<1)&0x7FF) | 0x800;
-			int i = my < mx;
-			d -= i;
-			if(d < -25)
-				return half(detail::binary, detail::underflow<half::round_style>(signy));
-			my <<= 11 + i;
-			return half(detail::binary, detail::fixed2half<half::round_style,11,false,false,true>(my/mx, d+14, signy, my%mx!=0));
-		}
-		detail::uint32 m = detail::atan2(	((absy&0x3FF)|((absy>0x3FF)<<10))<<(19+((d<0) ? d : (d>0) ? 0 : -1)),
-											((absx&0x3FF)|((absx>0x3FF)<<10))<<(19-((d>0) ? d : (d<0) ? 0 : 1)));
-		return half(detail::binary, detail::fixed2half<half::round_style,31,false,true,true>(signx ? (0xC90FDAA2-m) : m, 15, signy, signx));
-	#endif
+		detail::compare_n<'n'>(reinterpret_cast<const detail::uint16*>(x), 0, 0, mask, n);
+	}
+
+	/// Count set bits of bitmask.
+	/// This gives the number of values for which a [batch comparison](\ref batch_comparison) was true.
+	/// \param mask bitmask with bit *i* % 8 of `mask[i/8]` for *i*-th value
+	/// \param n number of values
+	/// \return number of set bits among the first \a n bits
+	inline std::size_t count(const unsigned char *mask, std::size_t n) { return detail::count_bits(mask, n); }
+
+	/// Select values according to bitmask.
+	/// This copies the values for which a [batch comparison](\ref batch_comparison) was true consecutively to \a dst.
+	/// \param src array of values to select from
+	/// \param mask bitmask with bit *i* % 8 of `mask[i/8]` for *i*-th value
+	/// \param dst array to store selected values at, with room for count(\a mask, \a n) values (may be identical to \a src, 
+	/// but should not overlap it otherwise)
+	/// \param n number of values to select from
+	/// \return number of selected values
+	inline std::size_t select(const half *src, const unsigned char *mask, half *dst, std::size_t n)
+	{
+		return detail::select_bits(reinterpret_cast<const detail::uint16*>(src), mask, reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
 	/// \}
-	/// \anchor hyperbolic
-	/// \name Hyperbolic functions
+
+	/// \anchor batch_functions
+	/// \name Batch functions
 	/// \{
 
-	/// Hyperbolic sine.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::sinh](https://en.cppreference.com/w/cpp/numeric/math/sinh).
-	/// \param arg function argument
-	/// \return hyperbolic sine value of \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half sinh(half arg)
+	/// Exponential function of array.
+	/// This computes `dst[i] = exp<R>(src[i])` for \a n consecutive values with results and exceptions identical to exp<R>(). The 
+	/// values are approximated in single-precision using the [selected instruction sets](\ref simd_level), and only those whose 
+	/// correct rounding can't be guaranteed from the approximation are computed exactly, making this several times faster for 
+	/// large arrays. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled, all values are looked up in the table at 
+	/// once instead, using gather instructions if available.
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store exponentials at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to exp<R>()
+	template<std::float_round_style R> void exp(const half *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::sinh(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp;
-		if(!abs || abs >= 0x7C00)
-			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		if(abs <= 0x2900)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_, 0, 1));
-		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, (half::round_style==std::round_to_nearest) ? 29 : 27);
-		detail::uint32 m = mm.first - mm.second;
-		for(exp+=13; m<0x80000000 && exp; m<<=1,--exp) ;
-		unsigned int sign = arg.data_ & 0x8000;
-		if(exp > 29)
-			return half(detail::binary, detail::overflow<half::round_style>(sign));
-		return half(detail::binary, detail::fixed2half<half::round_style,31,false,false,true>(m, exp, sign));
-	#endif
+		detail::approximated_n<R,'e',&detail::exp_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Hyperbolic cosine.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::cosh](https://en.cppreference.com/w/cpp/numeric/math/cosh).
-	/// \param arg function argument
-	/// \return hyperbolic cosine value of \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half cosh(half arg)
+	/// Exponential function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// exp<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store exponentials at
+	/// \param n number of values to compute
+	inline void exp(const half *src, half *dst, std::size_t n) { exp<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Binary exponential of array.
+	/// This computes `dst[i] = exp2<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store binary exponentials at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to exp2<R>()
+	template<std::float_round_style R> void exp2(const half *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::cosh(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp;
-		if(!abs)
-			return half(detail::binary, 0x3C00);
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs>0x7C00) ? detail::signal(arg.data_) : 0x7C00);
-		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, (half::round_style==std::round_to_nearest) ? 23 : 26);
-		detail::uint32 m = mm.first + mm.second, i = (~m&0xFFFFFFFF) >> 31;
-		m = (m>>i) | (m&i) | 0x80000000;
-		if((exp+=13+i) > 29)
-			return half(detail::binary, detail::overflow<half::round_style>());
-		return half(detail::binary, detail::fixed2half<half::round_style,31,false,false,true>(m, exp));
-	#endif
+		detail::approximated_n<R,'2',&detail::exp2_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Hyperbolic tangent.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::tanh](https://en.cppreference.com/w/cpp/numeric/math/tanh).
-	/// \param arg function argument
-	/// \return hyperbolic tangent value of \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half tanh(half arg)
+	/// Binary exponential of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// exp2<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store binary exponentials at
+	/// \param n number of values to compute
+	inline void exp2(const half *src, half *dst, std::size_t n) { exp2<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Exponential minus one of array.
+	/// This computes `dst[i] = expm1<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store exponentials minus one at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to expm1<R>()
+	template<std::float_round_style R> void expm1(const half *src, half *dst, std::size_t n)
 	{
-	#ifdef HALF_ARITHMETIC_TYPE
-		return half(detail::binary, detail::float2half<half::round_style>(std::tanh(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp;
-		if(!abs)
-			return arg;
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs>0x7C00) ? detail::signal(arg.data_) : (arg.data_-0x4000));
-		if(abs >= 0x4500)
-			return half(detail::binary, detail::rounded<half::round_style,true>((arg.data_&0x8000)|0x3BFF, 1, 1));
-		if(abs < 0x2700)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
-		if(half::round_style != std::round_to_nearest && abs == 0x2D3F)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-3, 0, 1));
-		std::pair<detail::uint32,detail::uint32> mm = detail::hyperbolic_args(abs, exp, 27);
-		detail::uint32 my = mm.first - mm.second - (half::round_style!=std::round_to_nearest), mx = mm.first + mm.second, i = (~mx&0xFFFFFFFF) >> 31;
-		for(exp=13; my<0x80000000; my<<=1,--exp) ;
-		mx = (mx>>i) | 0x80000000;
-		return half(detail::binary, detail::tangent_post<half::round_style>(my, mx, exp-i, arg.data_&0x8000));
-	#endif
+		detail::approximated_n<R,'m',&detail::expm1_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Hyperbolic area sine.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::asinh](https://en.cppreference.com/w/cpp/numeric/math/asinh).
-	/// \param arg function argument
-	/// \return area sine value of \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half asinh(half arg)
+	/// Exponential minus one of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// expm1<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store exponentials minus one at
+	/// \param n number of values to compute
+	inline void expm1(const half *src, half *dst, std::size_t n) { expm1<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Natural logarithm of array.
+	/// This computes `dst[i] = log<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store natural logarithms at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to log<R>()
+	template<std::float_round_style R> void log(const half *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::asinh(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF;
-		if(!abs || abs >= 0x7C00)
-			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		if(abs <= 0x2900)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-1, 1, 1));
-		if(half::round_style != std::round_to_nearest)
-			switch(abs)
-			{
-				case 0x32D4: return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-13, 1, 1));
-				case 0x3B5B: return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_-197, 1, 1));
-			}
-		return half(detail::binary, detail::area<half::round_style,true>(arg.data_));
-	#endif
+		detail::approximated_n<R,'l',&detail::log_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Hyperbolic area cosine.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::acosh](https://en.cppreference.com/w/cpp/numeric/math/acosh).
-	/// \param arg function argument
-	/// \return area cosine value of \a arg
-	/// \exception FE_INVALID for signaling NaN or arguments <1
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half acosh(half arg)
+	/// Natural logarithm of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// log<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store natural logarithms at
+	/// \param n number of values to compute
+	inline void log(const half *src, half *dst, std::size_t n) { log<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Common logarithm of array.
+	/// This computes `dst[i] = log10<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store common logarithms at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to log10<R>()
+	template<std::float_round_style R> void log10(const half *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::acosh(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF;
-		if((arg.data_&0x8000) || abs < 0x3C00)
-			return half(detail::binary, (abs<=0x7C00) ? detail::invalid() : detail::signal(arg.data_));
-		if(abs == 0x3C00)
-			return half(detail::binary, 0);
-		if(arg.data_ >= 0x7C00)
-			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		return half(detail::binary, detail::area<half::round_style,false>(arg.data_));
-	#endif
+		detail::approximated_n<R,'d',&detail::log10_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Hyperbolic area tangent.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::atanh](https://en.cppreference.com/w/cpp/numeric/math/atanh).
-	/// \param arg function argument
-	/// \return area tangent value of \a arg
-	/// \exception FE_INVALID for signaling NaN or if abs(\a arg) > 1
-	/// \exception FE_DIVBYZERO for +/-1
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half atanh(half arg)
+	/// Common logarithm of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// log10<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store common logarithms at
+	/// \param n number of values to compute
+	inline void log10(const half *src, half *dst, std::size_t n) { log10<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Binary logarithm of array.
+	/// This computes `dst[i] = log2<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store binary logarithms at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to log2<R>()
+	template<std::float_round_style R> void log2(const half *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::atanh(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF, exp = 0;
-		if(!abs)
-			return arg;
-		if(abs >= 0x3C00)
-			return half(detail::binary, (abs==0x3C00) ? detail::pole(arg.data_&0x8000) : (abs<=0x7C00) ? detail::invalid() : detail::signal(arg.data_));
-		if(abs < 0x2700)
-			return half(detail::binary, detail::rounded<half::round_style,true>(arg.data_, 0, 1));
-		detail::uint32 m = static_cast<detail::uint32>((abs&0x3FF)|((abs>0x3FF)<<10)) << ((abs>>10)+(abs<=0x3FF)+6), my = 0x80000000 + m, mx = 0x80000000 - m;
-		for(; mx<0x80000000; mx<<=1,++exp) ;
-		int i = my >= mx, s;
-		return half(detail::binary, detail::log2_post<half::round_style,0xB8AA3B2A>(detail::log2(
-			(detail::divide64(my>>i, mx, s)+1)>>1, 27)+0x10, exp+i-1, 16, arg.data_&0x8000));
-	#endif
+		detail::approximated_n<R,'b',&detail::log2_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Binary logarithm of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// log2<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store binary logarithms at
+	/// \param n number of values to compute
+	inline void log2(const half *src, half *dst, std::size_t n) { log2<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Natural logarithm plus one of array.
+	/// This computes `dst[i] = log1p<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store logarithms at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to log1p<R>()
+	template<std::float_round_style R> void log1p(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'p',&detail::log1p_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Natural logarithm plus one of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// log1p<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store logarithms at
+	/// \param n number of values to compute
+	inline void log1p(const half *src, half *dst, std::size_t n) { log1p<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Cubic root of array.
+	/// This computes `dst[i] = cbrt<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store cubic roots at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to cbrt<R>()
+	template<std::float_round_style R> void cbrt(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'3',&detail::cbrt_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Cubic root of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// cbrt<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store cubic roots at
+	/// \param n number of values to compute
+	inline void cbrt(const half *src, half *dst, std::size_t n) { cbrt<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Sine function of array.
+	/// This computes `dst[i] = sin<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store sines at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to sin<R>()
+	template<std::float_round_style R> void sin(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'s',&detail::sin_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Sine function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// sin<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store sines at
+	/// \param n number of values to compute
+	inline void sin(const half *src, half *dst, std::size_t n) { sin<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Cosine function of array.
+	/// This computes `dst[i] = cos<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store cosines at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to cos<R>()
+	template<std::float_round_style R> void cos(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'c',&detail::cos_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Cosine function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// cos<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store cosines at
+	/// \param n number of values to compute
+	inline void cos(const half *src, half *dst, std::size_t n) { cos<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Tangent function of array.
+	/// This computes `dst[i] = tan<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store tangents at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to tan<R>()
+	template<std::float_round_style R> void tan(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'t',&detail::tan_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Tangent function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// tan<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store tangents at
+	/// \param n number of values to compute
+	inline void tan(const half *src, half *dst, std::size_t n) { tan<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Arc tangent function of array.
+	/// This computes `dst[i] = atan<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store arc tangents at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to atan<R>()
+	template<std::float_round_style R> void atan(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'a',&detail::atan_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Arc tangent function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// atan<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store arc tangents at
+	/// \param n number of values to compute
+	inline void atan(const half *src, half *dst, std::size_t n) { atan<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Hyperbolic sine of array.
+	/// This computes `dst[i] = sinh<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store hyperbolic sines at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to sinh<R>()
+	template<std::float_round_style R> void sinh(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'S',&detail::sinh_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Hyperbolic sine of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// sinh<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store hyperbolic sines at
+	/// \param n number of values to compute
+	inline void sinh(const half *src, half *dst, std::size_t n) { sinh<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Hyperbolic cosine of array.
+	/// This computes `dst[i] = cosh<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store hyperbolic cosines at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to cosh<R>()
+	template<std::float_round_style R> void cosh(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'C',&detail::cosh_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Hyperbolic cosine of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// cosh<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store hyperbolic cosines at
+	/// \param n number of values to compute
+	inline void cosh(const half *src, half *dst, std::size_t n) { cosh<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Hyperbolic tangent of array.
+	/// This computes `dst[i] = tanh<R>(src[i])` and otherwise works like exp(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store hyperbolic tangents at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to tanh<R>()
+	template<std::float_round_style R> void tanh(const half *src, half *dst, std::size_t n)
+	{
+		detail::approximated_n<R,'T',&detail::tanh_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Hyperbolic tangent of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// tanh<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store hyperbolic tangents at
+	/// \param n number of values to compute
+	inline void tanh(const half *src, half *dst, std::size_t n) { tanh<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Error function of array.
+	/// This computes `dst[i] = erf<R>(src[i])` for \a n consecutive values with results and exceptions identical to erf<R>(). 
+	/// Unlike the other batch functions, this is merely a convenience loop computing one value after another, without any 
+	/// single-precision approximations. With [function tables](\ref HALF_ENABLE_UNARY_TABLES) enabled, all values are looked up 
+	/// in the table at once instead, using gather instructions if available.
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store error functions at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to erf<R>()
+	template<std::float_round_style R> void erf(const half *src, half *dst, std::size_t n)
+	{
+		detail::tabulated_n<R,&detail::erf_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// \}
-	/// \anchor special
-	/// \name Error and gamma functions
-	/// \{
+	/// Error function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// erf<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store error functions at
+	/// \param n number of values to compute
+	inline void erf(const half *src, half *dst, std::size_t n) { erf<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Complementary error function of array.
+	/// This computes `dst[i] = erfc<R>(src[i])` and otherwise works like erf(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store complementary error functions at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to erfc<R>()
+	template<std::float_round_style R> void erfc(const half *src, half *dst, std::size_t n)
+	{
+		detail::tabulated_n<R,&detail::erfc_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+	}
 
-	/// Error function.
-	/// This function may be 1 ULP off the correctly rounded exact result for any rounding mode in <0.5% of inputs.
-	///
-	/// **See also:** Documentation for [std::erf](https://en.cppreference.com/w/cpp/numeric/math/erf).
-	/// \param arg function argument
-	/// \return error function value of \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half erf(half arg)
+	/// Complementary error function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// erfc<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store complementary error functions at
+	/// \param n number of values to compute
+	inline void erfc(const half *src, half *dst, std::size_t n) { erfc<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Natural logarithm of gamma function of array.
+	/// This computes `dst[i] = lgamma<R>(src[i])` and otherwise works like erf(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store logarithms of gamma functions at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to lgamma<R>()
+	template<std::float_round_style R> void lgamma(const half *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::erf(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		unsigned int abs = arg.data_ & 0x7FFF;
-		if(!abs || abs >= 0x7C00)
-			return (abs>=0x7C00) ? half(detail::binary, (abs==0x7C00) ? (arg.data_-0x4000) : detail::signal(arg.data_)) : arg;
-		if(abs >= 0x4200)
-			return half(detail::binary, detail::rounded<half::round_style,true>((arg.data_&0x8000)|0x3BFF, 1, 1));
-		return half(detail::binary, detail::erf<half::round_style,false>(arg.data_));
-	#endif
+		detail::tabulated_n<R,&detail::lgamma_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Complementary error function.
-	/// This function may be 1 ULP off the correctly rounded exact result for any rounding mode in <0.5% of inputs.
-	///
-	/// **See also:** Documentation for [std::erfc](https://en.cppreference.com/w/cpp/numeric/math/erfc).
-	/// \param arg function argument
-	/// \return 1 minus error function value of \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half erfc(half arg)
+	/// Natural logarithm of gamma function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// lgamma<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store logarithms of gamma functions at
+	/// \param n number of values to compute
+	inline void lgamma(const half *src, half *dst, std::size_t n) { lgamma<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// Gamma function of array.
+	/// This computes `dst[i] = tgamma<R>(src[i])` and otherwise works like erf(const half*,half*,std::size_t).
+	/// \tparam R rounding mode to use
+	/// \param src array of function arguments
+	/// \param dst array to store gamma functions at (may be identical to \a src, but should not overlap it otherwise)
+	/// \param n number of values to compute
+	/// \exception according to tgamma<R>()
+	template<std::float_round_style R> void tgamma(const half *src, half *dst, std::size_t n)
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::erfc(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
-		if(abs >= 0x7C00)
-			return (abs>=0x7C00) ? half(detail::binary, (abs==0x7C00) ? (sign>>1) : detail::signal(arg.data_)) : arg;
-		if(!abs)
-			return half(detail::binary, 0x3C00);
-		if(abs >= 0x4400)
-			return half(detail::binary, detail::rounded<half::round_style,true>((sign>>1)-(sign>>15), sign>>15, 1));
-		return half(detail::binary, detail::erf<half::round_style,true>(arg.data_));
-	#endif
+		detail::tabulated_n<R,&detail::tgamma_impl<R> >(reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
 	}
 
-	/// Natural logarithm of gamma function.
-	/// This function may be 1 ULP off the correctly rounded exact result for any rounding mode in ~0.025% of inputs.
+	/// Gamma function of array.
+	/// This rounds according to the [default rounding mode](\ref HALF_ROUND_STYLE) and otherwise works like 
+	/// tgamma<R>(const half*,half*,std::size_t).
+	/// \param src array of function arguments
+	/// \param dst array to store gamma functions at
+	/// \param n number of values to compute
+	inline void tgamma(const half *src, half *dst, std::size_t n) { tgamma<(std::float_round_style)(HALF_ROUND_STYLE)>(src, dst, n); }
+
+	/// \}
+
+	/// Table of all values of a unary function.
+	/// This evaluates a function once for all 65536 half-precision arguments and afterwards just looks the results up, which 
+	/// pays off for functions costing more than a few operations and called on many values, like calibration curves, custom 
+	/// activation functions or piecewise mappings. Arrays are looked up using gather instructions of the 
+	/// [selected instruction sets](\ref simd_level) if available. The table takes 128 KiB and can be written to and read from 
+	/// streams, so that it only has to be built once.
 	///
-	/// **See also:** Documentation for [std::lgamma](https://en.cppreference.com/w/cpp/numeric/math/lgamma).
-	/// \param arg function argument
-	/// \return natural logarith of gamma function for \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_DIVBYZERO for 0 or negative integer arguments
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half lgamma(half arg)
+	/// ```cpp
+	/// half_float::unary_table gelu(half_float::parallel, [](half x) { return x * (half(1.0f)+erf(x*half(0.70710678f))) * half(0.5f); });
+	/// gelu(x.data(), y.data(), n);
+	/// ```
+	class unary_table
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::lgamma(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		int abs = arg.data_ & 0x7FFF;
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? 0x7C00 : detail::signal(arg.data_));
-		if(!abs || arg.data_ >= 0xE400 || (arg.data_ >= 0xBC00 && !(abs&((1<<(25-(abs>>10)))-1))))
-			return half(detail::binary, detail::pole());
-		if(arg.data_ == 0x3C00 || arg.data_ == 0x4000)
-			return half(detail::binary, 0);
-		return half(detail::binary, detail::gamma<half::round_style,true>(arg.data_));
-	#endif
-	}
+	public:
+		/// Default constructor.
+		/// This creates a table of the identity function.
+		unary_table() : values_(0x10001)
+		{
+			for(unsigned int i=0; i<0x10000; ++i)
+				values_[i] = static_cast<detail::uint16>(i);
+		}
 
-	/// Gamma function.
-	/// This function may be 1 ULP off the correctly rounded exact result for any rounding mode in <0.25% of inputs.
+		/// Tabulate function.
+		/// \tparam F type of function, callable with a half and returning a value convertible to half
+		/// \param fn function to tabulate, called once for each argument
+		/// \exception any exception thrown by \a fn
+		template<typename F> explicit unary_table(F fn) : values_(0x10001) { tabulate(fn, 0, 0x10000); }
+
+		/// Tabulate function in parallel.
+		/// This works like unary_table(F) but evaluates the function concurrently by the threads of a 
+		/// [parallel execution policy](\ref parallel_policy). So it has to be safe to call from multiple threads and must not 
+		/// throw.
+		/// \tparam F type of function, callable with a half and returning a value convertible to half
+		/// \param policy parallel execution policy
+		/// \param fn function to tabulate, called once for each argument
+		template<typename F> unary_table(const parallel_policy &policy, F fn) : values_(0x10001)
+		{
+		#if HALF_ENABLE_PARALLEL && HALF_ENABLE_CPP11_THREAD && HALF_ENABLE_CPP11_THREAD_LOCAL && !HALF_ERRHANDLING_ERRNO && \
+			!HALF_ERRHANDLING_FENV && !HALF_ERRHANDLING_THROWS
+			unsigned int threads = (std::min)(policy.threads(), 64u);
+			if(threads > 1)
+			{
+				unsigned int part = (0x10000+threads-1) / threads;
+				int flags = detail::parallel_pool().run([&](unsigned int i) { 
+					tabulate(fn, (std::min)(i*part, 0x10000u), (std::min)((i+1)*part, 0x10000u)); }, threads);
+				detail::raise(flags, flags!=0);
+				return;
+			}
+		#else
+			static_cast<void>(policy);
+		#endif
+			tabulate(fn, 0, 0x10000);
+		}
+
+		/// Look up function value.
+		/// \param arg function argument
+		/// \return tabulated function value
+		half operator()(half arg) const { return half(detail::binary, values_[arg.data_]); }
+
+		/// Look up function values of array.
+		/// \param src array of function arguments
+		/// \param dst array to store function values at (may be identical to \a src, but should not overlap it otherwise)
+		/// \param n number of values to look up
+		void operator()(const half *src, half *dst, std::size_t n) const
+		{
+			detail::lookup_n(&values_[0], reinterpret_cast<const detail::uint16*>(src), reinterpret_cast<detail::uint16*>(dst), n);
+		}
+
+		/// Get function values.
+		/// \return array of 65536 function values indexed by the bits of the arguments
+		const half* data() const { return reinterpret_cast<const half*>(&values_[0]); }
+
+		/// Write table to stream.
+		/// This writes the function values in the order of their arguments' bits as 16-bit little-endian binary numbers, 
+		/// 131072 bytes in total, independent of the platform.
+		/// \param out binary output stream to write to
+		/// \return reference to output stream
+		std::ostream& write(std::ostream &out) const
+		{
+			char buffer[512];
+			for(unsigned int i=0; i<0x10000 && out; i+=256)
+			{
+				for(unsigned int j=0; j<256; ++j)
+				{
+					buffer[2*j] = static_cast<char>(values_[i+j]&0xFF);
+					buffer[2*j+1] = static_cast<char>(values_[i+j]>>8);
+				}
+				out.write(buffer, sizeof(buffer));
+			}
+			return out;
+		}
+
+		/// Read table from stream.
+		/// This reads a table written by write(). If the stream ends early, the table is not changed.
+		/// \param in binary input stream to read from
+		/// \return reference to input stream
+		std::istream& read(std::istream &in)
+		{
+			std::vector<detail::uint16> values(0x10001);
+			char buffer[512];
+			for(unsigned int i=0; i<0x10000; i+=256)
+			{
+				if(!in.read(buffer, sizeof(buffer)))
+					return in;
+				for(unsigned int j=0; j<256; ++j)
+					values[i+j] = static_cast<detail::uint16>((buffer[2*j]&0xFF) | ((buffer[2*j+1]&0xFF)<<8));
+			}
+			values_.swap(values);
+			return in;
+		}
+
+	private:
+		/// Evaluate function for range of arguments.
+		/// \tparam F type of function
+		/// \param fn function to evaluate
+		/// \param begin first argument bits
+		/// \param end argument bits after last argument
+		template<typename F> void tabulate(F &fn, unsigned int begin, unsigned int end)
+		{
+			for(unsigned int i=begin; i<end; ++i)
+				values_[i] = static_cast<half>(fn(half(detail::binary, i))).data_;
+		}
+
+		/// Function values, padded by one for gathering 32-bit words.
+		std::vector<detail::uint16> values_;
+	};
+
+	/// Packed half-precision values.
+	/// This holds a fixed number of half-precision values and computes with all of them at once. If SSE2 is enabled at 
+	/// compile-time, the values are kept in SSE registers in blocks of eight, which are computed in single-precision like the 
+	/// [batch arithmetic](\ref batch_arithmetic) functions, using AVX2 and F16C if enabled at compile-time as well. Otherwise 
+	/// the values are computed one by one. Either way the results and exceptions of all operations are identical to those of 
+	/// the corresponding operations on the single values.
 	///
-	/// **See also:** Documentation for [std::tgamma](https://en.cppreference.com/w/cpp/numeric/math/tgamma).
-	/// \param arg function argument
-	/// \return gamma function value of \a arg
-	/// \exception FE_INVALID for signaling NaN, negative infinity or negative integer arguments
-	/// \exception FE_DIVBYZERO for 0
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half tgamma(half arg)
+	/// Unlike the [batch functions](\ref batch) these don't select the instruction set at runtime, since the values are meant 
+	/// to stay in registers across operations. The [half8](\ref half_float::half8) and [half16](\ref half_float::half16) 
+	/// typedefs should usually be used instead of this template directly.
+	/// \tparam N number of values (8, 16 or 32)
+	template<std::size_t N> class packed_half
 	{
-	#if defined(HALF_ARITHMETIC_TYPE) && HALF_ENABLE_CPP11_CMATH
-		return half(detail::binary, detail::float2half<half::round_style>(std::tgamma(detail::half2float<detail::internal_t>(arg.data_))));
-	#else
-		unsigned int abs = arg.data_ & 0x7FFF;
-		if(!abs)
-			return half(detail::binary, detail::pole(arg.data_));
-		if(abs >= 0x7C00)
-			return (arg.data_==0x7C00) ? arg : half(detail::binary, detail::signal(arg.data_));
-		if(arg.data_ >= 0xE400 || (arg.data_ >= 0xBC00 && !(abs&((1<<(25-(abs>>10)))-1))))
-			return half(detail::binary, detail::invalid());
-		if(arg.data_ >= 0xCA80)
-			return half(detail::binary, detail::underflow<half::round_style>((1-((abs>>(25-(abs>>10)))&1))<<15));
-		if(arg.data_ <= 0x100 || (arg.data_ >= 0x4900 && arg.data_ < 0x8000))
-			return half(detail::binary, detail::overflow<half::round_style>());
-		if(arg.data_ == 0x3C00)
-			return arg;
-		return half(detail::binary, detail::gamma<half::round_style,false>(arg.data_));
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(N==8 || N==16 || N==32, "packed_half only supports 8, 16 or 32 values");
 	#endif
-	}
 
-	/// \}
-	/// \anchor rounding
-	/// \name Rounding
-	/// \{
+	public:
+		/// Type of single values.
+		typedef half value_type;
 
-	/// Nearest integer not less than half value.
-	/// **See also:** Documentation for [std::ceil](https://en.cppreference.com/w/cpp/numeric/math/ceil).
-	/// \param arg half to round
-	/// \return nearest integer not less than \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_INEXACT if value had to be rounded
-	inline half ceil(half arg) { return half(detail::binary, detail::integral<std::round_toward_infinity,true,true>(arg.data_)); }
+		/// Number of values.
+		/// \return number of values
+		static HALF_CONSTEXPR std::size_t size() { return N; }
 
-	/// Nearest integer not greater than half value.
-	/// **See also:** Documentation for [std::floor](https://en.cppreference.com/w/cpp/numeric/math/floor).
-	/// \param arg half to round
-	/// \return nearest integer not greater than \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_INEXACT if value had to be rounded
-	inline half floor(half arg) { return half(detail::binary, detail::integral<std::round_toward_neg_infinity,true,true>(arg.data_)); }
+		/// Default constructor.
+		/// This initializes all values to positive zero.
+		packed_half() { fill(0); }
 
-	/// Nearest integer not greater in magnitude than half value.
-	/// **See also:** Documentation for [std::trunc](https://en.cppreference.com/w/cpp/numeric/math/trunc).
-	/// \param arg half to round
-	/// \return nearest integer not greater in magnitude than \a arg
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_INEXACT if value had to be rounded
-	inline half trunc(half arg) { return half(detail::binary, detail::integral<std::round_toward_zero,true,true>(arg.data_)); }
+		/// Broadcast constructor.
+		/// \param value value to use for all values
+		explicit packed_half(half value) { fill(value.data_); }
 
-	/// Nearest integer.
-	/// **See also:** Documentation for [std::round](https://en.cppreference.com/w/cpp/numeric/math/round).
-	/// \param arg half to round
-	/// \return nearest integer, rounded away from zero in half-way cases
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_INEXACT if value had to be rounded
-	inline half round(half arg) { return half(detail::binary, detail::integral<std::round_to_nearest,false,true>(arg.data_)); }
+		/// Load values.
+		/// \param src array of \a N values, which doesn't need to be aligned
+		/// \return packed values
+		static packed_half load(const half *src)
+		{
+			packed_half out;
+		#if HALF_PACKED_SSE2
+			for(std::size_t i=0; i<N/8; ++i)
+				out.data_.v[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src+8*i));
+		#else
+			for(std::size_t i=0; i<N; ++i)
+				out.data_.v[i] = src[i].data_;
+		#endif
+			return out;
+		}
 
-	/// Nearest integer.
-	/// **See also:** Documentation for [std::lround](https://en.cppreference.com/w/cpp/numeric/math/round).
-	/// \param arg half to round
-	/// \return nearest integer, rounded away from zero in half-way cases
-	/// \exception FE_INVALID if value is not representable as `long`
-	inline long lround(half arg) { return detail::half2int<std::round_to_nearest,false,false,long>(arg.data_); }
+		/// Load and convert single-precision values.
+		/// \param src array of \a N single-precision values, which doesn't need to be aligned
+		/// \return packed values rounded to half-precision
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		static packed_half load(const float *src)
+		{
+			packed_half out;
+		#if HALF_PACKED_SSE2
+			for(std::size_t i=0; i<N/8; ++i)
+				out.data_.v[i] = detail::packed_narrow<half::round_style>(_mm_loadu_ps(src+8*i), _mm_loadu_ps(src+8*i+4));
+		#else
+			for(std::size_t i=0; i<N; ++i)
+				out.data_.v[i] = detail::float2half<half::round_style>(src[i]);
+		#endif
+			return out;
+		}
 
-	/// Nearest integer using half's internal rounding mode.
-	/// **See also:** Documentation for [std::rint](https://en.cppreference.com/w/cpp/numeric/math/rint).
-	/// \param arg half expression to round
-	/// \return nearest integer using default rounding mode
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_INEXACT if value had to be rounded
-	inline half rint(half arg) { return half(detail::binary, detail::integral<half::round_style,true,true>(arg.data_)); }
+		/// Store values.
+		/// \param dst array to store \a N values at, which doesn't need to be aligned
+		void store(half *dst) const
+		{
+		#if HALF_PACKED_SSE2
+			for(std::size_t i=0; i<N/8; ++i)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst+8*i), data_.v[i]);
+		#else
+			for(std::size_t i=0; i<N; ++i)
+				dst[i].data_ = data_.v[i];
+		#endif
+		}
 
-	/// Nearest integer using half's internal rounding mode.
-	/// **See also:** Documentation for [std::lrint](https://en.cppreference.com/w/cpp/numeric/math/rint).
-	/// \param arg half expression to round
-	/// \return nearest integer using default rounding mode
-	/// \exception FE_INVALID if value is not representable as `long`
-	/// \exception FE_INEXACT if value had to be rounded
-	inline long lrint(half arg) { return detail::half2int<half::round_style,true,true,long>(arg.data_); }
+		/// Convert and store values as single-precision.
+		/// \param dst array to store \a N single-precision values at, which doesn't need to be aligned
+		void store(float *dst) const
+		{
+		#if HALF_PACKED_SSE2
+			for(std::size_t i=0; i<N/8; ++i)
+				detail::packed_widen(data_.v[i], dst+8*i, dst+8*i+4);
+		#else
+			for(std::size_t i=0; i<N; ++i)
+				dst[i] = detail::half2float<float>(data_.v[i]);
+		#endif
+		}
 
-	/// Nearest integer using half's internal rounding mode.
-	/// **See also:** Documentation for [std::nearbyint](https://en.cppreference.com/w/cpp/numeric/math/nearbyint).
-	/// \param arg half expression to round
-	/// \return nearest integer using default rounding mode
-	/// \exception FE_INVALID for signaling NaN
-	inline half nearbyint(half arg) { return half(detail::binary, detail::integral<half::round_style,true,false>(arg.data_)); }
-#if HALF_ENABLE_CPP11_LONG_LONG
-	/// Nearest integer.
-	/// **See also:** Documentation for [std::llround](https://en.cppreference.com/w/cpp/numeric/math/round).
-	/// \param arg half to round
-	/// \return nearest integer, rounded away from zero in half-way cases
-	/// \exception FE_INVALID if value is not representable as `long long`
-	inline long long llround(half arg) { return detail::half2int<std::round_to_nearest,false,false,long long>(arg.data_); }
+		/// Access single value.
+		/// \param i index of value
+		/// \return \a i-th value
+		half operator[](std::size_t i) const
+		{
+		#if HALF_PACKED_SSE2
+			detail::uint16 values[8];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(values), data_.v[i/8]);
+			return half(detail::binary, values[i%8]);
+		#else
+			return half(detail::binary, data_.v[i]);
+		#endif
+		}
+
+		/// Arithmetic assignment.
+		/// \param rhs values to add
+		/// \return reference to these values
+		/// \exception FE_... according to operator+(packed_half<N>,packed_half<N>)
+		packed_half& operator+=(packed_half rhs) { return *this = *this + rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs values to subtract
+		/// \return reference to these values
+		/// \exception FE_... according to operator-(packed_half<N>,packed_half<N>)
+		packed_half& operator-=(packed_half rhs) { return *this = *this - rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs values to multiply with
+		/// \return reference to these values
+		/// \exception FE_... according to operator*(packed_half<N>,packed_half<N>)
+		packed_half& operator*=(packed_half rhs) { return *this = *this * rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs values to divide by
+		/// \return reference to these values
+		/// \exception FE_... according to operator/(packed_half<N>,packed_half<N>)
+		packed_half& operator/=(packed_half rhs) { return *this = *this / rhs; }
+
+	private:
+		/// Set all values.
+		/// \param bits binary representation to set values to
+		void fill(unsigned int bits)
+		{
+		#if HALF_PACKED_SSE2
+			for(std::size_t i=0; i<N/8; ++i)
+				data_.v[i] = _mm_set1_epi16(static_cast<short>(bits));
+		#else
+			for(std::size_t i=0; i<N; ++i)
+				data_.v[i] = static_cast<detail::uint16>(bits);
+		#endif
+		}
+
+		/// Compute packed values.
+		/// \tparam O operation to perform (`+`, `-`, `*`, `/`, `f` for fused multiply add or `s` for square root)
+		/// \param x first operands
+		/// \param y second operands
+		/// \param z third operands
+		/// \return results
+		/// \exception FE_INVALID, ...DIVBYZERO, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<char O> static packed_half arithmetic(const packed_half &x, const packed_half &y, const packed_half &z)
+		{
+			packed_half out;
+		#if HALF_PACKED_SSE2
+			for(std::size_t i=0; i<N/8; ++i)
+				out.data_.v[i] = detail::packed_arithmetic<half::round_style,O>(x.data_.v[i], y.data_.v[i], z.data_.v[i]);
+		#else
+			for(std::size_t i=0; i<N; ++i)
+				out.data_.v[i] = static_cast<detail::uint16>((O=='s') ? detail::sqrt<half::round_style>(x.data_.v[i]) : (O=='f') ? 
+					detail::fma<half::round_style>(x.data_.v[i], y.data_.v[i], z.data_.v[i]) : 
+					detail::arithmetic<half::round_style,O>(x.data_.v[i], y.data_.v[i]));
+		#endif
+			return out;
+		}
+
+		/// Compute minima or maxima of packed values.
+		/// \tparam O `<` for minimum, `>` for maximum
+		/// \param x first operands
+		/// \param y second operands
+		/// \return minima or maxima
+		/// \exception FE_INVALID if a value is signaling NaN
+		template<char O> static packed_half minmax(const packed_half &x, const packed_half &y)
+		{
+			packed_half out;
+		#if HALF_PACKED_SSE2
+			for(std::size_t i=0; i<N/8; ++i)
+				out.data_.v[i] = detail::packed_minmax<O>(x.data_.v[i], y.data_.v[i]);
+		#else
+			for(std::size_t i=0; i<N; ++i)
+				out.data_.v[i] = static_cast<detail::uint16>((O=='<') ? detail::fmin(x.data_.v[i], y.data_.v[i]) : 
+					detail::fmax(x.data_.v[i], y.data_.v[i]));
+		#endif
+			return out;
+		}
+
+		/// Compare packed values.
+		/// \tparam O comparison to perform (`=`, `!`, `<`, `>`, `l` for less equal or `g` for greater equal)
+		/// \param x first operands
+		/// \param y second operands
+		/// \return bit mask with bit *i* set if comparison is true for *i*-th values
+		/// \exception FE_INVALID if a value is NaN
+		template<char O> static unsigned long compare(const packed_half &x, const packed_half &y)
+		{
+			unsigned long mask = 0;
+		#if HALF_PACKED_SSE2
+			for(std::size_t i=0; i<N/8; ++i)
+				mask |= static_cast<unsigned long>(detail::packed_compare<O>(x.data_.v[i], y.data_.v[i])) << (8*i);
+		#else
+			for(std::size_t i=0; i<N; ++i)
+			{
+				half a(detail::binary, x.data_.v[i]), b(detail::binary, y.data_.v[i]);
+				mask |= static_cast<unsigned long>((O=='=') ? (a==b) : (O=='!') ? (a!=b) : (O=='<') ? (a<b) : 
+					(O=='>') ? (a>b) : (O=='l') ? (a<=b) : (a>=b)) << i;
+			}
+		#endif
+			return mask;
+		}
+
+		/// Reduce packed values.
+		/// This combines the values at distance \a N / 2, \a N / 4 and so on down to 1, always keeping the first half.
+		/// \tparam O `+` for sum, `<` for minimum, `>` for maximum
+		/// \param x values to reduce
+		/// \return reduced value
+		/// \exception FE_INVALID, ...OVERFLOW, ...UNDERFLOW, ...INEXACT according to operation
+		template<char O> static half reduce(packed_half x)
+		{
+		#if HALF_PACKED_SSE2
+			for(std::size_t n=N/16; n; n/=2)
+				for(std::size_t i=0; i<n; ++i)
+					x.data_.v[i] = (O=='+') ? detail::packed_arithmetic<half::round_style,'+'>(x.data_.v[i], x.data_.v[i+n], x.data_.v[i+n]) : 
+						detail::packed_minmax<O>(x.data_.v[i], x.data_.v[i+n]);
+			return half(detail::binary, detail::packed_reduce<half::round_style,O>(x.data_.v[0]));
+		#else
+			for(std::size_t n=N/2; n; n/=2)
+				for(std::size_t i=0; i<n; ++i)
+					x.data_.v[i] = static_cast<detail::uint16>((O=='+') ? detail::add<half::round_style>(x.data_.v[i], x.data_.v[i+n]) : 
+						(O=='<') ? detail::fmin(x.data_.v[i], x.data_.v[i+n]) : detail::fmax(x.data_.v[i], x.data_.v[i+n]));
+			return half(detail::binary, x.data_.v[0]);
+		#endif
+		}
+
+		/// Internal values
+		detail::packed_storage<N> data_;
+
+	#ifndef HALF_DOXYGEN_ONLY
+		template<std::size_t M> friend packed_half<M> operator-(packed_half<M>);
+		template<std::size_t M> friend packed_half<M> operator+(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend packed_half<M> operator-(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend packed_half<M> operator*(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend packed_half<M> operator/(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend unsigned long operator==(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend unsigned long operator!=(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend unsigned long operator<(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend unsigned long operator>(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend unsigned long operator<=(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend unsigned long operator>=(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend packed_half<M> fabs(packed_half<M>);
+		template<std::size_t M> friend typename detail::packed_type<M>::type fma(packed_half<M>, packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend packed_half<M> fmax(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend packed_half<M> fmin(packed_half<M>, packed_half<M>);
+		template<std::size_t M> friend typename detail::packed_type<M>::type sqrt(packed_half<M>);
+		template<std::size_t M> friend half reduce(packed_half<M>);
+		template<std::size_t M> friend half hmin(packed_half<M>);
+		template<std::size_t M> friend half hmax(packed_half<M>);
+	#endif
+	};
+
+	/// Eight packed half-precision values.
+	/// These are held in an SSE register if SSE2 is enabled at compile-time.
+	typedef packed_half<8> half8;
+
+	/// Sixteen packed half-precision values.
+	/// These are held in two SSE registers if SSE2 is enabled at compile-time.
+	typedef packed_half<16> half16;
+
+	/// \anchor packed
+	/// \name Packed operations
+	/// \{
+
+	/// Identity.
+	/// \param arg operands
+	/// \return unchanged operands
+	template<std::size_t N> packed_half<N> operator+(packed_half<N> arg) { return arg; }
+
+	/// Negation.
+	/// \param arg operands
+	/// \return negated operands
+	template<std::size_t N> packed_half<N> operator-(packed_half<N> arg)
+	{
+	#if HALF_PACKED_SSE2
+		for(std::size_t i=0; i<N/8; ++i)
+			arg.data_.v[i] = _mm_xor_si128(arg.data_.v[i], _mm_set1_epi16(static_cast<short>(0x8000)));
+	#else
+		for(std::size_t i=0; i<N; ++i)
+			arg.data_.v[i] ^= 0x8000;
+	#endif
+		return arg;
+	}
+
+	/// Addition.
+	/// This works like operator+(half,half) for each pair of values.
+	/// \param x left operands
+	/// \param y right operands
+	/// \return sums
+	/// \exception FE_INVALID if adding infinities with different signs or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::size_t N> packed_half<N> operator+(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template arithmetic<'+'>(x, y, y); }
+
+	/// Subtraction.
+	/// This works like operator-(half,half) for each pair of values.
+	/// \param x left operands
+	/// \param y right operands
+	/// \return differences
+	/// \exception FE_INVALID if subtracting infinities with equal signs or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::size_t N> packed_half<N> operator-(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template arithmetic<'-'>(x, y, y); }
+
+	/// Multiplication.
+	/// This works like operator*(half,half) for each pair of values.
+	/// \param x left operands
+	/// \param y right operands
+	/// \return products
+	/// \exception FE_INVALID if multiplying 0 with infinity or if a value is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::size_t N> packed_half<N> operator*(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template arithmetic<'*'>(x, y, y); }
+
+	/// Division.
+	/// This works like operator/(half,half) for each pair of values.
+	/// \param x left operands
+	/// \param y right operands
+	/// \return quotients
+	/// \exception FE_INVALID if dividing 0s or infinities with each other or if a value is signaling NaN
+	/// \exception FE_DIVBYZERO if dividing finite value by 0
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	template<std::size_t N> packed_half<N> operator/(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template arithmetic<'/'>(x, y, y); }
 
-	/// Nearest integer using half's internal rounding mode.
-	/// **See also:** Documentation for [std::llrint](https://en.cppreference.com/w/cpp/numeric/math/rint).
-	/// \param arg half expression to round
-	/// \return nearest integer using default rounding mode
-	/// \exception FE_INVALID if value is not representable as `long long`
-	/// \exception FE_INEXACT if value had to be rounded
-	inline long long llrint(half arg) { return detail::half2int<half::round_style,true,true,long long>(arg.data_); }
-#endif
+	/// Comparison for equality.
+	/// This works like operator==(half,half) for each pair of values.
+	/// \param x first operands
+	/// \param y second operands
+	/// \return bit mask with bit *i* set if *i*-th operands are equal
+	/// \exception FE_INVALID if a value is NaN
+	template<std::size_t N> unsigned long operator==(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template compare<'='>(x, y); }
 
-	/// \}
-	/// \anchor float
-	/// \name Floating point manipulation
-	/// \{
+	/// Comparison for inequality.
+	/// This works like operator!=(half,half) for each pair of values.
+	/// \param x first operands
+	/// \param y second operands
+	/// \return bit mask with bit *i* set if *i*-th operands are not equal
+	/// \exception FE_INVALID if a value is NaN
+	template<std::size_t N> unsigned long operator!=(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template compare<'!'>(x, y); }
 
-	/// Decompress floating-point number.
-	/// **See also:** Documentation for [std::frexp](https://en.cppreference.com/w/cpp/numeric/math/frexp).
-	/// \param arg number to decompress
-	/// \param exp address to store exponent at
-	/// \return significant in range [0.5, 1)
-	/// \exception FE_INVALID for signaling NaN
-	inline half frexp(half arg, int *exp)
+	/// Comparison for less than.
+	/// This works like operator<(half,half) for each pair of values.
+	/// \param x first operands
+	/// \param y second operands
+	/// \return bit mask with bit *i* set if *i*-th value of \a x is less than that of \a y
+	/// \exception FE_INVALID if a value is NaN
+	template<std::size_t N> unsigned long operator<(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template compare<'<'>(x, y); }
+
+	/// Comparison for greater than.
+	/// This works like operator>(half,half) for each pair of values.
+	/// \param x first operands
+	/// \param y second operands
+	/// \return bit mask with bit *i* set if *i*-th value of \a x is greater than that of \a y
+	/// \exception FE_INVALID if a value is NaN
+	template<std::size_t N> unsigned long operator>(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template compare<'>'>(x, y); }
+
+	/// Comparison for less equal.
+	/// This works like operator<=(half,half) for each pair of values.
+	/// \param x first operands
+	/// \param y second operands
+	/// \return bit mask with bit *i* set if *i*-th value of \a x is less than or equal to that of \a y
+	/// \exception FE_INVALID if a value is NaN
+	template<std::size_t N> unsigned long operator<=(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template compare<'l'>(x, y); }
+
+	/// Comparison for greater equal.
+	/// This works like operator>=(half,half) for each pair of values.
+	/// \param x first operands
+	/// \param y second operands
+	/// \return bit mask with bit *i* set if *i*-th value of \a x is greater than or equal to that of \a y
+	/// \exception FE_INVALID if a value is NaN
+	template<std::size_t N> unsigned long operator>=(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template compare<'g'>(x, y); }
+
+	/// Absolute values.
+	/// \param arg operands
+	/// \return absolute values of operands
+	template<std::size_t N> packed_half<N> fabs(packed_half<N> arg)
 	{
-		*exp = 0;
-		unsigned int abs = arg.data_ & 0x7FFF;
-		if(abs >= 0x7C00 || !abs)
-			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		for(; abs<0x400; abs<<=1,--*exp) ;
-		*exp += (abs>>10) - 14;
-		return half(detail::binary, (arg.data_&0x8000)|0x3800|(abs&0x3FF));
+	#if HALF_PACKED_SSE2
+		for(std::size_t i=0; i<N/8; ++i)
+			arg.data_.v[i] = _mm_and_si128(arg.data_.v[i], _mm_set1_epi16(0x7FFF));
+	#else
+		for(std::size_t i=0; i<N; ++i)
+			arg.data_.v[i] &= 0x7FFF;
+	#endif
+		return arg;
 	}
 
-	/// Multiply by power of two.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::scalbln](https://en.cppreference.com/w/cpp/numeric/math/scalbn).
-	/// \param arg number to modify
-	/// \param exp power of two to multiply with
-	/// \return \a arg multplied by 2 raised to \a exp
-	/// \exception FE_INVALID for signaling NaN
+	/// Fused multiply add.
+	/// This works like fma(half,half,half) for each triple of values.
+	/// \param x first factors
+	/// \param y second factors
+	/// \param z summands
+	/// \return ( \a x * \a y ) + \a z rounded as one operation
+	/// \exception FE_INVALID according to operator*() and operator+() unless any argument is a quiet NaN and no argument is a signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding the final addition
+	template<std::size_t N> typename detail::packed_type<N>::type fma(packed_half<N> x, packed_half<N> y, packed_half<N> z) { return packed_half<N>::template arithmetic<'f'>(x, y, z); }
+
+	/// Maximum.
+	/// This works like fmax(half,half) for each pair of values.
+	/// \param x first operands
+	/// \param y second operands
+	/// \return maxima of operands, ignoring quiet NaNs
+	/// \exception FE_INVALID if a value is signaling NaN
+	template<std::size_t N> packed_half<N> fmax(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template minmax<'>'>(x, y); }
+
+	/// Minimum.
+	/// This works like fmin(half,half) for each pair of values.
+	/// \param x first operands
+	/// \param y second operands
+	/// \return minima of operands, ignoring quiet NaNs
+	/// \exception FE_INVALID if a value is signaling NaN
+	template<std::size_t N> packed_half<N> fmin(packed_half<N> x, packed_half<N> y) { return packed_half<N>::template minmax<'<'>(x, y); }
+
+	/// Square root.
+	/// This works like sqrt(half) for each value.
+	/// \param arg operands
+	/// \return square roots of operands
+	/// \exception FE_INVALID for signaling NaN and negative arguments
+	/// \exception FE_INEXACT according to rounding
+	template<std::size_t N> typename detail::packed_type<N>::type sqrt(packed_half<N> arg) { return packed_half<N>::template arithmetic<'s'>(arg, arg, arg); }
+
+	/// Sum of packed values.
+	/// The values are added pairwise in a fixed order, the first half of the values to the second half, then the first quarter 
+	/// to the second quarter and so on, each addition rounding like operator+(half,half). So the result doesn't depend on the 
+	/// instruction set.
+	/// \param arg values to add
+	/// \return sum of values
+	/// \exception FE_INVALID if adding infinities with different signs or if a value is signaling NaN
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half scalbln(half arg, long exp)
+	template<std::size_t N> half reduce(packed_half<N> arg) { return packed_half<N>::template reduce<'+'>(arg); }
+
+	/// Minimum of packed values.
+	/// This combines the values with fmin(half,half) in the same order as reduce().
+	/// \param arg values to reduce
+	/// \return minimum of values, ignoring quiet NaNs
+	/// \exception FE_INVALID if a value is signaling NaN
+	template<std::size_t N> half hmin(packed_half<N> arg) { return packed_half<N>::template reduce<'<'>(arg); }
+
+	/// Maximum of packed values.
+	/// This combines the values with fmax(half,half) in the same order as reduce().
+	/// \param arg values to reduce
+	/// \return maximum of values, ignoring quiet NaNs
+	/// \exception FE_INVALID if a value is signaling NaN
+	template<std::size_t N> half hmax(packed_half<N> arg) { return packed_half<N>::template reduce<'>'>(arg); }
+
+	/// \}
+
+	/// Base class of array expressions.
+	/// Arithmetic on [half_span](\ref half_float::half_span) and [const_half_span](\ref half_float::const_half_span) objects 
+	/// doesn't compute anything right away, but builds up an expression tree deriving from this class. Only assigning it to a 
+	/// [half_span](\ref half_float::half_span) evaluates the whole expression, in a single pass over the arrays, eight values at a 
+	/// time using [half8](\ref half_float::half8) and the remaining values one by one. Each operation of the expression still 
+	/// rounds its result to half-precision, so the results and exceptions are exactly the same as those of evaluating the 
+	/// expression with single half values element by element.
+	/// \tparam E type of actual expression
+	template<typename E> struct half_expr
 	{
-		unsigned int abs = arg.data_ & 0x7FFF, sign = arg.data_ & 0x8000;
-		if(abs >= 0x7C00 || !abs)
-			return (abs>0x7C00) ? half(detail::binary, detail::signal(arg.data_)) : arg;
-		for(; abs<0x400; abs<<=1,--exp) ;
-		exp += abs >> 10;
-		if(exp > 30)
-			return half(detail::binary, detail::overflow<half::round_style>(sign));
-		else if(exp < -10)
-			return half(detail::binary, detail::underflow<half::round_style>(sign));
-		else if(exp > 0)
-			return half(detail::binary, sign|(exp<<10)|(abs&0x3FF));
-		unsigned int m = (abs&0x3FF) | 0x400;
-		return half(detail::binary, detail::rounded<half::round_style,false>(sign|(m>>(1-exp)), (m>>-exp)&1, (m&((1<<-exp)-1))!=0));
-	}
+		/// Get actual expression.
+		/// \return reference to derived expression
+		const E& get() const { return static_cast<const E&>(*this); }
+	};
 
-	/// Multiply by power of two.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::scalbn](https://en.cppreference.com/w/cpp/numeric/math/scalbn).
-	/// \param arg number to modify
-	/// \param exp power of two to multiply with
-	/// \return \a arg multplied by 2 raised to \a exp
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half scalbn(half arg, int exp) { return scalbln(arg, exp); }
+	/// Read-only view of a half-precision array.
+	/// This is used as operand of [array expressions](\ref half_float::half_expr).
+	class const_half_span : public half_expr<const_half_span>
+	{
+	public:
+		/// Constructor.
+		/// \param data array of values
+		/// \param size number of values
+		const_half_span(const half *data, std::size_t size) : data_(data), size_(size) {}
 
-	/// Multiply by power of two.
-	/// This function is exact to rounding for all rounding modes.
-	///
-	/// **See also:** Documentation for [std::ldexp](https://en.cppreference.com/w/cpp/numeric/math/ldexp).
-	/// \param arg number to modify
-	/// \param exp power of two to multiply with
-	/// \return \a arg multplied by 2 raised to \a exp
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	inline half ldexp(half arg, int exp) { return scalbln(arg, exp); }
+		/// Get array.
+		/// \return pointer to first value
+		const half* data() const { return data_; }
 
-	/// Extract integer and fractional parts.
-	/// **See also:** Documentation for [std::modf](https://en.cppreference.com/w/cpp/numeric/math/modf).
-	/// \param arg number to decompress
-	/// \param iptr address to store integer part at
-	/// \return fractional part
-	/// \exception FE_INVALID for signaling NaN
-	inline half modf(half arg, half *iptr)
+		/// Get size.
+		/// \return number of values
+		std::size_t size() const { return size_; }
+
+		/// Access single value.
+		/// \param i index of value
+		/// \return \a i-th value
+		half operator[](std::size_t i) const { return data_[i]; }
+
+		/// Load packed values.
+		/// \param i index of first value
+		/// \return eight values starting at index \a i
+		half8 packed(std::size_t i) const { return half8::load(data_+i); }
+
+	private:
+		/// Array of values.
+		const half *data_;
+
+		/// Number of values.
+		std::size_t size_;
+	};
+
+	/// View of a half-precision array.
+	/// This can be used as operand of [array expressions](\ref half_float::half_expr) and evaluates them when assigned to:
+	/// ~~~~{.cpp}
+	/// half_span out(dst, n);
+	/// out = a*b + c*d - e;
+	/// ~~~~
+	/// The expression has to have at least as many values as this array. The destination array may be an operand of the 
+	/// expression itself, but it must not otherwise overlap with any operand.
+	class half_span : public half_expr<half_span>
 	{
-		unsigned int abs = arg.data_ & 0x7FFF;
-		if(abs > 0x7C00)
+	public:
+		/// Constructor.
+		/// \param data array of values
+		/// \param size number of values
+		half_span(half *data, std::size_t size) : data_(data), size_(size) {}
+
+		/// Copy constructor.
+		/// This creates another view of the same values, unlike assignment, which copies the values.
+		/// \param rhs view to copy
+		half_span(const half_span &rhs) : half_expr<half_span>(), data_(rhs.data_), size_(rhs.size_) {}
+
+		/// Conversion to read-only view.
+		/// \return read-only view of the same values
+		operator const_half_span() const { return const_half_span(data_, size_); }
+
+		/// Get array.
+		/// \return pointer to first value
+		half* data() const { return data_; }
+
+		/// Get size.
+		/// \return number of values
+		std::size_t size() const { return size_; }
+
+		/// Access single value.
+		/// \param i index of value
+		/// \return reference to \a i-th value
+		half& operator[](std::size_t i) const { return data_[i]; }
+
+		/// Load packed values.
+		/// \param i index of first value
+		/// \return eight values starting at index \a i
+		half8 packed(std::size_t i) const { return half8::load(data_+i); }
+
+		/// Copy values.
+		/// \param rhs array to copy values from
+		/// \return reference to this array
+		half_span& operator=(const half_span &rhs) { return assign(rhs); }
+
+		/// Evaluate expression.
+		/// \param rhs expression to evaluate into this array
+		/// \return reference to this array
+		/// \exception FE_... according to operations in expression
+		template<typename E> half_span& operator=(const half_expr<E> &rhs) { return assign(rhs.get()); }
+
+		/// Set all values.
+		/// \param rhs value to assign to all values
+		/// \return reference to this array
+		half_span& operator=(half rhs) { std::fill(data_, data_+size_, rhs); return *this; }
+
+		/// Arithmetic assignment.
+		/// \param rhs expression to add
+		/// \return reference to this array
+		/// \exception FE_... according to operations in expression
+		template<typename E> half_span& operator+=(const half_expr<E> &rhs) { return *this = *this + rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs expression to subtract
+		/// \return reference to this array
+		/// \exception FE_... according to operations in expression
+		template<typename E> half_span& operator-=(const half_expr<E> &rhs) { return *this = *this - rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs expression to multiply with
+		/// \return reference to this array
+		/// \exception FE_... according to operations in expression
+		template<typename E> half_span& operator*=(const half_expr<E> &rhs) { return *this = *this * rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs expression to divide by
+		/// \return reference to this array
+		/// \exception FE_... according to operations in expression
+		template<typename E> half_span& operator/=(const half_expr<E> &rhs) { return *this = *this / rhs; }
+
+		/// Arithmetic assignment.
+		/// \param rhs value to add
+		/// \return reference to this array
+		/// \exception FE_... according to operator+(half,half)
+		half_span& operator+=(half rhs);
+
+		/// Arithmetic assignment.
+		/// \param rhs value to subtract
+		/// \return reference to this array
+		/// \exception FE_... according to operator-(half,half)
+		half_span& operator-=(half rhs);
+
+		/// Arithmetic assignment.
+		/// \param rhs value to multiply with
+		/// \return reference to this array
+		/// \exception FE_... according to operator*(half,half)
+		half_span& operator*=(half rhs);
+
+		/// Arithmetic assignment.
+		/// \param rhs value to divide by
+		/// \return reference to this array
+		/// \exception FE_... according to operator/(half,half)
+		half_span& operator/=(half rhs);
+
+	private:
+		/// Evaluate expression.
+		/// \tparam E type of expression
+		/// \param expr expression to evaluate into this array
+		/// \return reference to this array
+		template<typename E> half_span& assign(const E &expr)
 		{
-			arg = half(detail::binary, detail::signal(arg.data_));
-			return *iptr = arg, arg;
+			std::size_t n = size_ & ~static_cast<std::size_t>(7);
+			for(std::size_t i=0; i<n; i+=8)
+				expr.packed(i).store(data_+i);
+			for(std::size_t i=n; i<size_; ++i)
+				data_[i] = expr[i];
+			return *this;
 		}
-		if(abs >= 0x6400)
-			return *iptr = arg, half(detail::binary, arg.data_&0x8000);
-		if(abs < 0x3C00)
-			return iptr->data_ = arg.data_ & 0x8000, arg;
-		unsigned int exp = abs >> 10, mask = (1<<(25-exp)) - 1, m = arg.data_ & mask;
-		iptr->data_ = arg.data_ & ~mask;
-		if(!m)
-			return half(detail::binary, arg.data_&0x8000);
-		for(; m<0x400; m<<=1,--exp) ;
-		return half(detail::binary, (arg.data_&0x8000)|(exp<<10)|(m&0x3FF));
-	}
 
-	/// Extract exponent.
-	/// **See also:** Documentation for [std::ilogb](https://en.cppreference.com/w/cpp/numeric/math/ilogb).
-	/// \param arg number to query
-	/// \return floating-point exponent
-	/// \retval FP_ILOGB0 for zero
-	/// \retval FP_ILOGBNAN for NaN
-	/// \retval INT_MAX for infinity
-	/// \exception FE_INVALID for 0 or infinite values
-	inline int ilogb(half arg)
+		/// Array of values.
+		half *data_;
+
+		/// Number of values.
+		std::size_t size_;
+	};
+
+	namespace detail
 	{
-		int abs = arg.data_ & 0x7FFF, exp;
-		if(!abs || abs >= 0x7C00)
+		/// Single value in array expression.
+		class scalar_expr : public half_expr<scalar_expr>
 		{
-			detail::raise(FE_INVALID);
-			return !abs ? FP_ILOGB0 : (abs==0x7C00) ? INT_MAX : FP_ILOGBNAN;
-		}
-		for(exp=(abs>>10)-15; abs<0x200; abs<<=1,--exp) ;
-		return exp;
-	}
+		public:
+			/// Constructor.
+			/// \param value value to use for all indices
+			explicit scalar_expr(half value) : value_(value) {}
 
-	/// Extract exponent.
-	/// **See also:** Documentation for [std::logb](https://en.cppreference.com/w/cpp/numeric/math/logb).
-	/// \param arg number to query
-	/// \return floating-point exponent
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_DIVBYZERO for 0
-	inline half logb(half arg)
-	{
-		int abs = arg.data_ & 0x7FFF, exp;
-		if(!abs)
-			return half(detail::binary, detail::pole(0x8000));
-		if(abs >= 0x7C00)
-			return half(detail::binary, (abs==0x7C00) ? 0x7C00 : detail::signal(arg.data_));
-		for(exp=(abs>>10)-15; abs<0x200; abs<<=1,--exp) ;
-		unsigned int value = static_cast<unsigned>(exp<0) << 15;
-		if(exp)
+			/// Evaluate single value.
+			/// \return value
+			half operator[](std::size_t) const { return value_; }
+
+			/// Evaluate packed values.
+			/// \return eight copies of value
+			half8 packed(std::size_t) const { return half8(value_); }
+
+		private:
+			/// Value.
+			half value_;
+		};
+
+		/// Unary operation in array expression.
+		/// \tparam O operation to perform (`-` for negation, `a` for absolute value or `s` for square root)
+		/// \tparam E type of operand expression
+		template<char O,typename E> class unary_expr : public half_expr<unary_expr<O,E> >
 		{
-			unsigned int m = std::abs(exp) << 6;
-			for(exp=18; m<0x400; m<<=1,--exp) ;
-			value |= (exp<<10) + m;
-		}
-		return half(detail::binary, value);
+		public:
+			/// Constructor.
+			/// \param arg operand
+			explicit unary_expr(const E &arg) : arg_(arg) {}
+
+			/// Evaluate single value.
+			/// \param i index of value
+			/// \return \a i-th result
+			half operator[](std::size_t i) const
+			{
+				half x = arg_[i];
+				return (O=='-') ? -x : (O=='a') ? fabs(x) : sqrt(x);
+			}
+
+			/// Evaluate packed values.
+			/// \param i index of first value
+			/// \return eight results starting at index \a i
+			half8 packed(std::size_t i) const
+			{
+				half8 x = arg_.packed(i);
+				return (O=='-') ? -x : (O=='a') ? fabs(x) : sqrt(x);
+			}
+
+		private:
+			/// Operand.
+			E arg_;
+		};
+
+		/// Binary operation in array expression.
+		/// \tparam O operation to perform (`+`, `-`, `*`, `/`, `<` for minimum or `>` for maximum)
+		/// \tparam L type of left operand expression
+		/// \tparam R type of right operand expression
+		template<char O,typename L,typename R> class binary_expr : public half_expr<binary_expr<O,L,R> >
+		{
+		public:
+			/// Constructor.
+			/// \param x left operand
+			/// \param y right operand
+			binary_expr(const L &x, const R &y) : x_(x), y_(y) {}
+
+			/// Evaluate single value.
+			/// \param i index of value
+			/// \return \a i-th result
+			half operator[](std::size_t i) const
+			{
+				half x = x_[i], y = y_[i];
+				return (O=='+') ? (x+y) : (O=='-') ? (x-y) : (O=='*') ? (x*y) : (O=='/') ? (x/y) : (O=='<') ? fmin(x, y) : fmax(x, y);
+			}
+
+			/// Evaluate packed values.
+			/// \param i index of first value
+			/// \return eight results starting at index \a i
+			half8 packed(std::size_t i) const
+			{
+				half8 x = x_.packed(i), y = y_.packed(i);
+				return (O=='+') ? (x+y) : (O=='-') ? (x-y) : (O=='*') ? (x*y) : (O=='/') ? (x/y) : (O=='<') ? fmin(x, y) : fmax(x, y);
+			}
+
+		private:
+			/// Left operand.
+			L x_;
+
+			/// Right operand.
+			R y_;
+		};
+
+		/// Fused multiply-add in array expression.
+		/// \tparam X type of first factor expression
+		/// \tparam Y type of second factor expression
+		/// \tparam Z type of summand expression
+		template<typename X,typename Y,typename Z> class fma_expr : public half_expr<fma_expr<X,Y,Z> >
+		{
+		public:
+			/// Constructor.
+			/// \param x first factor
+			/// \param y second factor
+			/// \param z summand
+			fma_expr(const X &x, const Y &y, const Z &z) : x_(x), y_(y), z_(z) {}
+
+			/// Evaluate single value.
+			/// \param i index of value
+			/// \return \a i-th result
+			half operator[](std::size_t i) const { return fma(x_[i], y_[i], z_[i]); }
+
+			/// Evaluate packed values.
+			/// \param i index of first value
+			/// \return eight results starting at index \a i
+			half8 packed(std::size_t i) const { return fma(x_.packed(i), y_.packed(i), z_.packed(i)); }
+
+		private:
+			/// First factor.
+			X x_;
+
+			/// Second factor.
+			Y y_;
+
+			/// Summand.
+			Z z_;
+		};
 	}
 
-	/// Next representable value.
-	/// **See also:** Documentation for [std::nextafter](https://en.cppreference.com/w/cpp/numeric/math/nextafter).
-	/// \param from value to compute next representable value for
-	/// \param to direction towards which to compute next value
-	/// \return next representable value after \a from in direction towards \a to
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW for infinite result from finite argument
-	/// \exception FE_UNDERFLOW for subnormal result
-	inline half nextafter(half from, half to)
-	{
-		int fabs = from.data_ & 0x7FFF, tabs = to.data_ & 0x7FFF;
-		if(fabs > 0x7C00 || tabs > 0x7C00)
-			return half(detail::binary, detail::signal(from.data_, to.data_));
-		if(from.data_ == to.data_ || !(fabs|tabs))
-			return to;
-		if(!fabs)
-		{
-			detail::raise(FE_UNDERFLOW, !HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT);
-			return half(detail::binary, (to.data_&0x8000)+1);
-		}
-		unsigned int out = from.data_ + (((from.data_>>15)^static_cast<unsigned>(
-			(from.data_^(0x8000|(0x8000-(from.data_>>15))))<(to.data_^(0x8000|(0x8000-(to.data_>>15))))))<<1) - 1;
-		detail::raise(FE_OVERFLOW, fabs<0x7C00 && (out&0x7C00)==0x7C00);
-		detail::raise(FE_UNDERFLOW, !HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT && (out&0x7C00)<0x400);
-		return half(detail::binary, out);
-	}
+	/// \anchor expressions
+	/// \name Array expressions
+	/// \{
+
+	/// Negation.
+	/// \param arg operand expression
+	/// \return expression negating operands
+	template<typename E> detail::unary_expr<'-',E> operator-(const half_expr<E> &arg) { return detail::unary_expr<'-',E>(arg.get()); }
+
+	/// Addition.
+	/// \param x left operand expression
+	/// \param y right operand expression
+	/// \return expression adding operands according to operator+(half,half)
+	template<typename L,typename R> detail::binary_expr<'+',L,R> operator+(const half_expr<L> &x, const half_expr<R> &y) { return detail::binary_expr<'+',L,R>(x.get(), y.get()); }
+
+	/// Addition.
+	/// \param x left operand expression
+	/// \param y right operand
+	/// \return expression adding operands according to operator+(half,half)
+	template<typename L> detail::binary_expr<'+',L,detail::scalar_expr> operator+(const half_expr<L> &x, half y) { return detail::binary_expr<'+',L,detail::scalar_expr>(x.get(), detail::scalar_expr(y)); }
+
+	/// Addition.
+	/// \param x left operand
+	/// \param y right operand expression
+	/// \return expression adding operands according to operator+(half,half)
+	template<typename R> detail::binary_expr<'+',detail::scalar_expr,R> operator+(half x, const half_expr<R> &y) { return detail::binary_expr<'+',detail::scalar_expr,R>(detail::scalar_expr(x), y.get()); }
+
+	/// Subtraction.
+	/// \param x left operand expression
+	/// \param y right operand expression
+	/// \return expression subtracting operands according to operator-(half,half)
+	template<typename L,typename R> detail::binary_expr<'-',L,R> operator-(const half_expr<L> &x, const half_expr<R> &y) { return detail::binary_expr<'-',L,R>(x.get(), y.get()); }
+
+	/// Subtraction.
+	/// \param x left operand expression
+	/// \param y right operand
+	/// \return expression subtracting operands according to operator-(half,half)
+	template<typename L> detail::binary_expr<'-',L,detail::scalar_expr> operator-(const half_expr<L> &x, half y) { return detail::binary_expr<'-',L,detail::scalar_expr>(x.get(), detail::scalar_expr(y)); }
+
+	/// Subtraction.
+	/// \param x left operand
+	/// \param y right operand expression
+	/// \return expression subtracting operands according to operator-(half,half)
+	template<typename R> detail::binary_expr<'-',detail::scalar_expr,R> operator-(half x, const half_expr<R> &y) { return detail::binary_expr<'-',detail::scalar_expr,R>(detail::scalar_expr(x), y.get()); }
+
+	/// Multiplication.
+	/// \param x left operand expression
+	/// \param y right operand expression
+	/// \return expression multiplying operands according to operator*(half,half)
+	template<typename L,typename R> detail::binary_expr<'*',L,R> operator*(const half_expr<L> &x, const half_expr<R> &y) { return detail::binary_expr<'*',L,R>(x.get(), y.get()); }
+
+	/// Multiplication.
+	/// \param x left operand expression
+	/// \param y right operand
+	/// \return expression multiplying operands according to operator*(half,half)
+	template<typename L> detail::binary_expr<'*',L,detail::scalar_expr> operator*(const half_expr<L> &x, half y) { return detail::binary_expr<'*',L,detail::scalar_expr>(x.get(), detail::scalar_expr(y)); }
+
+	/// Multiplication.
+	/// \param x left operand
+	/// \param y right operand expression
+	/// \return expression multiplying operands according to operator*(half,half)
+	template<typename R> detail::binary_expr<'*',detail::scalar_expr,R> operator*(half x, const half_expr<R> &y) { return detail::binary_expr<'*',detail::scalar_expr,R>(detail::scalar_expr(x), y.get()); }
+
+	/// Division.
+	/// \param x left operand expression
+	/// \param y right operand expression
+	/// \return expression dividing operands according to operator/(half,half)
+	template<typename L,typename R> detail::binary_expr<'/',L,R> operator/(const half_expr<L> &x, const half_expr<R> &y) { return detail::binary_expr<'/',L,R>(x.get(), y.get()); }
+
+	/// Division.
+	/// \param x left operand expression
+	/// \param y right operand
+	/// \return expression dividing operands according to operator/(half,half)
+	template<typename L> detail::binary_expr<'/',L,detail::scalar_expr> operator/(const half_expr<L> &x, half y) { return detail::binary_expr<'/',L,detail::scalar_expr>(x.get(), detail::scalar_expr(y)); }
+
+	/// Division.
+	/// \param x left operand
+	/// \param y right operand expression
+	/// \return expression dividing operands according to operator/(half,half)
+	template<typename R> detail::binary_expr<'/',detail::scalar_expr,R> operator/(half x, const half_expr<R> &y) { return detail::binary_expr<'/',detail::scalar_expr,R>(detail::scalar_expr(x), y.get()); }
+
+	/// Absolute value.
+	/// \param arg operand expression
+	/// \return expression computing absolute values of operands
+	template<typename E> detail::unary_expr<'a',E> fabs(const half_expr<E> &arg) { return detail::unary_expr<'a',E>(arg.get()); }
+
+	/// Square root.
+	/// \param arg operand expression
+	/// \return expression computing square roots of operands according to sqrt(half)
+	template<typename E> detail::unary_expr<'s',E> sqrt(const half_expr<E> &arg) { return detail::unary_expr<'s',E>(arg.get()); }
+
+	/// Minimum.
+	/// \param x first operand expression
+	/// \param y second operand expression
+	/// \return expression computing minima of operands according to fmin(half,half)
+	template<typename L,typename R> detail::binary_expr<'<',L,R> fmin(const half_expr<L> &x, const half_expr<R> &y) { return detail::binary_expr<'<',L,R>(x.get(), y.get()); }
+
+	/// Maximum.
+	/// \param x first operand expression
+	/// \param y second operand expression
+	/// \return expression computing maxima of operands according to fmax(half,half)
+	template<typename L,typename R> detail::binary_expr<'>',L,R> fmax(const half_expr<L> &x, const half_expr<R> &y) { return detail::binary_expr<'>',L,R>(x.get(), y.get()); }
 
-	/// Next representable value.
-	/// **See also:** Documentation for [std::nexttoward](https://en.cppreference.com/w/cpp/numeric/math/nexttoward).
-	/// \param from value to compute next representable value for
-	/// \param to direction towards which to compute next value
-	/// \return next representable value after \a from in direction towards \a to
-	/// \exception FE_INVALID for signaling NaN
-	/// \exception FE_OVERFLOW for infinite result from finite argument
-	/// \exception FE_UNDERFLOW for subnormal result
-	inline half nexttoward(half from, long double to)
+	/// Fused multiply add.
+	/// \param x first factor expression
+	/// \param y second factor expression
+	/// \param z summand expression
+	/// \return expression computing fused multiply-adds of operands according to fma(half,half,half)
+	template<typename X,typename Y,typename Z> detail::fma_expr<X,Y,Z> fma(const half_expr<X> &x, const half_expr<Y> &y, const half_expr<Z> &z) { return detail::fma_expr<X,Y,Z>(x.get(), y.get(), z.get()); }
+
+	/// \}
+
+	inline half_span& half_span::operator+=(half rhs) { return *this = *this + rhs; }
+	inline half_span& half_span::operator-=(half rhs) { return *this = *this - rhs; }
+	inline half_span& half_span::operator*=(half rhs) { return *this = *this * rhs; }
+	inline half_span& half_span::operator/=(half rhs) { return *this = *this / rhs; }
+
+	/// Interval of half-precision values.
+	/// This holds a lower and an upper bound and computes with them so that the exact result of every operation on any values 
+	/// inside the operand intervals is guaranteed to lie inside the resulting interval. Lower bounds are rounded toward negative 
+	/// and upper bounds toward positive infinity, using the [rounding mode templates](\ref half_float::add) of the corresponding 
+	/// operations. This makes it possible to bound the rounding and quantization errors of whole computations in half-precision 
+	/// at a small constant cost per operation.
+	///
+	/// Intervals with NaN bounds are invalid and result from NaN operands, from infinite bounds cancelling each other or from 
+	/// functions applied entirely outside their domains, like the square root of negative intervals. Division by an interval 
+	/// containing zero results in the entire range from negative to positive infinity. The enclosures are only guaranteed if 
+	/// [flushing](\ref HALF_FLUSH_DENORMALS) of subnormal values is disabled.
+	class half_interval
 	{
-		int fabs = from.data_ & 0x7FFF;
-		if(fabs > 0x7C00)
-			return half(detail::binary, detail::signal(from.data_));
-		long double lfrom = static_cast<long double>(from);
-		if(detail::builtin_isnan(to) || lfrom == to)
-			return half(static_cast<float>(to));
-		if(!fabs)
-		{
-			detail::raise(FE_UNDERFLOW, !HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT);
-			return half(detail::binary, (static_cast<unsigned>(detail::builtin_signbit(to))<<15)+1);
-		}
-		unsigned int out = from.data_ + (((from.data_>>15)^static_cast<unsigned>(lfrom<to))<<1) - 1;
-		detail::raise(FE_OVERFLOW, (out&0x7FFF)==0x7C00);
-		detail::raise(FE_UNDERFLOW, !HALF_ERRHANDLING_UNDERFLOW_TO_INEXACT && (out&0x7FFF)<0x400);
-		return half(detail::binary, out);
-	}
+	#if HALF_ENABLE_CPP11_STATIC_ASSERT
+		static_assert(sizeof(half)==2, "half_interval requires half to be 16 bits");
+	#endif
 
-	/// Take sign.
-	/// **See also:** Documentation for [std::copysign](https://en.cppreference.com/w/cpp/numeric/math/copysign).
-	/// \param x value to change sign for
-	/// \param y value to take sign from
-	/// \return value equal to \a x in magnitude and to \a y in sign
-	inline HALF_CONSTEXPR half copysign(half x, half y) { return half(detail::binary, x.data_^((x.data_^y.data_)&0x8000)); }
+	public:
+		/// Default constructor.
+		/// This initializes the interval to contain only positive zero.
+		HALF_CONSTEXPR half_interval() HALF_NOEXCEPT : lower_(), upper_() {}
+
+		/// Construction from single value.
+		/// \param value value to use for both bounds
+		HALF_CONSTEXPR half_interval(half value) HALF_NOEXCEPT : lower_(value), upper_(value) {}
+
+		/// Construction from bounds.
+		/// \param lower lower bound
+		/// \param upper upper bound (should not be smaller than \a lower)
+		HALF_CONSTEXPR half_interval(half lower, half upper) HALF_NOEXCEPT : lower_(lower), upper_(upper) {}
+
+		/// Conversion from single-precision.
+		/// This gives the closest enclosure of \a value in half-precision, which contains just one value if it is exactly 
+		/// representable or the two adjacent half-precision values otherwise.
+		/// \param value single-precision value to enclose
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		explicit half_interval(float value) : lower_(half_cast<half,std::round_toward_neg_infinity>(value)), 
+			upper_(half_cast<half,std::round_toward_infinity>(value)) {}
 
-	/// \}
-	/// \anchor classification
-	/// \name Floating point classification
+		/// Conversion from double-precision.
+		/// This gives the closest enclosure of \a value in half-precision, which contains just one value if it is exactly 
+		/// representable or the two adjacent half-precision values otherwise.
+		/// \param value double-precision value to enclose
+		/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+		explicit half_interval(double value) : lower_(half_cast<half,std::round_toward_neg_infinity>(value)), 
+			upper_(half_cast<half,std::round_toward_infinity>(value)) {}
+
+		/// Get lower bound.
+		/// \return lower bound
+		HALF_CONSTEXPR half lower() const HALF_NOEXCEPT { return lower_; }
+
+		/// Get upper bound.
+		/// \return upper bound
+		HALF_CONSTEXPR half upper() const HALF_NOEXCEPT { return upper_; }
+
+		/// Width of interval.
+		/// \return difference between bounds rounded toward positive infinity
+		/// \exception FE_INVALID for NaN bounds
+		/// \exception FE_OVERFLOW, ...INEXACT according to rounding
+		half width() const { return sub<std::round_toward_infinity>(upper_, lower_); }
+
+		/// Check whether value is inside interval.
+		/// \param value value to check
+		/// \retval true if \a value lies between the bounds
+		/// \retval false else
+		/// \exception FE_INVALID if \a value or a bound is NaN
+		bool contains(half value) const { return lower_ <= value && value <= upper_; }
+
+		/// Arithmetic assignment.
+		/// \param rhs interval to add
+		/// \return reference to this interval
+		/// \exception FE_... according to operator+(half_interval,half_interval)
+		half_interval& operator+=(half_interval rhs);
+
+		/// Arithmetic assignment.
+		/// \param rhs interval to subtract
+		/// \return reference to this interval
+		/// \exception FE_... according to operator-(half_interval,half_interval)
+		half_interval& operator-=(half_interval rhs);
+
+		/// Arithmetic assignment.
+		/// \param rhs interval to multiply with
+		/// \return reference to this interval
+		/// \exception FE_... according to operator*(half_interval,half_interval)
+		half_interval& operator*=(half_interval rhs);
+
+		/// Arithmetic assignment.
+		/// \param rhs interval to divide by
+		/// \return reference to this interval
+		/// \exception FE_... according to operator/(half_interval,half_interval)
+		half_interval& operator/=(half_interval rhs);
+
+	private:
+		/// Lower bound.
+		half lower_;
+
+		/// Upper bound.
+		half upper_;
+	};
+
+	/// \anchor interval
+	/// \name Interval operations
 	/// \{
 
-	/// Classify floating-point value.
-	/// **See also:** Documentation for [std::fpclassify](https://en.cppreference.com/w/cpp/numeric/math/fpclassify).
-	/// \param arg number to classify
-	/// \retval FP_ZERO for positive and negative zero
-	/// \retval FP_SUBNORMAL for subnormal numbers
-	/// \retval FP_INFINITY for positive and negative infinity
-	/// \retval FP_NAN for NaNs
-	/// \retval FP_NORMAL for all other (normal) values
-	inline HALF_CONSTEXPR int fpclassify(half arg)
-	{
-		return	!(arg.data_&0x7FFF) ? FP_ZERO :
-				((arg.data_&0x7FFF)<0x400) ? FP_SUBNORMAL :
-				((arg.data_&0x7FFF)<0x7C00) ? FP_NORMAL :
-				((arg.data_&0x7FFF)==0x7C00) ? FP_INFINITE :
-				FP_NAN;
-	}
+	/// Equality comparison.
+	/// \param x first interval
+	/// \param y second interval
+	/// \retval true if both bounds are equal
+	/// \retval false else
+	/// \exception FE_INVALID if a bound is NaN
+	inline bool operator==(half_interval x, half_interval y) { return x.lower() == y.lower() && x.upper() == y.upper(); }
 
-	/// Check if finite number.
-	/// **See also:** Documentation for [std::isfinite](https://en.cppreference.com/w/cpp/numeric/math/isfinite).
-	/// \param arg number to check
-	/// \retval true if neither infinity nor NaN
+	/// Inequality comparison.
+	/// \param x first interval
+	/// \param y second interval
+	/// \retval true if any bounds differ
 	/// \retval false else
-	inline HALF_CONSTEXPR bool isfinite(half arg) { return (arg.data_&0x7C00) != 0x7C00; }
+	/// \exception FE_INVALID if a bound is NaN
+	inline bool operator!=(half_interval x, half_interval y) { return !(x == y); }
 
-	/// Check for infinity.
-	/// **See also:** Documentation for [std::isinf](https://en.cppreference.com/w/cpp/numeric/math/isinf).
-	/// \param arg number to check
-	/// \retval true for positive or negative infinity
+	/// Comparison for less than.
+	/// \param x first interval
+	/// \param y second interval
+	/// \retval true if every value of \a x is less than every value of \a y
 	/// \retval false else
-	inline HALF_CONSTEXPR bool isinf(half arg) { return (arg.data_&0x7FFF) == 0x7C00; }
+	/// \exception FE_INVALID if a bound is NaN
+	inline bool operator<(half_interval x, half_interval y) { return x.upper() < y.lower(); }
 
-	/// Check for NaN.
-	/// **See also:** Documentation for [std::isnan](https://en.cppreference.com/w/cpp/numeric/math/isnan).
-	/// \param arg number to check
-	/// \retval true for NaNs
+	/// Comparison for greater than.
+	/// \param x first interval
+	/// \param y second interval
+	/// \retval true if every value of \a x is greater than every value of \a y
 	/// \retval false else
-	inline HALF_CONSTEXPR bool isnan(half arg) { return (arg.data_&0x7FFF) > 0x7C00; }
+	/// \exception FE_INVALID if a bound is NaN
+	inline bool operator>(half_interval x, half_interval y) { return x.lower() > y.upper(); }
 
-	/// Check if normal number.
-	/// **See also:** Documentation for [std::isnormal](https://en.cppreference.com/w/cpp/numeric/math/isnormal).
-	/// \param arg number to check
-	/// \retval true if normal number
-	/// \retval false if either subnormal, zero, infinity or NaN
-	inline HALF_CONSTEXPR bool isnormal(half arg) { return ((arg.data_&0x7C00)!=0) & ((arg.data_&0x7C00)!=0x7C00); }
+	/// Comparison for less equal.
+	/// \param x first interval
+	/// \param y second interval
+	/// \retval true if every value of \a x is less than or equal to every value of \a y
+	/// \retval false else
+	/// \exception FE_INVALID if a bound is NaN
+	inline bool operator<=(half_interval x, half_interval y) { return x.upper() <= y.lower(); }
 
-	/// Check sign.
-	/// **See also:** Documentation for [std::signbit](https://en.cppreference.com/w/cpp/numeric/math/signbit).
-	/// \param arg number to check
-	/// \retval true for negative number
-	/// \retval false for positive number
-	inline HALF_CONSTEXPR bool signbit(half arg) { return (arg.data_&0x8000) != 0; }
+	/// Comparison for greater equal.
+	/// \param x first interval
+	/// \param y second interval
+	/// \retval true if every value of \a x is greater than or equal to every value of \a y
+	/// \retval false else
+	/// \exception FE_INVALID if a bound is NaN
+	inline bool operator>=(half_interval x, half_interval y) { return x.lower() >= y.upper(); }
 
-	/// \}
-	/// \anchor compfunc
-	/// \name Comparison
-	/// \{
+	/// Identity.
+	/// \param arg operand
+	/// \return unchanged operand
+	inline HALF_CONSTEXPR half_interval operator+(half_interval arg) { return arg; }
 
-	/// Quiet comparison for greater than.
-	/// **See also:** Documentation for [std::isgreater](https://en.cppreference.com/w/cpp/numeric/math/isgreater).
+	/// Negation.
+	/// \param arg operand
+	/// \return interval of negated values
+	inline half_interval operator-(half_interval arg) { return half_interval(-arg.upper(), -arg.lower()); }
+
+	/// Addition.
 	/// \param x first operand
 	/// \param y second operand
-	/// \retval true if \a x greater than \a y
-	/// \retval false else
-	inline HALF_CONSTEXPR bool isgreater(half x, half y)
+	/// \return enclosure of sums of operands
+	/// \exception FE_INVALID if adding infinities with different signs or if a bound is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half_interval operator+(half_interval x, half_interval y)
 	{
-		return ((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) > ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15)) && !isnan(x) && !isnan(y);
+		return half_interval(add<std::round_toward_neg_infinity>(x.lower(), y.lower()), 
+			add<std::round_toward_infinity>(x.upper(), y.upper()));
 	}
 
-	/// Quiet comparison for greater equal.
-	/// **See also:** Documentation for [std::isgreaterequal](https://en.cppreference.com/w/cpp/numeric/math/isgreaterequal).
+	/// Subtraction.
 	/// \param x first operand
 	/// \param y second operand
-	/// \retval true if \a x greater equal \a y
-	/// \retval false else
-	inline HALF_CONSTEXPR bool isgreaterequal(half x, half y)
+	/// \return enclosure of differences of operands
+	/// \exception FE_INVALID if subtracting infinities with equal signs or if a bound is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half_interval operator-(half_interval x, half_interval y)
 	{
-		return ((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) >= ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15)) && !isnan(x) && !isnan(y);
+		return half_interval(sub<std::round_toward_neg_infinity>(x.lower(), y.upper()), 
+			sub<std::round_toward_infinity>(x.upper(), y.lower()));
 	}
 
-	/// Quiet comparison for less than.
-	/// **See also:** Documentation for [std::isless](https://en.cppreference.com/w/cpp/numeric/math/isless).
+	/// Multiplication.
+	/// This computes the products of all four combinations of bounds, ignoring NaNs from multiplying zero and infinite bounds.
 	/// \param x first operand
 	/// \param y second operand
-	/// \retval true if \a x less than \a y
-	/// \retval false else
-	inline HALF_CONSTEXPR bool isless(half x, half y)
+	/// \return enclosure of products of operands
+	/// \exception FE_INVALID if multiplying zero and infinite bounds or if a bound is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half_interval operator*(half_interval x, half_interval y)
 	{
-		return ((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) < ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15)) && !isnan(x) && !isnan(y);
+		half lo = mul<std::round_toward_neg_infinity>(x.lower(), y.lower()), hi = mul<std::round_toward_infinity>(x.lower(), y.lower());
+		lo = fmin(lo, mul<std::round_toward_neg_infinity>(x.lower(), y.upper()));
+		hi = fmax(hi, mul<std::round_toward_infinity>(x.lower(), y.upper()));
+		lo = fmin(lo, mul<std::round_toward_neg_infinity>(x.upper(), y.lower()));
+		hi = fmax(hi, mul<std::round_toward_infinity>(x.upper(), y.lower()));
+		lo = fmin(lo, mul<std::round_toward_neg_infinity>(x.upper(), y.upper()));
+		hi = fmax(hi, mul<std::round_toward_infinity>(x.upper(), y.upper()));
+		return half_interval(lo, hi);
 	}
 
-	/// Quiet comparison for less equal.
-	/// **See also:** Documentation for [std::islessequal](https://en.cppreference.com/w/cpp/numeric/math/islessequal).
+	/// Division.
+	/// This computes the quotients of all four combinations of bounds, ignoring NaNs from dividing infinite bounds. If \a y 
+	/// contains zero, the result is the entire range from negative to positive infinity, without raising exceptions.
 	/// \param x first operand
 	/// \param y second operand
-	/// \retval true if \a x less equal \a y
-	/// \retval false else
-	inline HALF_CONSTEXPR bool islessequal(half x, half y)
+	/// \return enclosure of quotients of operands
+	/// \exception FE_INVALID if dividing infinite bounds or if a bound is signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half_interval operator/(half_interval x, half_interval y)
 	{
-		return ((x.data_^(0x8000|(0x8000-(x.data_>>15))))+(x.data_>>15)) <= ((y.data_^(0x8000|(0x8000-(y.data_>>15))))+(y.data_>>15)) && !isnan(x) && !isnan(y);
+		bool zero = !isnan(y.lower()) && !isnan(y.upper()) && y.lower() <= half() && y.upper() >= half();
+		if(zero)
+			y = half_interval(static_cast<half>(1.0f));
+		half lo = div<std::round_toward_neg_infinity>(x.lower(), y.lower()), hi = div<std::round_toward_infinity>(x.lower(), y.lower());
+		lo = fmin(lo, div<std::round_toward_neg_infinity>(x.lower(), y.upper()));
+		hi = fmax(hi, div<std::round_toward_infinity>(x.lower(), y.upper()));
+		lo = fmin(lo, div<std::round_toward_neg_infinity>(x.upper(), y.lower()));
+		hi = fmax(hi, div<std::round_toward_infinity>(x.upper(), y.lower()));
+		lo = fmin(lo, div<std::round_toward_neg_infinity>(x.upper(), y.upper()));
+		hi = fmax(hi, div<std::round_toward_infinity>(x.upper(), y.upper()));
+		if(zero && !isnan(lo))
+			return half_interval(-std::numeric_limits<half>::infinity(), std::numeric_limits<half>::infinity());
+		return half_interval(lo, hi);
 	}
 
-	/// Quiet comarison for less or greater.
-	/// **See also:** Documentation for [std::islessgreater](https://en.cppreference.com/w/cpp/numeric/math/islessgreater).
-	/// \param x first operand
-	/// \param y second operand
-	/// \retval true if either less or greater
-	/// \retval false else
-	inline HALF_CONSTEXPR bool islessgreater(half x, half y)
+	/// Square root.
+	/// Negative values are ignored, as long as the interval isn't entirely negative.
+	/// \param arg operand
+	/// \return enclosure of square roots of non-negative values of \a arg, NaN bounds if there are none
+	/// \exception FE_INVALID if \a arg is entirely negative or if a bound is signaling NaN
+	/// \exception FE_INEXACT according to rounding
+	inline half_interval sqrt(half_interval arg)
 	{
-		return x.data_!=y.data_ && ((x.data_|y.data_)&0x7FFF) && !isnan(x) && !isnan(y);
+		half hi = sqrt<std::round_toward_infinity>(arg.upper());
+		return half_interval(isnan(hi) ? hi : sqrt<std::round_toward_neg_infinity>(fmax(arg.lower(), half())), hi);
 	}
 
-	/// Quiet check if unordered.
-	/// **See also:** Documentation for [std::isunordered](https://en.cppreference.com/w/cpp/numeric/math/isunordered).
-	/// \param x first operand
-	/// \param y second operand
-	/// \retval true if unordered (one or two NaN operands)
-	/// \retval false else
-	inline HALF_CONSTEXPR bool isunordered(half x, half y) { return isnan(x) || isnan(y); }
+	/// Exponential function.
+	/// \param arg operand
+	/// \return enclosure of exponentials of \a arg
+	/// \exception FE_INVALID for signaling NaN
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half_interval exp(half_interval arg)
+	{
+		return half_interval(exp<std::round_toward_neg_infinity>(arg.lower()), exp<std::round_toward_infinity>(arg.upper()));
+	}
 
-	/// \}
-	/// \anchor casting
-	/// \name Casting
-	/// \{
+	/// Natural logarithm.
+	/// Negative values are ignored, as long as the interval isn't entirely negative.
+	/// \param arg operand
+	/// \return enclosure of logarithms of non-negative values of \a arg, NaN bounds if there are none
+	/// \exception FE_INVALID if \a arg is entirely negative or if a bound is signaling NaN
+	/// \exception FE_DIVBYZERO if \a arg contains zero
+	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
+	inline half_interval log(half_interval arg)
+	{
+		half hi = log<std::round_toward_infinity>(arg.upper());
+		return half_interval(isnan(hi) ? hi : log<std::round_toward_neg_infinity>(fmax(arg.lower(), half())), hi);
+	}
 
-	/// Cast to or from half-precision floating-point number.
-	/// This casts between [half](\ref half_float::half) and any built-in arithmetic type. The values are converted 
-	/// directly using the default rounding mode, without any roundtrip over `float` that a `static_cast` would otherwise do.
-	///
-	/// Using this cast with neither of the two types being a [half](\ref half_float::half) or with any of the two types 
-	/// not being a built-in arithmetic type (apart from [half](\ref half_float::half), of course) results in a compiler 
-	/// error and casting between [half](\ref half_float::half)s returns the argument unmodified.
-	/// \tparam T destination type (half or built-in arithmetic type)
-	/// \tparam U source type (half or built-in arithmetic type)
-	/// \param arg value to cast
-	/// \return \a arg converted to destination type
-	/// \exception FE_INVALID if \a T is integer type and result is not representable as \a T
+	/// Add arrays of half-precision intervals.
+	/// This computes `dst[i] = x[i] + y[i]` for \a n consecutive intervals, with the results and exceptions being identical to 
+	/// those of operator+(half_interval,half_interval). But the bounds are computed in blocks using the 
+	/// [batch arithmetic](\ref batch_arithmetic) kernels, making this much faster for large arrays.
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a x or \a y, but should not overlap them otherwise)
+	/// \param n number of intervals to compute
+	/// \exception FE_... according to operator+(half_interval,half_interval)
+	inline void add(const half_interval *x, const half_interval *y, half_interval *dst, std::size_t n)
+	{
+		detail::interval_n<'+'>(reinterpret_cast<const detail::uint16*>(x), reinterpret_cast<const detail::uint16*>(y), 
+			reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Subtract arrays of half-precision intervals.
+	/// This works like add(const half_interval*,const half_interval*,half_interval*,std::size_t) but computes 
+	/// `dst[i] = x[i] - y[i]` like operator-(half_interval,half_interval).
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a x or \a y, but should not overlap them otherwise)
+	/// \param n number of intervals to compute
+	/// \exception FE_... according to operator-(half_interval,half_interval)
+	inline void sub(const half_interval *x, const half_interval *y, half_interval *dst, std::size_t n)
+	{
+		detail::interval_n<'-'>(reinterpret_cast<const detail::uint16*>(x), reinterpret_cast<const detail::uint16*>(y), 
+			reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Multiply arrays of half-precision intervals.
+	/// This works like add(const half_interval*,const half_interval*,half_interval*,std::size_t) but computes 
+	/// `dst[i] = x[i] * y[i]` like operator*(half_interval,half_interval).
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a x or \a y, but should not overlap them otherwise)
+	/// \param n number of intervals to compute
+	/// \exception FE_... according to operator*(half_interval,half_interval)
+	inline void mul(const half_interval *x, const half_interval *y, half_interval *dst, std::size_t n)
+	{
+		detail::interval_n<'*'>(reinterpret_cast<const detail::uint16*>(x), reinterpret_cast<const detail::uint16*>(y), 
+			reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Divide arrays of half-precision intervals.
+	/// This works like add(const half_interval*,const half_interval*,half_interval*,std::size_t) but computes 
+	/// `dst[i] = x[i] / y[i]` like operator/(half_interval,half_interval).
+	/// \param x array of first operands
+	/// \param y array of second operands
+	/// \param dst array to store results at (may be identical to \a x or \a y, but should not overlap them otherwise)
+	/// \param n number of intervals to compute
+	/// \exception FE_... according to operator/(half_interval,half_interval)
+	inline void div(const half_interval *x, const half_interval *y, half_interval *dst, std::size_t n)
+	{
+		detail::interval_n<'/'>(reinterpret_cast<const detail::uint16*>(x), reinterpret_cast<const detail::uint16*>(y), 
+			reinterpret_cast<detail::uint16*>(dst), n);
+	}
+
+	/// Convert array of single-precision values to half-precision intervals.
+	/// This computes `dst[i] = half_interval(src[i])` for \a n consecutive values, converting whole blocks of bounds at once 
+	/// using the [selected instruction sets](\ref simd_level). This is the fastest way to bound the quantization error of large 
+	/// arrays of values.
+	/// \param src array of values to convert
+	/// \param dst array to store intervals at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	template<typename T,typename U> T half_cast(U arg) { return detail::half_caster<T,U>::cast(arg); }
+	inline void convert(const float *src, half_interval *dst, std::size_t n)
+	{
+		detail::interval_convert_n(src, reinterpret_cast<detail::uint16*>(dst), n);
+	}
 
-	/// Cast to or from half-precision floating-point number.
-	/// This casts between [half](\ref half_float::half) and any built-in arithmetic type. The values are converted 
-	/// directly using the specified rounding mode, without any roundtrip over `float` that a `static_cast` would otherwise do.
-	///
-	/// Using this cast with neither of the two types being a [half](\ref half_float::half) or with any of the two types 
-	/// not being a built-in arithmetic type (apart from [half](\ref half_float::half), of course) results in a compiler 
-	/// error and casting between [half](\ref half_float::half)s returns the argument unmodified.
-	/// \tparam T destination type (half or built-in arithmetic type)
-	/// \tparam R rounding mode to use.
-	/// \tparam U source type (half or built-in arithmetic type)
-	/// \param arg value to cast
-	/// \return \a arg converted to destination type
-	/// \exception FE_INVALID if \a T is integer type and result is not representable as \a T
+	/// Convert array of double-precision values to half-precision intervals.
+	/// This works like convert(const float*,half_interval*,std::size_t) but rounds double-precision values directly.
+	/// \param src array of values to convert
+	/// \param dst array to store intervals at (should not overlap \a src)
+	/// \param n number of values to convert
 	/// \exception FE_OVERFLOW, ...UNDERFLOW, ...INEXACT according to rounding
-	template<typename T,std::float_round_style R,typename U> T half_cast(U arg) { return detail::half_caster<T,U,R>::cast(arg); }
-	/// \}
+	inline void convert(const double *src, half_interval *dst, std::size_t n)
+	{
+		detail::interval_convert_n(src, reinterpret_cast<detail::uint16*>(dst), n);
+	}
 
 	/// \}
+
+	inline half_interval& half_interval::operator+=(half_interval rhs) { return *this = *this + rhs; }
+	inline half_interval& half_interval::operator-=(half_interval rhs) { return *this = *this - rhs; }
+	inline half_interval& half_interval::operator*=(half_interval rhs) { return *this = *this * rhs; }
+	inline half_interval& half_interval::operator/=(half_interval rhs) { return *this = *this / rhs; }
+
 	/// \anchor errors
 	/// \name Error handling
 	/// \{
@@ -4593,6 +12758,13 @@ namespace half_float
 #undef HALF_NOTHROW
 #undef HALF_THREAD_LOCAL
 #undef HALF_TWOS_COMPLEMENT_INT
+#undef HALF_SIMD_SSE2
+#undef HALF_SIMD_AVX2
+#undef HALF_SIMD_AVX512
+#undef HALF_TARGET_SSE2
+#undef HALF_TARGET_AVX2
+#undef HALF_TARGET_AVX512
+#undef HALF_FORCEINLINE
 #ifdef HALF_POP_WARNINGS
 	#pragma warning(pop)
 	#undef HALF_POP_WARNINGS
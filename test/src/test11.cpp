@@ -22,6 +22,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <set>
 #include <iostream>
 #include <iomanip>
 #include <memory>
@@ -29,15 +30,26 @@
 #include <iterator>
 #include <functional>
 #include <fstream>
+#include <sstream>
 #include <random>
 #include <bitset>
 #include <limits>
 #include <typeinfo>
 #include <cstdint>
 #include <cmath>
+#include <cstring>
+#include <cfenv>
 #if HALF_ENABLE_CPP11_HASH
 	#include <unordered_map>
 #endif
+#if HALF_ENABLE_CPP11_THREAD
+	#include <thread>
+	#include <chrono>
+	#include <stdexcept>
+#endif
+#if HALF_ENABLE_CPP11_ATOMIC
+	#include <atomic>
+#endif
 
 
 #define UNARY_MATH_TEST(func) { \
@@ -56,8 +68,34 @@
 		err = std::max(err, error); rel = std::max(rel, error/std::min(std::abs(static_cast<double>(x)), std::abs(static_cast<double>(y)))); } return equal; }); \
 	if(err != 0.0 || rel != 0.0) std::cout << #func << " max error: " << err << " - max relative error: " << rel << '\n'; }
 
+#define ROUNDING_TEST(func) unary_test(#func "<R>", [](half arg) { return bracket_test(half_float::func(arg), \
+	half_float::func<std::round_to_nearest>(arg), half_float::func<std::round_toward_zero>(arg), \
+	half_float::func<std::round_toward_infinity>(arg), half_float::func<std::round_toward_neg_infinity>(arg)); })
+
+#define BINARY_ROUNDING_TEST(func) binary_test(#func "<R>", [](half x, half y) { return bracket_test(half_float::func(x, y), \
+	half_float::func<std::round_to_nearest>(x, y), half_float::func<std::round_toward_zero>(x, y), \
+	half_float::func<std::round_toward_infinity>(x, y), half_float::func<std::round_toward_neg_infinity>(x, y)); })
+
+#define BATCH_FUNCTION_TEST(func, halfs) (batch_function_test<std::round_to_nearest,&half_float::func<std::round_to_nearest>, \
+	&half_float::func<std::round_to_nearest>,&half_float::detail::func##_impl<std::round_to_nearest> >(halfs) && \
+	batch_function_test<std::round_toward_zero,&half_float::func<std::round_toward_zero>,&half_float::func<std::round_toward_zero>, \
+	&half_float::detail::func##_impl<std::round_toward_zero> >(halfs) && batch_function_test<std::round_toward_infinity, \
+	&half_float::func<std::round_toward_infinity>,&half_float::func<std::round_toward_infinity>, \
+	&half_float::detail::func##_impl<std::round_toward_infinity> >(halfs) && batch_function_test<std::round_toward_neg_infinity, \
+	&half_float::func<std::round_toward_neg_infinity>,&half_float::func<std::round_toward_neg_infinity>, \
+	&half_float::detail::func##_impl<std::round_toward_neg_infinity> >(halfs) && batch_function_test<(std::float_round_style)(HALF_ROUND_STYLE), \
+	&half_float::func,&half_float::func,&half_float::detail::func##_impl<(std::float_round_style)(HALF_ROUND_STYLE)> >(halfs))
+
+#define BATCH_REFERENCE_TEST(func, halfs) (batch_reference_test<std::round_to_nearest,&half_float::func<std::round_to_nearest> >( \
+	halfs, [](long double x) { return std::func(x); }) && batch_reference_test<std::round_toward_zero, \
+	&half_float::func<std::round_toward_zero> >(halfs, [](long double x) { return std::func(x); }) && \
+	batch_reference_test<std::round_toward_infinity,&half_float::func<std::round_toward_infinity> >(halfs, \
+	[](long double x) { return std::func(x); }) && batch_reference_test<std::round_toward_neg_infinity, \
+	&half_float::func<std::round_toward_neg_infinity> >(halfs, [](long double x) { return std::func(x); }))
+
 
 using half_float::half;
+using half_float::half_interval;
 using half_float::half_cast;
 
 half b2h(std::uint16_t bits)
@@ -70,17 +108,216 @@ std::uint16_t h2b(half h)
 	return *reinterpret_cast<std::uint16_t*>(&h);
 }
 
+#if HALF_FLUSH_DENORMALS
+half flushed(half h)
+{
+	return (fpclassify(h) == FP_SUBNORMAL) ? copysign(half(0.0f), h) : h;
+}
+#endif
+
 bool comp(half a, half b)
 {
+#if HALF_FLUSH_DENORMALS
+	return (isnan(a) && isnan(b)) || flushed(a) == flushed(b);
+#else
 	return (isnan(a) && isnan(b)) || a == b;
+#endif
+}
+
+#if HALF_FLUSH_DENORMALS
+
+bool same(half a, half b)
+{
+	return (isnan(a) && isnan(b)) || h2b(a) == h2b(b);
+}
+
+half next_flushed(half from, half to)
+{
+	half next = nextafter(from, to);
+	if(fpclassify(next) != FP_SUBNORMAL)
+		return next;
+	return (from == half(0.0f)) ? copysign(std::numeric_limits<half>::min(), next) : flushed(next);
+}
+#endif
+
+//CORDIC implementation of the trigonometric functions used before the table-driven kernels, as reference.
+namespace cordic
+{
+	using half_float::detail::uint32;
+	using half_float::detail::sign_mask;
+	using half_float::detail::arithmetic_shift;
+	using half_float::detail::rounded;
+	using half_float::detail::fixed2half;
+
+	static const uint32 angles[] = {
+		0x3243F6A9, 0x1DAC6705, 0x0FADBAFD, 0x07F56EA7, 0x03FEAB77, 0x01FFD55C, 0x00FFFAAB, 0x007FFF55,
+		0x003FFFEB, 0x001FFFFD, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000, 0x00008000,
+		0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100, 0x00000080,
+		0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001 };
+
+	std::pair<uint32,uint32> sincos(uint32 mz, unsigned int n)
+	{
+		uint32 mx = 0x26DD3B6A, my = 0;
+		for(unsigned int i=0; i<n; ++i)
+		{
+			uint32 sign = sign_mask(mz);
+			uint32 tx = mx - (arithmetic_shift(my, i)^sign) + sign;
+			uint32 ty = my + (arithmetic_shift(mx, i)^sign) - sign;
+			mx = tx;
+			my = ty;
+			mz -= (angles[i]^sign) - sign;
+		}
+		return std::make_pair(my, mx);
+	}
+
+	uint32 atan2(uint32 my, uint32 mx, unsigned int n = 31)
+	{
+		uint32 mz = 0;
+		for(unsigned int i=0; i<n; ++i)
+		{
+			uint32 sign = sign_mask(my);
+			uint32 tx = mx + (arithmetic_shift(my, i)^sign) - sign;
+			uint32 ty = my - (arithmetic_shift(mx, i)^sign) + sign;
+			mx = tx;
+			my = ty;
+			mz += (angles[i]^sign) - sign;
+		}
+		return mz;
+	}
+
+	//results for finite non-zero arguments that take the CORDIC path, or 0xFFFF for all others
+	template<std::float_round_style R> std::pair<unsigned int,unsigned int> sincos(half arg)
+	{
+		unsigned int bits = h2b(arg), abs = bits & 0x7FFF, sign = bits >> 15;
+		int k;
+		if(abs < 0x2500 || abs >= 0x7C00)
+			return std::make_pair(0xFFFF, 0xFFFF);
+		if(R != std::round_to_nearest)
+			switch(abs)
+			{
+				case 0x48B7: return std::make_pair(rounded<R,true>((~bits&0x8000)|0x1D07, 1, 1), rounded<R,true>(0xBBFF, 1, 1));
+				case 0x598C: return std::make_pair(rounded<R,true>((bits&0x8000)|0x3BFF, 1, 1), rounded<R,true>(0x80FC, 1, 1));
+				case 0x6A64: return std::make_pair(rounded<R,true>((~bits&0x8000)|0x3BFE, 1, 1), rounded<R,true>(0x27FF, 1, 1));
+				case 0x6D8C: return std::make_pair(rounded<R,true>((bits&0x8000)|0x0FE6, 1, 1), rounded<R,true>(0x3BFF, 1, 1));
+			}
+		std::pair<uint32,uint32> sc = sincos(half_float::detail::angle_arg(abs, k), 28);
+		switch(k & 3)
+		{
+			case 1: sc = std::make_pair(sc.second, -sc.first); break;
+			case 2: sc = std::make_pair(-sc.first, -sc.second); break;
+			case 3: sc = std::make_pair(-sc.second, sc.first); break;
+		}
+		return std::make_pair(fixed2half<R,30,true,true,true>((sc.first^-static_cast<uint32>(sign))+sign), 
+			fixed2half<R,30,true,true,true>(sc.second));
+	}
+
+	template<std::float_round_style R> unsigned int sin(half arg)
+	{
+		unsigned int bits = h2b(arg), abs = bits & 0x7FFF;
+		int k;
+		if(abs < 0x2900 || abs >= 0x7C00)
+			return 0xFFFF;
+		if(R != std::round_to_nearest)
+			switch(abs)
+			{
+				case 0x48B7: return rounded<R,true>((~bits&0x8000)|0x1D07, 1, 1);
+				case 0x6A64: return rounded<R,true>((~bits&0x8000)|0x3BFE, 1, 1);
+				case 0x6D8C: return rounded<R,true>((bits&0x8000)|0x0FE6, 1, 1);
+			}
+		std::pair<uint32,uint32> sc = sincos(half_float::detail::angle_arg(abs, k), 28);
+		uint32 sign = -static_cast<uint32>(((k>>1)&1)^(bits>>15));
+		return fixed2half<R,30,true,true,true>((((k&1) ? sc.second : sc.first)^sign) - sign);
+	}
+
+	template<std::float_round_style R> unsigned int cos(half arg)
+	{
+		unsigned int abs = h2b(arg) & 0x7FFF;
+		int k;
+		if(abs < 0x2500 || abs >= 0x7C00)
+			return 0xFFFF;
+		if(R != std::round_to_nearest && abs == 0x598C)
+			return rounded<R,true>(0x80FC, 1, 1);
+		std::pair<uint32,uint32> sc = sincos(half_float::detail::angle_arg(abs, k), 28);
+		uint32 sign = -static_cast<uint32>(((k>>1)^k)&1);
+		return fixed2half<R,30,true,true,true>((((k&1) ? sc.first : sc.second)^sign) - sign);
+	}
+
+	template<std::float_round_style R> unsigned int tan(half arg)
+	{
+		unsigned int bits = h2b(arg), abs = bits & 0x7FFF;
+		int exp = 13, k;
+		if(abs < 0x2700 || abs >= 0x7C00)
+			return 0xFFFF;
+		if(R != std::round_to_nearest)
+			switch(abs)
+			{
+				case 0x658C: return rounded<R,true>((bits&0x8000)|0x07E6, 1, 1);
+				case 0x7330: return rounded<R,true>((~bits&0x8000)|0x4B62, 1, 1);
+			}
+		std::pair<uint32,uint32> sc = sincos(half_float::detail::angle_arg(abs, k), 30);
+		if(k & 1)
+			sc = std::make_pair(-sc.second, sc.first);
+		uint32 signy = sign_mask(sc.first), signx = sign_mask(sc.second);
+		uint32 my = (sc.first^signy) - signy, mx = (sc.second^signx) - signx;
+		for(; my<0x80000000; my<<=1,--exp) ;
+		for(; mx<0x80000000; mx<<=1,++exp) ;
+		return half_float::detail::tangent_post<R>(my, mx, exp, (signy^signx^bits)&0x8000);
+	}
+
+	template<std::float_round_style R> unsigned int asin(half arg)
+	{
+		unsigned int bits = h2b(arg), abs = bits & 0x7FFF;
+		if(abs < 0x2900 || abs >= 0x3C00)
+			return 0xFFFF;
+		if(R != std::round_to_nearest && (abs == 0x2B44 || abs == 0x2DC3))
+			return rounded<R,true>(bits+1, 1, 1);
+		std::pair<uint32,uint32> sc = half_float::detail::atan2_args(abs);
+		uint32 m = atan2(sc.first, sc.second, (R==std::round_to_nearest) ? 27 : 26);
+		return fixed2half<R,30,false,true,true>(m, 14, bits&0x8000);
+	}
+
+	template<std::float_round_style R> unsigned int acos(half arg)
+	{
+		unsigned int bits = h2b(arg), abs = bits & 0x7FFF, sign = bits >> 15;
+		if(!abs || abs >= 0x3C00)
+			return 0xFFFF;
+		std::pair<uint32,uint32> cs = half_float::detail::atan2_args(abs);
+		uint32 m = atan2(cs.second, cs.first, 28);
+		return fixed2half<R,31,false,true,true>(sign ? (0xC90FDAA2-m) : m, 15, 0, sign);
+	}
+
+	template<std::float_round_style R> unsigned int atan(half arg)
+	{
+		unsigned int bits = h2b(arg), abs = bits & 0x7FFF;
+		if(abs <= 0x2700 || abs >= 0x7C00)
+			return 0xFFFF;
+		int exp = (abs>>10) + (abs<=0x3FF);
+		uint32 my = (abs&0x3FF) | ((abs>0x3FF)<<10);
+		uint32 m = (exp>15) ?	atan2(my<<19, 0x20000000>>(exp-15), (R==std::round_to_nearest) ? 26 : 24) :
+								atan2(my<<(exp+4), 0x20000000, (R==std::round_to_nearest) ? 30 : 28);
+		return fixed2half<R,30,false,true,true>(m, 14, bits&0x8000);
+	}
+
+	template<std::float_round_style R> unsigned int atan2(half y, half x)
+	{
+		unsigned int absx = h2b(x) & 0x7FFF, absy = h2b(y) & 0x7FFF, signx = h2b(x) >> 15, signy = h2b(y) & 0x8000;
+		if(!absx || !absy || absx >= 0x7C00 || absy >= 0x7C00)
+			return 0xFFFF;
+		int d = (absy>>10) + (absy<=0x3FF) - (absx>>10) - (absx<=0x3FF);
+		if(d > (signx ? 18 : 12) || (signx && d < -11) || (!signx && d < ((R==std::round_toward_zero) ? -15 : -9)))
+			return 0xFFFF;
+		uint32 m = atan2(	((absy&0x3FF)|((absy>0x3FF)<<10))<<(19+((d<0) ? d : (d>0) ? 0 : -1)),
+							((absx&0x3FF)|((absx>0x3FF)<<10))<<(19-((d>0) ? d : (d<0) ? 0 : 1)));
+		return fixed2half<R,31,false,true,true>(signx ? (0xC90FDAA2-m) : m, 15, signy, signx);
+	}
 }
 
 
 class half_test
 {
 public:
-	half_test(std::ostream &log, bool fast)
-		: tests_(0), log_(log), fast_(fast)
+	half_test(std::ostream &log, bool fast, const std::set<std::string> &known)
+		: tests_(0), log_(log), fast_(fast), known_(known)
 	{
 		//prepare halfs
 		half_vector batch;
@@ -135,6 +372,8 @@ public:
 		unary_test("float conversion", [](half arg) { return comp(half_cast<half>(half_cast<float>(arg)), arg); });
 		unary_test("double conversion", [](half arg) { return comp(half_cast<half>(half_cast<double>(arg)), arg); });
 		unary_test("long double conversion", [](half arg) { return comp(half_cast<half>(half_cast<long double>(arg)), arg); });
+		unary_test("long double exact conversion", [](half arg) -> bool { long double d = half_cast<long double>(arg); return isnan(arg) ? 
+			std::isnan(d) : (d == static_cast<long double>(half_cast<double>(arg)) && std::signbit(d) == signbit(arg)); });
 
 		//test classification
 		class_test("fpclassify", [](half arg, int cls) { return fpclassify(arg) == cls; });
@@ -159,6 +398,30 @@ public:
 		binary_test("subtraction", [](half a, half b) { return comp(a-b, static_cast<half>(static_cast<double>(a)-static_cast<double>(b))); });
 		binary_test("multiplication", [](half a, half b) { return comp(a*b, static_cast<half>(static_cast<double>(a)*static_cast<double>(b))); });
 		binary_test("division", [](half a, half b) { return comp(a/b, static_cast<half>(static_cast<double>(a)/static_cast<double>(b))); });
+		binary_test("float arithmetic", [](half a, half b) { return arithmetic_test<std::round_to_nearest>(a, b) && 
+			arithmetic_test<std::round_toward_zero>(a, b) && arithmetic_test<std::round_toward_infinity>(a, b) && 
+			arithmetic_test<std::round_toward_neg_infinity>(a, b); });
+		unary_test("float square root", [](half arg) { return arithmetic_test<std::round_to_nearest>(arg) && 
+			arithmetic_test<std::round_toward_zero>(arg) && arithmetic_test<std::round_toward_infinity>(arg) && 
+			arithmetic_test<std::round_toward_neg_infinity>(arg); });
+		binary_test("float fused multiply add", [](half a, half b) { return fma_test<std::round_to_nearest>(a, b) && 
+			fma_test<std::round_toward_zero>(a, b) && fma_test<std::round_toward_infinity>(a, b) && 
+			fma_test<std::round_toward_neg_infinity>(a, b); });
+	#if defined(FE_UPWARD) && defined(FE_TOWARDZERO)
+		const std::pair<const char*,int> host_modes[] = { { "FE_UPWARD", FE_UPWARD }, { "FE_TOWARDZERO", FE_TOWARDZERO } };
+		for(auto &&mode : host_modes)
+		{
+			std::fesetround(mode.second);
+			binary_test(std::string("float arithmetic under ")+mode.first, [](half a, half b) { 
+				return arithmetic_test<std::round_to_nearest>(a, b) && arithmetic_test<std::round_toward_zero>(a, b) && 
+				arithmetic_test<std::round_toward_infinity>(a, b) && arithmetic_test<std::round_toward_neg_infinity>(a, b) && 
+				fma_test<std::round_to_nearest>(a, b) && fma_test<std::round_toward_zero>(a, b); });
+			unary_test(std::string("float square root under ")+mode.first, [](half arg) { 
+				return arithmetic_test<std::round_to_nearest>(arg) && arithmetic_test<std::round_toward_zero>(arg) && 
+				arithmetic_test<std::round_toward_infinity>(arg) && arithmetic_test<std::round_toward_neg_infinity>(arg); });
+			std::fesetround(FE_TONEAREST);
+		}
+	#endif
 		binary_test("equal", [](half a, half b) { return (a==b) == (static_cast<double>(a)==static_cast<double>(b)); });
 		binary_test("not equal", [](half a, half b) { return (a!=b) == (static_cast<double>(a)!=static_cast<double>(b)); });
 		binary_test("less", [](half a, half b) { return (a<b) == (static_cast<double>(a)<static_cast<double>(b)); });
@@ -229,6 +492,67 @@ public:
 		binary_test("copysign", [](half a, half b) -> bool { half h = copysign(a, b); 
 			return comp(abs(h), abs(a)) && signbit(h)==signbit(b); });
 
+		//test explicit rounding modes
+		binary_test("arithmetic<round_to_nearest>", rounding_test<std::round_to_nearest>);
+		binary_test("arithmetic<round_toward_zero>", rounding_test<std::round_toward_zero>);
+		binary_test("arithmetic<round_toward_infinity>", rounding_test<std::round_toward_infinity>);
+		binary_test("arithmetic<round_toward_neg_infinity>", rounding_test<std::round_toward_neg_infinity>);
+		ROUNDING_TEST(exp);
+		ROUNDING_TEST(exp2);
+		ROUNDING_TEST(expm1);
+		ROUNDING_TEST(log);
+		ROUNDING_TEST(log10);
+		ROUNDING_TEST(log2);
+		ROUNDING_TEST(log1p);
+		ROUNDING_TEST(rsqrt);
+		ROUNDING_TEST(cbrt);
+		ROUNDING_TEST(sin);
+		ROUNDING_TEST(cos);
+		ROUNDING_TEST(tan);
+		ROUNDING_TEST(asin);
+		ROUNDING_TEST(acos);
+		ROUNDING_TEST(atan);
+		ROUNDING_TEST(sinh);
+		ROUNDING_TEST(cosh);
+		ROUNDING_TEST(tanh);
+		ROUNDING_TEST(asinh);
+		ROUNDING_TEST(acosh);
+		ROUNDING_TEST(atanh);
+		ROUNDING_TEST(erf);
+		ROUNDING_TEST(erfc);
+		ROUNDING_TEST(lgamma);
+		ROUNDING_TEST(tgamma);
+		BINARY_ROUNDING_TEST(fdim);
+		BINARY_ROUNDING_TEST(hypot);
+		BINARY_ROUNDING_TEST(pow);
+		binary_test("atan2<R>", [](half y, half x) -> bool { half n = atan2(y, x), lo = nextafter(n, -std::numeric_limits<half>::infinity()), 
+			hi = nextafter(n, std::numeric_limits<half>::infinity()); 
+		#if HALF_FLUSH_DENORMALS
+			lo = next_flushed(n, -std::numeric_limits<half>::infinity()), hi = next_flushed(n, std::numeric_limits<half>::infinity());
+		#endif
+			return isnan(n) || (comp(half_float::atan2<std::round_to_nearest>(y, x), n) && lo <= half_float::atan2<std::round_toward_zero>(y, x) && 
+			half_float::atan2<std::round_toward_zero>(y, x) <= hi && lo <= half_float::atan2<std::round_toward_infinity>(y, x) && 
+			half_float::atan2<std::round_toward_infinity>(y, x) <= hi && lo <= half_float::atan2<std::round_toward_neg_infinity>(y, x) && 
+			half_float::atan2<std::round_toward_neg_infinity>(y, x) <= hi); });
+		unary_test("trigonometric<R> vs CORDIC", [](half arg) { return cordic_test<std::round_to_nearest>(arg) && 
+			cordic_test<std::round_toward_zero>(arg) && cordic_test<std::round_toward_infinity>(arg) && 
+			cordic_test<std::round_toward_neg_infinity>(arg); });
+		binary_test("atan2<R> vs CORDIC", [](half y, half x) { return cordic_atan2_test<std::round_to_nearest>(y, x) && 
+			cordic_atan2_test<std::round_toward_zero>(y, x) && cordic_atan2_test<std::round_toward_infinity>(y, x) && 
+			cordic_atan2_test<std::round_toward_neg_infinity>(y, x); });
+		unary_test("rint<R>", [](half arg) { return !isfinite(arg) || (
+			comp(half_float::rint<std::round_toward_zero>(arg), half_cast<half>(half_cast<int,std::round_toward_zero>(arg))) && 
+			comp(half_float::rint<std::round_toward_infinity>(arg), half_cast<half>(half_cast<int,std::round_toward_infinity>(arg))) && 
+			comp(half_float::nearbyint<std::round_toward_neg_infinity>(arg), half_cast<half>(half_cast<int,std::round_toward_neg_infinity>(arg)))); });
+		unary_test("lrint<R>", [](half arg) { return !isfinite(arg) || (half_float::lrint<std::round_toward_zero>(arg) == 
+			half_cast<long,std::round_toward_zero>(arg) && half_float::lrint<std::round_toward_infinity>(arg) == 
+			half_cast<long,std::round_toward_infinity>(arg) && half_float::lrint<std::round_toward_neg_infinity>(arg) == 
+			half_cast<long,std::round_toward_neg_infinity>(arg)); });
+		unary_test("ldexp<R>", [](half arg) -> bool { unsigned int passed = 0; for(int i=-30; i<0; ++i) passed += 
+			comp(half_float::ldexp<std::round_toward_infinity>(arg, i), half_cast<half,std::round_toward_infinity>(std::ldexp(static_cast<double>(arg), i))) && 
+			comp(half_float::ldexp<std::round_toward_neg_infinity>(arg, i), half_cast<half,std::round_toward_neg_infinity>(std::ldexp(static_cast<double>(arg), i))); 
+			return passed==30; });
+
 	#if HALF_ENABLE_CPP11_CMATH
 		//test basic functions
 		BINARY_MATH_TEST(remainder);
@@ -414,6 +738,305 @@ public:
 		int_test("half_cast<round_toward_neg_infinity>(int)", [](int i) -> bool { 
 			return comp(half_cast<half,std::round_toward_neg_infinity>(i), half_cast<half,std::round_toward_neg_infinity>(static_cast<float>(i))); });
 
+		simple_test("stochastic_generator", []() -> bool { half_float::stochastic_generator a(7), b(7), c(8); bool diff = false; 
+			for(unsigned int i=0; i<1000; ++i) { auto x = a(), y = b(), z = c(); if(x != y) return false; diff |= x != z; } 
+			a.seed(7); b.seed(7); for(unsigned int i=0; i<100; ++i) if(a() != b()) return false; return diff; });
+		simple_test("half_cast<half>(float,mt19937)", []() -> bool { std::mt19937 a(3), b(3); std::vector<float> floats(1000); 
+			half_vector halfs(floats.size()); for(std::size_t i=0; i<floats.size(); ++i) floats[i] = std::ldexp(static_cast<float>(i), -20); 
+			half_float::convert(floats.data(), halfs.data(), floats.size(), a); 
+			for(std::size_t i=0; i<floats.size(); ++i) 
+				if(!comp(halfs[i], half_cast<half>(floats[i], b))) 
+					return false; 
+			return true; });
+		simple_test("half_cast<half,R,P>", []() { return h2b(half_cast<half,std::round_to_nearest,half_float::policy_saturate>(1e10f)) == 0x7BFF && 
+			h2b(half_cast<half,std::round_to_nearest,half_float::policy_saturate>(-std::numeric_limits<float>::infinity())) == 0xFBFF && 
+			h2b(half_cast<half,std::round_to_nearest,half_float::policy_saturate>(70000)) == 0x7BFF && 
+			isnan(half_cast<half,std::round_to_nearest,half_float::policy_saturate>(std::numeric_limits<double>::quiet_NaN())) && 
+			h2b(half_cast<half,std::round_to_nearest,half_float::policy_scrub_nan>(-std::numeric_limits<float>::quiet_NaN())) == 0 && 
+			h2b(half_cast<half,std::round_to_nearest,half_float::policy_flush_subnormals>(-1e-5)) == 0x8000 && 
+			h2b(half_cast<half,std::round_toward_infinity,half_float::policy_flush_subnormals>(6.1e-5f)) == 0x0400 && 
+			h2b(half_cast<half,std::round_to_nearest,half_float::policy_saturate|half_float::policy_scrub_nan>(b2h(0x7E00))) == 0; });
+		simple_test("half_cast<half>(min)", []() { return comp(half_cast<half>(std::numeric_limits<std::int8_t>::min()), half(-128.0f)) && 
+			comp(half_cast<half>(std::numeric_limits<std::int16_t>::min()), half(-32768.0f)) && isinf(half_cast<half>(std::numeric_limits<int>::min())) && 
+			isinf(half_cast<half>(std::numeric_limits<long long>::min())); });
+
+		//test batch conversion
+		std::vector<float> floats;
+		auto rand32 = std::bind(std::uniform_int_distribution<std::uint32_t>(0, std::numeric_limits<std::uint32_t>::max()), std::default_random_engine());
+		for(unsigned int i=0; i<0x10000; ++i)
+			floats.push_back(half_cast<float>(b2h(i)));
+		for(unsigned long i=0, n=fast_ ? 1e6 : (1<<24); i<n; ++i)
+		{
+			std::uint32_t u = rand32();
+			float f;
+			std::memcpy(&f, &u, sizeof(f));
+			floats.push_back(f);
+		}
+		floats.push_back(std::numeric_limits<float>::max());
+		floats.push_back(65520.0f);
+		floats.push_back(-std::numeric_limits<float>::denorm_min());
+		half_vector allhalfs;
+		for(unsigned int i=0; i<0x10000; ++i)
+			allhalfs.push_back(b2h(i));
+		std::vector<double> doubles;
+		auto rand64 = std::bind(std::uniform_int_distribution<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max()), std::default_random_engine());
+		for(unsigned int i=0; i<0x10000; ++i)
+		{
+			double d = half_cast<double>(b2h(i)), e = half_cast<double>(b2h(i+1));
+			doubles.push_back(d);
+			if(!std::isinf(d) && !std::isnan(d) && !std::isinf(e) && !std::isnan(e) && (i&0x7FFF)!=0x7FFF)
+			{
+				double m = d + (e-d)/2;
+				doubles.push_back(m);
+				doubles.push_back(std::nextafter(m, 0.0));
+				doubles.push_back(std::nextafter(m, m*2));
+			}
+		}
+		for(unsigned long i=0, n=fast_ ? 1e6 : (1<<24); i<n; ++i)
+		{
+			std::uint64_t u = rand64();
+			double d;
+			std::memcpy(&d, &u, sizeof(d));
+			doubles.push_back(d);
+			u = (u&0x800FFFFFFFFFFFFF) | (static_cast<std::uint64_t>(960+(u>>52)%100)<<52);
+			std::memcpy(&d, &u, sizeof(d));
+			doubles.push_back(d);
+		}
+		doubles.push_back(std::numeric_limits<double>::max());
+		doubles.push_back(std::numeric_limits<double>::min());
+		doubles.push_back(-std::numeric_limits<double>::denorm_min());
+		doubles.push_back(std::ldexp(1.0, 128));
+		doubles.push_back(std::nextafter(65520.0, 0.0));
+		doubles.push_back(std::ldexp(-1.0, -126));
+		simple_test("set_simd_level", []() { return half_float::set_simd_level(half_float::simd_avx512) == half_float::supported_simd_level() && 
+			half_float::get_simd_level() == half_float::supported_simd_level() && half_float::set_simd_level(half_float::simd_scalar) == 
+			half_float::simd_scalar && half_float::get_simd_level() == half_float::simd_scalar; });
+	#if HALF_ENABLE_CPP11_THREAD && HALF_ENABLE_CPP11_ATOMIC
+		simple_test("set_simd_level(concurrent)", [&floats]() -> bool { std::atomic<bool> done(false); 
+			std::thread selector([&done]() { for(unsigned int i=0; !done; ++i) half_float::set_simd_level(static_cast<half_float::simd_level>(i%4)); }); 
+			bool result = true; 
+			for(int i=0; i<4; ++i) 
+				result = batch_test<std::round_to_nearest,half>(floats) && result; 
+			done = true; selector.join(); return result; });
+	#endif
+		simple_test("set_parallel_threads", []() -> bool { unsigned int threads = half_float::set_parallel_threads(3); 
+			bool result = half_float::get_parallel_threads() == 3 && half_float::parallel.threads() == 3 && 
+			half_float::parallel_policy(2).threads() == 2 && half_float::set_parallel_threads(0) == 3 && half_float::get_parallel_threads() >= 1; 
+			half_float::set_parallel_threads(threads); return result && threads >= 1; });
+	#if HALF_ENABLE_PARALLEL && HALF_ENABLE_CPP11_THREAD && HALF_ENABLE_CPP11_THREAD_LOCAL
+		simple_test("thread_pool(nested)", []() -> bool { std::vector<std::atomic<int>> hits(16); 
+			half_float::detail::parallel_pool().run([&hits](unsigned int i) { 
+				half_float::detail::parallel_pool().run([&hits,i](unsigned int j) { ++hits[4*i+j]; }, 4); }, 4); 
+			return std::all_of(hits.begin(), hits.end(), [](const std::atomic<int> &n) { return n == 1; }); });
+		simple_test("thread_pool(exception)", []() -> bool { std::atomic<int> done(0); bool caught = false; 
+			try { half_float::detail::parallel_pool().run([&done](unsigned int i) { if(!i) throw std::runtime_error("part 0"); 
+				std::this_thread::sleep_for(std::chrono::milliseconds(10)); ++done; }, 4); } 
+			catch(const std::runtime_error&) { caught = done == 3; } 
+			half_float::detail::parallel_pool().run([&done](unsigned int) { ++done; }, 4); return caught && done == 7; });
+	#endif
+		for(int level=half_float::supported_simd_level(); level>=half_float::simd_scalar; --level)
+		{
+			static const char *const names[] = { "scalar", "sse2", "avx2", "avx512" };
+			std::string isa = std::string(" [") + names[half_float::set_simd_level(static_cast<half_float::simd_level>(level))] + ']';
+			simple_test("convert(half)"+isa, []() -> bool { half_vector halfs(0x10000); std::vector<float> floats(halfs.size()); 
+				for(unsigned int i=0; i<halfs.size(); ++i) halfs[i] = b2h(i); 
+				half_float::convert(halfs.data(), floats.data(), halfs.size()); 
+				for(unsigned int i=0; i<halfs.size(); ++i) { float f = half_cast<float>(halfs[i]); if(std::memcmp(&f, &floats[i], sizeof(float)) && 
+				!(isnan(halfs[i]) && std::isnan(floats[i]))) return false; } return true; });
+			simple_test("convert(half,double)"+isa, []() -> bool { half_vector halfs(0x10000); std::vector<double> doubles(halfs.size()); 
+				for(unsigned int i=0; i<halfs.size(); ++i) halfs[i] = b2h(i); 
+				half_float::convert(halfs.data(), doubles.data(), halfs.size()); 
+				for(unsigned int i=0; i<halfs.size(); ++i) { double d = half_cast<double>(halfs[i]); if(std::memcmp(&d, &doubles[i], sizeof(double)) && 
+				!(isnan(halfs[i]) && std::isnan(doubles[i]))) return false; } return true; });
+			simple_test("approximate"+isa, []() -> bool { return approximate_test<'e'>(std::exp, -22.7) && approximate_test<'2'>(std::exp2, -22.7) && 
+				approximate_test<'m'>(std::expm1, -21.7) && approximate_test<'l'>(std::log, -22.3) && approximate_test<'d'>(std::log10, -21.9) && 
+				approximate_test<'b'>(std::log2, -21.9) && approximate_test<'p'>(std::log1p, -21.8) && approximate_test<'3'>(std::cbrt, -22.3) && 
+				approximate_test<'s'>(std::sin, -22.3) && approximate_test<'c'>(std::cos, -22.3) && approximate_test<'t'>(std::tan, -21.1) && 
+				approximate_test<'a'>(std::atan, -22.2) && approximate_test<'S'>(std::sinh, -21.9) && approximate_test<'C'>(std::cosh, -22.1) && 
+				approximate_test<'T'>(std::tanh, -21.5); });
+			simple_test("convert(half,long double)"+isa, []() -> bool { half_vector halfs(0x10000); std::vector<long double> ldoubles(halfs.size()); 
+				for(unsigned int i=0; i<halfs.size(); ++i) halfs[i] = b2h(i); 
+				half_float::convert(halfs.data(), ldoubles.data(), halfs.size()); 
+				for(unsigned int i=0; i<halfs.size(); ++i) { long double d = half_cast<long double>(halfs[i]); if((d != ldoubles[i] || 
+				std::signbit(d) != std::signbit(ldoubles[i])) && !(isnan(halfs[i]) && std::isnan(ldoubles[i]))) return false; } return true; });
+			simple_test("convert(float)"+isa, [&floats]() { return batch_test<(std::float_round_style)(HALF_ROUND_STYLE),half>(floats); });
+			simple_test("convert<round_to_nearest>(float)"+isa, [&floats]() { return batch_test<std::round_to_nearest,half>(floats); });
+			simple_test("convert<round_toward_zero>(float)"+isa, [&floats]() { return batch_test<std::round_toward_zero,half>(floats); });
+			simple_test("convert<round_toward_infinity>(float)"+isa, [&floats]() { return batch_test<std::round_toward_infinity,half>(floats); });
+			simple_test("convert<round_toward_neg_infinity>(float)"+isa, [&floats]() { return batch_test<std::round_toward_neg_infinity,half>(floats); });
+			simple_test("convert<round_indeterminate>(float)"+isa, [&floats]() -> bool { half_vector halfs(floats.size()); 
+				half_float::convert<std::round_indeterminate>(floats.data(), halfs.data(), floats.size()); 
+				for(std::size_t i=0; i<floats.size(); ++i) 
+					if(!comp(halfs[i], half_cast<half,std::round_to_nearest>(floats[i])) && !comp(halfs[i], half_cast<half,std::round_toward_zero>(floats[i]))) 
+						return false; 
+				return true; });
+			simple_test("convert(float,stochastic_generator)"+isa, [&floats]() { return batch_stochastic_test(floats); });
+			simple_test("convert<policy_saturate|policy_flush_subnormals>(float,stochastic_generator)"+isa, [&floats]() -> bool { 
+				const unsigned int P = half_float::policy_saturate | half_float::policy_flush_subnormals; half_vector halfs(floats.size()); 
+				half_float::stochastic_generator gen(5), ref(5), ref2(5); half_float::convert<P>(floats.data(), halfs.data(), floats.size(), gen); 
+				for(std::size_t i=0; i<floats.size(); ++i) { half h = half_cast<half,P>(floats[i], ref); 
+				if(h2b(h) != h2b(halfs[i]) || h2b(h) != policy<P>(half_cast<half>(floats[i], ref2))) return false; } return true; });
+			simple_test("convert<round_to_nearest,policy_saturate>(float)"+isa, [&floats]() { 
+				return batch_policy_test<std::round_to_nearest,half_float::policy_saturate>(floats); });
+			simple_test("convert<round_toward_infinity,policy_scrub_nan|policy_flush_subnormals>(float)"+isa, [&floats]() { 
+				return batch_policy_test<std::round_toward_infinity,half_float::policy_scrub_nan|half_float::policy_flush_subnormals>(floats); });
+			simple_test("convert<round_toward_zero,policy_saturate|policy_scrub_nan|policy_flush_subnormals>(float)"+isa, [&floats]() { 
+				return batch_policy_test<std::round_toward_zero,half_float::policy_saturate|half_float::policy_scrub_nan|
+				half_float::policy_flush_subnormals>(floats); });
+			simple_test("convert(float,stochastic_generator) bias"+isa, []() -> bool { std::vector<float> floats(200000); 
+				half_vector halfs(floats.size()); half_float::stochastic_generator gen(1); for(std::size_t i=0; i<floats.size(); i+=2) { 
+				floats[i] = 1.0f + std::ldexp(1.0f, -12); floats[i+1] = std::ldexp(-1.0f, -26); } 
+				half_float::convert(floats.data(), halfs.data(), floats.size(), gen); unsigned int up[2] = { 0, 0 }; 
+				for(std::size_t i=0; i<floats.size(); i+=2) { up[0] += h2b(halfs[i]) == 0x3C01; up[1] += h2b(halfs[i+1]) == 0x8001; } 
+				return up[0] > 24000 && up[0] < 26000 && up[1] > 24000 && up[1] < 26000; });
+			simple_test("convert(int8)"+isa, [&allhalfs]() { return batch_int_test<std::int8_t>(allhalfs); });
+			simple_test("convert(uint8)"+isa, [&allhalfs]() { return batch_int_test<std::uint8_t>(allhalfs); });
+			simple_test("convert(int16)"+isa, [&allhalfs]() { return batch_int_test<std::int16_t>(allhalfs); });
+			simple_test("convert(uint16)"+isa, [&allhalfs]() { return batch_int_test<std::uint16_t>(allhalfs); });
+			simple_test("convert(int32)"+isa, [&allhalfs]() { return batch_int_test<std::int32_t>(allhalfs); });
+			simple_test("convert(uint32)"+isa, [&allhalfs]() { return batch_int_test<std::uint32_t>(allhalfs); });
+			simple_test("convert(int64)"+isa, [&allhalfs]() { return batch_int_test<std::int64_t>(allhalfs); });
+			simple_test("convert(double)"+isa, [&doubles]() { return batch_test<(std::float_round_style)(HALF_ROUND_STYLE),half>(doubles); });
+			simple_test("convert<round_to_nearest>(double)"+isa, [&doubles]() { return batch_test<std::round_to_nearest,half>(doubles); });
+			simple_test("convert<round_toward_zero>(double)"+isa, [&doubles]() { return batch_test<std::round_toward_zero,half>(doubles); });
+			simple_test("convert<round_toward_infinity>(double)"+isa, [&doubles]() { return batch_test<std::round_toward_infinity,half>(doubles); });
+			simple_test("convert<round_toward_neg_infinity>(double)"+isa, [&doubles]() { return batch_test<std::round_toward_neg_infinity,half>(doubles); });
+			simple_test("convert<round_to_nearest,policy_saturate|policy_scrub_nan|policy_flush_subnormals>(double)"+isa, [&doubles]() { 
+				return batch_policy_test<std::round_to_nearest,half_float::policy_saturate|half_float::policy_scrub_nan|
+				half_float::policy_flush_subnormals>(doubles); });
+			simple_test("convert<round_to_nearest,policy_saturate>(int32)"+isa, []() -> bool { std::vector<std::int32_t> ints; 
+				for(std::int32_t i=-100000; i<=100000; ++i) ints.push_back(i); 
+				return batch_policy_test<std::round_to_nearest,half_float::policy_saturate>(ints); });
+			simple_test("convert<R>(int32)"+isa, []() -> bool { std::vector<std::int32_t> ints; 
+				for(std::int32_t i=-70000; i<=70000; ++i) ints.push_back(i); 
+				ints.push_back(std::numeric_limits<std::int32_t>::min()); ints.push_back(std::numeric_limits<std::int32_t>::max()); 
+				return batch_test<std::round_to_nearest,half>(ints) && batch_test<std::round_toward_zero,half>(ints) && 
+					batch_test<std::round_toward_infinity,half>(ints) && batch_test<std::round_toward_neg_infinity,half>(ints) && 
+					batch_test<std::round_indeterminate,half>(ints); });
+			simple_test("convert streaming"+isa, [&floats,&doubles,&allhalfs]() -> bool { std::vector<std::int16_t> ints(allhalfs.size()); 
+				for(std::size_t i=0; i<ints.size(); ++i) ints[i] = static_cast<std::int16_t>(i); 
+				std::size_t threshold = half_float::set_streaming_threshold(0); bool result = batch_stream_test<half>(floats) && 
+				batch_stream_test<half>(doubles) && batch_stream_test<half>(ints) && batch_stream_test<float>(allhalfs) && 
+				batch_stream_test<double>(allhalfs) && batch_stream_test<std::int16_t>(allhalfs) && batch_stochastic_test(floats); 
+				half_float::set_streaming_threshold(threshold); return result; });
+			simple_test("convert(parallel_policy)"+isa, [&floats,&doubles]() -> bool { half_vector halfs(floats.size()); 
+				half_float::convert(floats.data(), halfs.data(), floats.size()); std::vector<std::int32_t> ints(300000); 
+				for(std::size_t i=0; i<ints.size(); ++i) ints[i] = static_cast<std::int32_t>(i*7919%2000000000) - 1000000000; 
+				std::vector<float> exact(300000, 1.0f); exact.back() = 1e10f; bool result = batch_parallel_test<half>(exact) && 
+				batch_parallel_test<half>(floats) && batch_parallel_test<half>(doubles) && batch_parallel_test<half>(ints) && 
+				batch_parallel_test<float>(halfs) && batch_parallel_test<double>(halfs) && batch_parallel_test<std::int16_t>(halfs); 
+				std::size_t threshold = half_float::set_streaming_threshold(0); result = result && batch_parallel_test<float>(halfs); 
+				half_float::set_streaming_threshold(threshold); return result; });
+			simple_test("add"+isa, [&allhalfs]() { return batch_arithmetic_test<'+'>(allhalfs); });
+			simple_test("sub"+isa, [&allhalfs]() { return batch_arithmetic_test<'-'>(allhalfs); });
+			simple_test("mul"+isa, [&allhalfs]() { return batch_arithmetic_test<'*'>(allhalfs); });
+			simple_test("div"+isa, [&allhalfs]() { return batch_arithmetic_test<'/'>(allhalfs); });
+		#ifdef FE_UPWARD
+			simple_test("add under FE_UPWARD"+isa, [&allhalfs]() { std::fesetround(FE_UPWARD); 
+				bool result = batch_arithmetic_test<'+'>(allhalfs) && std::fegetround() == FE_UPWARD; 
+				std::fesetround(FE_TONEAREST); return result; });
+		#endif
+			simple_test("fma_n"+isa, [&allhalfs]() { return batch_fma_test(allhalfs); });
+			simple_test("axpy"+isa, [&allhalfs]() { return batch_fma_test(allhalfs, 1); });
+			simple_test("scale_add"+isa, [&allhalfs]() { return batch_fma_test(allhalfs, 6); });
+			simple_test("compare"+isa, [&allhalfs]() { return batch_compare_test(allhalfs); });
+			simple_test("exp(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(exp, allhalfs); });
+			simple_test("exp2(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(exp2, allhalfs); });
+			simple_test("expm1(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(expm1, allhalfs); });
+			simple_test("log(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(log, allhalfs); });
+			simple_test("log10(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(log10, allhalfs); });
+			simple_test("log2(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(log2, allhalfs); });
+			simple_test("log1p(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(log1p, allhalfs); });
+			simple_test("cbrt(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(cbrt, allhalfs); });
+			simple_test("sin(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(sin, allhalfs); });
+			simple_test("cos(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(cos, allhalfs); });
+			simple_test("tan(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(tan, allhalfs); });
+			simple_test("atan(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(atan, allhalfs); });
+			simple_test("sinh(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(sinh, allhalfs); });
+			simple_test("cosh(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(cosh, allhalfs); });
+			simple_test("tanh(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(tanh, allhalfs); });
+			simple_test("erf(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(erf, allhalfs); });
+			simple_test("erfc(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(erfc, allhalfs); });
+			simple_test("lgamma(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(lgamma, allhalfs); });
+			simple_test("tgamma(const half*)"+isa, [&allhalfs]() { return BATCH_FUNCTION_TEST(tgamma, allhalfs); });
+			simple_test("unary_table"+isa, [&allhalfs]() { return unary_table_test(allhalfs); });
+		}
+
+		//test special functions against references
+		half_vector erfargs, erfcargs, lgammaargs, tgammaargs;
+		for(std::size_t i=0; i<allhalfs.size(); ++i)
+		{
+			half arg = allhalfs[i];
+			if(!isfinite(arg) || arg == half(0.0f))
+				continue;
+			if(abs(arg) < half(3.0f))
+				erfargs.push_back(arg);
+			if(abs(arg) < half(4.0f))
+				erfcargs.push_back(arg);
+			if(arg != trunc(arg) || (arg > half(2.0f)))
+				lgammaargs.push_back(arg);
+			if(arg != trunc(arg) && arg > half(-13.0f) && arg < half(10.0f) && (arg < half(0.0f) || h2b(arg) >= 0x100))
+				tgammaargs.push_back(arg);
+		}
+		simple_test("erf_fixed", [&erfargs]() { return fixed_test(erfargs, &half_float::detail::erf_fixed<false>, 
+			[](long double x) { return std::erf(x); }, 0.0); });
+		simple_test("erfc_fixed", [&erfcargs]() { return fixed_test(erfcargs, &half_float::detail::erf_fixed<true>, 
+			[](long double x) { return std::erfc(x); }, 0.0); });
+		simple_test("lgamma_fixed", [&lgammaargs]() { return fixed_test(lgammaargs, &half_float::detail::gamma_fixed<true>, 
+			[](long double x) { return std::lgamma(x); }, 1.0); });
+		simple_test("tgamma_fixed", [&tgammaargs]() { return fixed_test(tgammaargs, &half_float::detail::gamma_fixed<false>, 
+			[](long double x) { return std::tgamma(x); }, 0.0); });
+		simple_test("erf(const half*) reference", [&erfargs]() { return BATCH_REFERENCE_TEST(erf, erfargs); });
+		simple_test("erfc(const half*) reference", [&erfcargs]() { return BATCH_REFERENCE_TEST(erfc, erfcargs); });
+		simple_test("lgamma(const half*) reference", [&lgammaargs]() { return BATCH_REFERENCE_TEST(lgamma, lgammaargs); });
+		simple_test("tgamma(const half*) reference", [&tgammaargs]() { return BATCH_REFERENCE_TEST(tgamma, tgammaargs); });
+
+		//test packed types
+		simple_test("half8", [&allhalfs]() { return packed_test<8>(allhalfs); });
+		simple_test("half16", [&allhalfs]() { return packed_test<16>(allhalfs); });
+
+		//test array expressions
+		simple_test("half_span", [&allhalfs]() { return expression_test(allhalfs); });
+
+		//test intervals
+		simple_test("half_interval batch", [&allhalfs]() { return interval_test(allhalfs); });
+		simple_test("half_interval comparison", []() { half_interval a(half(1.0f), half(2.0f)), b(half(2.0f), half(3.0f)), 
+			c(half(2.5f)); return a == a && a != b && a <= b && !(a < b) && b >= a && !(b > a) && b > a-half_interval(half(1.0f)) && 
+			c < half_interval(half(3.0f)) && !(c < b) && !(c > b) && b.contains(c.lower()) && !a.contains(c.upper()); });
+	#if !HALF_FLUSH_DENORMALS
+		binary_test("half_interval arithmetic", [](half a, half b) { return interval_test(half_interval(a), half_interval(b)) && 
+			interval_test(half_interval(fmin(a, b), fmax(a, b)), half_interval(b)) && 
+			interval_test(half_interval(a), half_interval(fmin(a, b), fmax(a, b))); });
+		unary_test("half_interval functions", [](half arg) -> bool { half_interval x(arg, nextafter(arg, 
+			std::numeric_limits<half>::infinity())), s = sqrt(x), e = exp(x), l = log(x); double lo = static_cast<double>(x.lower()), 
+			hi = static_cast<double>(x.upper()); return isnan(arg) || (interval_encloses(e, std::exp(lo)) && 
+			interval_encloses(e, std::exp(hi)) && (hi < 0.0) == isnan(s.lower()) && (hi < 0.0) == isnan(l.upper()) && 
+			(hi < 0.0 || (interval_encloses(s, std::sqrt(std::max(lo, 0.0))) && interval_encloses(s, std::sqrt(hi)) && 
+			interval_encloses(l, std::log(std::max(lo, 0.0))) && interval_encloses(l, std::log(hi))))); });
+	#endif
+
+	#if HALF_FLUSH_DENORMALS
+		//test flushing of subnormals
+		binary_test("flush denormals arithmetic", [](half a, half b) -> bool { half x = flushed(a), y = flushed(b); 
+			return same(a+b, flushed(half(static_cast<double>(x)+static_cast<double>(y)))) && 
+				same(a-b, flushed(half(static_cast<double>(x)-static_cast<double>(y)))) && 
+				same(a*b, flushed(half(static_cast<double>(x)*static_cast<double>(y)))) && 
+				same(a/b, flushed(half(static_cast<double>(x)/static_cast<double>(y)))) && 
+				same(fma(a, b, a), fma(x, y, x)) && same(fma(a, b, a), flushed(fma(a, b, a))) && 
+				same(fmod(a, b), fmod(x, y)) && same(remainder(a, b), remainder(x, y)) && same(fdim(a, b), fdim(x, y)) && 
+				same(hypot(a, b), hypot(x, y)) && same(pow(a, b), pow(x, y)) && same(atan2(a, b), atan2(x, y)) && 
+				same(hypot(a, b), flushed(hypot(a, b))) && same(pow(a, b), flushed(pow(a, b))) && same(atan2(a, b), flushed(atan2(a, b))); });
+		unary_test("flush denormals functions", [](half arg) -> bool { static half (*const functions[])(half) = { half_float::sqrt, 
+			half_float::rsqrt, half_float::cbrt, half_float::exp, half_float::exp2, half_float::expm1, half_float::log, half_float::log10, 
+			half_float::log2, half_float::log1p, half_float::sin, half_float::cos, half_float::tan, half_float::asin, half_float::acos, 
+			half_float::atan, half_float::sinh, half_float::cosh, half_float::tanh, half_float::asinh, half_float::acosh, half_float::atanh, 
+			half_float::erf, half_float::erfc, half_float::lgamma, half_float::tgamma }; half x = flushed(arg); 
+			for(unsigned int i=0; i<sizeof(functions)/sizeof(functions[0]); ++i)
+				if(!same(functions[i](arg), functions[i](x)) || !same(functions[i](arg), flushed(functions[i](arg))))
+					return false;
+			return true; });
+	#endif
+
 		//test numeric limits
 		unary_test("numeric_limits::min", [](half arg) { return !isnormal(arg) || signbit(arg) || arg>=std::numeric_limits<half>::min(); });
 		unary_test("numeric_limits::lowest", [](half arg) { return !isfinite(arg) || arg>=std::numeric_limits<half>::lowest(); });
@@ -447,15 +1070,19 @@ public:
 			comp(+3.14159265359_h, half(3.14159265359f)) && comp(1e-2_h, half(1e-2f)) && comp(-4.2e3_h, half(-4.2e3f)); });
 	#endif
 
+		//known failures (like comparisons with inexact library functions) are reported, but don't count as failed.
+		std::size_t unexpected = std::count_if(failed_.begin(), failed_.end(), 
+			[this](const std::string &name) { return !known_.count(name); });
 		if(failed_.empty())
 			log_ << "all tests passed\n";
 		else
 		{
-			log_ << (failed_.size()) << " OF " << tests_ << " FAILED:\n    ";
-			std::copy(failed_.begin(), failed_.end(), std::ostream_iterator<std::string>(log_, "\n    "));
+			log_ << (failed_.size()) << " OF " << tests_ << " FAILED (" << (failed_.size()-unexpected) << " KNOWN):\n    ";
+			for(auto &&name : failed_)
+				log_ << name << (known_.count(name) ? " (known)" : "") << "\n    ";
 			log_ << '\n';
 		}
-		return failed_.size();
+		return static_cast<unsigned int>(unexpected);
 	}
 
 private:
@@ -463,6 +1090,834 @@ private:
 	typedef std::map<std::string,half_vector> test_map;
 	typedef std::map<std::string,int> class_map;
 
+	template<typename F,typename G> static bool arithmetic_test(F fast, G soft)
+	{
+	#if HALF_ERRHANDLING_FLAGS
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		unsigned int a = fast();
+		int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		unsigned int b = soft();
+		return a == b && half_float::fetestexcept(FE_ALL_EXCEPT) == flags;
+	#else
+		return fast() == soft();
+	#endif
+	}
+
+	template<std::float_round_style R> static bool arithmetic_test(half x, half y)
+	{
+		unsigned int a = half_float::detail::flush_arg(h2b(x)), b = half_float::detail::flush_arg(h2b(y));
+		return arithmetic_test([=]() { return half_float::detail::add_float<R>(a, b); }, [=]() { return half_float::detail::add_soft<R>(a, b); }) && 
+			arithmetic_test([=]() { return half_float::detail::mul_float<R>(a, b); }, [=]() { return half_float::detail::mul_soft<R>(a, b); }) && 
+			arithmetic_test([=]() { return half_float::detail::div_float<R>(a, b); }, [=]() { return half_float::detail::div_soft<R>(a, b); });
+	}
+
+	template<std::float_round_style R> static bool arithmetic_test(half arg)
+	{
+		unsigned int a = half_float::detail::flush_arg(h2b(arg));
+		return arithmetic_test([=]() { return half_float::detail::sqrt_float<R>(a); }, [=]() { return half_float::detail::sqrt_soft<R>(a); });
+	}
+
+	template<std::float_round_style R> static bool fma_test(half x, half y)
+	{
+		unsigned int a = half_float::detail::flush_arg(h2b(x)), b = half_float::detail::flush_arg(h2b(y));
+		unsigned int c = h2b(static_cast<half>(-static_cast<double>(b2h(a))*static_cast<double>(b2h(b))));
+		const unsigned int values[] = { c-1, c, c+1, 0x0000, 0x8000, 0x8001, 0x3C00, 0x7C00 };
+		for(unsigned int i=0; i<sizeof(values)/sizeof(values[0]); ++i)
+		{
+			unsigned int z = half_float::detail::flush_arg(values[i]&0xFFFF);
+			if(!arithmetic_test([=]() { return half_float::detail::fma_float<R>(a, b, z); }, 
+				[=]() { return half_float::detail::fma_soft<R>(a, b, z); }))
+				return false;
+		}
+		return true;
+	}
+
+	template<char O> static half batch_arithmetic(half x, half y)
+	{
+		return (O=='+') ? (x+y) : (O=='-') ? (x-y) : (O=='*') ? (x*y) : (x/y);
+	}
+
+	template<char O> static void batch_arithmetic(const half *x, const half *y, half *dst, std::size_t n, unsigned int broadcast)
+	{
+		if(broadcast == 1)
+			(O=='+') ? half_float::add(*x, y, dst, n) : (O=='-') ? half_float::sub(*x, y, dst, n) : 
+				(O=='*') ? half_float::mul(*x, y, dst, n) : half_float::div(*x, y, dst, n);
+		else if(broadcast == 2)
+			(O=='+') ? half_float::add(x, *y, dst, n) : (O=='-') ? half_float::sub(x, *y, dst, n) : 
+				(O=='*') ? half_float::mul(x, *y, dst, n) : half_float::div(x, *y, dst, n);
+		else
+			(O=='+') ? half_float::add(x, y, dst, n) : (O=='-') ? half_float::sub(x, y, dst, n) : 
+				(O=='*') ? half_float::mul(x, y, dst, n) : half_float::div(x, y, dst, n);
+	}
+
+	template<char O> static bool batch_arithmetic_test(const half_vector &x, const half_vector &y, unsigned int broadcast = 0)
+	{
+		half_vector dst(x.size()), ref(x.size());
+		for(std::size_t i=0; i<x.size(); ++i)
+			ref[i] = batch_arithmetic<O>(x[i], y[i]);
+		batch_arithmetic<O>(x.data(), y.data(), dst.data(), x.size(), broadcast);
+		if(std::memcmp(dst.data(), ref.data(), x.size()*sizeof(half)))
+			return false;
+		if(broadcast != 1)
+		{
+			dst = x;
+			batch_arithmetic<O>(dst.data(), y.data(), dst.data(), x.size(), broadcast);
+			if(std::memcmp(dst.data(), ref.data(), x.size()*sizeof(half)))
+				return false;
+		}
+	#if HALF_ERRHANDLING_FLAGS
+		for(std::size_t i=0, n=1; i<x.size(); i+=n, n=n%40+1)
+		{
+			n = std::min(n, x.size()-i);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			batch_arithmetic<O>(&x[i], &y[i], &dst[i], n, broadcast);
+			int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			for(std::size_t j=i; j<i+n; ++j)
+				batch_arithmetic<O>(x[j], y[j]);
+			if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+				return false;
+		}
+	#endif
+		return true;
+	}
+
+	template<std::float_round_style R,char O> static bool batch_arithmetic_test(const half_vector &x, const half_vector &y)
+	{
+		std::vector<std::uint16_t> dst(x.size());
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		half_float::detail::arithmetic_n<R,O,0>(reinterpret_cast<const std::uint16_t*>(x.data()), 
+			reinterpret_cast<const std::uint16_t*>(y.data()), dst.data(), x.size());
+		int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		for(std::size_t i=0; i<x.size(); ++i)
+			if(dst[i] != half_float::detail::arithmetic<R,O>(h2b(x[i]), h2b(y[i])))
+				return false;
+		return half_float::fetestexcept(FE_ALL_EXCEPT) == flags;
+	}
+
+	template<char O> static bool batch_arithmetic_test(const half_vector &halfs)
+	{
+		static const std::uint16_t values[] = { 0x0000, 0x8000, 0x0001, 0x83FF, 0x3C00, 0xBE00, 0x7BFF, 0x1400, 0x7C00, 0xFC00, 0x7E00, 0x7D00 };
+		half_vector x(halfs), y(halfs.size());
+		for(std::size_t i=0; i<y.size(); ++i)
+			y[i] = halfs[i*40503%halfs.size()];
+		if(!batch_arithmetic_test<O>(x, y) || !batch_arithmetic_test<O>(y, x) || 
+			!batch_arithmetic_test<std::round_toward_zero,O>(x, y) || !batch_arithmetic_test<std::round_toward_infinity,O>(x, y) || 
+			!batch_arithmetic_test<std::round_toward_neg_infinity,O>(x, y))
+			return false;
+		for(unsigned int i=0; i<sizeof(values)/sizeof(values[0]); ++i)
+		{
+			std::fill(y.begin(), y.end(), b2h(values[i]));
+			if(!batch_arithmetic_test<O>(x, y, 2) || !batch_arithmetic_test<O>(y, x, 1))
+				return false;
+		}
+		return true;
+	}
+
+	template<char O> static void batch_compare(const half *x, half a, half b, unsigned char *mask, std::size_t n)
+	{
+		switch(O)
+		{
+			case '<': half_float::compare_lt(x, a, mask, n); break;
+			case 'l': half_float::compare_le(x, a, mask, n); break;
+			case '>': half_float::compare_gt(x, a, mask, n); break;
+			case 'g': half_float::compare_ge(x, a, mask, n); break;
+			case '=': half_float::compare_eq(x, a, mask, n); break;
+			case 'b': half_float::compare_between(x, a, b, mask, n); break;
+			default: half_float::isnan(x, mask, n);
+		}
+	}
+
+	template<char O> static bool batch_compare_test(const half_vector &x, half a, half b)
+	{
+		std::size_t n = x.size();
+		std::vector<unsigned char> mask((n+7)/8+1, 0xAA), ref((n+7)/8+1, 0);
+		half_vector selected, dst(n);
+		ref.back() = 0xAA;
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		for(std::size_t i=0; i<n; ++i)
+		{
+			bool result = (O=='<') ? (x[i]<a) : (O=='l') ? (x[i]<=a) : (O=='>') ? (x[i]>a) : (O=='g') ? (x[i]>=a) : 
+				(O=='=') ? (x[i]==a) : (O=='b') ? (a<=x[i] && x[i]<=b) : isnan(x[i]);
+			ref[i/8] |= static_cast<unsigned char>(result << (i%8));
+			if(result)
+				selected.push_back(x[i]);
+		}
+		int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		batch_compare<O>(x.data(), a, b, mask.data(), n);
+		if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags || mask != ref || half_float::count(mask.data(), n) != selected.size() || 
+			half_float::select(x.data(), mask.data(), dst.data(), n) != selected.size())
+			return false;
+		return !std::memcmp(dst.data(), selected.data(), selected.size()*sizeof(half));
+	}
+
+	static bool batch_compare_test(const half_vector &halfs)
+	{
+		static const std::uint16_t values[] = { 0x0000, 0x8000, 0x0001, 0x83FF, 0x3C00, 0xBE00, 0x7BFF, 0xFC00, 0x7C00, 0x7E00, 0x7D00 };
+		half_vector x(halfs.begin()+3, halfs.end()-10);
+		for(unsigned int i=0; i<sizeof(values)/sizeof(values[0]); ++i)
+		{
+			half a = b2h(values[i]);
+			if(!batch_compare_test<'<'>(x, a, a) || !batch_compare_test<'l'>(x, a, a) || !batch_compare_test<'>'>(x, a, a) || 
+				!batch_compare_test<'g'>(x, a, a) || !batch_compare_test<'='>(x, a, a))
+				return false;
+			for(unsigned int j=0; j<sizeof(values)/sizeof(values[0]); ++j)
+				if(!batch_compare_test<'b'>(x, a, b2h(values[j])))
+					return false;
+		}
+		return batch_compare_test<'n'>(x, half(), half()) && batch_compare_test<'<'>(half_vector(x.begin(), x.begin()+77), 
+			half(1.0f), half(1.0f));
+	}
+
+	template<std::float_round_style R,half(*F)(half),void(*B)(const half*,half*,std::size_t),unsigned int(*E)(unsigned int)> 
+	static bool batch_function_test(const half_vector &x)
+	{
+		std::size_t n = x.size();
+		half_vector ref(n), dst(n);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		for(std::size_t i=0; i<n; ++i)
+			ref[i] = F(x[i]);
+		int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		B(x.data(), dst.data(), n);
+		if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags || std::memcmp(dst.data(), ref.data(), n*sizeof(half)))
+			return false;
+		for(std::size_t i=0; i<n; ++i)
+			if(E(h2b(x[i])) != h2b(ref[i]))
+				return false;
+		B(dst.data()+3, dst.data()+3, 77);
+		for(std::size_t i=3; i<80 && i<n; ++i)
+			if(h2b(dst[i]) != E(h2b(ref[i])))
+				return false;
+		return true;
+	}
+
+	template<std::float_round_style R,void(*B)(const half*,half*,std::size_t),typename F> 
+	static bool batch_reference_test(const half_vector &x, F reference)
+	{
+		half_vector y(x.size());
+		B(x.data(), y.data(), x.size());
+		for(std::size_t i=0; i<x.size(); ++i)
+		{
+		#if HALF_FLUSH_DENORMALS
+			half ref = flushed(half_cast<half,R>(static_cast<double>(reference(half_cast<long double>(flushed(x[i]))))));
+		#else
+			half ref = half_cast<half,R>(static_cast<double>(reference(half_cast<long double>(x[i]))));
+		#endif
+			if(h2b(y[i]) != h2b(ref))
+				return false;
+		}
+		return true;
+	}
+
+	template<typename F,typename G> static bool fixed_test(const half_vector &x, F value, G reference, double floor)
+	{
+		for(std::size_t i=0; i<x.size(); ++i)
+		{
+			half_float::detail::f63 f = value(h2b(x[i]));
+			double y = std::ldexp(static_cast<double>(f.hi)*4294967296.0+static_cast<double>(f.lo), f.exp-63) * (f.sign ? -1.0 : 1.0), tol = std::ldexp(std::max(std::abs(y), floor), -38);
+			if(std::abs(y-reference(half_cast<long double>(x[i]))) > tol/8 || !band_test<std::round_to_nearest>(y, tol) || 
+				!band_test<std::round_toward_zero>(y, tol) || !band_test<std::round_toward_infinity>(y, tol) || 
+				!band_test<std::round_toward_neg_infinity>(y, tol))
+				return false;
+		}
+		return true;
+	}
+
+	template<std::float_round_style R> static bool band_test(double x, double tol)
+	{
+		return h2b(half_cast<half,R>(x-tol)) == h2b(half_cast<half,R>(x)) && h2b(half_cast<half,R>(x+tol)) == h2b(half_cast<half,R>(x));
+	}
+
+	static bool unary_table_test(const half_vector &x)
+	{
+		auto fn = [](half arg) { return fma(arg, arg, half(-0.5f)) / (abs(arg)+half(1.0f)); };
+		half_float::unary_table table(fn), identity, parallel(half_float::parallel_policy(4), fn);
+		half_float::unary_table rounded([](half arg) { return std::exp(static_cast<float>(arg)); });
+		half_vector y(x.size()), z(x.size());
+		table(x.data(), y.data(), x.size());
+		parallel(x.data()+5, z.data()+5, x.size()-5);
+		for(std::size_t i=0; i<x.size(); ++i)
+			if(!comp(y[i], fn(x[i])) || !comp(table(x[i]), y[i]) || h2b(table.data()[h2b(x[i])]) != h2b(y[i]) || 
+				(i >= 5 && h2b(z[i]) != h2b(y[i])) || h2b(identity(x[i])) != h2b(x[i]) || 
+				h2b(rounded(x[i])) != h2b(half(std::exp(static_cast<float>(x[i])))))
+				return false;
+		identity(y.data()+3, y.data()+3, 99);
+		rounded(z.data()+5, z.data()+5, 61);
+		for(std::size_t i=5; i<66; ++i)
+			if(h2b(z[i]) != h2b(rounded(y[i])))
+				return false;
+		std::stringstream stream;
+		if(!table.write(stream) || stream.str().size() != 0x20000 || !identity.read(stream) || 
+			std::memcmp(identity.data(), table.data(), 0x20000))
+			return false;
+		std::istringstream truncated(stream.str().substr(0, 0x1FFFF));
+		return !rounded.read(truncated) && h2b(rounded(half(1.0f))) == 0x4170 && 
+			static_cast<unsigned char>(stream.str()[2*0x3C00]) == (h2b(fn(half(1.0f)))&0xFF);
+	}
+
+	static void batch_fma(const half *x, const half *y, const half *z, half *dst, std::size_t n, unsigned int broadcast)
+	{
+		if(broadcast == 1)
+		{
+			if(z != dst)
+				std::copy(z, z+n, dst);
+			half_float::axpy(*x, y, dst, n);
+		}
+		else if(broadcast == 6)
+			half_float::scale_add(x, *y, *z, dst, n);
+		else
+			half_float::fma_n(x, y, z, dst, n);
+	}
+
+	static bool batch_fma_test(const half_vector &x, const half_vector &y, const half_vector &z, unsigned int broadcast)
+	{
+		half_vector dst(x.size()), ref(x.size());
+		for(std::size_t i=0; i<x.size(); ++i)
+			ref[i] = fma(x[(broadcast&1) ? 0 : i], y[(broadcast&2) ? 0 : i], z[(broadcast&4) ? 0 : i]);
+		batch_fma(x.data(), y.data(), z.data(), dst.data(), x.size(), broadcast);
+		if(std::memcmp(dst.data(), ref.data(), x.size()*sizeof(half)))
+			return false;
+		if(!broadcast)
+		{
+			dst = z;
+			batch_fma(x.data(), y.data(), dst.data(), dst.data(), x.size(), broadcast);
+			if(std::memcmp(dst.data(), ref.data(), x.size()*sizeof(half)))
+				return false;
+		}
+	#if HALF_ERRHANDLING_FLAGS
+		for(std::size_t i=0, n=1; i<x.size(); i+=n, n=n%40+1)
+		{
+			n = std::min(n, x.size()-i);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			batch_fma(&x[(broadcast&1) ? 0 : i], &y[(broadcast&2) ? 0 : i], &z[(broadcast&4) ? 0 : i], &dst[i], n, broadcast);
+			int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			for(std::size_t j=i; j<i+n; ++j)
+				fma(x[(broadcast&1) ? 0 : j], y[(broadcast&2) ? 0 : j], z[(broadcast&4) ? 0 : j]);
+			if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+				return false;
+		}
+	#endif
+		return true;
+	}
+
+	template<std::float_round_style R> static bool batch_fma_test(const half_vector &x, const half_vector &y, const half_vector &z)
+	{
+		std::vector<std::uint16_t> dst(x.size());
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		half_float::detail::fma_n<R,0>(reinterpret_cast<const std::uint16_t*>(x.data()), reinterpret_cast<const std::uint16_t*>(y.data()), 
+			reinterpret_cast<const std::uint16_t*>(z.data()), dst.data(), x.size());
+		int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		for(std::size_t i=0; i<x.size(); ++i)
+			if(dst[i] != half_float::detail::fma<R>(h2b(x[i]), h2b(y[i]), h2b(z[i])))
+				return false;
+		return half_float::fetestexcept(FE_ALL_EXCEPT) == flags;
+	}
+
+	static bool batch_fma_test(const half_vector &halfs, unsigned int broadcast = 0)
+	{
+		static const std::uint16_t values[] = { 0x0000, 0x8000, 0x0001, 0x83FF, 0x3C00, 0xBE00, 0x7BFF, 0x1400, 0x7C00, 0xFC00, 0x7E00, 0x7D00 };
+		half_vector x(halfs), y(halfs.size()), z(halfs.size());
+		for(std::size_t i=0; i<y.size(); ++i)
+		{
+			y[i] = halfs[i*40503%halfs.size()];
+			z[i] = (i&3) ? halfs[i*20071%halfs.size()] : b2h(h2b(static_cast<half>(-static_cast<double>(x[i])*static_cast<double>(y[i]))) + (i>>2)%3 - 1);
+		}
+		if(!broadcast)
+			return batch_fma_test(x, y, z, 0) && batch_fma_test(z, x, y, 0) && batch_fma_test<std::round_toward_zero>(x, y, z) && 
+				batch_fma_test<std::round_toward_infinity>(x, y, z) && batch_fma_test<std::round_toward_neg_infinity>(x, y, z);
+		for(unsigned int i=0; i<sizeof(values)/sizeof(values[0]); ++i)
+		{
+			half a = b2h(values[i]), b = b2h(values[(i*5+3)%(sizeof(values)/sizeof(values[0]))]);
+			if(broadcast == 1)
+				std::fill(x.begin(), x.end(), a);
+			else
+			{
+				std::fill(y.begin(), y.end(), a);
+				std::fill(z.begin(), z.end(), b);
+			}
+			if(!batch_fma_test(x, y, z, broadcast))
+				return false;
+			if(broadcast == 6)
+			{
+				std::fill(z.begin(), z.end(), a);
+				if(!batch_fma_test(x, y, z, broadcast))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	template<std::size_t N,typename P,typename S> static bool packed_test(const half_vector &x, const half_vector &y, 
+		const half_vector &z, P packed, S scalar)
+	{
+		typedef half_float::packed_half<N> packed_type;
+		half dst[N], ref[N];
+		for(std::size_t i=0; i+N<=x.size(); i+=N)
+		{
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			packed(packed_type::load(&x[i]), packed_type::load(&y[i]), packed_type::load(&z[i])).store(dst);
+			int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			for(std::size_t j=0; j<N; ++j)
+				ref[j] = scalar(x[i+j], y[i+j], z[i+j]);
+			if(std::memcmp(dst, ref, sizeof(dst)) || half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+				return false;
+		}
+		return true;
+	}
+
+	template<std::size_t N,typename P,typename S> static bool packed_reduce_test(const half_vector &x, P packed, S scalar)
+	{
+		half values[N];
+		for(std::size_t i=0; i+N<=x.size(); i+=N)
+		{
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			half result = packed(half_float::packed_half<N>::load(&x[i]));
+			int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			std::copy(&x[i], &x[i]+N, values);
+			for(std::size_t n=N/2; n; n/=2)
+				for(std::size_t j=0; j<n; ++j)
+					values[j] = scalar(values[j], values[j+n]);
+			if(h2b(result) != h2b(values[0]) || half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+				return false;
+		}
+		return true;
+	}
+
+	template<std::size_t N> static bool packed_test(const half_vector &halfs)
+	{
+		typedef half_float::packed_half<N> P;
+		half_vector x(halfs), y(halfs.size()), z(halfs.size()), small(halfs.size());
+		for(std::size_t i=0; i<y.size(); ++i)
+		{
+			y[i] = halfs[i*40503%halfs.size()];
+			z[i] = (i&3) ? halfs[i*20071%halfs.size()] : b2h(h2b(static_cast<half>(-static_cast<double>(x[i])*static_cast<double>(y[i]))) + (i>>2)%3 - 1);
+			small[i] = b2h(h2b(halfs[i*7%halfs.size()])&0x87FF);
+		}
+		if(!packed_test<N>(x, y, z, [](P a, P b, P) { return a + b; }, [](half a, half b, half) { return a + b; }) || 
+			!packed_test<N>(x, y, z, [](P a, P b, P) { return a - b; }, [](half a, half b, half) { return a - b; }) || 
+			!packed_test<N>(x, y, z, [](P a, P b, P) { return a * b; }, [](half a, half b, half) { return a * b; }) || 
+			!packed_test<N>(x, y, z, [](P a, P b, P) { return a / b; }, [](half a, half b, half) { return a / b; }) || 
+			!packed_test<N>(y, x, z, [](P a, P b, P) { return a / b; }, [](half a, half b, half) { return a / b; }) || 
+			!packed_test<N>(x, y, z, [](P a, P b, P) { a -= b; a *= b; a += b; return a /= b; }, 
+				[](half a, half b, half) { return (((a-b)*b)+b)/b; }) || 
+			!packed_test<N>(x, y, z, [](P a, P b, P c) { return fma(a, b, c); }, [](half a, half b, half c) { return fma(a, b, c); }) || 
+			!packed_test<N>(x, y, z, [](P a, P, P) { return sqrt(a); }, [](half a, half, half) { return sqrt(a); }) || 
+			!packed_test<N>(x, y, z, [](P a, P b, P) { return fmin(a, b); }, [](half a, half b, half) { return fmin(a, b); }) || 
+			!packed_test<N>(x, y, z, [](P a, P b, P) { return fmax(a, b); }, [](half a, half b, half) { return fmax(a, b); }) || 
+			!packed_test<N>(x, y, z, [](P a, P, P) { return -fabs(+a); }, [](half a, half, half) { return -fabs(a); }))
+			return false;
+		for(std::size_t i=0; i+N<=x.size(); i+=N)
+		{
+			static const char ops[] = { '=', '!', '<', '>', 'l', 'g' };
+			P a = P::load(&x[i]), b = P::load(&y[i]);
+			for(unsigned int o=0; o<6; ++o)
+			{
+				half_float::feclearexcept(FE_ALL_EXCEPT);
+				unsigned long mask = (o==0) ? (a==b) : (o==1) ? (a!=b) : (o==2) ? (a<b) : (o==3) ? (a>b) : (o==4) ? (a<=b) : (a>=b), ref = 0;
+				int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+				half_float::feclearexcept(FE_ALL_EXCEPT);
+				for(std::size_t j=0; j<N; ++j)
+				{
+					half c = x[i+j], d = y[i+j];
+					ref |= static_cast<unsigned long>((ops[o]=='=') ? (c==d) : (ops[o]=='!') ? (c!=d) : (ops[o]=='<') ? (c<d) : 
+						(ops[o]=='>') ? (c>d) : (ops[o]=='l') ? (c<=d) : (c>=d)) << j;
+				}
+				if(mask != ref || half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+					return false;
+			}
+			for(std::size_t j=0; j<N; ++j)
+				if(h2b(a[j]) != h2b(x[i+j]) || h2b(P(x[i+j])[N-1-j%N]) != h2b(x[i+j]))
+					return false;
+		}
+		if(h2b(P()[N/2]) != 0 || !packed_reduce_test<N>(x, [](P a) { return reduce(a); }, [](half a, half b) { return a + b; }) || 
+			!packed_reduce_test<N>(small, [](P a) { return reduce(a); }, [](half a, half b) { return a + b; }) || 
+			!packed_reduce_test<N>(y, [](P a) { return hmin(a); }, [](half a, half b) { return fmin(a, b); }) || 
+			!packed_reduce_test<N>(y, [](P a) { return hmax(a); }, [](half a, half b) { return fmax(a, b); }))
+			return false;
+		std::vector<float> floats(x.size()), dst(x.size());
+		for(std::size_t i=0; i<floats.size(); ++i)
+			floats[i] = std::ldexp(static_cast<float>(i*2654435761u%16777216), static_cast<int>(i%48)-56) * ((i&1) ? -1.0f : 1.0f);
+		for(std::size_t i=0; i+N<=x.size(); i+=N)
+		{
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			P a = P::load(&floats[i]);
+			int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			for(std::size_t j=0; j<N; ++j)
+				if(h2b(a[j]) != h2b(half_cast<half>(floats[i+j])))
+					return false;
+			if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+				return false;
+			P::load(&x[i]).store(&dst[i]);
+			for(std::size_t j=i; j<i+N; ++j)
+				if(std::memcmp(&dst[j], &(floats[j] = static_cast<float>(x[j])), sizeof(float)))
+					return false;
+		}
+		return true;
+	}
+
+	template<typename E,typename F> static bool expression_test(half_vector &dst, const half_float::half_expr<E> &expr, F scalar)
+	{
+		half_vector ref(dst);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		for(std::size_t i=0; i<ref.size(); ++i)
+			ref[i] = scalar(i);
+		int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		half_float::half_span(dst.data(), dst.size()) = expr;
+		return !std::memcmp(dst.data(), ref.data(), dst.size()*sizeof(half)) && half_float::fetestexcept(FE_ALL_EXCEPT) == flags;
+	}
+
+	template<std::float_round_style R> static bool rounding_test(half x, half y)
+	{
+		double a = static_cast<double>(x), b = static_cast<double>(y);
+		return comp(half_float::add<R>(x, y), half_cast<half,R>(a+b)) && comp(half_float::sub<R>(x, y), half_cast<half,R>(a-b)) && 
+			comp(half_float::mul<R>(x, y), half_cast<half,R>(a*b)) && comp(half_float::div<R>(x, y), half_cast<half,R>(a/b)) && 
+			comp(half_float::fma<R>(x, y, x), half_cast<half,R>(a*b+a)) && comp(half_float::sqrt<R>(x), half_cast<half,R>(std::sqrt(a)));
+	}
+
+	static bool bracket_test(half def, half nearest, half zero, half up, half down)
+	{
+		if(isnan(def))
+			return isnan(nearest) && isnan(zero) && isnan(up) && isnan(down);
+		return comp(def, nearest) && down <= up && adjacent(down, up) && (nearest == down || nearest == up) && 
+			zero == ((down>=half(0.0f)) ? down : up);
+	}
+
+	//identical to the CORDIC results for all arguments and rounding modes
+	template<std::float_round_style R> static bool cordic_test(half arg)
+	{
+		half s, c;
+		half_float::sincos<R>(arg, &s, &c);
+		std::pair<unsigned int,unsigned int> sc = cordic::sincos<R>(arg);
+		return cordic_equal(cordic::sin<R>(arg), half_float::sin<R>(arg)) && cordic_equal(cordic::cos<R>(arg), half_float::cos<R>(arg)) && 
+			cordic_equal(cordic::tan<R>(arg), half_float::tan<R>(arg)) && cordic_equal(sc.first, s) && cordic_equal(sc.second, c) && 
+			cordic_equal(cordic::asin<R>(arg), half_float::asin<R>(arg)) && cordic_equal(cordic::acos<R>(arg), half_float::acos<R>(arg)) && 
+			cordic_equal(cordic::atan<R>(arg), half_float::atan<R>(arg));
+	}
+
+	//identical to the CORDIC result or correctly rounded where that was not
+	template<std::float_round_style R> static bool cordic_atan2_test(half y, half x)
+	{
+		half h = half_float::atan2<R>(y, x);
+		return cordic_equal(cordic::atan2<R>(y, x), h) || 
+			comp(h, half_cast<half,R>(std::atan2(static_cast<long double>(y), static_cast<long double>(x))));
+	}
+
+	static bool cordic_equal(unsigned int ref, half h)
+	{
+		return ref == 0xFFFF || comp(b2h(ref), h);
+	}
+
+	static bool adjacent(half down, half up)
+	{
+	#if HALF_FLUSH_DENORMALS
+		return next_flushed(down, up) == up;
+	#else
+		return nextafter(down, up) == up;
+	#endif
+	}
+
+	static bool expression_test(const half_vector &halfs)
+	{
+		std::size_t n = halfs.size() - 5;
+		half_vector x(halfs.begin(), halfs.begin()+n), y(n), z(n), w(n), dst(n);
+		for(std::size_t i=0; i<n; ++i)
+		{
+			y[i] = halfs[i*40503%halfs.size()];
+			z[i] = halfs[i*20071%halfs.size()];
+			w[i] = halfs[i*7%halfs.size()];
+		}
+		half_float::const_half_span a(x.data(), n), b(y.data(), n), c(z.data(), n);
+		half_float::half_span d(w.data(), n), out(dst.data(), n);
+		half h(1.5f);
+		if(!expression_test(dst, a*b + c*d - a, [&](std::size_t i) { return x[i]*y[i] + z[i]*w[i] - x[i]; }) || 
+			!expression_test(dst, (a-h) / (h+b), [&](std::size_t i) { return (x[i]-h) / (h+y[i]); }) || 
+			!expression_test(dst, h*a - b*h + c/h - h/d, [&](std::size_t i) { return h*x[i] - y[i]*h + z[i]/h - h/w[i]; }) || 
+			!expression_test(dst, fma(a, b, -sqrt(fabs(c))), [&](std::size_t i) { return fma(x[i], y[i], -sqrt(fabs(z[i]))); }) || 
+			!expression_test(dst, fmax(fmin(a, b), c), [&](std::size_t i) { return fmax(fmin(x[i], y[i]), z[i]); }) || 
+			!expression_test(w, d*d + a, [&](std::size_t i) { return w[i]*w[i] + x[i]; }))
+			return false;
+		half_vector ref(w);
+		for(std::size_t i=0; i<n; ++i)
+			ref[i] = (((w[i]+x[i])-y[i])*z[i]/h + h) * h;
+		d += a; d -= b; d *= c; d /= h; d += h; d *= h;
+		if(std::memcmp(w.data(), ref.data(), n*sizeof(half)))
+			return false;
+		out = d;
+		if(std::memcmp(dst.data(), w.data(), n*sizeof(half)))
+			return false;
+		out = h;
+		return std::count_if(dst.begin(), dst.end(), [h](half v) { return h2b(v) == h2b(h); }) == static_cast<std::ptrdiff_t>(n);
+	}
+
+	static bool interval_encloses(half_interval r, double value)
+	{
+		return std::isnan(value) || (static_cast<double>(r.lower()) <= value && value <= static_cast<double>(r.upper()));
+	}
+
+	static bool interval_test(half_interval x, half_interval y)
+	{
+		half_interval r[] = { x + y, x - y, x * y, x / y };
+		bool infinite = isinf(x.lower()) || isinf(x.upper()) || isinf(y.lower()) || isinf(y.upper());
+		for(unsigned int i=0; i<4; ++i)
+		{
+			double u = static_cast<double>((i&1) ? x.upper() : x.lower()), v = static_cast<double>((i&2) ? y.upper() : y.lower());
+			double exact[] = { u + v, u - v, u * v, u / v };
+			for(unsigned int j=0; j<4; ++j)
+				if(!(infinite && (isnan(r[j].lower()) || isnan(r[j].upper()))) && 
+					(!interval_encloses(r[j], exact[j]) || r[j].lower() > r[j].upper()))
+					return false;
+		}
+		return true;
+	}
+
+	template<char O> static bool interval_test(const std::vector<half_interval> &x, const std::vector<half_interval> &y)
+	{
+		std::vector<half_interval> dst(x.size()), ref(x.size());
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		for(std::size_t i=0; i<x.size(); ++i)
+			ref[i] = (O=='+') ? x[i]+y[i] : (O=='-') ? x[i]-y[i] : (O=='*') ? x[i]*y[i] : x[i]/y[i];
+		int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		(O=='+') ? half_float::add(x.data(), y.data(), dst.data(), x.size()) : (O=='-') ? half_float::sub(x.data(), y.data(), dst.data(), x.size()) : 
+			(O=='*') ? half_float::mul(x.data(), y.data(), dst.data(), x.size()) : half_float::div(x.data(), y.data(), dst.data(), x.size());
+		if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags || std::memcmp(dst.data(), ref.data(), x.size()*sizeof(half_interval)))
+			return false;
+		dst = x;
+		(O=='+') ? half_float::add(dst.data(), y.data(), dst.data(), x.size()) : (O=='-') ? half_float::sub(dst.data(), y.data(), dst.data(), x.size()) : 
+			(O=='*') ? half_float::mul(dst.data(), y.data(), dst.data(), x.size()) : half_float::div(dst.data(), y.data(), dst.data(), x.size());
+		return !std::memcmp(dst.data(), ref.data(), x.size()*sizeof(half_interval));
+	}
+
+	static bool interval_test(const half_vector &halfs)
+	{
+		std::vector<half_interval> x(halfs.size()), y(halfs.size());
+		std::vector<float> floats(halfs.size());
+		std::vector<double> doubles(halfs.size());
+		for(std::size_t i=0; i<halfs.size(); ++i)
+		{
+			half a = halfs[i], b = halfs[i*40503%halfs.size()], c = halfs[i*20071%halfs.size()];
+			x[i] = half_interval(fmin(a, b), fmax(a, b));
+			y[i] = (i%3) ? half_interval(fmin(b, c), fmax(b, c)) : half_interval(c);
+			floats[i] = static_cast<float>(a) * 1.001f;
+			doubles[i] = static_cast<double>(b) / 3.0;
+		}
+		if(!interval_test<'+'>(x, y) || !interval_test<'-'>(x, y) || !interval_test<'*'>(x, y) || !interval_test<'/'>(x, y))
+			return false;
+		half_float::convert(floats.data(), x.data(), x.size());
+		half_float::convert(doubles.data(), y.data(), y.size());
+		for(std::size_t i=0; i<halfs.size(); ++i)
+		{
+			half_interval f(floats[i]), d(doubles[i]);
+			if(std::memcmp(&x[i], &f, sizeof(f)) || std::memcmp(&y[i], &d, sizeof(d)))
+				return false;
+		}
+		return true;
+	}
+
+	template<std::float_round_style R,typename T,typename U> static bool batch_test(const std::vector<U> &src)
+	{
+		std::vector<T> dst(src.size());
+		half_float::convert<R>(src.data(), dst.data(), src.size());
+		for(std::size_t i=0; i<src.size(); ++i)
+		{
+			T value = half_cast<T,R>(src[i]);
+			if(std::memcmp(&value, &dst[i], sizeof(T)))
+				return false;
+		}
+	#if HALF_ERRHANDLING_FLAGS
+		for(std::size_t i=0, n=1; i<src.size(); i+=n, n=n%40+1)
+		{
+			n = std::min(n, src.size()-i);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			half_float::convert<R>(&src[i], &dst[i], n);
+			int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			for(std::size_t j=i; j<i+n; ++j)
+				half_cast<T,R>(src[j]);
+			if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+				return false;
+		}
+	#endif
+		return true;
+	}
+
+	template<typename T,typename U> static bool batch_stream_test(const std::vector<U> &src)
+	{
+		std::vector<T> dst(src.size()+8);
+		for(std::size_t offset=0; offset<8; offset+=3)
+		{
+			half_float::convert(src.data(), dst.data()+offset, src.size());
+			for(std::size_t i=0; i<src.size(); ++i)
+			{
+				T value = half_cast<T>(src[i]);
+				if(std::memcmp(&value, &dst[offset+i], sizeof(T)) && !(value != value && dst[offset+i] != dst[offset+i]))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename T,typename U> static bool batch_parallel_test(const std::vector<U> &src)
+	{
+		std::vector<T> dst(src.size()), ref(src.size());
+		half_float::feclearexcept(FE_ALL_EXCEPT);
+		half_float::convert(src.data(), ref.data(), src.size());
+		int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+		for(unsigned int threads=2; threads<=5; threads+=3)
+		{
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			half_float::convert(half_float::parallel_policy(threads), src.data(), dst.data(), src.size());
+			if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags || std::memcmp(dst.data(), ref.data(), src.size()*sizeof(T)))
+				return false;
+		}
+		return true;
+	}
+
+	template<char C> static bool approximate_test(double (*fn)(double), double bound)
+	{
+		typedef void (*kernel)(half_float::detail::approx_block&);
+		static const kernel kernels[4] = { &half_float::detail::approximate_scalar<C>,
+		#if HALF_SIMD_SSE2
+			&half_float::detail::approximate_sse2<C>,
+		#else
+			0,
+		#endif
+		#if HALF_SIMD_AVX2
+			&half_float::detail::approximate_avx2<C>,
+		#else
+			0,
+		#endif
+		#if HALF_SIMD_AVX512
+			&half_float::detail::approximate_avx512<C> };
+		#else
+			0 };
+		#endif
+		half_float::detail::approx_block block;
+		bound = std::pow(2.0, bound);
+		for(unsigned int i=0; i<0x10000; i+=256)
+		{
+			for(unsigned int j=0; j<256; ++j)
+				block.x[j] = half_cast<float>(b2h(i+j));
+			half_float::detail::simd_kernel(kernels)(block);
+			for(unsigned int j=0; j<256; ++j)
+			{
+				double x = block.x[j], y = fn(x), a = std::abs(y), lo = block.lo[j], hi = block.hi[j];
+				if(std::isfinite(x) && x != 0.0 && a >= std::ldexp(1.0, -26) && a < 65520.0 && 
+					std::abs(0.5*(lo+hi)-y) > bound*a+std::ldexp((std::max)(std::abs(lo), std::abs(hi)), -24))
+					return false;
+			}
+		}
+		return true;
+	}
+
+	template<unsigned int P> static std::uint16_t policy(half h)
+	{
+		if(isnan(h))
+			return (P&half_float::policy_scrub_nan) ? 0 : h2b(h);
+		if(isinf(h))
+			return (P&half_float::policy_saturate) ? (h2b(h)-1) : h2b(h);
+		if((P&half_float::policy_flush_subnormals) && !isnormal(h))
+			return h2b(h) & 0x8000;
+		return h2b(h);
+	}
+
+	template<std::float_round_style R,unsigned int P,typename U> static bool batch_policy_test(const std::vector<U> &src)
+	{
+		half_vector dst(src.size());
+		half_float::convert<R,P>(src.data(), dst.data(), src.size());
+		for(std::size_t i=0; i<src.size(); ++i)
+		{
+			half value = half_cast<half,R,P>(src[i]);
+			if(h2b(value) != h2b(dst[i]) || h2b(value) != policy<P>(half_cast<half,R>(src[i])))
+				return false;
+		}
+	#if HALF_ERRHANDLING_FLAGS
+		for(std::size_t i=0, n=1; i<src.size(); i+=n, n=n%40+1)
+		{
+			n = std::min(n, src.size()-i);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			half_float::convert<R,P>(&src[i], &dst[i], n);
+			int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			for(std::size_t j=i; j<i+n; ++j)
+				half_cast<half,R>(src[j]);
+			if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+				return false;
+		}
+	#endif
+		return true;
+	}
+
+	static bool batch_stochastic_test(const std::vector<float> &src)
+	{
+		half_vector dst(src.size());
+		half_float::stochastic_generator gen(42), ref(42);
+		for(std::size_t i=0, n=1; i<src.size(); i+=n, n=n%40+1)
+		{
+			n = std::min(n, src.size()-i);
+		#if HALF_ERRHANDLING_FLAGS
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			half_float::convert(&src[i], &dst[i], n, gen);
+			int flags = half_float::fetestexcept(FE_ALL_EXCEPT);
+			half_float::feclearexcept(FE_ALL_EXCEPT);
+			for(std::size_t j=i; j<i+n; ++j)
+				if(h2b(half_cast<half>(src[j], ref)) != h2b(dst[j]))
+					return false;
+			if(half_float::fetestexcept(FE_ALL_EXCEPT) != flags)
+				return false;
+		#else
+			half_float::convert(&src[i], &dst[i], n, gen);
+			for(std::size_t j=i; j<i+n; ++j)
+				if(h2b(half_cast<half>(src[j], ref)) != h2b(dst[j]))
+					return false;
+		#endif
+		}
+		for(std::size_t i=0; i<src.size(); ++i)
+		{
+			half trunc = half_cast<half,std::round_toward_zero>(src[i]);
+			if(h2b(dst[i]) != h2b(trunc) && (h2b(dst[i]) != h2b(trunc)+1 || half_cast<float>(trunc) == src[i]))
+				return false;
+		}
+		half_float::convert(src.data(), dst.data(), src.size(), gen);
+		for(std::size_t i=0; i<src.size(); ++i)
+			if(h2b(half_cast<half>(src[i], ref)) != h2b(dst[i]))
+				return false;
+		return true;
+	}
+
+	template<typename T> static bool batch_int_test(const half_vector &halfs)
+	{
+		std::vector<T> ints;
+		if(std::numeric_limits<T>::digits <= 16)
+			for(long i=std::numeric_limits<T>::min(); i<=static_cast<long>(std::numeric_limits<T>::max()); ++i)
+				ints.push_back(static_cast<T>(i));
+		else
+		{
+			auto rand = std::bind(std::uniform_int_distribution<long long>(std::numeric_limits<T>::min(), std::numeric_limits<T>::max()), std::default_random_engine());
+			for(long i=-70000; i<=70000; ++i)
+				ints.push_back(static_cast<T>(i));
+			for(unsigned int i=0; i<100000; ++i)
+				ints.push_back(static_cast<T>(rand()));
+			ints.push_back(std::numeric_limits<T>::min());
+			ints.push_back(std::numeric_limits<T>::max());
+		}
+		return batch_test<std::round_to_nearest,half>(ints) && batch_test<std::round_toward_zero,half>(ints) && 
+			batch_test<std::round_toward_infinity,half>(ints) && batch_test<std::round_toward_neg_infinity,half>(ints) && 
+			batch_test<std::round_to_nearest,T>(halfs) && 
+			batch_test<std::round_toward_zero,T>(halfs) && batch_test<std::round_toward_infinity,T>(halfs) && 
+			batch_test<std::round_toward_neg_infinity,T>(halfs) && batch_test<std::round_indeterminate,T>(halfs);
+	}
+
 	template<typename F> bool class_test(const std::string &name, F test)
 	{
 		unsigned int count = 0;
@@ -508,9 +1963,17 @@ private:
 		for(auto iterB=halfs_.begin(); iterB!=halfs_.end(); ++iterB)
 		{
 			unsigned int passed = 0;
+			log_ << "    " << iterB->first << ": ";
+		#if HALF_FLUSH_DENORMALS
+			if(skipped(name, iterB->first))
+			{
+				log_ << "skipped\n";
+				++count;
+				continue;
+			}
+		#endif
 			for(auto iterH=iterB->second.begin(); iterH!=iterB->second.end(); ++iterH)
 				passed += test(*iterH);
-			log_ << "    " << iterB->first << ": ";
 			if(passed == iterB->second.size())
 			{
 				log_ << "all passed\n";
@@ -536,6 +1999,10 @@ private:
 		{
 			for(auto iterB2=halfs_.begin(); iterB2!=halfs_.end(); ++iterB2)
 			{
+			#if HALF_FLUSH_DENORMALS
+				if(skipped(name, iterB1->first) || skipped(name, iterB2->first))
+					continue;
+			#endif
 				unsigned int end1 = (iterB1->first.find("NaN")==std::string::npos) ? iterB1->second.size() : 1;
 				unsigned int end2 = (iterB2->first.find("NaN")==std::string::npos) ? iterB2->second.size() : 1;
 				for(unsigned int i=fast_ ? std::min(rand(), iterB1->second.size()-1) : 0; i<end1; i+=step)
@@ -606,12 +2073,21 @@ private:
 		return passed;
 	}
 
+#if HALF_FLUSH_DENORMALS
+	//subnormal arguments are only tested by the flush tests, since the others compare with unflushed references.
+	bool skipped(const std::string &name, const std::string &category)
+	{
+		return classes_[category] == FP_SUBNORMAL && name.compare(0, 16, "flush denormals ") != 0;
+	}
+#endif
+
 	test_map halfs_;
 	class_map classes_;
 	unsigned int tests_;
 	std::vector<std::string> failed_;
 	std::ostream &log_;
 	bool fast_;
+	std::set<std::string> known_;
 };
 
 #include <chrono>
@@ -624,6 +2100,156 @@ private:
 	std::chrono::time_point<std::chrono::high_resolution_clock> start_;
 };
 
+template<typename F> double throughput(std::size_t bytes, F fn)
+{
+	double best = 0.0;
+	for(int i=0; i<5; ++i)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		fn();
+		best = std::max(best, bytes/std::chrono::duration<double,std::nano>(std::chrono::high_resolution_clock::now()-start).count());
+	}
+	return best;
+}
+
+template<typename F> double latency(std::size_t count, F fn)
+{
+	double best = std::numeric_limits<double>::max();
+	for(int i=0; i<5; ++i)
+	{
+		auto start = std::chrono::high_resolution_clock::now();
+		fn();
+		best = std::min(best, std::chrono::duration<double,std::nano>(std::chrono::high_resolution_clock::now()-start).count()/count);
+	}
+	return best;
+}
+
+int benchmark(std::ostream &out)
+{
+	static const char *const names[] = { "scalar", "sse2", "avx2", "avx512" };
+	const std::size_t n = std::size_t(1) << 26;
+	std::vector<float> floats(n), copy(n);
+	std::vector<half> halfs(n);
+	auto rand = std::bind(std::uniform_real_distribution<float>(-65504.0f, 65504.0f), std::default_random_engine());
+	for(std::size_t i=0; i<n; ++i)
+		floats[i] = rand();
+	std::size_t threshold = half_float::get_streaming_threshold();
+	out << "streaming threshold: " << (threshold>>10) << " KiB\n" << std::fixed << std::setprecision(2) << std::setfill(' ') << std::left;
+	out << std::setw(36) << "memcpy:" << throughput(2*n*sizeof(float), [&]() { std::memcpy(copy.data(), floats.data(), n*sizeof(float)); }) << " GB/s\n";
+	for(int level=half_float::supported_simd_level(); level>=half_float::simd_scalar; --level)
+	{
+		half_float::set_simd_level(static_cast<half_float::simd_level>(level));
+		for(int stream=1; stream>=0; --stream)
+		{
+			half_float::set_streaming_threshold(stream ? 0 : std::numeric_limits<std::size_t>::max());
+			std::string name = std::string(names[level]) + (stream ? " streaming" : "");
+			out << std::setw(36) << (name+" float->half:") << throughput(n*(sizeof(float)+sizeof(half)), [&]() { 
+				half_float::convert(floats.data(), halfs.data(), n); }) << " GB/s\n";
+			out << std::setw(36) << (name+" half->float:") << throughput(n*(sizeof(float)+sizeof(half)), [&]() { 
+				half_float::convert(halfs.data(), copy.data(), n); }) << " GB/s\n";
+		}
+	}
+	half_float::set_streaming_threshold(threshold);
+	std::vector<half> other(halfs.rbegin(), halfs.rend()), result(n);
+	out << std::setw(36) << "operator+:" << throughput(3*n*sizeof(half), [&]() { 
+		for(std::size_t i=0; i<n; ++i) result[i] = halfs[i] + other[i]; }) << " GB/s\n";
+	out << std::setw(36) << "operator*:" << throughput(3*n*sizeof(half), [&]() { 
+		for(std::size_t i=0; i<n; ++i) result[i] = halfs[i] * other[i]; }) << " GB/s\n";
+	out << std::setw(36) << "operator/:" << throughput(3*n*sizeof(half), [&]() { 
+		for(std::size_t i=0; i<n; ++i) result[i] = halfs[i] / other[i]; }) << " GB/s\n";
+	out << std::setw(36) << "fma:" << throughput(4*n*sizeof(half), [&]() { 
+		for(std::size_t i=0; i<n; ++i) result[i] = fma(halfs[i], other[i], halfs[i]); }) << " GB/s\n";
+	out << std::setw(36) << "half16 fma:" << throughput(4*n*sizeof(half), [&]() { 
+		for(std::size_t i=0; i+16<=n; i+=16) fma(half_float::half16::load(&halfs[i]), half_float::half16::load(&other[i]), 
+			half_float::half16::load(&halfs[i])).store(&result[i]); }) << " GB/s\n";
+	half scale(0.25f);
+	std::vector<unsigned char> mask(n/8);
+	out << std::setw(36) << "operator< bitmask:" << throughput(n*sizeof(half)+n/8, [&]() { 
+		for(std::size_t i=0; i<n; i+=8) { unsigned int bits = 0; for(std::size_t j=0; j<8; ++j) bits |= (halfs[i+j] < scale) << j; 
+		mask[i/8] = static_cast<unsigned char>(bits); } }) << " GB/s\n";
+	out << std::setw(36) << "loop a*s+b*s-a:" << throughput(3*n*sizeof(half), [&]() { 
+		for(std::size_t i=0; i<n; ++i) result[i] = halfs[i]*scale + other[i]*scale - halfs[i]; }) << " GB/s\n";
+	out << std::setw(36) << "half_span a*s+b*s-a:" << throughput(3*n*sizeof(half), [&]() { 
+		half_float::const_half_span a(halfs.data(), n), b(other.data(), n); 
+		half_float::half_span(result.data(), n) = a*scale + b*scale - a; }) << " GB/s\n";
+	std::vector<half> subnormals(n);
+	for(std::size_t i=0; i<n; ++i)
+		subnormals[i] = b2h(static_cast<std::uint16_t>(i&0x83FF));
+	const std::string flush = HALF_FLUSH_DENORMALS ? " (flushed)" : " (unflushed)";
+	out << std::setw(36) << ("operator* subnormal"+flush+":") << throughput(3*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = subnormals[i] * other[i]; }) << " GB/s\n";
+	out << std::setw(36) << ("log2 subnormal"+flush+":") << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = log2(subnormals[i]); }) << " GB/s\n";
+	out << std::setw(36) << "exp:" << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = exp(halfs[i]); }) << " GB/s\n";
+	out << std::setw(36) << "sin:" << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = sin(halfs[i]); }) << " GB/s\n";
+	half chain(0.0f);
+	out << std::setw(36) << "sin latency:" << latency(n/16, [&]() {
+		for(std::size_t i=0; i<n/16; ++i) chain = sin(halfs[i]+chain);
+		result[0] = chain; }) << " ns\n";
+	out << std::setw(36) << "cos latency:" << latency(n/16, [&]() {
+		for(std::size_t i=0; i<n/16; ++i) chain = cos(halfs[i]+chain);
+		result[0] = chain; }) << " ns\n";
+	out << std::setw(36) << "atan latency:" << latency(n/16, [&]() {
+		for(std::size_t i=0; i<n/16; ++i) chain = atan(halfs[i]+chain);
+		result[0] = chain; }) << " ns\n";
+	out << std::setw(36) << "erf:" << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = erf(halfs[i]); }) << " GB/s\n";
+	out << std::setw(36) << "tgamma:" << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = tgamma(halfs[i]); }) << " GB/s\n";
+	std::vector<half> moderate(n);
+	for(std::size_t i=0; i<n; ++i)
+		moderate[i] = ldexp(halfs[i], -12);
+	out << std::setw(36) << "erfc |x|<16:" << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = erfc(moderate[i]); }) << " GB/s\n";
+	out << std::setw(36) << "lgamma |x|<16:" << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = lgamma(moderate[i]); }) << " GB/s\n";
+	out << std::setw(36) << "tgamma |x|<16:" << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = tgamma(moderate[i]); }) << " GB/s\n";
+	auto gelu = [](half x) { return x * (half(1.0f)+erf(x*half(0.70710678f))) * half(0.5f); };
+	out << std::setw(36) << "gelu:" << throughput(2*n*sizeof(half), [&]() {
+		for(std::size_t i=0; i<n; ++i) result[i] = gelu(halfs[i]); }) << " GB/s\n";
+	half_float::unary_table table(half_float::parallel, gelu);
+	std::vector<half_interval> intervals(n/2), reversed(n/2), products(n/2);
+	half_float::convert(floats.data(), intervals.data(), n/2);
+	reversed.assign(intervals.rbegin(), intervals.rend());
+	out << std::setw(36) << "half_interval operator*:" << throughput(3*n/2*sizeof(half_interval), [&]() { 
+		for(std::size_t i=0; i<n/2; ++i) products[i] = intervals[i] * reversed[i]; }) << " GB/s\n";
+	for(int level=half_float::supported_simd_level(); level>=half_float::simd_scalar; --level)
+	{
+		half_float::set_simd_level(static_cast<half_float::simd_level>(level));
+		std::string name = names[level];
+		out << std::setw(36) << (name+" add:") << throughput(3*n*sizeof(half), [&]() { 
+			half_float::add(halfs.data(), other.data(), result.data(), n); }) << " GB/s\n";
+		out << std::setw(36) << (name+" mul:") << throughput(3*n*sizeof(half), [&]() { 
+			half_float::mul(halfs.data(), other.data(), result.data(), n); }) << " GB/s\n";
+		out << std::setw(36) << (name+" div:") << throughput(3*n*sizeof(half), [&]() { 
+			half_float::div(halfs.data(), other.data(), result.data(), n); }) << " GB/s\n";
+		out << std::setw(36) << (name+" fma_n:") << throughput(4*n*sizeof(half), [&]() { 
+			half_float::fma_n(halfs.data(), other.data(), halfs.data(), result.data(), n); }) << " GB/s\n";
+		out << std::setw(36) << (name+" compare_lt:") << throughput(n*sizeof(half)+n/8, [&]() { 
+			half_float::compare_lt(halfs.data(), scale, mask.data(), n); }) << " GB/s\n";
+		out << std::setw(36) << (name+" exp(const half*):") << throughput(2*n*sizeof(half), [&]() { 
+			half_float::exp(halfs.data(), result.data(), n); }) << " GB/s\n";
+		out << std::setw(36) << (name+" sin(const half*):") << throughput(2*n*sizeof(half), [&]() { 
+			half_float::sin(halfs.data(), result.data(), n); }) << " GB/s\n";
+		out << std::setw(36) << (name+" unary_table:") << throughput(2*n*sizeof(half), [&]() { 
+			table(halfs.data(), result.data(), n); }) << " GB/s\n";
+		out << std::setw(36) << (name+" float->half_interval:") << throughput(n/2*(sizeof(float)+sizeof(half_interval)), [&]() { 
+			half_float::convert(floats.data(), intervals.data(), n/2); }) << " GB/s\n";
+		out << std::setw(36) << (name+" half_interval mul:") << throughput(3*n/2*sizeof(half_interval), [&]() { 
+			half_float::mul(intervals.data(), reversed.data(), products.data(), n/2); }) << " GB/s\n";
+	}
+	half_float::set_simd_level(half_float::supported_simd_level());
+	std::string name = "parallel (" + std::to_string(half_float::get_parallel_threads()) + " threads)";
+	out << std::setw(36) << (name+" float->half:") << throughput(n*(sizeof(float)+sizeof(half)), [&]() { 
+		half_float::convert(half_float::parallel, floats.data(), halfs.data(), n); }) << " GB/s\n";
+	out << std::setw(36) << (name+" half->float:") << throughput(n*(sizeof(float)+sizeof(half)), [&]() { 
+		half_float::convert(half_float::parallel, halfs.data(), copy.data(), n); }) << " GB/s\n";
+	return 0;
+}
+
 int main(int argc, char *argv[])
 {
 /*	auto rand_abs = std::bind(std::uniform_int_distribution<std::uint32_t>(0x00000000, 0x7F100000), std::default_random_engine());
@@ -652,16 +2278,25 @@ int main(int argc, char *argv[])
 
 	std::vector<std::string> args(argv, argv+argc);
 	std::unique_ptr<std::ostream> file;
+	std::set<std::string> known;
 	bool fast = false;
 	for(auto iter=std::next(args.begin()); iter!=args.end(); ++iter)
 	{
 		if(*iter == "-fast")
 			fast = true;
+		else if(*iter == "-known" && std::next(iter) != args.end())
+		{
+			std::istringstream names(*++iter);
+			for(std::string name; std::getline(names, name, ','); )
+				known.insert(name);
+		}
+		else if(*iter == "-bench")
+			return benchmark(std::cout);
 		else
 			file.reset(new std::ofstream(*iter));
 	}
-	half_test test(file ? *file : std::cout, fast);
+	half_test test(file ? *file : std::cout, fast, known);
 
 	timer time;
-	return test.test();
+	return static_cast<int>(std::min(test.test(), 255u));
 }